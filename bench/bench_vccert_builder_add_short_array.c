@@ -0,0 +1,124 @@
+/**
+ * \file bench_vccert_builder_add_short_array.c
+ *
+ * Compare adding numeric fields one at a time against the array encoders.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <vccert/builder.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+#define FIELD_COUNT 64
+#define ITERATIONS 200000
+
+static uint16_t fields[FIELD_COUNT];
+static uint64_t u64[FIELD_COUNT];
+static uint32_t u32[FIELD_COUNT];
+
+/**
+ * Return a monotonic timestamp in nanoseconds.
+ */
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * Print one result line and return the elapsed time.
+ */
+static uint64_t report(const char* name, uint64_t start, uint64_t end)
+{
+    uint64_t elapsed = end - start;
+
+    printf("%-28s %8.2f ns/field\n", name,
+        (double)elapsed / ((double)ITERATIONS * FIELD_COUNT));
+
+    return elapsed;
+}
+
+int main(void)
+{
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_builder_context_t builder;
+    uint64_t start, per_field, array;
+    size_t i, j;
+
+    vccrypt_suite_register_velo_v1();
+    malloc_allocator_options_init(&alloc_opts);
+
+    if (0 != vccrypt_suite_options_init(
+                &crypto_suite, &alloc_opts, VCCRYPT_SUITE_VELO_V1)
+     || 0 != vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite)
+     || 0 != vccert_builder_init(&builder_opts, &builder, 16384))
+    {
+        fprintf(stderr, "setup failed.\n");
+        return 1;
+    }
+
+    for (i = 0; i < FIELD_COUNT; ++i)
+    {
+        fields[i] = (uint16_t)(0x0100 + i);
+        u64[i] = 0x0123456789ABCDEFULL * (i + 1);
+        u32[i] = 0x01234567UL * (uint32_t)(i + 1);
+    }
+
+    /* uint64 fields */
+    start = now_ns();
+    for (j = 0; j < ITERATIONS; ++j)
+    {
+        vccert_builder_reset(&builder);
+        for (i = 0; i < FIELD_COUNT; ++i)
+            vccert_builder_add_short_uint64(&builder, fields[i], u64[i]);
+    }
+    per_field = report("uint64 per field", start, now_ns());
+
+    start = now_ns();
+    for (j = 0; j < ITERATIONS; ++j)
+    {
+        vccert_builder_reset(&builder);
+        vccert_builder_add_short_uint64_array(
+            &builder, fields, u64, FIELD_COUNT);
+    }
+    array = report("uint64 array", start, now_ns());
+    printf("%-28s %8.2fx\n\n", "uint64 speedup",
+        (double)per_field / (double)array);
+
+    /* uint32 fields */
+    start = now_ns();
+    for (j = 0; j < ITERATIONS; ++j)
+    {
+        vccert_builder_reset(&builder);
+        for (i = 0; i < FIELD_COUNT; ++i)
+            vccert_builder_add_short_uint32(&builder, fields[i], u32[i]);
+    }
+    per_field = report("uint32 per field", start, now_ns());
+
+    start = now_ns();
+    for (j = 0; j < ITERATIONS; ++j)
+    {
+        vccert_builder_reset(&builder);
+        vccert_builder_add_short_uint32_array(
+            &builder, fields, u32, FIELD_COUNT);
+    }
+    array = report("uint32 array", start, now_ns());
+    printf("%-28s %8.2fx\n", "uint32 speedup",
+        (double)per_field / (double)array);
+
+    dispose((disposable_t*)&builder);
+    dispose((disposable_t*)&builder_opts);
+    dispose((disposable_t*)&crypto_suite);
+    dispose((disposable_t*)&alloc_opts);
+
+    return 0;
+}
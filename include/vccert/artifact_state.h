@@ -0,0 +1,237 @@
+/**
+ * \file artifact_state.h
+ *
+ * \brief The artifact state table tracks the state of each artifact by block
+ * height, and provides an artifact state resolver backed by that table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_ARTIFACT_STATE_HEADER_GUARD
+#define VCCERT_ARTIFACT_STATE_HEADER_GUARD
+
+#include <stdint.h>
+#include <vccert/parser.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The state of an artifact as of a given block height.
+ */
+typedef struct vccert_artifact_state_version
+{
+    /**
+     * \brief The block height at which this state was applied.
+     */
+    uint64_t height;
+
+    /**
+     * \brief The id of the certificate that moved the artifact to this state.
+     */
+    uint8_t txn_id[16];
+
+    /**
+     * \brief The state of the artifact.
+     */
+    int32_t state;
+
+} vccert_artifact_state_version_t;
+
+/**
+ * \brief The version history of a single artifact, oldest first.
+ */
+typedef struct vccert_artifact_state_entry
+{
+    /**
+     * \brief The artifact id.
+     */
+    uint8_t artifact_id[16];
+
+    /**
+     * \brief The number of versions in the history.
+     */
+    size_t count;
+
+    /**
+     * \brief The number of versions the history can hold.
+     */
+    size_t capacity;
+
+    /**
+     * \brief The versions of this artifact, in the order they were applied,
+     * or NULL for an empty entry.
+     */
+    vccert_artifact_state_version_t* versions;
+
+} vccert_artifact_state_entry_t;
+
+/**
+ * \brief An in-memory table of artifact state, versioned by block height.
+ *
+ * Applying a certificate appends a new version to its artifact's history;
+ * existing versions are never changed.  A snapshot reads the table as of a
+ * given height, so snapshots for earlier heights stay valid as later blocks
+ * are applied.  The table must not be updated while it is being read.
+ */
+typedef struct vccert_artifact_state_table
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator used for the table.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief The number of artifacts in the table.
+     */
+    size_t count;
+
+    /**
+     * \brief The number of entries, minus one.  Always a power of two, minus
+     * one.
+     */
+    size_t mask;
+
+    /**
+     * \brief The open-addressed entries, keyed by artifact id.
+     */
+    vccert_artifact_state_entry_t* entries;
+
+    /**
+     * \brief The height of the last certificate applied.
+     */
+    uint64_t height;
+
+} vccert_artifact_state_table_t;
+
+/**
+ * \brief A read-only view of an artifact state table as of a block height.
+ */
+typedef struct vccert_artifact_state_snapshot
+{
+    /**
+     * \brief The table being viewed.
+     */
+    const vccert_artifact_state_table_t* table;
+
+    /**
+     * \brief Versions applied after this height are not visible.
+     */
+    uint64_t height;
+
+} vccert_artifact_state_snapshot_t;
+
+/**
+ * \brief Initialize an empty artifact state table.
+ *
+ * The table is owned by the caller and must be disposed by calling dispose()
+ * when no longer needed.
+ *
+ * \param table             The table to initialize.
+ * \param alloc_opts        The allocator to use for this table.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_TABLE_INIT_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_TABLE_INIT_OUT_OF_MEMORY if the table
+ *        could not be allocated.
+ */
+int vccert_artifact_state_table_init(
+    vccert_artifact_state_table_t* table, allocator_options_t* alloc_opts);
+
+/**
+ * \brief Apply an attested certificate to an artifact state table.
+ *
+ * The \ref VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE and \ref
+ * VCCERT_FIELD_TYPE_CERTIFICATE_ID of the certificate become the latest
+ * version of its \ref VCCERT_FIELD_TYPE_ARTIFACT_ID, as of the given height.
+ * Certificates must be applied in block order.
+ *
+ * \param table             The table to update.
+ * \param cert              The parser context of an attested certificate.
+ * \param height            The height of the block holding the certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_MISSING_FIELD if the
+ *        certificate lacks one of the fields above.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_HEIGHT_OUT_OF_ORDER if
+ *        height is lower than that of a certificate already applied.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_OUT_OF_MEMORY if the
+ *        table could not be grown.
+ */
+int vccert_artifact_state_table_apply(
+    vccert_artifact_state_table_t* table, vccert_parser_context_t* cert,
+    uint64_t height);
+
+/**
+ * \brief Take a snapshot of an artifact state table as of a block height.
+ *
+ * Taking a snapshot copies nothing.  The snapshot is valid for as long as the
+ * table is.
+ *
+ * \param snapshot          The snapshot to initialize.
+ * \param table             The table to view.
+ * \param height            The height to view the table at.
+ */
+void vccert_artifact_state_table_snapshot(
+    vccert_artifact_state_snapshot_t* snapshot,
+    const vccert_artifact_state_table_t* table, uint64_t height);
+
+/**
+ * \brief Find the state of an artifact in a snapshot.
+ *
+ * \param snapshot          The snapshot to search.
+ * \param artifact_id       The 128-bit artifact id to find.
+ * \param state             Pointer to receive the artifact's state.
+ * \param txn_id            Optional buffer of 16 bytes to receive the id of
+ *                          the certificate that set this state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_SNAPSHOT_FIND_INVALID_ARG if one of
+ *        the arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_SNAPSHOT_FIND_NOT_FOUND if the
+ *        artifact had no state as of the snapshot's height.
+ */
+int vccert_artifact_state_snapshot_find(
+    const vccert_artifact_state_snapshot_t* snapshot,
+    const uint8_t* artifact_id, int32_t* state, uint8_t* txn_id);
+
+/**
+ * \brief An artifact state resolver backed by an artifact state snapshot.
+ *
+ * To use it, set the parser options' parser_options_artifact_state_resolver
+ * to this function and its artifact_state_context to a \ref
+ * vccert_artifact_state_snapshot_t.
+ *
+ * \param options           The \ref vccert_parser_options_t for this parser.
+ * \param parser            The parser context.  Unused.
+ * \param artifact_id       The 128-bit artifact id to find.
+ * \param txn_id            Optional buffer of at least 16 bytes to receive
+ *                          the id of the certificate that set this state.
+ *
+ * \returns the state of this artifact, or -1 if it cannot be found.
+ */
+int32_t vccert_artifact_state_resolver(
+    void* options, void* parser, const uint8_t* artifact_id,
+    vccrypt_buffer_t* txn_id);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_ARTIFACT_STATE_HEADER_GUARD
@@ -0,0 +1,372 @@
+/**
+ * \file block.h
+ *
+ * \brief The block view provides random access to the wrapped transactions in
+ * a block certificate.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_BLOCK_HEADER_GUARD
+#define VCCERT_BLOCK_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <vccert/parser.h>
+#include <vccert/thread_pool.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief Reported by vccert_block_validate() when a failure is not tied to a
+ * single wrapped transaction.
+ */
+#define VCCERT_BLOCK_NO_TXN ((size_t)-1)
+
+/**
+ * \brief The location of a single wrapped transaction within a block.
+ */
+typedef struct vccert_block_txn_entry
+{
+    /**
+     * \brief The offset of the transaction certificate from the start of the
+     * block certificate.
+     */
+    size_t offset;
+
+    /**
+     * \brief The size of the transaction certificate.
+     */
+    size_t size;
+
+} vccert_block_txn_entry_t;
+
+/**
+ * \brief A block view indexes every \ref
+ * VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE in a block certificate in one
+ * pass, so that any transaction can then be reached in constant time.
+ */
+typedef struct vccert_block_view
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator options used for the offset table.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief The parser context for the block certificate.  This is borrowed
+     * and must outlive the view.
+     */
+    const vccert_parser_context_t* block;
+
+    /**
+     * \brief The number of wrapped transactions in the block.
+     */
+    size_t count;
+
+    /**
+     * \brief The number of entries allocated in the offset table.
+     */
+    size_t capacity;
+
+    /**
+     * \brief The offset table, in block order.
+     */
+    vccert_block_txn_entry_t* txns;
+
+} vccert_block_view_t;
+
+/**
+ * \brief Initialize a block view by indexing the wrapped transactions in a
+ * block certificate.
+ *
+ * The block is walked within its attested bounds if it has been attested, and
+ * within its raw bounds otherwise.  This view is owned by the caller and must
+ * be disposed of when no longer needed by calling dispose().
+ *
+ * \param view              The block view to initialize.
+ * \param alloc_opts        The allocator options to use for the offset table.
+ * \param block             The parser context for the block certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BLOCK_VIEW_INIT_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_VIEW_INIT_OUT_OF_MEMORY if the offset table
+ *        could not be allocated.
+ *      - \ref VCCERT_ERROR_BLOCK_VIEW_INIT_INVALID_FIELD_SIZE if the block
+ *        certificate is malformed.
+ */
+int vccert_block_view_init(
+    vccert_block_view_t* view, allocator_options_t* alloc_opts,
+    const vccert_parser_context_t* block);
+
+/**
+ * \brief Return the number of wrapped transactions in a block.
+ *
+ * \param view              The block view.
+ *
+ * \returns the number of wrapped transactions.
+ */
+size_t vccert_block_txn_count(const vccert_block_view_t* view);
+
+/**
+ * \brief Get the wrapped transaction certificate at the given index.
+ *
+ * \param view              The block view.
+ * \param index             The index of the transaction, in block order.
+ * \param value             Pointer to receive the transaction certificate.
+ * \param size              Pointer to receive the transaction size.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BLOCK_TXN_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_TXN_OUT_OF_RANGE if the index is past the end
+ *        of the block.
+ */
+int vccert_block_txn_at(
+    const vccert_block_view_t* view, size_t index, const uint8_t** value,
+    size_t* size);
+
+/**
+ * \brief Initialize a parser context for the wrapped transaction at the given
+ * index.
+ *
+ * The parser uses the block parser's options and can be attested like any
+ * other certificate.  The transaction bytes are not copied.  This parser
+ * context is owned by the caller and must be disposed of when no longer needed
+ * by calling dispose().
+ *
+ * \param view              The block view.
+ * \param index             The index of the transaction, in block order.
+ * \param txn               The parser context to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BLOCK_TXN_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_TXN_OUT_OF_RANGE if the index is past the end
+ *        of the block.
+ *      - a non-zero error code on failure.
+ */
+int vccert_block_txn_parser_init(
+    const vccert_block_view_t* view, size_t index,
+    vccert_parser_context_t* txn);
+
+/**
+ * \brief Validate a block certificate and every transaction it wraps.
+ *
+ * The block is walked once to find its wrapped transactions.  Worker threads
+ * from the pool then run the remaining stages as a pipeline connected by
+ * bounded lock-free queues: each transaction is split out into its own parser
+ * context, its signature is verified with vccert_parser_attest(), and, if
+ * requested, its contract is run.  Signatures are verified in parallel, but
+ * contracts run one at a time in block order, so contracts see the same
+ * sequence of calls as a sequential loop.  The block's own signature is
+ * checked concurrently, and every transaction must lie within the signed part
+ * of the block.
+ *
+ * All resolvers in the block parser's options are called from worker threads
+ * and must be safe to call concurrently.
+ *
+ * \param block             The parser context for the block certificate.
+ * \param height            The current height of the blockchain.
+ * \param verify_contracts  Set to true if the contract for each wrapped
+ *                          transaction should be verified.
+ * \param pool              The thread pool to use, or NULL to validate on the
+ *                          calling thread.
+ * \param failed_txn        Pointer to receive the index of the first
+ *                          transaction, in block order, that failed, or
+ *                          \ref VCCERT_BLOCK_NO_TXN.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BLOCK_VALIDATE_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_VALIDATE_OUT_OF_MEMORY if the pipeline state
+ *        could not be allocated.
+ *      - \ref VCCERT_ERROR_BLOCK_VALIDATE_UNSIGNED_TXN if a transaction lies
+ *        outside of the signed part of the block.
+ *      - the error returned by vccert_parser_attest() for the block, or for
+ *        the first failing transaction.
+ *      - a non-zero error code on failure.
+ */
+int vccert_block_validate(
+    vccert_parser_context_t* block, uint64_t height, bool verify_contracts,
+    vccert_thread_pool_t* pool, size_t* failed_txn);
+
+/**
+ * \brief Run the contracts for a set of attested transactions, in parallel
+ * where they touch different artifacts.
+ *
+ * Transactions are partitioned by \ref VCCERT_FIELD_TYPE_ARTIFACT_ID.  Each
+ * partition runs on one worker, in block order, while independent partitions
+ * run concurrently.  Every contract is run, even after a failure, so the
+ * status reported for each transaction is the same as that of a sequential
+ * loop calling each contract in block order, provided that a contract only
+ * reads and writes the state of its own artifact.
+ *
+ * Resolvers and contracts are called from worker threads and must be safe to
+ * call concurrently for different artifacts.
+ *
+ * \param txns              Array of parser contexts for the transactions, in
+ *                          block order.  Each must already have passed
+ *                          vccert_parser_attest().
+ * \param count             The number of transactions.
+ * \param pool              The thread pool to use, or NULL to run every
+ *                          contract on the calling thread.
+ * \param statuses          Array of count entries to receive the contract
+ *                          status of each transaction.
+ * \param failed_txn        Pointer to receive the index of the first
+ *                          transaction, in block order, whose contract
+ *                          failed, or \ref VCCERT_BLOCK_NO_TXN.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS if every contract passed.
+ *      - \ref VCCERT_ERROR_BLOCK_EXECUTE_CONTRACTS_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_EXECUTE_CONTRACTS_OUT_OF_MEMORY if the
+ *        partition table could not be allocated.
+ *      - the status of the first failing transaction.
+ */
+int vccert_block_execute_contracts(
+    vccert_parser_context_t* txns, size_t count, vccert_thread_pool_t* pool,
+    int* statuses, size_t* failed_txn);
+
+/**
+ * \brief Run the contracts for a set of attested transactions optimistically,
+ * re-running only those that read an artifact state that changed.
+ *
+ * Every contract first runs in parallel against a versioned view of artifact
+ * state: each transaction's \ref VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE is a
+ * version of its artifact, and a read through the artifact state resolver
+ * sees the latest version written earlier in the block, or the state given
+ * by the caller's resolver if there is none.  The version each contract read
+ * is recorded.  Once a round completes, the reads are checked in block order
+ * against the versions written by transactions that actually passed, and only
+ * the transactions that read a stale version run again.  Rounds repeat until
+ * every read is current, which gives the same statuses as running each
+ * contract in block order and applying each passing transaction's new state.
+ *
+ * Contracts are run with a copy of the transactions' parser options in which
+ * the artifact state resolver is replaced; every other resolver, and the
+ * options context, are unchanged.  Resolvers and contracts are called from
+ * worker threads and must be safe to call concurrently.
+ *
+ * \param txns              Array of parser contexts for the transactions, in
+ *                          block order.  Each must already have passed
+ *                          vccert_parser_attest(), and all must share the same
+ *                          parser options.
+ * \param count             The number of transactions.
+ * \param pool              The thread pool to use, or NULL to run every
+ *                          contract on the calling thread.
+ * \param statuses          Array of count entries to receive the contract
+ *                          status of each transaction.
+ * \param failed_txn        Pointer to receive the index of the first
+ *                          transaction, in block order, whose contract
+ *                          failed, or \ref VCCERT_BLOCK_NO_TXN.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS if every contract passed.
+ *      - \ref VCCERT_ERROR_BLOCK_EXECUTE_SPECULATIVE_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_EXECUTE_SPECULATIVE_OUT_OF_MEMORY if the
+ *        version table or a read set could not be allocated.
+ *      - the status of the first failing transaction.
+ */
+int vccert_block_execute_speculative(
+    vccert_parser_context_t* txns, size_t count, vccert_thread_pool_t* pool,
+    int* statuses, size_t* failed_txn);
+
+/**
+ * \brief The size of the header of a block filter.
+ *
+ * A block filter is a Bloom filter over the \ref
+ * VCCERT_FIELD_TYPE_ARTIFACT_ID and \ref VCCERT_FIELD_TYPE_CERTIFICATE_ID
+ * fields of the wrapped transactions in a block, written by
+ * vccert_block_filter_write() to be stored alongside the block.  All values
+ * are big endian.
+ *
+ * | Offset | Size | Field                                   |
+ * |--------|------|-----------------------------------------|
+ * | 0      | 4    | magic, "VCBF"                           |
+ * | 4      | 4    | the number of probes per id             |
+ * | 8      | 8    | the number of bits, a multiple of 64    |
+ * | 16     | n/8  | the bits                                |
+ */
+#define VCCERT_BLOCK_FILTER_HEADER_SIZE 16
+
+/**
+ * \brief Write a filter over the artifact and certificate ids of the wrapped
+ * transactions in a block.
+ *
+ * The filter is sized for a false positive rate of about one percent.  Call
+ * this first with a NULL buffer to get the size of the filter.
+ *
+ * \param view              The block view.
+ * \param buffer            The buffer to receive the filter, or NULL.
+ * \param size              The size of the buffer.
+ * \param required          Pointer to receive the size of the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BLOCK_FILTER_WRITE_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_FILTER_WRITE_BUFFER_TOO_SMALL if the buffer
+ *        is too small.
+ *      - \ref VCCERT_ERROR_BLOCK_FILTER_WRITE_BAD_TXN if a wrapped transaction
+ *        is malformed.
+ */
+int vccert_block_filter_write(
+    const vccert_block_view_t* view, uint8_t* buffer, size_t size,
+    size_t* required);
+
+/**
+ * \brief Check whether a block may hold a transaction for an artifact.
+ *
+ * A false answer is definite, so the block can be skipped without being
+ * parsed.  A true answer may be a false positive.  A missing or damaged
+ * filter cannot rule anything out, and always gives true.
+ *
+ * \param filter            The block filter.
+ * \param size              The size of the block filter.
+ * \param artifact_id       The 128-bit artifact id.
+ *
+ * \returns false if no wrapped transaction in the block has this artifact
+ * id, and true if one may.
+ */
+bool vccert_block_may_contain_artifact(
+    const uint8_t* filter, size_t size, const uint8_t* artifact_id);
+
+/**
+ * \brief Check whether a block may hold a transaction with a certificate id.
+ *
+ * This answers as vccert_block_may_contain_artifact() does.
+ *
+ * \param filter            The block filter.
+ * \param size              The size of the block filter.
+ * \param certificate_id    The 128-bit certificate id.
+ *
+ * \returns false if no wrapped transaction in the block has this
+ * certificate id, and true if one may.
+ */
+bool vccert_block_may_contain_certificate(
+    const uint8_t* filter, size_t size, const uint8_t* certificate_id);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_BLOCK_HEADER_GUARD
@@ -8,7 +8,7 @@
  * contract mode, in which a certificate must be strictly built following a
  * contract.
  *
- * \copyright 2017-2021 Velo Payments, Inc.  All rights reserved.
+ * \copyright 2017-2026 Velo Payments, Inc.  All rights reserved.
  */
 
 #ifndef VCCERT_BUILDER_HEADER_GUARD
@@ -17,6 +17,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <vccert/parser.h>
+#include <vccert/thread_pool.h>
 #include <vccrypt/suite.h>
 #include <vpr/allocator.h>
 #include <vpr/disposable.h>
@@ -31,6 +32,11 @@ extern "C" {
  */
 #define VCCERT_MAX_FIELD_SIZE   ((size_t)(0x7FFF))
 
+/**
+ * The maximum number of variable field slots in a builder template.
+ */
+#define VCCERT_BUILDER_TEMPLATE_MAX_SLOTS 16
+
 /**
  * \brief The builder options structure is used to manage options needed to
  * build a certificate.
@@ -81,6 +87,152 @@ typedef struct vccert_builder_context
 
 } vccert_builder_context_t;
 
+/**
+ * \brief The builder pool manages a fixed set of builder contexts that can be
+ * reused across many certificates.
+ *
+ * All builder contexts in the pool are initialized up front, so acquiring and
+ * releasing a context does not allocate memory.  A builder pool is not thread
+ * safe; each thread that issues certificates should own its own pool.
+ */
+typedef struct vccert_builder_pool
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The options structure for this pool.
+     */
+    vccert_builder_options_t* options;
+
+    /**
+     * \brief The number of builder contexts owned by this pool.
+     */
+    size_t capacity;
+
+    /**
+     * \brief The number of builder contexts available for acquisition.
+     */
+    size_t available;
+
+    /**
+     * \brief The builder contexts owned by this pool.
+     */
+    vccert_builder_context_t* contexts;
+
+    /**
+     * \brief Stack of builder contexts available for acquisition.
+     */
+    vccert_builder_context_t** free_list;
+
+    /**
+     * \brief For each builder context, true while it is acquired.
+     */
+    bool* in_use;
+
+} vccert_builder_pool_t;
+
+/**
+ * \brief A variable field slot in a builder template.
+ */
+typedef struct vccert_builder_template_slot
+{
+    /**
+     * \brief The short field ID of this slot.
+     */
+    uint16_t field;
+
+    /**
+     * \brief The offset of the field value in the template.
+     */
+    size_t offset;
+
+    /**
+     * \brief The size of the field value.
+     */
+    size_t size;
+
+} vccert_builder_template_slot_t;
+
+/**
+ * \brief A builder template holds a pre-encoded certificate prefix along with
+ * the location of the variable fields in that prefix.
+ *
+ * Fixed fields are added to the template by calling the vccert_builder_add_*()
+ * methods on the template's builder.  Variable fields are reserved by calling
+ * vccert_builder_template_add_slot().  The encoded prefix is copied into a
+ * builder context with vccert_builder_template_apply(), after which each slot
+ * can be patched in place before the certificate is signed.
+ */
+typedef struct vccert_builder_template
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The builder holding the encoded certificate prefix.
+     */
+    vccert_builder_context_t builder;
+
+    /**
+     * \brief The number of variable field slots in this template.
+     */
+    size_t slot_count;
+
+    /**
+     * \brief The variable field slots in this template.
+     */
+    vccert_builder_template_slot_t slots[VCCERT_BUILDER_TEMPLATE_MAX_SLOTS];
+
+} vccert_builder_template_t;
+
+/**
+ * \brief A prepared signer holds everything needed to sign certificates with
+ * a single signing key.
+ *
+ * The private key, signer UUID, digital signature context, and signature
+ * scratch buffer are set up once, so vccert_builder_sign_prepared() does not
+ * allocate or initialize anything per certificate.  Because the scratch buffer
+ * is shared, a prepared signer must only be used by one thread at a time.
+ */
+typedef struct vccert_builder_signer
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The options structure for this signer.
+     */
+    vccert_builder_options_t* options;
+
+    /**
+     * \brief The 128-bit signer UUID.
+     */
+    uint8_t signer_id[16];
+
+    /**
+     * \brief A copy of the private signing key.
+     */
+    vccrypt_buffer_t private_key;
+
+    /**
+     * \brief Scratch buffer receiving each signature.
+     */
+    vccrypt_buffer_t signature;
+
+    /**
+     * \brief The reusable digital signature context.
+     */
+    vccrypt_digital_signature_context_t sign;
+
+} vccert_builder_signer_t;
+
 /**
  * \brief Initialize a builder options structure using the given allocator and
  * crypto suite.
@@ -251,6 +403,75 @@ int vccert_builder_add_short_int64(
 int vccert_builder_add_short_uint64(
     vccert_builder_context_t* context, uint16_t field, uint64_t value);
 
+/**
+ * \brief Add an array of uint32_t fields to the certificate with short field
+ * IDs.
+ *
+ * This produces the same certificate bytes as calling
+ * vccert_builder_add_short_uint32() once for each field, in order, but
+ * encodes every field in a single pass.  Either every field is added or, on
+ * error, none are.
+ *
+ * \param context           The builder context to use for this operation.
+ * \param fields            The short field ID of each field to add.
+ * \param values            The uint32_t value of each field.
+ * \param count             The number of fields to add.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_ADD_INVALID_ARG if one of the arguments to
+ *              this method is invalid.
+ */
+int vccert_builder_add_short_uint32_array(
+    vccert_builder_context_t* context, const uint16_t* fields,
+    const uint32_t* values, size_t count);
+
+/**
+ * \brief Add an array of int64_t fields to the certificate with short field
+ * IDs.
+ *
+ * This produces the same certificate bytes as calling
+ * vccert_builder_add_short_int64() once for each field, in order, but
+ * encodes every field in a single pass.  Either every field is added or, on
+ * error, none are.
+ *
+ * \param context           The builder context to use for this operation.
+ * \param fields            The short field ID of each field to add.
+ * \param values            The int64_t value of each field.
+ * \param count             The number of fields to add.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_ADD_INVALID_ARG if one of the arguments to
+ *              this method is invalid.
+ */
+int vccert_builder_add_short_int64_array(
+    vccert_builder_context_t* context, const uint16_t* fields,
+    const int64_t* values, size_t count);
+
+/**
+ * \brief Add an array of uint64_t fields to the certificate with short field
+ * IDs.
+ *
+ * This produces the same certificate bytes as calling
+ * vccert_builder_add_short_uint64() once for each field, in order, but
+ * encodes every field in a single pass.  Either every field is added or, on
+ * error, none are.
+ *
+ * \param context           The builder context to use for this operation.
+ * \param fields            The short field ID of each field to add.
+ * \param values            The uint64_t value of each field.
+ * \param count             The number of fields to add.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_ADD_INVALID_ARG if one of the arguments to
+ *              this method is invalid.
+ */
+int vccert_builder_add_short_uint64_array(
+    vccert_builder_context_t* context, const uint16_t* fields,
+    const uint64_t* values, size_t count);
+
 /**
  * \brief Add a byte buffer field to the certificate with a short field ID.
  *
@@ -286,6 +507,26 @@ int vccert_builder_add_short_UUID(
     vccert_builder_context_t* context, uint16_t field,
     const uint8_t* value);
 
+/**
+ * \brief Add a field index covering every field added so far.
+ *
+ * The index records the type and header offset of each field, so that a parser
+ * can find fields in the attested certificate without walking it.  It should be
+ * added after the last data field and immediately before signing, so that it
+ * sits just before the signer ID and is covered by the signature.
+ *
+ * \param context           The builder context to use for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_ADD_INVALID_ARG if one of the arguments to
+ *              this method is invalid, or the index would not fit in the
+ *              certificate.
+ *      - \ref VCCERT_ERROR_BUILDER_ADD_TOO_BIG if the index would exceed the
+ *              max supported field size.
+ */
+int vccert_builder_add_field_index(vccert_builder_context_t* context);
+
 /**
  * \brief Sign the certificate using the given signer UUID and private key.
  *
@@ -308,6 +549,84 @@ int vccert_builder_sign(
     vccert_builder_context_t* context, const uint8_t* signer_id,
     const vccrypt_buffer_t* private_key);
 
+/**
+ * \brief Initialize a prepared signer for the given signer UUID and private
+ * key.
+ *
+ * The private key is copied into the signer, so the caller's key buffer may be
+ * disposed once this call returns.  This signer is owned by the caller and
+ * must be disposed of when no longer needed by calling dispose().
+ *
+ * Note that the signer_id is expected as a Big Endian representation of a UUID.
+ *
+ * \param options           The builder options to use for this signer.
+ * \param signer            The signer to initialize.
+ * \param signer_id         The 128-bit signer UUID.
+ * \param private_key       The private key buffer to use to sign
+ *                          certificates.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGNER_INIT_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - a nonzero value indicating error.
+ */
+int vccert_builder_signer_init(
+    vccert_builder_options_t* options, vccert_builder_signer_t* signer,
+    const uint8_t* signer_id, const vccrypt_buffer_t* private_key);
+
+/**
+ * \brief Sign the certificate using a prepared signer.
+ *
+ * This produces the same certificate as vccert_builder_sign() called with the
+ * signer's UUID and private key.
+ *
+ * \param context           The builder context to use for this operation.
+ * \param signer            The prepared signer to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGN_PREPARED_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGN_INVALID_FIELD_SIZE if the signature
+ *             would overwrite memory.
+ *      - a nonzero value indicating error.
+ */
+int vccert_builder_sign_prepared(
+    vccert_builder_context_t* context, vccert_builder_signer_t* signer);
+
+/**
+ * \brief Sign a batch of finished certificates using a prepared signer,
+ * spreading the work across a thread pool.
+ *
+ * Each certificate is signed exactly as vccert_builder_sign_prepared() would
+ * sign it.  The signer's key and UUID are shared by every worker; each worker
+ * gets its own signature context and scratch buffer.  Failure to sign one
+ * certificate does not stop the others from being signed.
+ *
+ * \param contexts          The builder contexts to sign.
+ * \param count             The number of builder contexts.
+ * \param signer            The prepared signer to use.
+ * \param pool              The thread pool to use, or NULL to sign on the
+ *                          calling thread.
+ * \param status            Array of count entries that receives the status
+ *                          of signing each context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS if every certificate was signed.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGN_BATCH_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGN_BATCH_OUT_OF_MEMORY if per-worker
+ *             scratch space could not be allocated.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGN_BATCH_FAILED if any certificate
+ *             could not be signed.
+ *      - a nonzero value indicating error.
+ */
+int vccert_builder_sign_batch(
+    vccert_builder_context_t** contexts, size_t count,
+    vccert_builder_signer_t* signer, vccert_thread_pool_t* pool,
+    int* status);
+
 /**
  * \brief Get a pointer to the current certificate and its size.
  *
@@ -325,6 +644,260 @@ int vccert_builder_sign(
 const uint8_t* vccert_builder_emit(
     vccert_builder_context_t* context, size_t* size);
 
+/**
+ * \brief Reset a builder context so that it can be used to build another
+ * certificate.
+ *
+ * The certificate buffer is retained and cleared, and the offset is rewound to
+ * the beginning of the buffer.  Any pointer previously returned by
+ * vccert_builder_emit() for this context is no longer valid.
+ *
+ * \param context           The builder context to reset.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_RESET_INVALID_ARG if one of the arguments to
+ *             this method is invalid.
+ */
+int vccert_builder_reset(vccert_builder_context_t* context);
+
+/**
+ * \brief Initialize a builder pool holding the given number of builder
+ * contexts, each of which can build a certificate up to the given size.
+ *
+ * This pool is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().  All contexts must be released back to the pool
+ * before it is disposed.
+ *
+ * \param options           The builder options to use for each context.
+ * \param pool              The builder pool to initialize.
+ * \param capacity          The number of builder contexts in this pool.
+ * \param size              The maximum size of each certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_POOL_INIT_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_POOL_INIT_OUT_OF_MEMORY if the pool could
+ *             not be allocated.
+ *      - a non-zero value on error.
+ */
+int vccert_builder_pool_init(
+    vccert_builder_options_t* options, vccert_builder_pool_t* pool,
+    size_t capacity, size_t size);
+
+/**
+ * \brief Acquire an empty builder context from the pool.
+ *
+ * The context remains owned by the pool and must be returned to it by calling
+ * vccert_builder_pool_release().  It must not be disposed by the caller.
+ *
+ * \param pool              The builder pool from which a context is acquired.
+ * \param context           Pointer to receive the builder context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_POOL_INVALID_ARG if one of the arguments to
+ *             this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_POOL_EXHAUSTED if every context in this
+ *             pool is currently acquired.
+ */
+int vccert_builder_pool_acquire(
+    vccert_builder_pool_t* pool, vccert_builder_context_t** context);
+
+/**
+ * \brief Release a builder context back to the pool.
+ *
+ * The context is reset before it is made available again.  Any pointer
+ * previously returned by vccert_builder_emit() for this context is no longer
+ * valid.
+ *
+ * \param pool              The builder pool that owns this context.
+ * \param context           The builder context to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_POOL_INVALID_ARG if one of the arguments to
+ *             this method is invalid, or if the context is not owned by this
+ *             pool.
+ */
+int vccert_builder_pool_release(
+    vccert_builder_pool_t* pool, vccert_builder_context_t* context);
+
+/**
+ * \brief Initialize a builder template that can hold a certificate prefix up
+ * to the given size.
+ *
+ * This template is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().
+ *
+ * \param options           The builder options to use for this template.
+ * \param tmpl              The builder template to initialize.
+ * \param size              The maximum size of the certificate prefix.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INIT_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - a non-zero value on error.
+ */
+int vccert_builder_template_init(
+    vccert_builder_options_t* options, vccert_builder_template_t* tmpl,
+    size_t size);
+
+/**
+ * \brief Reserve a variable field slot at the end of the template prefix.
+ *
+ * The field header is encoded in the template and the value is zero-filled.
+ * The value is supplied later by patching the slot.
+ *
+ * \param tmpl              The builder template to update.
+ * \param field             The short field ID of this slot.
+ * \param size              The size of the field value in bytes.
+ * \param slot              Pointer to receive the slot index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_ADD_TOO_BIG if the field exceeds the
+ *             maximum supported field size.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_TOO_MANY_SLOTS if this template
+ *             has no room for another slot.
+ */
+int vccert_builder_template_add_slot(
+    vccert_builder_template_t* tmpl, uint16_t field, size_t size,
+    size_t* slot);
+
+/**
+ * \brief Copy the template prefix into the given builder context.
+ *
+ * This replaces the current contents of the builder context.  Additional
+ * fields can be added after the prefix, and the slots can be patched with
+ * vccert_builder_template_patch() until the certificate is signed.
+ *
+ * \param tmpl              The builder template to apply.
+ * \param context           The builder context to receive the prefix.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG if one of the
+ *             arguments to this method is invalid, or if the builder context
+ *             is too small to hold the prefix.
+ */
+int vccert_builder_template_apply(
+    const vccert_builder_template_t* tmpl, vccert_builder_context_t* context);
+
+/**
+ * \brief Patch the value of a template slot in a builder context.
+ *
+ * \param tmpl              The builder template that was applied to this
+ *                          builder context.
+ * \param context           The builder context to patch.
+ * \param slot              The slot index to patch.
+ * \param value             The new value of this slot.
+ * \param size              The size of the value, which must match the slot
+ *                          size.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_SLOT_SIZE_MISMATCH if the value
+ *             size does not match the slot size.
+ */
+int vccert_builder_template_patch(
+    const vccert_builder_template_t* tmpl, vccert_builder_context_t* context,
+    size_t slot, const uint8_t* value, size_t size);
+
+/**
+ * \brief Patch a uint16_t template slot in a builder context.
+ *
+ * Note that this value will be written as a Big Endian integer value.
+ *
+ * \param tmpl              The builder template that was applied to this
+ *                          builder context.
+ * \param context           The builder context to patch.
+ * \param slot              The slot index to patch.
+ * \param value             The new value of this slot.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_SLOT_SIZE_MISMATCH if the slot
+ *             does not hold a 16-bit value.
+ */
+int vccert_builder_template_patch_uint16(
+    const vccert_builder_template_t* tmpl, vccert_builder_context_t* context,
+    size_t slot, uint16_t value);
+
+/**
+ * \brief Patch a uint32_t template slot in a builder context.
+ *
+ * Note that this value will be written as a Big Endian integer value.
+ *
+ * \param tmpl              The builder template that was applied to this
+ *                          builder context.
+ * \param context           The builder context to patch.
+ * \param slot              The slot index to patch.
+ * \param value             The new value of this slot.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_SLOT_SIZE_MISMATCH if the slot
+ *             does not hold a 32-bit value.
+ */
+int vccert_builder_template_patch_uint32(
+    const vccert_builder_template_t* tmpl, vccert_builder_context_t* context,
+    size_t slot, uint32_t value);
+
+/**
+ * \brief Patch a uint64_t template slot in a builder context.
+ *
+ * Note that this value will be written as a Big Endian integer value.
+ *
+ * \param tmpl              The builder template that was applied to this
+ *                          builder context.
+ * \param context           The builder context to patch.
+ * \param slot              The slot index to patch.
+ * \param value             The new value of this slot.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_SLOT_SIZE_MISMATCH if the slot
+ *             does not hold a 64-bit value.
+ */
+int vccert_builder_template_patch_uint64(
+    const vccert_builder_template_t* tmpl, vccert_builder_context_t* context,
+    size_t slot, uint64_t value);
+
+/**
+ * \brief Patch a UUID template slot in a builder context.
+ *
+ * Note that this value is expected as a Big Endian representation of a UUID.
+ *
+ * \param tmpl              The builder template that was applied to this
+ *                          builder context.
+ * \param context           The builder context to patch.
+ * \param slot              The slot index to patch.
+ * \param value             The 128-bit UUID.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_SLOT_SIZE_MISMATCH if the slot
+ *             does not hold a UUID.
+ */
+int vccert_builder_template_patch_UUID(
+    const vccert_builder_template_t* tmpl, vccert_builder_context_t* context,
+    size_t slot, const uint8_t* value);
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
@@ -0,0 +1,158 @@
+/**
+ * \file columns.h
+ *
+ * \brief Extract the same short fields from a batch of certificates into
+ * dense columns.
+ *
+ * Each column names a short field and the schema type it should be read as.
+ * Integer, boolean, byte and date types are decoded from big endian into an
+ * array holding one fixed-width value per row.  Every other type is returned
+ * as a \ref vccert_column_span_t giving the location of the field value
+ * within the row's certificate.  Each certificate is walked once, however
+ * many columns are extracted.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_COLUMNS_HEADER_GUARD
+#define VCCERT_COLUMNS_HEADER_GUARD
+
+#include <stdint.h>
+#include <vccert/schema.h>
+#include <vccert/store.h>
+#include <vccert/thread_pool.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The largest number of columns in one extraction, so that a row's
+ * missing fields fit in one 64-bit bitmap.
+ */
+#define VCCERT_COLUMNS_MAX 64
+
+/**
+ * \brief Reported by the extraction functions when every row could be read.
+ */
+#define VCCERT_COLUMNS_NO_ROW ((size_t)-1)
+
+/**
+ * \brief The location of a variable-sized field value.
+ */
+typedef struct vccert_column_span
+{
+    /**
+     * \brief The offset of the value from the start of the certificate.
+     */
+    size_t offset;
+
+    /**
+     * \brief The size of the value.
+     */
+    size_t size;
+
+} vccert_column_span_t;
+
+/**
+ * \brief A column to extract.
+ */
+typedef struct vccert_column
+{
+    /**
+     * \brief The short field id to extract.
+     */
+    uint16_t field;
+
+    /**
+     * \brief The schema type to read the field as.
+     *
+     * \ref VCCERT_SCHEMA_TYPE_BYTE, \ref VCCERT_SCHEMA_TYPE_BOOLEAN, \ref
+     * VCCERT_SCHEMA_TYPE_INT8 and \ref VCCERT_SCHEMA_TYPE_UINT8 fill one
+     * uint8_t per row; the 16-, 32- and 64-bit integer types fill one integer
+     * of that width per row; and \ref VCCERT_SCHEMA_TYPE_C_STYLE_DATE fills
+     * one int64_t per row.  Signed types are stored in their signed form.
+     * Any other type fills one \ref vccert_column_span_t per row.
+     */
+    vccert_schema_type_t type;
+
+    /**
+     * \brief The array to receive one value per row.
+     */
+    void* values;
+
+} vccert_column_t;
+
+/**
+ * \brief Extract columns from a batch of certificates.
+ *
+ * The first occurrence of each field is used.  A field that is absent, or
+ * whose size does not match a fixed-width type, is reported as missing and
+ * its value is zeroed.  A certificate that cannot be walked has every column
+ * reported as missing, and extraction carries on with the remaining rows.
+ *
+ * Rows are split into contiguous partitions, several per worker.
+ *
+ * \param columns           The columns to extract.
+ * \param column_count      The number of columns, at most \ref
+ *                          VCCERT_COLUMNS_MAX.
+ * \param certs             The certificate of each row.
+ * \param sizes             The size of each row's certificate.
+ * \param rows              The number of rows.
+ * \param pool              The thread pool to use, or NULL to extract every
+ *                          row on the calling thread.
+ * \param missing           Optional array to receive, for each row, a bitmap
+ *                          with bit n set if column n was missing.
+ * \param failed            Optional pointer to receive the first row that
+ *                          could not be walked, or \ref VCCERT_COLUMNS_NO_ROW.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE if a certificate
+ *        could not be walked.
+ */
+int vccert_columns_extract(
+    const vccert_column_t* columns, size_t column_count,
+    const uint8_t* const* certs, const size_t* sizes, size_t rows,
+    vccert_thread_pool_t* pool, uint64_t* missing, size_t* failed);
+
+/**
+ * \brief Extract columns from every certificate in a store.
+ *
+ * This behaves as vccert_columns_extract(), with one row per certificate in
+ * store order.  Spans are relative to each certificate.
+ *
+ * \param columns           The columns to extract.
+ * \param column_count      The number of columns, at most \ref
+ *                          VCCERT_COLUMNS_MAX.
+ * \param store             The store view.
+ * \param pool              The thread pool to use, or NULL to extract every
+ *                          row on the calling thread.
+ * \param missing           Optional array to receive, for each row, a bitmap
+ *                          with bit n set if column n was missing.
+ * \param failed            Optional pointer to receive the first row that
+ *                          could not be read, or \ref VCCERT_COLUMNS_NO_ROW.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE if a certificate
+ *        could not be walked.
+ *      - the error returned by vccert_store_at() for the first frame that
+ *        could not be read.
+ */
+int vccert_columns_extract_store(
+    const vccert_column_t* columns, size_t column_count,
+    const vccert_store_t* store, vccert_thread_pool_t* pool,
+    uint64_t* missing, size_t* failed);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_COLUMNS_HEADER_GUARD
@@ -0,0 +1,226 @@
+/**
+ * \file decoded.h
+ *
+ * \brief A decoded certificate holds the well-known fields of a certificate as
+ * aligned, native-endian values, so that code reading the same fields many
+ * times does not decode them at every call site.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_DECODED_HEADER_GUARD
+#define VCCERT_DECODED_HEADER_GUARD
+
+#include <stdint.h>
+#include <vccert/parser.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \defgroup DecodedFieldFlags Flags for the known fields of a decoded
+ * certificate.
+ *
+ * @{
+ */
+#define VCCERT_DECODED_HAS_CERTIFICATE_VERSION          (1UL << 0)
+#define VCCERT_DECODED_HAS_VALID_FROM                   (1UL << 1)
+#define VCCERT_DECODED_HAS_VALID_TO                     (1UL << 2)
+#define VCCERT_DECODED_HAS_CRYPTO_SUITE                 (1UL << 3)
+#define VCCERT_DECODED_HAS_CERTIFICATE_TYPE             (1UL << 4)
+#define VCCERT_DECODED_HAS_CERTIFICATE_ID               (1UL << 5)
+#define VCCERT_DECODED_HAS_PREVIOUS_CERTIFICATE_ID      (1UL << 6)
+#define VCCERT_DECODED_HAS_NEXT_CERTIFICATE_ID          (1UL << 7)
+#define VCCERT_DECODED_HAS_ARTIFACT_TYPE                (1UL << 8)
+#define VCCERT_DECODED_HAS_ARTIFACT_ID                  (1UL << 9)
+#define VCCERT_DECODED_HAS_PREVIOUS_ARTIFACT_STATE      (1UL << 10)
+#define VCCERT_DECODED_HAS_NEW_ARTIFACT_STATE           (1UL << 11)
+#define VCCERT_DECODED_HAS_SIGNER_ID                    (1UL << 12)
+#define VCCERT_DECODED_HAS_BLOCK_UUID                   (1UL << 13)
+#define VCCERT_DECODED_HAS_PREVIOUS_BLOCK_UUID          (1UL << 14)
+#define VCCERT_DECODED_HAS_BLOCK_HEIGHT                 (1UL << 15)
+/**
+ * @}
+ */
+
+/**
+ * \brief A field that has no slot of its own in a decoded certificate.
+ */
+typedef struct vccert_decoded_field
+{
+    /**
+     * \brief The value, which points into the certificate.
+     */
+    const uint8_t* value;
+
+    /**
+     * \brief The size of the value.
+     */
+    size_t size;
+
+    /**
+     * \brief The short field type.
+     */
+    uint16_t field;
+
+} vccert_decoded_field_t;
+
+/**
+ * \brief A certificate decoded once into plain memory.
+ *
+ * The first occurrence of each known field is decoded into its slot, and its
+ * flag is set in present.  Every other field, including later occurrences of
+ * known fields, is listed in the overflow table in certificate order.  Slots
+ * for absent fields are zero.
+ */
+typedef struct vccert_decoded
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator options used for the overflow table.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief The \ref DecodedFieldFlags for the slots that are set.
+     */
+    uint32_t present;
+
+    /**
+     * \brief The certificate format version.
+     */
+    uint32_t certificate_version;
+
+    /**
+     * \brief The valid from date, in seconds from Jan-01-1970.
+     */
+    uint64_t valid_from;
+
+    /**
+     * \brief The valid to date, in seconds from Jan-01-1970.
+     */
+    uint64_t valid_to;
+
+    /**
+     * \brief The block height.
+     */
+    uint64_t block_height;
+
+    /**
+     * \brief The certificate type UUID.
+     */
+    uint8_t certificate_type[16];
+
+    /**
+     * \brief The certificate UUID.
+     */
+    uint8_t certificate_id[16];
+
+    /**
+     * \brief The previous certificate UUID.
+     */
+    uint8_t previous_certificate_id[16];
+
+    /**
+     * \brief The next certificate UUID.
+     */
+    uint8_t next_certificate_id[16];
+
+    /**
+     * \brief The artifact type UUID.
+     */
+    uint8_t artifact_type[16];
+
+    /**
+     * \brief The artifact UUID.
+     */
+    uint8_t artifact_id[16];
+
+    /**
+     * \brief The signer UUID.
+     */
+    uint8_t signer_id[16];
+
+    /**
+     * \brief The block UUID.
+     */
+    uint8_t block_uuid[16];
+
+    /**
+     * \brief The previous block UUID.
+     */
+    uint8_t previous_block_uuid[16];
+
+    /**
+     * \brief The certificate crypto suite.
+     */
+    uint16_t crypto_suite;
+
+    /**
+     * \brief The previous artifact state.
+     */
+    uint16_t previous_artifact_state;
+
+    /**
+     * \brief The new artifact state.
+     */
+    uint16_t new_artifact_state;
+
+    /**
+     * \brief The number of fields in the overflow table.
+     */
+    size_t overflow_count;
+
+    /**
+     * \brief The number of entries allocated in the overflow table.
+     */
+    size_t overflow_capacity;
+
+    /**
+     * \brief The overflow table, in certificate order.
+     */
+    vccert_decoded_field_t* overflow;
+
+} vccert_decoded_t;
+
+/**
+ * \brief Decode a certificate into plain memory.
+ *
+ * The certificate is walked once, within its attested bounds if it has been
+ * attested, and within its raw bounds otherwise.  Overflow values point into
+ * the certificate, which must outlive the decoded certificate.  The decoded
+ * certificate is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().
+ *
+ * \param decoded           The decoded certificate to initialize.
+ * \param alloc_opts        The allocator options to use for the overflow
+ *                          table.
+ * \param parser            The parser context for the certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_DECODED_INIT_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_DECODED_INIT_OUT_OF_MEMORY if the overflow table
+ *        could not be allocated.
+ *      - \ref VCCERT_ERROR_DECODED_INIT_INVALID_FIELD_SIZE if the certificate
+ *        is malformed, or a known field has the wrong size.
+ */
+int vccert_decoded_init(
+    vccert_decoded_t* decoded, allocator_options_t* alloc_opts,
+    const vccert_parser_context_t* parser);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_DECODED_HEADER_GUARD
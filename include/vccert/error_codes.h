@@ -160,6 +160,708 @@ extern "C" {
  */
 #define VCCERT_ERROR_BUILDER_ADD_TOO_BIG 0x3135
 
+/**
+ * \brief An invalid argument was passed to vccert_builder_reset().
+ */
+#define VCCERT_ERROR_BUILDER_RESET_INVALID_ARG 0x3138
+
+/**
+ * \brief An invalid argument was passed to vccert_builder_pool_init().
+ */
+#define VCCERT_ERROR_BUILDER_POOL_INIT_INVALID_ARG 0x313C
+
+/**
+ * \brief Memory could not be allocated for the builder pool.
+ */
+#define VCCERT_ERROR_BUILDER_POOL_INIT_OUT_OF_MEMORY 0x313D
+
+/**
+ * \brief An invalid argument was passed to vccert_builder_pool_acquire() or
+ * vccert_builder_pool_release().
+ */
+#define VCCERT_ERROR_BUILDER_POOL_INVALID_ARG 0x313E
+
+/**
+ * \brief All builder contexts in the pool are currently in use.
+ */
+#define VCCERT_ERROR_BUILDER_POOL_EXHAUSTED 0x313F
+
+/**
+ * \brief An invalid argument was passed to vccert_builder_template_init().
+ */
+#define VCCERT_ERROR_BUILDER_TEMPLATE_INIT_INVALID_ARG 0x3140
+
+/**
+ * \brief An invalid argument was passed to a vccert_builder_template_*()
+ * method.
+ */
+#define VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG 0x3141
+
+/**
+ * \brief The template already holds the maximum number of variable field slots.
+ */
+#define VCCERT_ERROR_BUILDER_TEMPLATE_TOO_MANY_SLOTS 0x3142
+
+/**
+ * \brief The value patched into a template slot does not match the size of that
+ * slot.
+ */
+#define VCCERT_ERROR_BUILDER_TEMPLATE_SLOT_SIZE_MISMATCH 0x3143
+
+/**
+ * \brief An invalid argument was passed to vccert_builder_signer_init().
+ */
+#define VCCERT_ERROR_BUILDER_SIGNER_INIT_INVALID_ARG 0x3144
+
+/**
+ * \brief An invalid argument was passed to vccert_builder_sign_prepared().
+ */
+#define VCCERT_ERROR_BUILDER_SIGN_PREPARED_INVALID_ARG 0x3145
+
+/**
+ * \brief An invalid argument was passed to vccert_builder_sign_batch().
+ */
+#define VCCERT_ERROR_BUILDER_SIGN_BATCH_INVALID_ARG 0x3146
+
+/**
+ * \brief vccert_builder_sign_batch() could not allocate per-worker signing
+ * scratch space.
+ */
+#define VCCERT_ERROR_BUILDER_SIGN_BATCH_OUT_OF_MEMORY 0x3147
+
+/**
+ * \brief At least one certificate in a batch passed to
+ * vccert_builder_sign_batch() could not be signed.  Consult the per-context
+ * status array for details.
+ */
+#define VCCERT_ERROR_BUILDER_SIGN_BATCH_FAILED 0x3148
+
+/**
+ * \brief An invalid argument was passed to vccert_thread_pool_init().
+ */
+#define VCCERT_ERROR_THREAD_POOL_INIT_INVALID_ARG 0x3150
+
+/**
+ * \brief vccert_thread_pool_init() could not allocate the thread pool.
+ */
+#define VCCERT_ERROR_THREAD_POOL_INIT_OUT_OF_MEMORY 0x3151
+
+/**
+ * \brief vccert_thread_pool_init() could not start a worker thread.
+ */
+#define VCCERT_ERROR_THREAD_POOL_INIT_THREAD_CREATE 0x3152
+
+/**
+ * \brief An invalid argument was passed to vccert_thread_pool_run().
+ */
+#define VCCERT_ERROR_THREAD_POOL_RUN_INVALID_ARG 0x3154
+
+/**
+ * \brief An invalid argument was passed to vccert_parser_tuple_init().
+ */
+#define VCCERT_ERROR_PARSER_TUPLE_INIT_INVALID_ARG 0x3158
+
+/**
+ * \brief The tuple passed to vccert_parser_tuple_init() does not lie within the
+ * parent certificate.
+ */
+#define VCCERT_ERROR_PARSER_TUPLE_INIT_OUT_OF_BOUNDS 0x3159
+
+/**
+ * \brief An invalid argument was passed to vccert_block_view_init().
+ */
+#define VCCERT_ERROR_BLOCK_VIEW_INIT_INVALID_ARG 0x3160
+
+/**
+ * \brief vccert_block_view_init() could not allocate the transaction offset
+ * table.
+ */
+#define VCCERT_ERROR_BLOCK_VIEW_INIT_OUT_OF_MEMORY 0x3161
+
+/**
+ * \brief vccert_block_view_init() encountered a field with an invalid size in
+ * the block certificate.
+ */
+#define VCCERT_ERROR_BLOCK_VIEW_INIT_INVALID_FIELD_SIZE 0x3162
+
+/**
+ * \brief An invalid argument was passed to a block view transaction accessor.
+ */
+#define VCCERT_ERROR_BLOCK_TXN_INVALID_ARG 0x3164
+
+/**
+ * \brief The transaction index passed to a block view transaction accessor is
+ * past the end of the block.
+ */
+#define VCCERT_ERROR_BLOCK_TXN_OUT_OF_RANGE 0x3165
+
+/**
+ * \brief A bounded work queue could not be allocated.
+ */
+#define VCCERT_ERROR_THREAD_POOL_QUEUE_INIT_OUT_OF_MEMORY 0x3155
+
+/**
+ * \brief An invalid argument was passed to vccert_block_validate().
+ */
+#define VCCERT_ERROR_BLOCK_VALIDATE_INVALID_ARG 0x3168
+
+/**
+ * \brief vccert_block_validate() could not allocate its pipeline state.
+ */
+#define VCCERT_ERROR_BLOCK_VALIDATE_OUT_OF_MEMORY 0x3169
+
+/**
+ * \brief A wrapped transaction lies outside of the signed portion of the block
+ * certificate.
+ */
+#define VCCERT_ERROR_BLOCK_VALIDATE_UNSIGNED_TXN 0x316A
+
+/**
+ * \brief An invalid argument was passed to vccert_block_execute_contracts().
+ */
+#define VCCERT_ERROR_BLOCK_EXECUTE_CONTRACTS_INVALID_ARG 0x316C
+
+/**
+ * \brief vccert_block_execute_contracts() could not allocate its partition
+ * table.
+ */
+#define VCCERT_ERROR_BLOCK_EXECUTE_CONTRACTS_OUT_OF_MEMORY 0x316D
+
+/**
+ * \brief An invalid argument was passed to vccert_block_execute_speculative().
+ */
+#define VCCERT_ERROR_BLOCK_EXECUTE_SPECULATIVE_INVALID_ARG 0x3170
+
+/**
+ * \brief vccert_block_execute_speculative() could not allocate its version
+ * table or read sets.
+ */
+#define VCCERT_ERROR_BLOCK_EXECUTE_SPECULATIVE_OUT_OF_MEMORY 0x3171
+
+/**
+ * \brief An invalid argument was passed to vccert_artifact_state_table_init().
+ */
+#define VCCERT_ERROR_ARTIFACT_STATE_TABLE_INIT_INVALID_ARG 0x3174
+
+/**
+ * \brief vccert_artifact_state_table_init() could not allocate the table.
+ */
+#define VCCERT_ERROR_ARTIFACT_STATE_TABLE_INIT_OUT_OF_MEMORY 0x3175
+
+/**
+ * \brief An invalid argument was passed to vccert_artifact_state_table_apply().
+ */
+#define VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_INVALID_ARG 0x3176
+
+/**
+ * \brief The certificate passed to vccert_artifact_state_table_apply() lacks an
+ * artifact id, new artifact state, or certificate id.
+ */
+#define VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_MISSING_FIELD 0x3177
+
+/**
+ * \brief A certificate was applied to an artifact state table at a lower height
+ * than one already applied.
+ */
+#define VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_HEIGHT_OUT_OF_ORDER 0x3178
+
+/**
+ * \brief vccert_artifact_state_table_apply() could not grow the table.
+ */
+#define VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_OUT_OF_MEMORY 0x3179
+
+/**
+ * \brief An invalid argument was passed to
+ * vccert_artifact_state_snapshot_find().
+ */
+#define VCCERT_ERROR_ARTIFACT_STATE_SNAPSHOT_FIND_INVALID_ARG 0x317A
+
+/**
+ * \brief The artifact had no state as of the snapshot's height.
+ */
+#define VCCERT_ERROR_ARTIFACT_STATE_SNAPSHOT_FIND_NOT_FOUND 0x317B
+
+/**
+ * \brief An invalid argument was passed to vccert_keyring_init().
+ */
+#define VCCERT_ERROR_KEYRING_INIT_INVALID_ARG 0x3180
+
+/**
+ * \brief vccert_keyring_init() could not allocate the keyring.
+ */
+#define VCCERT_ERROR_KEYRING_INIT_OUT_OF_MEMORY 0x3181
+
+/**
+ * \brief An invalid argument was passed to vccert_keyring_add().
+ */
+#define VCCERT_ERROR_KEYRING_ADD_INVALID_ARG 0x3182
+
+/**
+ * \brief The certificate passed to vccert_keyring_add() is not a public entity
+ * certificate.
+ */
+#define VCCERT_ERROR_KEYRING_ADD_WRONG_CERTIFICATE_TYPE 0x3183
+
+/**
+ * \brief The certificate passed to vccert_keyring_add() lacks an artifact id or
+ * a public key.
+ */
+#define VCCERT_ERROR_KEYRING_ADD_MISSING_FIELD 0x3184
+
+/**
+ * \brief An entity certificate was added to a keyring at a lower height than an
+ * earlier certificate for the same entity.
+ */
+#define VCCERT_ERROR_KEYRING_ADD_HEIGHT_OUT_OF_ORDER 0x3185
+
+/**
+ * \brief vccert_keyring_add() could not grow the keyring.
+ */
+#define VCCERT_ERROR_KEYRING_ADD_OUT_OF_MEMORY 0x3186
+
+/**
+ * \brief An invalid argument was passed to vccert_keyring_find().
+ */
+#define VCCERT_ERROR_KEYRING_FIND_INVALID_ARG 0x3187
+
+/**
+ * \brief The entity had no keys as of the requested height.
+ */
+#define VCCERT_ERROR_KEYRING_FIND_NOT_FOUND 0x3188
+
+/**
+ * \brief An output buffer passed to vccert_keyring_find() does not match the
+ * size of the stored key.
+ */
+#define VCCERT_ERROR_KEYRING_FIND_KEY_SIZE 0x3189
+
+/**
+ * \brief An invalid argument was passed to vccert_keydir_write().
+ */
+#define VCCERT_ERROR_KEYDIR_WRITE_INVALID_ARG 0x3190
+
+/**
+ * \brief The buffer passed to vccert_keydir_write() is too small for the key
+ * directory.
+ */
+#define VCCERT_ERROR_KEYDIR_WRITE_BUFFER_TOO_SMALL 0x3191
+
+/**
+ * \brief The keys in the keyring passed to vccert_keydir_write() do not all
+ * have the same size.
+ */
+#define VCCERT_ERROR_KEYDIR_WRITE_KEY_SIZE_MISMATCH 0x3192
+
+/**
+ * \brief vccert_keydir_write() could not allocate its sort index.
+ */
+#define VCCERT_ERROR_KEYDIR_WRITE_OUT_OF_MEMORY 0x3193
+
+/**
+ * \brief An invalid argument was passed to vccert_keydir_init().
+ */
+#define VCCERT_ERROR_KEYDIR_INIT_INVALID_ARG 0x3194
+
+/**
+ * \brief The key directory passed to vccert_keydir_init() has a bad magic
+ * number, version, or record size.
+ */
+#define VCCERT_ERROR_KEYDIR_INIT_BAD_HEADER 0x3195
+
+/**
+ * \brief The key directory passed to vccert_keydir_init() is shorter than its
+ * header says.
+ */
+#define VCCERT_ERROR_KEYDIR_INIT_TRUNCATED 0x3196
+
+/**
+ * \brief An invalid argument was passed to vccert_keydir_find().
+ */
+#define VCCERT_ERROR_KEYDIR_FIND_INVALID_ARG 0x3197
+
+/**
+ * \brief The entity had no keys in the key directory as of the requested
+ * height.
+ */
+#define VCCERT_ERROR_KEYDIR_FIND_NOT_FOUND 0x3198
+
+/**
+ * \brief An output buffer passed to vccert_keydir_find() does not match the
+ * size of the stored key.
+ */
+#define VCCERT_ERROR_KEYDIR_FIND_KEY_SIZE 0x3199
+
+/**
+ * \brief an invalid argument was passed to vccert_store_init.
+ */
+#define VCCERT_ERROR_STORE_INIT_INVALID_ARG 0x31A0
+
+/**
+ * \brief the certificate store offset index could not be allocated.
+ */
+#define VCCERT_ERROR_STORE_INIT_OUT_OF_MEMORY 0x31A1
+
+/**
+ * \brief a certificate frame runs past the end of the certificate store.
+ */
+#define VCCERT_ERROR_STORE_INIT_TRUNCATED 0x31A2
+
+/**
+ * \brief the offset index does not belong to this certificate store.
+ */
+#define VCCERT_ERROR_STORE_INIT_BAD_INDEX 0x31A3
+
+/**
+ * \brief an invalid argument was passed to vccert_store_open.
+ */
+#define VCCERT_ERROR_STORE_OPEN_INVALID_ARG 0x31A4
+
+/**
+ * \brief certificate store files cannot be mapped on this platform.
+ */
+#define VCCERT_ERROR_STORE_OPEN_UNSUPPORTED 0x31A5
+
+/**
+ * \brief a certificate store file could not be opened or mapped.
+ */
+#define VCCERT_ERROR_STORE_OPEN_FAILED 0x31A6
+
+/**
+ * \brief an invalid argument was passed to vccert_store_at.
+ */
+#define VCCERT_ERROR_STORE_AT_INVALID_ARG 0x31A7
+
+/**
+ * \brief the certificate index is past the end of the certificate store.
+ */
+#define VCCERT_ERROR_STORE_AT_OUT_OF_RANGE 0x31A8
+
+/**
+ * \brief the offset index points to a frame outside of the certificate store.
+ */
+#define VCCERT_ERROR_STORE_AT_BAD_FRAME 0x31A9
+
+/**
+ * \brief an invalid argument was passed to vccert_store_index_write.
+ */
+#define VCCERT_ERROR_STORE_INDEX_WRITE_INVALID_ARG 0x31AA
+
+/**
+ * \brief the buffer is too small to hold the offset index.
+ */
+#define VCCERT_ERROR_STORE_INDEX_WRITE_BUFFER_TOO_SMALL 0x31AB
+
+/**
+ * \brief an invalid argument was passed to vccert_store_for_each.
+ */
+#define VCCERT_ERROR_STORE_FOR_EACH_INVALID_ARG 0x31AC
+
+/**
+ * \brief the partition table for vccert_store_for_each could not be allocated.
+ */
+#define VCCERT_ERROR_STORE_FOR_EACH_OUT_OF_MEMORY 0x31AD
+
+/**
+ * \brief an invalid argument was passed to vccert_log_writer_init.
+ */
+#define VCCERT_ERROR_LOG_WRITER_INIT_INVALID_ARG 0x31B0
+
+/**
+ * \brief the log writer buffers could not be allocated.
+ */
+#define VCCERT_ERROR_LOG_WRITER_INIT_OUT_OF_MEMORY 0x31B1
+
+/**
+ * \brief an invalid argument was passed to vccert_log_writer_open.
+ */
+#define VCCERT_ERROR_LOG_WRITER_OPEN_INVALID_ARG 0x31B2
+
+/**
+ * \brief log segment files cannot be written on this platform.
+ */
+#define VCCERT_ERROR_LOG_WRITER_OPEN_UNSUPPORTED 0x31B3
+
+/**
+ * \brief the log segment file could not be created.
+ */
+#define VCCERT_ERROR_LOG_WRITER_OPEN_FAILED 0x31B4
+
+/**
+ * \brief a log segment file could not be written or synced.
+ */
+#define VCCERT_ERROR_LOG_WRITER_IO 0x31B5
+
+/**
+ * \brief an invalid argument was passed to vccert_log_writer_append.
+ */
+#define VCCERT_ERROR_LOG_WRITER_APPEND_INVALID_ARG 0x31B6
+
+/**
+ * \brief the log writer buffers could not be grown.
+ */
+#define VCCERT_ERROR_LOG_WRITER_APPEND_OUT_OF_MEMORY 0x31B7
+
+/**
+ * \brief the certificate is too large to frame in a log segment.
+ */
+#define VCCERT_ERROR_LOG_WRITER_APPEND_TOO_LARGE 0x31B8
+
+/**
+ * \brief the log segment has already been finished.
+ */
+#define VCCERT_ERROR_LOG_WRITER_FINISHED 0x31B9
+
+/**
+ * \brief an invalid argument was passed to vccert_log_writer_commit.
+ */
+#define VCCERT_ERROR_LOG_WRITER_COMMIT_INVALID_ARG 0x31BA
+
+/**
+ * \brief an invalid argument was passed to vccert_log_writer_finish.
+ */
+#define VCCERT_ERROR_LOG_WRITER_FINISH_INVALID_ARG 0x31BB
+
+/**
+ * \brief the log segment footer could not be allocated.
+ */
+#define VCCERT_ERROR_LOG_WRITER_FINISH_OUT_OF_MEMORY 0x31BC
+
+/**
+ * \brief an invalid argument was passed to vccert_log_segment_init.
+ */
+#define VCCERT_ERROR_LOG_SEGMENT_INIT_INVALID_ARG 0x31BD
+
+/**
+ * \brief the log segment footer is missing or damaged.
+ */
+#define VCCERT_ERROR_LOG_SEGMENT_INIT_BAD_FOOTER 0x31BE
+
+/**
+ * \brief an invalid argument was passed to vccert_log_segment_at.
+ */
+#define VCCERT_ERROR_LOG_SEGMENT_AT_INVALID_ARG 0x31BF
+
+/**
+ * \brief the certificate index is past the end of the log segment.
+ */
+#define VCCERT_ERROR_LOG_SEGMENT_AT_OUT_OF_RANGE 0x31C0
+
+/**
+ * \brief the certificate frame is damaged or fails its checksum.
+ */
+#define VCCERT_ERROR_LOG_SEGMENT_AT_BAD_FRAME 0x31C1
+
+/**
+ * \brief an invalid argument was passed to vccert_log_segment_find.
+ */
+#define VCCERT_ERROR_LOG_SEGMENT_FIND_INVALID_ARG 0x31C2
+
+/**
+ * \brief no certificate in the log segment has this certificate id.
+ */
+#define VCCERT_ERROR_LOG_SEGMENT_FIND_NOT_FOUND 0x31C3
+
+/**
+ * \brief an invalid argument was passed to vccert_id_index_init.
+ */
+#define VCCERT_ERROR_ID_INDEX_INIT_INVALID_ARG 0x31D0
+
+/**
+ * \brief the id index tables could not be allocated.
+ */
+#define VCCERT_ERROR_ID_INDEX_INIT_OUT_OF_MEMORY 0x31D1
+
+/**
+ * \brief an invalid argument was passed to vccert_id_index_add.
+ */
+#define VCCERT_ERROR_ID_INDEX_ADD_INVALID_ARG 0x31D2
+
+/**
+ * \brief the id index tables could not be grown.
+ */
+#define VCCERT_ERROR_ID_INDEX_ADD_OUT_OF_MEMORY 0x31D3
+
+/**
+ * \brief a loaded id index cannot be added to.
+ */
+#define VCCERT_ERROR_ID_INDEX_ADD_READ_ONLY 0x31D4
+
+/**
+ * \brief a certificate with this certificate id is already indexed.
+ */
+#define VCCERT_ERROR_ID_INDEX_ADD_DUPLICATE 0x31D5
+
+/**
+ * \brief the certificate fields could not be parsed.
+ */
+#define VCCERT_ERROR_ID_INDEX_ADD_BAD_CERTIFICATE 0x31D6
+
+/**
+ * \brief an invalid argument was passed to vccert_id_index_load.
+ */
+#define VCCERT_ERROR_ID_INDEX_LOAD_INVALID_ARG 0x31D7
+
+/**
+ * \brief the id index header is damaged or does not match its size.
+ */
+#define VCCERT_ERROR_ID_INDEX_LOAD_BAD_HEADER 0x31D8
+
+/**
+ * \brief an invalid argument was passed to vccert_id_index_write.
+ */
+#define VCCERT_ERROR_ID_INDEX_WRITE_INVALID_ARG 0x31D9
+
+/**
+ * \brief the buffer is too small to hold the id index.
+ */
+#define VCCERT_ERROR_ID_INDEX_WRITE_BUFFER_TOO_SMALL 0x31DA
+
+/**
+ * \brief an invalid argument was passed to an id index find method.
+ */
+#define VCCERT_ERROR_ID_INDEX_FIND_INVALID_ARG 0x31DB
+
+/**
+ * \brief the id is not in the id index.
+ */
+#define VCCERT_ERROR_ID_INDEX_FIND_NOT_FOUND 0x31DC
+
+/**
+ * \brief a loaded id index has a damaged certificate list.
+ */
+#define VCCERT_ERROR_ID_INDEX_FIND_BAD_ENTRY 0x31DD
+
+/**
+ * \brief An invalid argument was passed to vccert_block_filter_write().
+ */
+#define VCCERT_ERROR_BLOCK_FILTER_WRITE_INVALID_ARG 0x31E0
+
+/**
+ * \brief The buffer passed to vccert_block_filter_write() is too small for the
+ * filter.
+ */
+#define VCCERT_ERROR_BLOCK_FILTER_WRITE_BUFFER_TOO_SMALL 0x31E1
+
+/**
+ * \brief vccert_block_filter_write() found a wrapped transaction whose fields
+ * could not be walked.
+ */
+#define VCCERT_ERROR_BLOCK_FILTER_WRITE_BAD_TXN 0x31E2
+
+/**
+ * \brief An invalid argument was passed to vccert_columns_extract() or
+ * vccert_columns_extract_store().
+ */
+#define VCCERT_ERROR_COLUMNS_EXTRACT_INVALID_ARG 0x31E4
+
+/**
+ * \brief A certificate passed to vccert_columns_extract() or
+ * vccert_columns_extract_store() could not be walked.
+ */
+#define VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE 0x31E5
+
+/**
+ * \brief An invalid argument was passed to vccert_filter_init().
+ */
+#define VCCERT_ERROR_FILTER_INIT_INVALID_ARG 0x31E8
+
+/**
+ * \brief vccert_filter_init() could not allocate its scratch columns.
+ */
+#define VCCERT_ERROR_FILTER_INIT_OUT_OF_MEMORY 0x31E9
+
+/**
+ * \brief A predicate passed to vccert_filter_init() has an unknown operation, a
+ * type that is not fixed-width, or an empty range.
+ */
+#define VCCERT_ERROR_FILTER_INIT_BAD_PREDICATE 0x31EA
+
+/**
+ * \brief An invalid argument was passed to vccert_filter_run().
+ */
+#define VCCERT_ERROR_FILTER_RUN_INVALID_ARG 0x31EC
+
+/**
+ * \brief An invalid argument was passed to vccert_filter_count_by().
+ */
+#define VCCERT_ERROR_FILTER_COUNT_BY_INVALID_ARG 0x31ED
+
+/**
+ * \brief vccert_filter_count_by() could not allocate its group table.
+ */
+#define VCCERT_ERROR_FILTER_COUNT_BY_OUT_OF_MEMORY 0x31EE
+
+/**
+ * \brief vccert_filter_count_by() found more groups than the caller has room
+ * for.
+ */
+#define VCCERT_ERROR_FILTER_COUNT_BY_TOO_MANY_GROUPS 0x31EF
+
+/**
+ * \brief vccert_filter_count_by() found a group field larger than
+ * VCCERT_FILTER_MAX_KEY_SIZE.
+ */
+#define VCCERT_ERROR_FILTER_COUNT_BY_KEY_TOO_LARGE 0x31F0
+
+/**
+ * \brief An invalid argument was passed to vccert_parser_validate_batch().
+ */
+#define VCCERT_ERROR_PARSER_VALIDATE_BATCH_INVALID_ARG 0x31F4
+
+/**
+ * \brief At least one certificate passed to vccert_parser_validate_batch() is
+ * malformed.
+ */
+#define VCCERT_ERROR_PARSER_VALIDATE_BATCH_MALFORMED 0x31F5
+
+/**
+ * \brief An invalid argument was passed to vccert_layout_cache_init().
+ */
+#define VCCERT_ERROR_LAYOUT_CACHE_INIT_INVALID_ARG 0x31F8
+
+/**
+ * \brief vccert_layout_cache_init() could not allocate its layout table.
+ */
+#define VCCERT_ERROR_LAYOUT_CACHE_INIT_OUT_OF_MEMORY 0x31F9
+
+/**
+ * \brief An invalid argument was passed to vccert_layout_cache_lookup().
+ */
+#define VCCERT_ERROR_LAYOUT_CACHE_LOOKUP_INVALID_ARG 0x31FA
+
+/**
+ * \brief The signed field index in this certificate is malformed, or does not
+ * match the fields in the certificate.
+ */
+#define VCCERT_ERROR_PARSER_ATTEST_BAD_FIELD_INDEX 0x3200
+
+/**
+ * \brief An invalid argument was passed to vccert_decoded_init().
+ */
+#define VCCERT_ERROR_DECODED_INIT_INVALID_ARG 0x3204
+
+/**
+ * \brief The overflow table for a decoded certificate could not be allocated.
+ */
+#define VCCERT_ERROR_DECODED_INIT_OUT_OF_MEMORY 0x3205
+
+/**
+ * \brief The certificate is malformed, or a known field in it does not have the
+ * size its type requires.
+ */
+#define VCCERT_ERROR_DECODED_INIT_INVALID_FIELD_SIZE 0x3206
+
+/**
+ * \brief An invalid argument was passed to a vccert_parser_get_*() accessor.
+ */
+#define VCCERT_ERROR_PARSER_GET_INVALID_ARG 0x3208
+
+/**
+ * \brief The field found by a vccert_parser_get_*() accessor does not have the
+ * size of the requested type.
+ */
+#define VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE 0x3209
+
 /**
  * @}
  */
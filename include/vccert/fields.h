@@ -229,9 +229,17 @@ typedef enum vccert_field_type
      * Crypto Suite Dependent Length and Content.
      */
     VCCERT_FIELD_TYPE_PRIVATE_SIGNING_KEY = 0x0055,
+    /**
+     * \brief Field Index.
+     *
+     * Sequence of 6-byte records, each a 16-bit field type followed by the
+     * 32-bit offset of that field's header, sorted by type and then offset.
+     * Written by vccert_builder_add_field_index() just before the signer ID,
+     * so that it is covered by the signature.
+     */
+    VCCERT_FIELD_TYPE_FIELD_INDEX = 0x0056,
 
     /* reserved fields */
-    VCCERT_FIELD_TYPE_VELO_RESERVED_0056 = 0x0056,
     VCCERT_FIELD_TYPE_VELO_RESERVED_0057 = 0x0057,
     VCCERT_FIELD_TYPE_VELO_RESERVED_0058 = 0x0058,
     VCCERT_FIELD_TYPE_VELO_RESERVED_0059 = 0x0059,
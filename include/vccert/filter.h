@@ -0,0 +1,290 @@
+/**
+ * \file filter.h
+ *
+ * \brief A small query engine that selects certificates from a batch by
+ * predicates over their short fields, and counts the selected certificates
+ * by the value of a field.
+ *
+ * A filter is compiled once from a list of predicates, all of which must
+ * hold for a certificate to be selected.  Running the filter extracts the
+ * fields it needs from a chunk of certificates into columns with
+ * vccert_columns_extract(), then tests each predicate against a whole column
+ * at a time, using SIMD comparisons where the platform has them, to build a
+ * selection bitmap.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_FILTER_HEADER_GUARD
+#define VCCERT_FILTER_HEADER_GUARD
+
+#include <stdint.h>
+#include <vccert/columns.h>
+#include <vccert/schema.h>
+#include <vccert/thread_pool.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The largest number of predicates in one filter.
+ */
+#define VCCERT_FILTER_MAX_PREDICATES 32
+
+/**
+ * \brief The largest group field value counted by vccert_filter_count_by().
+ */
+#define VCCERT_FILTER_MAX_KEY_SIZE 16
+
+/**
+ * \brief The number of certificates extracted and tested at a time.
+ */
+#define VCCERT_FILTER_CHUNK_ROWS 4096
+
+/**
+ * \brief Filter predicate operations.
+ */
+typedef enum vccert_filter_op
+{
+    /**
+     * \brief The field value is exactly the given bytes, such as a
+     * certificate type, transaction type or artifact type UUID, or an
+     * artifact state.
+     */
+    VCCERT_FILTER_OP_EQUAL,
+
+    /**
+     * \brief The field is an integer of the predicate's type, between the
+     * predicate's min and max inclusive, such as a validity date or block
+     * height.  For signed types, min and max hold int64_t values.
+     */
+    VCCERT_FILTER_OP_RANGE,
+
+} vccert_filter_op_t;
+
+/**
+ * \brief A predicate over one short field.  A certificate without the field,
+ * or whose field has the wrong size for the type, never matches.
+ */
+typedef struct vccert_filter_predicate
+{
+    /**
+     * \brief The short field id.
+     */
+    uint16_t field;
+
+    /**
+     * \brief The operation.
+     */
+    vccert_filter_op_t op;
+
+    /**
+     * \brief For \ref VCCERT_FILTER_OP_RANGE, a fixed-width integer, boolean,
+     * byte or date schema type.
+     */
+    vccert_schema_type_t type;
+
+    /**
+     * \brief For \ref VCCERT_FILTER_OP_RANGE, the smallest matching value.
+     */
+    uint64_t min;
+
+    /**
+     * \brief For \ref VCCERT_FILTER_OP_RANGE, the largest matching value.
+     */
+    uint64_t max;
+
+    /**
+     * \brief For \ref VCCERT_FILTER_OP_EQUAL, the value to match.  This is
+     * borrowed and must outlive the filter.
+     */
+    const uint8_t* value;
+
+    /**
+     * \brief For \ref VCCERT_FILTER_OP_EQUAL, the size of the value.
+     */
+    size_t value_size;
+
+} vccert_filter_predicate_t;
+
+/**
+ * \brief The count of selected certificates sharing one group field value.
+ */
+typedef struct vccert_filter_group
+{
+    /**
+     * \brief The group field value.
+     */
+    uint8_t key[VCCERT_FILTER_MAX_KEY_SIZE];
+
+    /**
+     * \brief The size of the group field value, or 0 for the certificates
+     * without the field.
+     */
+    size_t key_size;
+
+    /**
+     * \brief The number of selected certificates in this group.
+     */
+    uint64_t count;
+
+} vccert_filter_group_t;
+
+/**
+ * \brief A compiled filter.  A filter holds scratch columns, so it must only
+ * be run by one thread at a time; the thread pool it is run with spreads the
+ * field extraction across workers.
+ */
+typedef struct vccert_filter
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator options used for the scratch columns.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief The predicates.
+     */
+    vccert_filter_predicate_t predicates[VCCERT_FILTER_MAX_PREDICATES];
+
+    /**
+     * \brief The number of predicates.
+     */
+    size_t predicate_count;
+
+    /**
+     * \brief One column per predicate, followed by the group column.
+     */
+    vccert_column_t columns[VCCERT_FILTER_MAX_PREDICATES + 1];
+
+    /**
+     * \brief The missing bitmap of each row in a chunk.
+     */
+    uint64_t* missing;
+
+    /**
+     * \brief The range keys of a chunk.
+     */
+    uint64_t* keys;
+
+    /**
+     * \brief The storage behind the scratch columns.
+     */
+    void* scratch;
+
+} vccert_filter_t;
+
+/**
+ * \brief Compile a filter from a list of predicates, all of which must hold.
+ *
+ * This filter is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().
+ *
+ * \param filter            The filter to initialize.
+ * \param alloc_opts        The allocator options to use.
+ * \param predicates        The predicates.
+ * \param predicate_count   The number of predicates, at most \ref
+ *                          VCCERT_FILTER_MAX_PREDICATES.  With none, every
+ *                          certificate is selected.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_FILTER_INIT_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_FILTER_INIT_BAD_PREDICATE if a predicate is
+ *        invalid.
+ *      - \ref VCCERT_ERROR_FILTER_INIT_OUT_OF_MEMORY if the scratch columns
+ *        could not be allocated.
+ */
+int vccert_filter_init(
+    vccert_filter_t* filter, allocator_options_t* alloc_opts,
+    const vccert_filter_predicate_t* predicates, size_t predicate_count);
+
+/**
+ * \brief Select the certificates in a batch that match a filter.
+ *
+ * A certificate that cannot be walked is never selected, and is reported as
+ * in vccert_columns_extract(); the rest of the batch is still filtered.
+ *
+ * \param filter            The filter.
+ * \param certs             The certificates.
+ * \param sizes             The size of each certificate.
+ * \param rows              The number of certificates.
+ * \param pool              The thread pool to extract fields with, or NULL.
+ * \param selected          Optional array of (rows + 63) / 64 words to
+ *                          receive a bitmap, with bit (n % 64) of word
+ *                          (n / 64) set if certificate n was selected.
+ * \param matches           Pointer to receive the number of certificates
+ *                          selected.
+ * \param failed            Optional pointer to receive the first certificate
+ *                          that could not be walked, or \ref
+ *                          VCCERT_COLUMNS_NO_ROW.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_FILTER_RUN_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE if a certificate
+ *        could not be walked.
+ */
+int vccert_filter_run(
+    vccert_filter_t* filter, const uint8_t* const* certs,
+    const size_t* sizes, size_t rows, vccert_thread_pool_t* pool,
+    uint64_t* selected, size_t* matches, size_t* failed);
+
+/**
+ * \brief Count the certificates in a batch that match a filter, grouped by
+ * the value of a short field.
+ *
+ * Groups are reported in the order that their first certificate appears in
+ * the batch.  Selected certificates without the group field are counted in a
+ * group with an empty key.
+ *
+ * \param filter            The filter.
+ * \param certs             The certificates.
+ * \param sizes             The size of each certificate.
+ * \param rows              The number of certificates.
+ * \param pool              The thread pool to extract fields with, or NULL.
+ * \param group_field       The short field id to group by.
+ * \param groups            Array to receive the groups.
+ * \param capacity          The number of entries in groups.
+ * \param group_count       Pointer to receive the number of groups.
+ * \param failed            Optional pointer to receive the first certificate
+ *                          that could not be walked, or \ref
+ *                          VCCERT_COLUMNS_NO_ROW.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_FILTER_COUNT_BY_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_FILTER_COUNT_BY_OUT_OF_MEMORY if the group table
+ *        could not be allocated.
+ *      - \ref VCCERT_ERROR_FILTER_COUNT_BY_TOO_MANY_GROUPS if there are more
+ *        than capacity groups.
+ *      - \ref VCCERT_ERROR_FILTER_COUNT_BY_KEY_TOO_LARGE if a selected
+ *        certificate's group field is larger than \ref
+ *        VCCERT_FILTER_MAX_KEY_SIZE.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE if a certificate
+ *        could not be walked.
+ */
+int vccert_filter_count_by(
+    vccert_filter_t* filter, const uint8_t* const* certs,
+    const size_t* sizes, size_t rows, vccert_thread_pool_t* pool,
+    uint16_t group_field, vccert_filter_group_t* groups, size_t capacity,
+    size_t* group_count, size_t* failed);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_FILTER_HEADER_GUARD
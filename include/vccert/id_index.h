@@ -0,0 +1,297 @@
+/**
+ * \file id_index.h
+ *
+ * \brief The id index maps certificate ids, previous certificate ids and
+ * artifact ids to positions in a certificate store, so that the history of an
+ * artifact can be walked without scanning the store.
+ *
+ * The index is kept as open-addressed hash tables in the same byte layout that
+ * vccert_id_index_write() saves, so a saved index can be loaded and probed in
+ * place.  All integers are big endian.
+ *
+ * | Offset | Size | Header field                                |
+ * |--------|------|---------------------------------------------|
+ * | 0      | 4    | magic, "VCII"                               |
+ * | 4      | 4    | reserved, 0                                 |
+ * | 8      | 8    | certificate table slots, a power of two     |
+ * | 16     | 8    | successor table slots, a power of two       |
+ * | 24     | 8    | artifact table slots, a power of two        |
+ * | 32     | 8    | certificate table entries in use            |
+ * | 40     | 8    | successor table entries in use              |
+ * | 48     | 8    | artifact table entries in use               |
+ * | 56     | 8    | history entries                             |
+ *
+ * The header is followed by the certificate table, the successor table, the
+ * artifact table and the history entries.  Certificate and successor slots
+ * hold a 16-byte id and the position plus one, or zero if the slot is empty.
+ * Artifact slots hold a 16-byte id, the first history entry plus one, the last
+ * history entry, and the number of entries.  History entries hold a position
+ * and the next entry of the same artifact plus one, or zero.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_ID_INDEX_HEADER_GUARD
+#define VCCERT_ID_INDEX_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <vccert/store.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The size of the id index header.
+ */
+#define VCCERT_ID_INDEX_HEADER_SIZE 64
+
+/**
+ * \brief An open-addressed hash table of fixed-size slots.
+ */
+typedef struct vccert_id_table
+{
+    /**
+     * \brief The slots.
+     */
+    uint8_t* slots;
+
+    /**
+     * \brief The number of slots, minus one.  Always a power of two, minus
+     * one.
+     */
+    size_t mask;
+
+    /**
+     * \brief The number of slots in use.
+     */
+    size_t count;
+
+} vccert_id_table_t;
+
+/**
+ * \brief An index of the certificates in a store by id.
+ *
+ * The index must not be updated while it is being read; concurrent lookups
+ * are safe.
+ */
+typedef struct vccert_id_index
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator used for the tables, or NULL for a loaded index.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief Certificate id to position.
+     */
+    vccert_id_table_t certificates;
+
+    /**
+     * \brief Previous certificate id to the position of the certificate that
+     * follows it.
+     */
+    vccert_id_table_t successors;
+
+    /**
+     * \brief Artifact id to the history of the artifact.
+     */
+    vccert_id_table_t artifacts;
+
+    /**
+     * \brief The history entries, in the order they were added.
+     */
+    uint8_t* entries;
+
+    /**
+     * \brief The number of history entries.
+     */
+    size_t entry_count;
+
+    /**
+     * \brief The number of history entries allocated.
+     */
+    size_t entry_capacity;
+
+} vccert_id_index_t;
+
+/**
+ * \brief Initialize an empty id index.
+ *
+ * The index is owned by the caller and must be disposed by calling dispose()
+ * when no longer needed.
+ *
+ * \param index             The index to initialize.
+ * \param alloc_opts        The allocator to use for this index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_INIT_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_ID_INDEX_INIT_OUT_OF_MEMORY if the tables could not
+ *        be allocated.
+ */
+int vccert_id_index_init(
+    vccert_id_index_t* index, allocator_options_t* alloc_opts);
+
+/**
+ * \brief Load an id index saved by vccert_id_index_write().
+ *
+ * The saved bytes are probed in place, so they must outlive the index, and
+ * the index cannot be added to.  The index must be disposed by calling
+ * dispose() when no longer needed.
+ *
+ * \param index             The index to initialize.
+ * \param data              The saved index, for example a memory mapping.
+ * \param size              The size of the saved index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_LOAD_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_ID_INDEX_LOAD_BAD_HEADER if the header is damaged or
+ *        does not match the size.
+ */
+int vccert_id_index_load(
+    vccert_id_index_t* index, const void* data, size_t size);
+
+/**
+ * \brief Save an id index.
+ *
+ * Call this first with a NULL buffer to get the size of the saved index.
+ *
+ * \param index             The index to save.
+ * \param buffer            The buffer to receive the index, or NULL.
+ * \param size              The size of the buffer.
+ * \param required          Pointer to receive the size of the saved index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_WRITE_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_ID_INDEX_WRITE_BUFFER_TOO_SMALL if the buffer is too
+ *        small.
+ */
+int vccert_id_index_write(
+    const vccert_id_index_t* index, uint8_t* buffer, size_t size,
+    size_t* required);
+
+/**
+ * \brief Index a certificate appended to a store at the given position.
+ *
+ * The \ref VCCERT_FIELD_TYPE_CERTIFICATE_ID, \ref
+ * VCCERT_FIELD_TYPE_PREVIOUS_CERTIFICATE_ID and \ref
+ * VCCERT_FIELD_TYPE_ARTIFACT_ID of the certificate are indexed when present.
+ * Certificates of an artifact must be added in store order.
+ *
+ * \param index             The index to update.
+ * \param cert              The certificate.
+ * \param size              The size of the certificate.
+ * \param position          The position of the certificate in the store.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_ADD_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_ID_INDEX_ADD_READ_ONLY if the index was loaded.
+ *      - \ref VCCERT_ERROR_ID_INDEX_ADD_BAD_CERTIFICATE if the certificate
+ *        fields could not be parsed.
+ *      - \ref VCCERT_ERROR_ID_INDEX_ADD_DUPLICATE if a certificate with the
+ *        same certificate id was already added.
+ *      - \ref VCCERT_ERROR_ID_INDEX_ADD_OUT_OF_MEMORY if the tables could not
+ *        be grown.
+ */
+int vccert_id_index_add(
+    vccert_id_index_t* index, const uint8_t* cert, size_t size,
+    uint64_t position);
+
+/**
+ * \brief Index every certificate in a store.
+ *
+ * \param index             The index to update.
+ * \param store             The store to index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_ADD_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - a status code from vccert_store_at() or vccert_id_index_add().
+ */
+int vccert_id_index_add_store(
+    vccert_id_index_t* index, const vccert_store_t* store);
+
+/**
+ * \brief Find the position of a certificate by its certificate id.
+ *
+ * \param index             The index to search.
+ * \param certificate_id    The 128-bit certificate id to find.
+ * \param position          Pointer to receive the position.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_FIND_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_ID_INDEX_FIND_NOT_FOUND if the id is not indexed.
+ */
+int vccert_id_index_find_certificate(
+    const vccert_id_index_t* index, const uint8_t* certificate_id,
+    uint64_t* position);
+
+/**
+ * \brief Find the position of the certificate whose previous certificate id
+ * is the given certificate id.
+ *
+ * \param index             The index to search.
+ * \param certificate_id    The 128-bit certificate id whose successor to find.
+ * \param position          Pointer to receive the position.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_FIND_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_ID_INDEX_FIND_NOT_FOUND if no certificate follows
+ *        this one.
+ */
+int vccert_id_index_find_successor(
+    const vccert_id_index_t* index, const uint8_t* certificate_id,
+    uint64_t* position);
+
+/**
+ * \brief Get the positions of the certificates of an artifact, in the order
+ * they were added.
+ *
+ * \param index             The index to search.
+ * \param artifact_id       The 128-bit artifact id to find.
+ * \param positions         Array to receive up to capacity positions, or NULL.
+ * \param capacity          The number of entries in positions.
+ * \param count             Pointer to receive the number of certificates of
+ *                          the artifact, which may exceed capacity.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_FIND_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_ID_INDEX_FIND_NOT_FOUND if the artifact is not
+ *        indexed.
+ *      - \ref VCCERT_ERROR_ID_INDEX_FIND_BAD_ENTRY if a loaded index has a
+ *        damaged history.
+ */
+int vccert_id_index_find_artifact(
+    const vccert_id_index_t* index, const uint8_t* artifact_id,
+    uint64_t* positions, size_t capacity, size_t* count);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_ID_INDEX_HEADER_GUARD
@@ -0,0 +1,196 @@
+/**
+ * \file keydir.h
+ *
+ * \brief The key directory is a flat, sorted file of entity public keys that
+ * can be searched in place, for example through a memory mapping.
+ *
+ * A key directory starts with a 32-byte header, followed by fixed-size
+ * records sorted by entity id and then by height.  All integers are big
+ * endian.
+ *
+ * | Offset | Size | Header field                                |
+ * |--------|------|---------------------------------------------|
+ * | 0      | 4    | magic, "VCKD"                               |
+ * | 4      | 2    | format version, 1                           |
+ * | 6      | 2    | signing key size                            |
+ * | 8      | 2    | encryption key size                         |
+ * | 10     | 2    | reserved, 0                                 |
+ * | 12     | 4    | record size, 32 plus both key sizes         |
+ * | 16     | 8    | record count                                |
+ * | 24     | 8    | reserved, 0                                 |
+ *
+ * | Offset | Size | Record field                                |
+ * |--------|------|---------------------------------------------|
+ * | 0      | 16   | entity id                                   |
+ * | 16     | 8    | first height at which these keys are used   |
+ * | 24     | 8    | first height at which they are not, or ~0   |
+ * | 32     | n    | public signing key                          |
+ * | 32 + n | m    | public encryption key                       |
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_KEYDIR_HEADER_GUARD
+#define VCCERT_KEYDIR_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <vccert/keyring.h>
+#include <vccert/parser.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The size of the key directory header.
+ */
+#define VCCERT_KEYDIR_HEADER_SIZE 32
+
+/**
+ * \brief The size of a key directory record, not counting its keys.
+ */
+#define VCCERT_KEYDIR_RECORD_HEADER_SIZE 32
+
+/**
+ * \brief A read-only view of a key directory held in memory.
+ *
+ * The view borrows the key directory bytes, which must outlive it.  Lookups
+ * do not allocate and only copy keys into the caller's buffers, so a view
+ * may be searched from many threads at once.
+ */
+typedef struct vccert_keydir
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The first record.
+     */
+    const uint8_t* records;
+
+    /**
+     * \brief The number of records.
+     */
+    size_t count;
+
+    /**
+     * \brief The size of each record.
+     */
+    size_t record_size;
+
+    /**
+     * \brief The size of each public signing key.
+     */
+    size_t signing_key_size;
+
+    /**
+     * \brief The size of each public encryption key.
+     */
+    size_t encryption_key_size;
+
+} vccert_keydir_t;
+
+/**
+ * \brief Write the keys in a keyring as a key directory.
+ *
+ * Call this first with a NULL buffer to get the size of the key directory.
+ *
+ * \param keyring           The keyring to write.
+ * \param buffer            The buffer to receive the key directory, or NULL.
+ * \param size              The size of the buffer.
+ * \param required          Pointer to receive the size of the key directory.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_KEYDIR_WRITE_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_KEYDIR_WRITE_BUFFER_TOO_SMALL if the buffer is too
+ *        small.
+ *      - \ref VCCERT_ERROR_KEYDIR_WRITE_KEY_SIZE_MISMATCH if the keys in the
+ *        keyring do not all have the same size.
+ *      - \ref VCCERT_ERROR_KEYDIR_WRITE_OUT_OF_MEMORY if the sort index could
+ *        not be allocated.
+ */
+int vccert_keydir_write(
+    const vccert_keyring_t* keyring, uint8_t* buffer, size_t size,
+    size_t* required);
+
+/**
+ * \brief Initialize a view of a key directory.
+ *
+ * Only the header is checked; records are read as they are searched.
+ *
+ * \param keydir            The view to initialize.
+ * \param data              The key directory, for example a memory mapping.
+ * \param size              The size of the key directory.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_KEYDIR_INIT_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_KEYDIR_INIT_BAD_HEADER if the header is not that of
+ *        a key directory this library can read.
+ *      - \ref VCCERT_ERROR_KEYDIR_INIT_TRUNCATED if the records run past the
+ *        end of the data.
+ */
+int vccert_keydir_init(
+    vccert_keydir_t* keydir, const void* data, size_t size);
+
+/**
+ * \brief Find the public keys of an entity as of a block height.
+ *
+ * The entity is found by interpolation search on its id, then its records are
+ * binary searched by height.
+ *
+ * \param keydir            The key directory to search.
+ * \param entity_id         The 128-bit entity id to find.
+ * \param height            The block height at which the keys are needed.
+ * \param encryption_key    Optional buffer to receive the public encryption
+ *                          key.  Its size must match the stored key.
+ * \param signing_key       Optional buffer to receive the public signing key.
+ *                          Its size must match the stored key.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_KEYDIR_FIND_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_KEYDIR_FIND_NOT_FOUND if the entity had no keys as
+ *        of this height.
+ *      - \ref VCCERT_ERROR_KEYDIR_FIND_KEY_SIZE if an output buffer does not
+ *        match the size of the stored key.
+ */
+int vccert_keydir_find(
+    const vccert_keydir_t* keydir, const uint8_t* entity_id, uint64_t height,
+    vccrypt_buffer_t* encryption_key, vccrypt_buffer_t* signing_key);
+
+/**
+ * \brief An entity key resolver backed by a key directory.
+ *
+ * To use it, set the parser options' parser_options_entity_key_resolver to
+ * this function and its entity_key_context to a \ref vccert_keydir_t.
+ *
+ * \param options           The \ref vccert_parser_options_t for this parser.
+ * \param parser            The parser context.  Unused.
+ * \param height            The block height at which the keys are needed.
+ * \param entity_id         The 128-bit entity id to find.
+ * \param pubenckey_buffer  A buffer to receive the public encryption key.
+ * \param pubsignkey_buffer A buffer to receive the public signing key.
+ *
+ * \returns true if the entity was found and false if it was not.
+ */
+bool vccert_keydir_entity_key_resolver(
+    void* options, void* parser, uint64_t height,
+    const uint8_t* entity_id, vccrypt_buffer_t* pubenckey_buffer,
+    vccrypt_buffer_t* pubsignkey_buffer);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_KEYDIR_HEADER_GUARD
@@ -0,0 +1,216 @@
+/**
+ * \file keyring.h
+ *
+ * \brief The keyring holds the public keys of entities by block height, and
+ * provides an entity key resolver backed by those keys.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_KEYRING_HEADER_GUARD
+#define VCCERT_KEYRING_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <vccert/parser.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The public keys of an entity from a given block height on.
+ */
+typedef struct vccert_keyring_version
+{
+    /**
+     * \brief The block height from which these keys are used.
+     */
+    uint64_t height;
+
+    /**
+     * \brief The size of the public encryption key.
+     */
+    size_t encryption_key_size;
+
+    /**
+     * \brief The size of the public signing key.
+     */
+    size_t signing_key_size;
+
+    /**
+     * \brief The public encryption key, followed by the public signing key.
+     */
+    uint8_t* keys;
+
+} vccert_keyring_version_t;
+
+/**
+ * \brief The key history of a single entity, oldest first.
+ */
+typedef struct vccert_keyring_entry
+{
+    /**
+     * \brief The entity id.
+     */
+    uint8_t entity_id[16];
+
+    /**
+     * \brief The number of versions in the history.
+     */
+    size_t count;
+
+    /**
+     * \brief The number of versions the history can hold.
+     */
+    size_t capacity;
+
+    /**
+     * \brief The key versions of this entity, ordered by height, or NULL for
+     * an empty entry.
+     */
+    vccert_keyring_version_t* versions;
+
+} vccert_keyring_entry_t;
+
+/**
+ * \brief A keyring of entity public keys, versioned by block height.
+ *
+ * Keys are copied into the keyring when an entity certificate is added, so a
+ * lookup is one hash probe and a binary search, and only copies the keys into
+ * the caller's buffers.  The keyring must not be updated while it is being
+ * read; concurrent lookups are safe.
+ */
+typedef struct vccert_keyring
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator used for the keyring.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief The number of entities in the keyring.
+     */
+    size_t count;
+
+    /**
+     * \brief The number of entries, minus one.  Always a power of two, minus
+     * one.
+     */
+    size_t mask;
+
+    /**
+     * \brief The open-addressed entries, keyed by entity id.
+     */
+    vccert_keyring_entry_t* entries;
+
+} vccert_keyring_t;
+
+/**
+ * \brief Initialize an empty keyring.
+ *
+ * The keyring is owned by the caller and must be disposed by calling
+ * dispose() when no longer needed.
+ *
+ * \param keyring           The keyring to initialize.
+ * \param alloc_opts        The allocator to use for this keyring.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_KEYRING_INIT_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_KEYRING_INIT_OUT_OF_MEMORY if the keyring could not
+ *        be allocated.
+ */
+int vccert_keyring_init(
+    vccert_keyring_t* keyring, allocator_options_t* alloc_opts);
+
+/**
+ * \brief Add the keys from an attested public entity certificate.
+ *
+ * The \ref VCCERT_FIELD_TYPE_PUBLIC_ENCRYPTION_KEY and \ref
+ * VCCERT_FIELD_TYPE_PUBLIC_SIGNING_KEY of the certificate become the keys of
+ * the entity named by its \ref VCCERT_FIELD_TYPE_ARTIFACT_ID from the given
+ * height on.  Certificates for an entity must be added in height order.
+ *
+ * \param keyring           The keyring to update.
+ * \param cert              The parser context of an attested public entity
+ *                          certificate.
+ * \param height            The height from which these keys are used.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_KEYRING_ADD_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_KEYRING_ADD_WRONG_CERTIFICATE_TYPE if the
+ *        certificate is not a public entity certificate.
+ *      - \ref VCCERT_ERROR_KEYRING_ADD_MISSING_FIELD if the certificate lacks
+ *        one of the fields above.
+ *      - \ref VCCERT_ERROR_KEYRING_ADD_HEIGHT_OUT_OF_ORDER if height is lower
+ *        than that of a certificate already added for this entity.
+ *      - \ref VCCERT_ERROR_KEYRING_ADD_OUT_OF_MEMORY if the keyring could not
+ *        be grown.
+ */
+int vccert_keyring_add(
+    vccert_keyring_t* keyring, vccert_parser_context_t* cert,
+    uint64_t height);
+
+/**
+ * \brief Find the public keys of an entity as of a block height.
+ *
+ * \param keyring           The keyring to search.
+ * \param entity_id         The 128-bit entity id to find.
+ * \param height            The block height at which the keys are needed.
+ * \param encryption_key    Optional buffer to receive the public encryption
+ *                          key.  Its size must match the stored key.
+ * \param signing_key       Optional buffer to receive the public signing key.
+ *                          Its size must match the stored key.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_KEYRING_FIND_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_KEYRING_FIND_NOT_FOUND if the entity had no keys as
+ *        of this height.
+ *      - \ref VCCERT_ERROR_KEYRING_FIND_KEY_SIZE if an output buffer does not
+ *        match the size of the stored key.
+ */
+int vccert_keyring_find(
+    const vccert_keyring_t* keyring, const uint8_t* entity_id,
+    uint64_t height, vccrypt_buffer_t* encryption_key,
+    vccrypt_buffer_t* signing_key);
+
+/**
+ * \brief An entity key resolver backed by a keyring.
+ *
+ * To use it, set the parser options' parser_options_entity_key_resolver to
+ * this function and its entity_key_context to a \ref vccert_keyring_t.
+ *
+ * \param options           The \ref vccert_parser_options_t for this parser.
+ * \param parser            The parser context.  Unused.
+ * \param height            The block height at which the keys are needed.
+ * \param entity_id         The 128-bit entity id to find.
+ * \param pubenckey_buffer  A buffer to receive the public encryption key.
+ * \param pubsignkey_buffer A buffer to receive the public signing key.
+ *
+ * \returns true if the entity was found and false if it was not.
+ */
+bool vccert_keyring_entity_key_resolver(
+    void* options, void* parser, uint64_t height,
+    const uint8_t* entity_id, vccrypt_buffer_t* pubenckey_buffer,
+    vccrypt_buffer_t* pubsignkey_buffer);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_KEYRING_HEADER_GUARD
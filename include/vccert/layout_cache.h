@@ -0,0 +1,156 @@
+/**
+ * \file layout_cache.h
+ *
+ * \brief A cache of learned certificate layouts, which finds every field of a
+ * certificate with a familiar shape without walking it.
+ *
+ * The layout of a certificate is its sequence of field headers.  Walking a
+ * certificate reads each header in turn, and each read depends on the size
+ * read before it.  Once a layout has been learned from one certificate, the
+ * cache records the offset and bytes of each of its headers.  A later
+ * certificate of the same size and first header is checked by comparing its
+ * bytes at every recorded offset at once, which needs no dependent reads and
+ * uses SIMD gathers where the platform has them.  If every header matches,
+ * walking the certificate would find exactly the recorded offsets, so they
+ * are returned directly.  Otherwise the certificate is walked, and its layout
+ * replaces the one that it collided with.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_LAYOUT_CACHE_HEADER_GUARD
+#define VCCERT_LAYOUT_CACHE_HEADER_GUARD
+
+#include <stdint.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief One learned layout.
+ */
+typedef struct vccert_layout
+{
+    /**
+     * \brief The size of the certificates with this layout.
+     */
+    size_t size;
+
+    /**
+     * \brief The number of fields, or 0 if this slot is empty.
+     */
+    size_t field_count;
+
+} vccert_layout_t;
+
+/**
+ * \brief A cache of learned layouts.  A lookup updates the cache, so a cache
+ * must only be used by one thread at a time.
+ */
+typedef struct vccert_layout_cache
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator options used for the layout table.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief The number of layout slots, minus one.
+     */
+    size_t mask;
+
+    /**
+     * \brief The largest number of fields in a cached layout.
+     */
+    size_t max_fields;
+
+    /**
+     * \brief The layout slots.
+     */
+    vccert_layout_t* layouts;
+
+    /**
+     * \brief The header offsets of each slot, max_fields per slot.
+     */
+    uint32_t* offsets;
+
+    /**
+     * \brief The raw header bytes of each slot, max_fields per slot.
+     */
+    uint32_t* headers;
+
+    /**
+     * \brief The number of lookups answered from a learned layout.
+     */
+    uint64_t hits;
+
+    /**
+     * \brief The number of lookups that walked the certificate.
+     */
+    uint64_t misses;
+
+} vccert_layout_cache_t;
+
+/**
+ * \brief Initialize a layout cache.
+ *
+ * This cache is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().
+ *
+ * \param cache             The cache to initialize.
+ * \param alloc_opts        The allocator options to use.
+ * \param max_layouts       The number of layouts to keep, rounded up to a
+ *                          power of two.
+ * \param max_fields        The largest number of fields in a layout worth
+ *                          keeping.  Certificates with more fields are always
+ *                          walked.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LAYOUT_CACHE_INIT_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_LAYOUT_CACHE_INIT_OUT_OF_MEMORY if the layout table
+ *        could not be allocated.
+ */
+int vccert_layout_cache_init(
+    vccert_layout_cache_t* cache, allocator_options_t* alloc_opts,
+    size_t max_layouts, size_t max_fields);
+
+/**
+ * \brief Find the offset of every field header in a certificate.
+ *
+ * \param cache             The cache.
+ * \param cert              The certificate.
+ * \param size              The size of the certificate.
+ * \param offsets           Array to receive the offset of each field header.
+ * \param capacity          The number of entries in offsets.
+ * \param field_count       Pointer to receive the number of fields, which may
+ *                          exceed capacity, in which case only the first
+ *                          offsets are written.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LAYOUT_CACHE_LOOKUP_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - the error returned by vccert_parser_field() for the first malformed
+ *        field header.
+ */
+int vccert_layout_cache_lookup(
+    vccert_layout_cache_t* cache, const uint8_t* cert, size_t size,
+    size_t* offsets, size_t capacity, size_t* field_count);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_LAYOUT_CACHE_HEADER_GUARD
@@ -0,0 +1,437 @@
+/**
+ * \file log.h
+ *
+ * \brief The certificate log appends certificates to segment files in
+ * batches, and finishes each segment with a footer that lets readers find any
+ * certificate without scanning the segment.
+ *
+ * Each certificate in a segment is framed by its size and a CRC-32C of the
+ * size and certificate.
+ *
+ * | Offset | Size | Frame field                                 |
+ * |--------|------|---------------------------------------------|
+ * | 0      | 4    | certificate size, n                         |
+ * | 4      | 4    | CRC-32C of the size and certificate         |
+ * | 8      | n    | certificate                                 |
+ *
+ * The footer follows the last frame, and is followed by a fixed-size trailer
+ * at the end of the segment.
+ *
+ * | Offset | Size | Footer field                                |
+ * |--------|------|---------------------------------------------|
+ * | 0      | 4    | magic, "VCLF"                               |
+ * | 4      | 4    | reserved, 0                                 |
+ * | 8      | 8    | number of certificates, n                   |
+ * | 16     | 8n   | offset of each frame, in append order       |
+ * | 16+8n  | 24n  | certificate id and position of each         |
+ * |        |      | certificate, sorted by id                   |
+ *
+ * | Offset | Size | Trailer field                               |
+ * |--------|------|---------------------------------------------|
+ * | 0      | 8    | offset of the footer                        |
+ * | 8      | 4    | CRC-32C of the footer                       |
+ * | 12     | 4    | magic, "VCLT"                               |
+ *
+ * All integers are big endian.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_LOG_HEADER_GUARD
+#define VCCERT_LOG_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The size of the frame header before each certificate.
+ */
+#define VCCERT_LOG_FRAME_HEADER_SIZE 8
+
+/**
+ * \brief The size of the footer, not counting its tables.
+ */
+#define VCCERT_LOG_FOOTER_HEADER_SIZE 16
+
+/**
+ * \brief The size of the trailer at the end of a finished segment.
+ */
+#define VCCERT_LOG_TRAILER_SIZE 16
+
+/**
+ * \brief Write bytes to the end of a log segment.
+ *
+ * \param context           The I/O context given to the writer.
+ * \param data              The bytes to write.
+ * \param size              The number of bytes to write.
+ *
+ * \returns \ref VCCERT_STATUS_SUCCESS if every byte was written, or a non-zero
+ * error code.
+ */
+typedef int (*vccert_log_write_t)(
+    void* context, const void* data, size_t size);
+
+/**
+ * \brief Make every byte written to a log segment so far durable.
+ *
+ * \param context           The I/O context given to the writer.
+ *
+ * \returns \ref VCCERT_STATUS_SUCCESS on success, or a non-zero error code.
+ */
+typedef int (*vccert_log_sync_t)(void* context);
+
+/**
+ * \brief The group commit policy of a log writer.
+ *
+ * Appended certificates are buffered and committed as one group, with a
+ * single write and a single sync, once either limit is reached.  A limit of
+ * zero is never reached, so a writer with both limits at zero only commits
+ * when asked.
+ */
+typedef struct vccert_log_policy
+{
+    /**
+     * \brief Commit once this many bytes are buffered.
+     */
+    size_t max_batch_bytes;
+
+    /**
+     * \brief Commit once this many certificates are buffered.
+     */
+    size_t max_batch_certs;
+
+} vccert_log_policy_t;
+
+/**
+ * \brief The location and id of a certificate appended to a segment.
+ */
+typedef struct vccert_log_entry
+{
+    /**
+     * \brief The offset of the certificate frame in the segment.
+     */
+    uint64_t offset;
+
+    /**
+     * \brief The \ref VCCERT_FIELD_TYPE_CERTIFICATE_ID of the certificate, or
+     * zeroes if it has none.
+     */
+    uint8_t certificate_id[16];
+
+} vccert_log_entry_t;
+
+/**
+ * \brief A writer for a single log segment.
+ *
+ * A writer is not thread safe; callers that append from several threads must
+ * serialize their calls.
+ */
+typedef struct vccert_log_writer
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator options used by this writer.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief The group commit policy.
+     */
+    vccert_log_policy_t policy;
+
+    /**
+     * \brief The write callback.
+     */
+    vccert_log_write_t write;
+
+    /**
+     * \brief The sync callback, or NULL if the segment is never synced.
+     */
+    vccert_log_sync_t sync;
+
+    /**
+     * \brief The I/O context passed to the callbacks.
+     */
+    void* context;
+
+    /**
+     * \brief The file written by a writer from vccert_log_writer_open(), or
+     * -1.
+     */
+    int fd;
+
+    /**
+     * \brief The frames waiting to be committed.
+     */
+    uint8_t* buffer;
+
+    /**
+     * \brief The number of bytes waiting to be committed.
+     */
+    size_t buffer_size;
+
+    /**
+     * \brief The number of bytes allocated for the buffer.
+     */
+    size_t buffer_capacity;
+
+    /**
+     * \brief The segment size, counting the bytes waiting to be committed.
+     */
+    uint64_t offset;
+
+    /**
+     * \brief The number of certificates appended.
+     */
+    size_t count;
+
+    /**
+     * \brief The number of certificates committed.
+     */
+    size_t committed;
+
+    /**
+     * \brief The number of entries allocated.
+     */
+    size_t capacity;
+
+    /**
+     * \brief The entry of each certificate, in append order.
+     */
+    vccert_log_entry_t* entries;
+
+    /**
+     * \brief The first write or sync failure, which every later call returns.
+     */
+    int status;
+
+    /**
+     * \brief True once the footer has been written.
+     */
+    bool finished;
+
+} vccert_log_writer_t;
+
+/**
+ * \brief A read-only view of a finished log segment.
+ */
+typedef struct vccert_log_segment
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The segment.  This is borrowed and must outlive the view.
+     */
+    const uint8_t* data;
+
+    /**
+     * \brief The size of the segment up to the footer.
+     */
+    size_t size;
+
+    /**
+     * \brief The number of certificates in the segment.
+     */
+    size_t count;
+
+    /**
+     * \brief The big endian frame offsets, in append order.
+     */
+    const uint8_t* offsets;
+
+    /**
+     * \brief The certificate ids and positions, sorted by id.
+     */
+    const uint8_t* ids;
+
+} vccert_log_segment_t;
+
+/**
+ * \brief Initialize a log writer that writes through callbacks.
+ *
+ * This writer is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().  Disposing of a writer does not commit or
+ * finish its segment.
+ *
+ * \param writer            The writer to initialize.
+ * \param alloc_opts        The allocator options to use.
+ * \param policy            The group commit policy.
+ * \param write             The write callback.
+ * \param sync              The sync callback, or NULL.
+ * \param context           The I/O context passed to the callbacks.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_INIT_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_INIT_OUT_OF_MEMORY if the writer buffers
+ *        could not be allocated.
+ */
+int vccert_log_writer_init(
+    vccert_log_writer_t* writer, allocator_options_t* alloc_opts,
+    const vccert_log_policy_t* policy, vccert_log_write_t write,
+    vccert_log_sync_t sync, void* context);
+
+/**
+ * \brief Initialize a log writer that creates a segment file.
+ *
+ * The file is created, or truncated if it exists, and is closed when the
+ * writer is disposed.  Each commit is a single write followed by an fsync.
+ * This is only available on hosted POSIX builds.
+ *
+ * \param writer            The writer to initialize.
+ * \param alloc_opts        The allocator options to use.
+ * \param policy            The group commit policy.
+ * \param path              The path of the segment file.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_OPEN_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_OPEN_UNSUPPORTED if files cannot be
+ *        written on this platform.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_OPEN_FAILED if the file could not be
+ *        created.
+ *      - a status code from vccert_log_writer_init().
+ */
+int vccert_log_writer_open(
+    vccert_log_writer_t* writer, allocator_options_t* alloc_opts,
+    const vccert_log_policy_t* policy, const char* path);
+
+/**
+ * \brief Append a certificate, such as the output of vccert_builder_emit(),
+ * to the segment.
+ *
+ * The certificate is copied into the current group, which is committed if the
+ * policy says so.  Only certificates counted by the writer's committed field
+ * are known to be durable.
+ *
+ * \param writer            The writer.
+ * \param cert              The certificate.
+ * \param size              The size of the certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_APPEND_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_APPEND_OUT_OF_MEMORY if the writer
+ *        buffers could not be grown.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_APPEND_TOO_LARGE if the certificate is
+ *        too large to frame.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_FINISHED if the segment was finished.
+ *      - a status code from vccert_log_writer_commit().
+ */
+int vccert_log_writer_append(
+    vccert_log_writer_t* writer, const uint8_t* cert, size_t size);
+
+/**
+ * \brief Commit the current group with a single write and a single sync.
+ *
+ * \param writer            The writer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_COMMIT_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - a status code from the write or sync callback, which every later call
+ *        on this writer also returns.
+ */
+int vccert_log_writer_commit(vccert_log_writer_t* writer);
+
+/**
+ * \brief Finish the segment by committing the footer and trailer.
+ *
+ * \param writer            The writer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_FINISH_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_FINISH_OUT_OF_MEMORY if the footer could
+ *        not be allocated.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_FINISHED if the segment was finished.
+ *      - a status code from vccert_log_writer_commit().
+ */
+int vccert_log_writer_finish(vccert_log_writer_t* writer);
+
+/**
+ * \brief Initialize a view of a finished log segment.
+ *
+ * The trailer and footer are checked; frames are checked as they are read.
+ *
+ * \param segment           The view to initialize.
+ * \param data              The segment, for example a memory mapping.
+ * \param size              The size of the segment.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_INIT_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_INIT_BAD_FOOTER if the segment was not
+ *        finished, or its footer is damaged.
+ */
+int vccert_log_segment_init(
+    vccert_log_segment_t* segment, const void* data, size_t size);
+
+/**
+ * \brief Get the certificate at the given position in a segment, checking its
+ * frame checksum.
+ *
+ * \param segment           The segment view.
+ * \param index             The position of the certificate, in append order.
+ * \param cert              Pointer to receive the certificate.
+ * \param size              Pointer to receive the certificate size.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_AT_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_AT_OUT_OF_RANGE if the position is past
+ *        the end of the segment.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_AT_BAD_FRAME if the frame does not fit
+ *        in the segment or fails its checksum.
+ */
+int vccert_log_segment_at(
+    const vccert_log_segment_t* segment, size_t index, const uint8_t** cert,
+    size_t* size);
+
+/**
+ * \brief Find the position of a certificate in a segment by its certificate
+ * id.
+ *
+ * \param segment           The segment view.
+ * \param certificate_id    The 128-bit certificate id to find.
+ * \param index             Pointer to receive the position of the first
+ *                          certificate appended with this id.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_FIND_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_FIND_NOT_FOUND if no certificate has
+ *        this id.
+ */
+int vccert_log_segment_find(
+    const vccert_log_segment_t* segment, const uint8_t* certificate_id,
+    size_t* index);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_LOG_HEADER_GUARD
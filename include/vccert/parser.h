@@ -8,7 +8,7 @@
  * contract mode, in which a certificate must be strictly parsed following a
  * contract.
  *
- * \copyright 2017-2022 Velo Payments, Inc.  All rights reserved.
+ * \copyright 2017-2026 Velo Payments, Inc.  All rights reserved.
  */
 
 #ifndef VCCERT_PARSER_HEADER_GUARD
@@ -41,6 +41,12 @@ extern "C" {
  * \brief Size of the Field Size.
  */
 #define FIELD_SIZE_SIZE 2
+
+/**
+ * \brief Size of one record in a field index: a field type and the 32-bit
+ * offset of that field's header.
+ */
+#define VCCERT_FIELD_INDEX_RECORD_SIZE 6
 /**
  * @}
  */
@@ -219,6 +225,18 @@ typedef struct vccert_parser_options
      */
     void* context;
 
+    /**
+     * \brief Context for a library-provided artifact state resolver, such as
+     * the snapshot used by vccert_artifact_state_resolver().  NULL by default.
+     */
+    void* artifact_state_context;
+
+    /**
+     * \brief Context for a library-provided entity key resolver, such as the
+     * keyring used by vccert_keyring_entity_key_resolver().  NULL by default.
+     */
+    void* entity_key_context;
+
 } vccert_parser_options_t;
 
 /**
@@ -261,6 +279,17 @@ typedef struct vccert_parser_context
      */
     struct vccert_parser_context* parent;
 
+    /**
+     * \brief The signed field index, set by vccert_parser_attest() when the
+     * attested certificate carries one, and NULL otherwise.
+     */
+    const uint8_t* field_index;
+
+    /**
+     * \brief The size of the signed field index in bytes.
+     */
+    size_t field_index_size;
+
 } vccert_parser_context_t;
 
 /**
@@ -379,6 +408,38 @@ int vccert_parser_init(
     vccert_parser_options_t* options, vccert_parser_context_t* context,
     const void* cert, size_t size);
 
+/**
+ * \brief Initialize a lightweight parser view over a tuple-valued field of a
+ * parent certificate.
+ *
+ * Tuple-valued fields, such as \ref VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE
+ * or \ref VCCERT_FIELD_TYPE_GRANT_TUPLE, hold a nested stream of fields.  The
+ * resulting view borrows the parent's options, allocates nothing, and can be
+ * used with vccert_parser_field_first(), vccert_parser_field_next(),
+ * vccert_parser_find_short(), and vccert_parser_find_next().  The value must
+ * lie within the parent's attested bounds, or within its raw bounds if the
+ * parent has not been attested.
+ *
+ * The view owns no resources; disposing it is allowed but not required.  It
+ * must not outlive the parent certificate.  A tuple view cannot be attested
+ * on its own; to attest a wrapped certificate, use vccert_parser_init().
+ *
+ * \param parent            The parser context of the enclosing certificate.
+ * \param tuple             The parser context to initialize as a view.
+ * \param value             The tuple field value, found in the parent.
+ * \param size              The size of the tuple field value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_TUPLE_INIT_INVALID_ARG if an invalid
+ *        argument was passed to vccert_parser_tuple_init().
+ *      - \ref VCCERT_ERROR_PARSER_TUPLE_INIT_OUT_OF_BOUNDS if the value does
+ *        not lie within the parent certificate.
+ */
+int vccert_parser_tuple_init(
+    const vccert_parser_context_t* parent, vccert_parser_context_t* tuple,
+    const uint8_t* value, size_t size);
+
 /**
  * \brief Perform attestation on a certificate.
  *
@@ -572,6 +633,377 @@ int vccert_parser_find(
 int vccert_parser_find_next(
     vccert_parser_context_t* context, const uint8_t** value, size_t* size);
 
+/**
+ * \brief Find the first occurrence of a field and decode it as
+ * an unsigned 8-bit Big Endian integer.
+ *
+ * This searches the certificate as vccert_parser_find_short() does.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param value             A pointer to receive the decoded value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if the field is not
+ *        1 byte long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the field is
+ *        not found.
+ */
+int vccert_parser_get_uint8(
+    vccert_parser_context_t* context, uint16_t field_id, uint8_t* value);
+
+/**
+ * \brief Find the first occurrence of a field and decode it as
+ * a signed 8-bit Big Endian integer.
+ *
+ * This searches the certificate as vccert_parser_find_short() does.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param value             A pointer to receive the decoded value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if the field is not
+ *        1 byte long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the field is
+ *        not found.
+ */
+int vccert_parser_get_int8(
+    vccert_parser_context_t* context, uint16_t field_id, int8_t* value);
+
+/**
+ * \brief Find the first occurrence of a field and decode it as
+ * an unsigned 16-bit Big Endian integer.
+ *
+ * This searches the certificate as vccert_parser_find_short() does.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param value             A pointer to receive the decoded value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if the field is not
+ *        2 bytes long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the field is
+ *        not found.
+ */
+int vccert_parser_get_uint16(
+    vccert_parser_context_t* context, uint16_t field_id, uint16_t* value);
+
+/**
+ * \brief Find the first occurrence of a field and decode it as
+ * a signed 16-bit Big Endian integer.
+ *
+ * This searches the certificate as vccert_parser_find_short() does.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param value             A pointer to receive the decoded value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if the field is not
+ *        2 bytes long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the field is
+ *        not found.
+ */
+int vccert_parser_get_int16(
+    vccert_parser_context_t* context, uint16_t field_id, int16_t* value);
+
+/**
+ * \brief Find the first occurrence of a field and decode it as
+ * an unsigned 32-bit Big Endian integer.
+ *
+ * This searches the certificate as vccert_parser_find_short() does.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param value             A pointer to receive the decoded value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if the field is not
+ *        4 bytes long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the field is
+ *        not found.
+ */
+int vccert_parser_get_uint32(
+    vccert_parser_context_t* context, uint16_t field_id, uint32_t* value);
+
+/**
+ * \brief Find the first occurrence of a field and decode it as
+ * a signed 32-bit Big Endian integer.
+ *
+ * This searches the certificate as vccert_parser_find_short() does.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param value             A pointer to receive the decoded value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if the field is not
+ *        4 bytes long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the field is
+ *        not found.
+ */
+int vccert_parser_get_int32(
+    vccert_parser_context_t* context, uint16_t field_id, int32_t* value);
+
+/**
+ * \brief Find the first occurrence of a field and decode it as
+ * an unsigned 64-bit Big Endian integer.
+ *
+ * This searches the certificate as vccert_parser_find_short() does.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param value             A pointer to receive the decoded value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if the field is not
+ *        8 bytes long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the field is
+ *        not found.
+ */
+int vccert_parser_get_uint64(
+    vccert_parser_context_t* context, uint16_t field_id, uint64_t* value);
+
+/**
+ * \brief Find the first occurrence of a field and decode it as
+ * a signed 64-bit Big Endian integer.
+ *
+ * This searches the certificate as vccert_parser_find_short() does.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param value             A pointer to receive the decoded value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if the field is not
+ *        8 bytes long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the field is
+ *        not found.
+ */
+int vccert_parser_get_int64(
+    vccert_parser_context_t* context, uint16_t field_id, int64_t* value);
+
+/**
+ * \brief Find the first occurrence of a field and copy it as a UUID.
+ *
+ * This searches the certificate as vccert_parser_find_short() does.  The UUID
+ * is copied in its Big Endian representation.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param value             A 16-byte buffer to receive the UUID.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if the field is not
+ *        16 bytes long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the field is
+ *        not found.
+ */
+int vccert_parser_get_uuid(
+    vccert_parser_context_t* context, uint16_t field_id, uint8_t* value);
+
+/**
+ * \brief Decode every occurrence of a field as an unsigned 32-bit Big Endian
+ * integer.
+ *
+ * The certificate is walked once, within its attested bounds if it has been
+ * attested.  Runs of consecutive occurrences, as written by
+ * vccert_builder_add_short_uint32_array(), are decoded with a byte-shuffle
+ * kernel where the platform has one.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param values            The array to receive the decoded values.  This may
+ *                          be NULL if capacity is 0.
+ * \param capacity          The number of entries in values.
+ * \param count             Set to the number of occurrences.  This may exceed
+ *                          capacity, in which case only the first capacity
+ *                          values are written.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success, including when the field does
+ *        not occur.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if an occurrence is
+ *        not 4 bytes long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_INVALID_FIELD_SIZE if the certificate
+ *        is malformed.
+ */
+int vccert_parser_get_uint32_array(
+    vccert_parser_context_t* context, uint16_t field_id, uint32_t* values,
+    size_t capacity, size_t* count);
+
+/**
+ * \brief Decode every occurrence of a field as a signed 64-bit Big Endian
+ * integer.
+ *
+ * The certificate is walked once, within its attested bounds if it has been
+ * attested.  Runs of consecutive occurrences, as written by
+ * vccert_builder_add_short_int64_array(), are decoded with a byte-shuffle
+ * kernel where the platform has one.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param values            The array to receive the decoded values.  This may
+ *                          be NULL if capacity is 0.
+ * \param capacity          The number of entries in values.
+ * \param count             Set to the number of occurrences.  This may exceed
+ *                          capacity, in which case only the first capacity
+ *                          values are written.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success, including when the field does
+ *        not occur.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if an occurrence is
+ *        not 8 bytes long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_INVALID_FIELD_SIZE if the certificate
+ *        is malformed.
+ */
+int vccert_parser_get_int64_array(
+    vccert_parser_context_t* context, uint16_t field_id, int64_t* values,
+    size_t capacity, size_t* count);
+
+/**
+ * \brief Decode every occurrence of a field as an unsigned 64-bit Big Endian
+ * integer.
+ *
+ * The certificate is walked once, within its attested bounds if it has been
+ * attested.  Runs of consecutive occurrences, as written by
+ * vccert_builder_add_short_uint64_array(), are decoded with a byte-shuffle
+ * kernel where the platform has one.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param values            The array to receive the decoded values.  This may
+ *                          be NULL if capacity is 0.
+ * \param capacity          The number of entries in values.
+ * \param count             Set to the number of occurrences.  This may exceed
+ *                          capacity, in which case only the first capacity
+ *                          values are written.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success, including when the field does
+ *        not occur.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if an occurrence is
+ *        not 8 bytes long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_INVALID_FIELD_SIZE if the certificate
+ *        is malformed.
+ */
+int vccert_parser_get_uint64_array(
+    vccert_parser_context_t* context, uint16_t field_id, uint64_t* values,
+    size_t capacity, size_t* count);
+
+/**
+ * \brief The number of certificates walked in lockstep by
+ * vccert_parser_validate_batch().
+ */
+#define VCCERT_PARSER_BATCH_LANES 8
+
+/**
+ * \brief A certificate to validate with vccert_parser_validate_batch(), and
+ * the result of validating it.
+ */
+typedef struct vccert_parser_batch_entry
+{
+    /**
+     * \brief The certificate.
+     */
+    const uint8_t* cert;
+
+    /**
+     * \brief The size of the certificate.
+     */
+    size_t size;
+
+    /**
+     * \brief Optional array to receive the offset of each field header.
+     */
+    size_t* offsets;
+
+    /**
+     * \brief The number of entries in offsets.
+     */
+    size_t offset_capacity;
+
+    /**
+     * \brief Set to \ref VCCERT_STATUS_SUCCESS, to \ref
+     * VCCERT_ERROR_PARSER_FIELD_INVALID_ARG if the certificate is empty or a
+     * field header is cut short, or to \ref
+     * VCCERT_ERROR_PARSER_FIELD_INVALID_FIELD_SIZE if a field value runs past
+     * the end of the certificate.
+     */
+    int status;
+
+    /**
+     * \brief Set to the number of fields, or to the number of well-formed
+     * fields before the first malformed header.  This may exceed
+     * offset_capacity, in which case only the first offsets are written.
+     */
+    size_t field_count;
+
+} vccert_parser_batch_entry_t;
+
+/**
+ * \brief Check the field headers of a batch of certificates.
+ *
+ * Every field header must lie within its certificate, and every field value
+ * must end within it.  A certificate is walked one header at a time, and each
+ * step depends on the size read in the last one, so a single walk is bound
+ * by memory latency.  This walks \ref VCCERT_PARSER_BATCH_LANES certificates
+ * in lockstep instead, taking one step in each per round, so that their
+ * header reads overlap.  A lane moves on to the next certificate in the batch
+ * as soon as its current one is done.
+ *
+ * Signatures are not checked; this only establishes that each certificate
+ * can be walked.
+ *
+ * \param entries           The certificates to check.
+ * \param count             The number of certificates.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS if every certificate is well formed.
+ *      - \ref VCCERT_ERROR_PARSER_VALIDATE_BATCH_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_PARSER_VALIDATE_BATCH_MALFORMED if at least one
+ *        certificate is malformed; its entry holds the reason.
+ */
+int vccert_parser_validate_batch(
+    vccert_parser_batch_entry_t* entries, size_t count);
+
 /**
  * \brief Call the given contract closure with the given parser context.
  *
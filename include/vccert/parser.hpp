@@ -0,0 +1,364 @@
+/**
+ * \file parser.hpp
+ *
+ * \brief Header-only C++17 views over the fields of a certificate.
+ *
+ * A \ref vccert::field_range walks a certificate with an iterator that decodes
+ * each field header inline, so a range-for over the fields compiles to a plain
+ * loop instead of a call into vccert_parser_field_next() per field.  A \ref
+ * vccert::parser owns a parser context and disposes of it when destroyed.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_PARSER_HPP_HEADER_GUARD
+#define VCCERT_PARSER_HPP_HEADER_GUARD
+
+#if !defined(__cplusplus) || __cplusplus < 201703L
+# error "vccert/parser.hpp requires C++17."
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <vccert/parser.h>
+
+#if defined(__has_include)
+# if __has_include(<span>) && __cplusplus > 201703L
+#  include <span>
+# endif
+#endif
+
+namespace vccert {
+
+/**
+ * \brief A view of a single certificate field: its type and its value.
+ *
+ * The value points into the certificate, which must outlive the view.
+ */
+class field
+{
+public:
+    constexpr field() noexcept = default;
+
+    constexpr field(
+        uint16_t type, const uint8_t* data, std::size_t size) noexcept
+        : type_(type), data_(data), size_(size)
+    {
+    }
+
+    /**
+     * \brief The short field type.
+     */
+    constexpr uint16_t type() const noexcept { return type_; }
+
+    /**
+     * \brief The first byte of the value.
+     */
+    constexpr const uint8_t* data() const noexcept { return data_; }
+
+    /**
+     * \brief The size of the value in bytes.
+     */
+    constexpr std::size_t size() const noexcept { return size_; }
+
+    constexpr bool empty() const noexcept { return 0 == size_; }
+
+    constexpr const uint8_t* begin() const noexcept { return data_; }
+
+    constexpr const uint8_t* end() const noexcept { return data_ + size_; }
+
+    constexpr uint8_t operator[](std::size_t i) const noexcept
+    {
+        return data_[i];
+    }
+
+#if defined(__cpp_lib_span)
+    /**
+     * \brief The value as a span.
+     */
+    constexpr std::span<const uint8_t> span() const noexcept
+    {
+        return std::span<const uint8_t>(data_, size_);
+    }
+#endif
+
+private:
+    uint16_t type_ = 0;
+    const uint8_t* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+/**
+ * \brief A forward iterator over the fields of a certificate.
+ *
+ * Iteration stops at the end of the certificate, or at the first malformed
+ * field header, in the same places that vccert_parser_field_next() stops.
+ */
+class field_iterator
+{
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = field;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const field*;
+    using reference = const field&;
+
+    /**
+     * \brief Construct an end iterator.
+     */
+    constexpr field_iterator() noexcept = default;
+
+    /**
+     * \brief Construct an iterator at the first field of a certificate.
+     */
+    field_iterator(const uint8_t* cert, std::size_t size) noexcept
+        : cert_(cert), size_(size)
+    {
+        decode(0);
+    }
+
+    reference operator*() const noexcept { return current_; }
+
+    pointer operator->() const noexcept { return &current_; }
+
+    field_iterator& operator++() noexcept
+    {
+        decode(next_);
+        return *this;
+    }
+
+    field_iterator operator++(int) noexcept
+    {
+        field_iterator prev = *this;
+        decode(next_);
+        return prev;
+    }
+
+    /**
+     * \brief The offset of the current field header, or of the place where
+     * iteration stopped.
+     */
+    std::size_t offset() const noexcept { return offset_; }
+
+    friend bool operator==(
+        const field_iterator& lhs, const field_iterator& rhs) noexcept
+    {
+        return lhs.cert_ == rhs.cert_ && lhs.offset_ == rhs.offset_;
+    }
+
+    friend bool operator!=(
+        const field_iterator& lhs, const field_iterator& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    /**
+     * \brief Decode the field header at the given offset, or become an end
+     * iterator if there is no well-formed field there.
+     */
+    void decode(std::size_t offset) noexcept
+    {
+        const std::size_t header = FIELD_TYPE_SIZE + FIELD_SIZE_SIZE;
+
+        /* as in vccert_parser_field(), a header must not end the cert. */
+        if (nullptr == cert_ || offset >= size_ || size_ - offset <= header)
+        {
+            *this = field_iterator();
+            return;
+        }
+
+        const uint8_t* in = cert_ + offset;
+        uint16_t type = (uint16_t)((in[0] << 8) | in[1]);
+        std::size_t value_size = ((std::size_t)in[2] << 8) | in[3];
+
+        if (value_size > size_ - offset - header)
+        {
+            *this = field_iterator();
+            return;
+        }
+
+        offset_ = offset;
+        next_ = offset + header + value_size;
+        current_ = field(type, in + header, value_size);
+    }
+
+    const uint8_t* cert_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t offset_ = 0;
+    std::size_t next_ = 0;
+    field current_;
+};
+
+/**
+ * \brief The fields of a certificate, for use with range-for and standard
+ * algorithms.
+ */
+class field_range
+{
+public:
+    constexpr field_range() noexcept = default;
+
+    constexpr field_range(const uint8_t* cert, std::size_t size) noexcept
+        : cert_(cert), size_(size)
+    {
+    }
+
+    /**
+     * \brief The fields of a parser context, within its attested bounds if it
+     * has been attested.
+     */
+    explicit field_range(const vccert_parser_context_t& context) noexcept
+        : cert_(context.cert), size_(context.size)
+    {
+    }
+
+    field_iterator begin() const noexcept
+    {
+        return field_iterator(cert_, size_);
+    }
+
+    field_iterator end() const noexcept { return field_iterator(); }
+
+    /**
+     * \brief Return true if every field in the range is well-formed, so that
+     * iteration reaches the end of the certificate.
+     */
+    bool well_formed() const noexcept
+    {
+        std::size_t offset = 0;
+
+        for (field_iterator i = begin(); i != end(); ++i)
+        {
+            offset = (std::size_t)(i->end() - cert_);
+        }
+
+        return nullptr != cert_ && offset == size_;
+    }
+
+private:
+    const uint8_t* cert_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+/**
+ * \brief A move-only owner of a parser context.
+ *
+ * Errors are reported with the status codes of the C API.
+ */
+class parser
+{
+public:
+    parser() noexcept = default;
+
+    ~parser() { reset(); }
+
+    parser(const parser&) = delete;
+    parser& operator=(const parser&) = delete;
+
+    parser(parser&& other) noexcept
+        : context_(other.context_), live_(other.live_)
+    {
+        other.live_ = false;
+    }
+
+    parser& operator=(parser&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            context_ = other.context_;
+            live_ = other.live_;
+            other.live_ = false;
+        }
+
+        return *this;
+    }
+
+    /**
+     * \brief Initialize this parser over a certificate, disposing of any
+     * certificate it held before.
+     *
+     * \returns the status code from vccert_parser_init().
+     */
+    int init(
+        vccert_parser_options_t* options, const void* cert,
+        std::size_t size) noexcept
+    {
+        reset();
+
+        int retval = vccert_parser_init(options, &context_, cert, size);
+        live_ = (VCCERT_STATUS_SUCCESS == retval);
+
+        return retval;
+    }
+
+    /**
+     * \brief Dispose of the parser context, if there is one.
+     */
+    void reset() noexcept
+    {
+        if (live_)
+        {
+            dispose((disposable_t*)&context_);
+            live_ = false;
+        }
+    }
+
+    /**
+     * \brief Return true if this parser holds a certificate.
+     */
+    explicit operator bool() const noexcept { return live_; }
+
+    /**
+     * \brief Attest the certificate.
+     *
+     * \returns the status code from vccert_parser_attest().
+     */
+    int attest(uint64_t height, bool verify_contract) noexcept
+    {
+        return vccert_parser_attest(&context_, height, verify_contract);
+    }
+
+    /**
+     * \brief The fields of the certificate, within its attested bounds if it
+     * has been attested.
+     */
+    field_range fields() const noexcept
+    {
+        return live_ ? field_range(context_) : field_range();
+    }
+
+    /**
+     * \brief Find the first field with the given type, as
+     * vccert_parser_find_short() does.
+     */
+    std::optional<field> find(uint16_t type) noexcept
+    {
+        const uint8_t* value;
+        std::size_t size;
+
+        if (!live_
+         || VCCERT_STATUS_SUCCESS !=
+                vccert_parser_find_short(&context_, type, &value, &size))
+        {
+            return std::nullopt;
+        }
+
+        return field(type, value, size);
+    }
+
+    vccert_parser_context_t* get() noexcept { return &context_; }
+
+    const vccert_parser_context_t* get() const noexcept { return &context_; }
+
+private:
+    vccert_parser_context_t context_ = {};
+    bool live_ = false;
+};
+
+}  // namespace vccert
+
+#endif  //VCCERT_PARSER_HPP_HEADER_GUARD
@@ -0,0 +1,298 @@
+/**
+ * \file store.h
+ *
+ * \brief The certificate store reads a file of concatenated certificates in
+ * place, handing out parsers that point straight into the file.
+ *
+ * A store file is a sequence of frames.  Each frame is a 4-byte big endian
+ * certificate size followed by the certificate.  Finding a certificate by
+ * position needs an offset index, which is either built by walking the frames
+ * or loaded from an index written earlier by vccert_store_index_write().
+ *
+ * | Offset | Size | Index field                                 |
+ * |--------|------|---------------------------------------------|
+ * | 0      | 4    | magic, "VCSI"                               |
+ * | 4      | 4    | reserved, 0                                 |
+ * | 8      | 8    | number of certificates                      |
+ * | 16     | 8    | size of the store file                      |
+ * | 24     | 8n   | offset of each frame in the store file      |
+ *
+ * All integers are big endian.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_STORE_HEADER_GUARD
+#define VCCERT_STORE_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <vccert/parser.h>
+#include <vccert/thread_pool.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief The size of the frame header before each certificate.
+ */
+#define VCCERT_STORE_FRAME_HEADER_SIZE 4
+
+/**
+ * \brief The size of the offset index header.
+ */
+#define VCCERT_STORE_INDEX_HEADER_SIZE 24
+
+/**
+ * \brief Reported by vccert_store_for_each() when no certificate failed.
+ */
+#define VCCERT_STORE_NO_CERT ((size_t)-1)
+
+/**
+ * \brief A read-only, indexed view of a certificate store.
+ */
+typedef struct vccert_store
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator options used for a built offset index.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief The store file.  This is borrowed, unless the store was opened
+     * with vccert_store_open().
+     */
+    const uint8_t* data;
+
+    /**
+     * \brief The size of the store file.
+     */
+    size_t size;
+
+    /**
+     * \brief The number of certificates in the store.
+     */
+    size_t count;
+
+    /**
+     * \brief The big endian frame offsets, in file order.
+     */
+    const uint8_t* offsets;
+
+    /**
+     * \brief The offset table when it was built rather than loaded, or NULL.
+     */
+    uint8_t* built_offsets;
+
+    /**
+     * \brief The number of bytes allocated for a built offset table.
+     */
+    size_t capacity;
+
+    /**
+     * \brief True if the store file was mapped by vccert_store_open().
+     */
+    bool mapped_data;
+
+    /**
+     * \brief True if the offset index was mapped by vccert_store_open().
+     */
+    bool mapped_index;
+
+} vccert_store_t;
+
+/**
+ * \brief A visitor called by vccert_store_for_each() once per certificate.
+ *
+ * \param context           The user context passed to vccert_store_for_each().
+ * \param index             The position of the certificate in the store.
+ * \param cert              The certificate, inside the store file.
+ * \param size              The size of the certificate.
+ * \param worker            The id of the thread pool worker running this
+ *                          visit.
+ *
+ * \returns a status code; any value other than \ref VCCERT_STATUS_SUCCESS
+ * stops the visits of this partition.
+ */
+typedef int (*vccert_store_visitor_t)(
+    void* context, size_t index, const uint8_t* cert, size_t size,
+    size_t worker);
+
+/**
+ * \brief Initialize a view of a certificate store held in memory.
+ *
+ * If an index is given, it is checked against the store and used as is;
+ * frames are then only checked as they are read.  Otherwise, an offset index
+ * is built by walking every frame.  Neither the store nor the index is copied,
+ * so both must outlive the view.  This view is owned by the caller and must be
+ * disposed of when no longer needed by calling dispose().
+ *
+ * \param store             The store view to initialize.
+ * \param alloc_opts        The allocator options to use for a built index.
+ * \param data              The store file, for example a memory mapping.
+ * \param size              The size of the store file.
+ * \param index             An offset index for this store, or NULL.
+ * \param index_size        The size of the offset index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_STORE_INIT_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_STORE_INIT_OUT_OF_MEMORY if the offset index could
+ *        not be allocated.
+ *      - \ref VCCERT_ERROR_STORE_INIT_TRUNCATED if a frame runs past the end of
+ *        the store.
+ *      - \ref VCCERT_ERROR_STORE_INIT_BAD_INDEX if the index does not belong to
+ *        this store.
+ */
+int vccert_store_init(
+    vccert_store_t* store, allocator_options_t* alloc_opts, const void* data,
+    size_t size, const void* index, size_t index_size);
+
+/**
+ * \brief Open a certificate store file by mapping it into memory.
+ *
+ * The store file, and the index file if one is given, are mapped read-only
+ * and stay mapped until the store is disposed.  This is only available on
+ * hosted POSIX builds.
+ *
+ * \param store             The store view to initialize.
+ * \param alloc_opts        The allocator options to use for a built index.
+ * \param path              The path of the store file.
+ * \param index_path        The path of an offset index file, or NULL to build
+ *                          the index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_STORE_OPEN_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_STORE_OPEN_UNSUPPORTED if files cannot be mapped on
+ *        this platform.
+ *      - \ref VCCERT_ERROR_STORE_OPEN_FAILED if a file could not be opened or
+ *        mapped.
+ *      - a status code from vccert_store_init().
+ */
+int vccert_store_open(
+    vccert_store_t* store, allocator_options_t* alloc_opts, const char* path,
+    const char* index_path);
+
+/**
+ * \brief Write the offset index of a store.
+ *
+ * Call this first with a NULL buffer to get the size of the index.
+ *
+ * \param store             The store view.
+ * \param buffer            The buffer to receive the index, or NULL.
+ * \param size              The size of the buffer.
+ * \param required          Pointer to receive the size of the index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_STORE_INDEX_WRITE_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_STORE_INDEX_WRITE_BUFFER_TOO_SMALL if the buffer is
+ *        too small.
+ */
+int vccert_store_index_write(
+    const vccert_store_t* store, uint8_t* buffer, size_t size,
+    size_t* required);
+
+/**
+ * \brief Get the certificate at the given position in the store.
+ *
+ * \param store             The store view.
+ * \param index             The position of the certificate.
+ * \param cert              Pointer to receive the certificate.
+ * \param size              Pointer to receive the certificate size.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_STORE_AT_INVALID_ARG if one of the arguments to this
+ *        method is invalid.
+ *      - \ref VCCERT_ERROR_STORE_AT_OUT_OF_RANGE if the position is past the
+ *        end of the store.
+ *      - \ref VCCERT_ERROR_STORE_AT_BAD_FRAME if a loaded index points to a
+ *        frame that does not fit in the store.
+ */
+int vccert_store_at(
+    const vccert_store_t* store, size_t index, const uint8_t** cert,
+    size_t* size);
+
+/**
+ * \brief Initialize a parser context for the certificate at the given
+ * position in the store.
+ *
+ * The certificate bytes are not copied.  This parser context is owned by the
+ * caller and must be disposed of when no longer needed by calling dispose().
+ *
+ * \param store             The store view.
+ * \param options           The parser options to use.
+ * \param parser            The parser context to initialize.
+ * \param index             The position of the certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - a status code from vccert_store_at() or vccert_parser_init().
+ */
+int vccert_store_parser_init(
+    const vccert_store_t* store, vccert_parser_options_t* options,
+    vccert_parser_context_t* parser, size_t index);
+
+/**
+ * \brief Get the range of positions in one of several equal partitions of a
+ * store, for callers that spread the store over their own threads.
+ *
+ * \param store             The store view.
+ * \param partition         The partition, from 0 up to partitions.
+ * \param partitions        The number of partitions.
+ * \param begin             Pointer to receive the first position.
+ * \param end               Pointer to receive one past the last position.
+ */
+void vccert_store_partition(
+    const vccert_store_t* store, size_t partition, size_t partitions,
+    size_t* begin, size_t* end);
+
+/**
+ * \brief Visit every certificate in the store, in parallel.
+ *
+ * The store is split into contiguous partitions, several per worker, and each
+ * partition is visited in order by one worker.  A partition stops at its first
+ * failing visit.  The visitor is called from worker threads and must be safe
+ * to call concurrently.
+ *
+ * \param store             The store view.
+ * \param pool              The thread pool to use, or NULL to visit every
+ *                          certificate on the calling thread.
+ * \param visitor           The visitor to call.
+ * \param context           The user context passed to the visitor.
+ * \param failed            Optional pointer to receive the position of the
+ *                          first certificate that failed, or \ref
+ *                          VCCERT_STORE_NO_CERT.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS if every visit succeeded.
+ *      - \ref VCCERT_ERROR_STORE_FOR_EACH_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_STORE_FOR_EACH_OUT_OF_MEMORY if the partition table
+ *        could not be allocated.
+ *      - the status of the first failing certificate.
+ */
+int vccert_store_for_each(
+    const vccert_store_t* store, vccert_thread_pool_t* pool,
+    vccert_store_visitor_t visitor, void* context, size_t* failed);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_STORE_HEADER_GUARD
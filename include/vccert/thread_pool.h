@@ -0,0 +1,118 @@
+/**
+ * \file thread_pool.h
+ *
+ * \brief A small fixed-size thread pool used to spread independent work, such
+ * as signing or verifying a batch of certificates, across cores.
+ *
+ * On platforms without thread support (freestanding and WebAssembly builds),
+ * the pool runs every task on the calling thread.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_THREAD_POOL_HEADER_GUARD
+#define VCCERT_THREAD_POOL_HEADER_GUARD
+
+#include <stddef.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * \brief A task run by the thread pool once for each index in a run.
+ *
+ * \param context           The user context passed to vccert_thread_pool_run().
+ * \param index             The index of the work item to process.
+ * \param worker            The id of the worker running this item, from 0 up
+ *                          to the pool's worker count.  Worker 0 is always the
+ *                          thread that called vccert_thread_pool_run().
+ */
+typedef void (*vccert_thread_pool_task_t)(
+    void* context, size_t index, size_t worker);
+
+/**
+ * \brief A fixed-size pool of worker threads.
+ */
+typedef struct vccert_thread_pool
+{
+    /**
+     * \brief This is a disposable structure.
+     */
+    disposable_t hdr;
+
+    /**
+     * \brief The allocator options used by this pool.
+     */
+    allocator_options_t* alloc_opts;
+
+    /**
+     * \brief The number of workers, including the calling thread, that
+     * process items in each run.
+     */
+    size_t worker_count;
+
+    /**
+     * \brief Platform-specific pool state.
+     */
+    void* impl;
+
+} vccert_thread_pool_t;
+
+/**
+ * \brief Initialize a thread pool with the given number of workers.
+ *
+ * The calling thread counts as a worker, so worker_count - 1 threads are
+ * started.  On platforms without thread support, the worker count is always
+ * 1.  This pool is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().
+ *
+ * \param pool              The thread pool to initialize.
+ * \param alloc_opts        The allocator options to use.
+ * \param worker_count      The number of workers; must be at least 1.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_THREAD_POOL_INIT_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_THREAD_POOL_INIT_OUT_OF_MEMORY if the pool could
+ *             not be allocated.
+ *      - \ref VCCERT_ERROR_THREAD_POOL_INIT_THREAD_CREATE if a worker thread
+ *             could not be started.
+ */
+int vccert_thread_pool_init(
+    vccert_thread_pool_t* pool, allocator_options_t* alloc_opts,
+    size_t worker_count);
+
+/**
+ * \brief Run a task for every index in [0, count) and wait for all of them to
+ * complete.
+ *
+ * Items are handed out dynamically, so the order in which indices run is
+ * unspecified.  The calling thread participates as worker 0.  A pool must
+ * only be run by one thread at a time.  If pool is NULL, every item is run on
+ * the calling thread.
+ *
+ * \param pool              The thread pool to use, or NULL.
+ * \param task              The task to run.
+ * \param context           The user context passed to each task.
+ * \param count             The number of items to process.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_THREAD_POOL_RUN_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ */
+int vccert_thread_pool_run(
+    vccert_thread_pool_t* pool, vccert_thread_pool_task_t task,
+    void* context, size_t count);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_THREAD_POOL_HEADER_GUARD
@@ -0,0 +1,41 @@
+/**
+ * \file artifact_state_internal.h
+ *
+ * Internal helpers for the artifact state table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_PRIVATE_ARTIFACT_STATE_INTERNAL_HEADER_GUARD
+#define VCCERT_PRIVATE_ARTIFACT_STATE_INTERNAL_HEADER_GUARD
+
+#include <vccert/artifact_state.h>
+#include <vccert/error_codes.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * The number of entries in a new table.
+ */
+#define VCCERT_ARTIFACT_STATE_INITIAL_ENTRIES 64
+
+/**
+ * Find the entry for an artifact, or the empty entry where it belongs.
+ *
+ * \param table         The table to search.
+ * \param artifact_id   The 128-bit artifact id to find.
+ *
+ * \returns the entry for this artifact, or an empty entry.
+ */
+vccert_artifact_state_entry_t* vccert_artifact_state_table_entry(
+    const vccert_artifact_state_table_t* table, const uint8_t* artifact_id);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_PRIVATE_ARTIFACT_STATE_INTERNAL_HEADER_GUARD
@@ -0,0 +1,60 @@
+/**
+ * \file vccert_artifact_state_resolver.c
+ *
+ * An artifact state resolver backed by an artifact state snapshot.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "artifact_state_internal.h"
+
+/**
+ * \brief An artifact state resolver backed by an artifact state snapshot.
+ *
+ * To use it, set the parser options' parser_options_artifact_state_resolver
+ * to this function and its artifact_state_context to a \ref
+ * vccert_artifact_state_snapshot_t.
+ *
+ * \param options           The \ref vccert_parser_options_t for this parser.
+ * \param parser            The parser context.  Unused.
+ * \param artifact_id       The 128-bit artifact id to find.
+ * \param txn_id            Optional buffer of at least 16 bytes to receive
+ *                          the id of the certificate that set this state.
+ *
+ * \returns the state of this artifact, or -1 if it cannot be found.
+ */
+int32_t vccert_artifact_state_resolver(
+    void* options, void* UNUSED(parser), const uint8_t* artifact_id,
+    vccrypt_buffer_t* txn_id)
+{
+    vccert_parser_options_t* opts = (vccert_parser_options_t*)options;
+    int32_t state;
+
+    MODEL_ASSERT(opts != NULL);
+    MODEL_ASSERT(opts->artifact_state_context != NULL);
+
+    if (NULL == opts || NULL == opts->artifact_state_context)
+    {
+        return -1;
+    }
+
+    uint8_t* id_buffer = NULL;
+    if (NULL != txn_id && txn_id->size >= 16)
+    {
+        id_buffer = (uint8_t*)txn_id->data;
+    }
+
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_artifact_state_snapshot_find(
+                (const vccert_artifact_state_snapshot_t*)
+                    opts->artifact_state_context,
+                artifact_id, &state, id_buffer))
+    {
+        return -1;
+    }
+
+    return state;
+}
@@ -0,0 +1,84 @@
+/**
+ * \file vccert_artifact_state_snapshot_find.c
+ *
+ * Find the state of an artifact in an artifact state snapshot.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "artifact_state_internal.h"
+
+/**
+ * \brief Find the state of an artifact in a snapshot.
+ *
+ * \param snapshot          The snapshot to search.
+ * \param artifact_id       The 128-bit artifact id to find.
+ * \param state             Pointer to receive the artifact's state.
+ * \param txn_id            Optional buffer of 16 bytes to receive the id of
+ *                          the certificate that set this state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_SNAPSHOT_FIND_INVALID_ARG if one of
+ *        the arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_SNAPSHOT_FIND_NOT_FOUND if the
+ *        artifact had no state as of the snapshot's height.
+ */
+int vccert_artifact_state_snapshot_find(
+    const vccert_artifact_state_snapshot_t* snapshot,
+    const uint8_t* artifact_id, int32_t* state, uint8_t* txn_id)
+{
+    MODEL_ASSERT(snapshot != NULL);
+    MODEL_ASSERT(snapshot->table != NULL);
+    MODEL_ASSERT(artifact_id != NULL);
+    MODEL_ASSERT(state != NULL);
+
+    /* parameter sanity check */
+    if (NULL == snapshot || NULL == snapshot->table
+     || NULL == snapshot->table->entries || NULL == artifact_id
+     || NULL == state)
+    {
+        return VCCERT_ERROR_ARTIFACT_STATE_SNAPSHOT_FIND_INVALID_ARG;
+    }
+
+    const vccert_artifact_state_entry_t* entry =
+        vccert_artifact_state_table_entry(snapshot->table, artifact_id);
+    if (NULL == entry->versions)
+    {
+        return VCCERT_ERROR_ARTIFACT_STATE_SNAPSHOT_FIND_NOT_FOUND;
+    }
+
+    /* find the number of versions at or below the snapshot height. */
+    size_t lo = 0, hi = entry->count;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (entry->versions[mid].height <= snapshot->height)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    /* the artifact did not exist yet at this height. */
+    if (0 == lo)
+    {
+        return VCCERT_ERROR_ARTIFACT_STATE_SNAPSHOT_FIND_NOT_FOUND;
+    }
+
+    const vccert_artifact_state_version_t* version = &entry->versions[lo - 1];
+    *state = version->state;
+    if (NULL != txn_id)
+    {
+        memcpy(txn_id, version->txn_id, sizeof(version->txn_id));
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
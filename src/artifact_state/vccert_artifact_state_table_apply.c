@@ -0,0 +1,195 @@
+/**
+ * \file vccert_artifact_state_table_apply.c
+ *
+ * Apply an attested certificate to an artifact state table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/fields.h>
+#include <vpr/parameters.h>
+
+#include "artifact_state_internal.h"
+
+/* the initial size of an artifact's version history. */
+#define ARTIFACT_STATE_INITIAL_VERSIONS 4
+
+/* forward decls */
+static int vccert_artifact_state_table_grow(
+    vccert_artifact_state_table_t* table);
+
+/**
+ * \brief Apply an attested certificate to an artifact state table.
+ *
+ * The \ref VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE and \ref
+ * VCCERT_FIELD_TYPE_CERTIFICATE_ID of the certificate become the latest
+ * version of its \ref VCCERT_FIELD_TYPE_ARTIFACT_ID, as of the given height.
+ * Certificates must be applied in block order.
+ *
+ * \param table             The table to update.
+ * \param cert              The parser context of an attested certificate.
+ * \param height            The height of the block holding the certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_MISSING_FIELD if the
+ *        certificate lacks one of the fields above.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_HEIGHT_OUT_OF_ORDER if
+ *        height is lower than that of a certificate already applied.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_OUT_OF_MEMORY if the
+ *        table could not be grown.
+ */
+int vccert_artifact_state_table_apply(
+    vccert_artifact_state_table_t* table, vccert_parser_context_t* cert,
+    uint64_t height)
+{
+    int retval;
+    const uint8_t* artifact_id;
+    const uint8_t* txn_id;
+    const uint8_t* state;
+    size_t artifact_id_size, txn_id_size, state_size;
+
+    MODEL_ASSERT(table != NULL);
+    MODEL_ASSERT(table->entries != NULL);
+    MODEL_ASSERT(cert != NULL);
+
+    /* parameter sanity check */
+    if (NULL == table || NULL == table->entries || NULL == cert)
+    {
+        return VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_INVALID_ARG;
+    }
+
+    /* the table only moves forward. */
+    if (height < table->height)
+    {
+        return VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_HEIGHT_OUT_OF_ORDER;
+    }
+
+    /* get the fields that make up the new version. */
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_parser_find_short(
+                cert, VCCERT_FIELD_TYPE_ARTIFACT_ID, &artifact_id,
+                &artifact_id_size)
+     || sizeof(table->entries->artifact_id) != artifact_id_size
+     || VCCERT_STATUS_SUCCESS !=
+            vccert_parser_find_short(
+                cert, VCCERT_FIELD_TYPE_CERTIFICATE_ID, &txn_id, &txn_id_size)
+     || sizeof(table->entries->versions->txn_id) != txn_id_size
+     || VCCERT_STATUS_SUCCESS !=
+            vccert_parser_find_short(
+                cert, VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE, &state,
+                &state_size)
+     || sizeof(uint16_t) != state_size)
+    {
+        return VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_MISSING_FIELD;
+    }
+
+    /* keep the table at most half full. */
+    if (2 * (table->count + 1) > table->mask + 1)
+    {
+        retval = vccert_artifact_state_table_grow(table);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    vccert_artifact_state_entry_t* entry =
+        vccert_artifact_state_table_entry(table, artifact_id);
+
+    /* start a history for a new artifact. */
+    if (NULL == entry->versions)
+    {
+        entry->versions =
+            (vccert_artifact_state_version_t*)
+                allocate(
+                    table->alloc_opts,
+                    ARTIFACT_STATE_INITIAL_VERSIONS
+                        * sizeof(vccert_artifact_state_version_t));
+        if (NULL == entry->versions)
+        {
+            return VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_OUT_OF_MEMORY;
+        }
+
+        memcpy(entry->artifact_id, artifact_id, artifact_id_size);
+        entry->count = 0;
+        entry->capacity = ARTIFACT_STATE_INITIAL_VERSIONS;
+        ++table->count;
+    }
+    /* grow an existing history. */
+    else if (entry->count == entry->capacity)
+    {
+        vccert_artifact_state_version_t* versions =
+            (vccert_artifact_state_version_t*)
+                reallocate(
+                    table->alloc_opts, entry->versions,
+                    entry->capacity * sizeof(vccert_artifact_state_version_t),
+                    2 * entry->capacity
+                        * sizeof(vccert_artifact_state_version_t));
+        if (NULL == versions)
+        {
+            return VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_OUT_OF_MEMORY;
+        }
+
+        entry->versions = versions;
+        entry->capacity *= 2;
+    }
+
+    /* append the new version. */
+    vccert_artifact_state_version_t* version = &entry->versions[entry->count];
+    version->height = height;
+    memcpy(version->txn_id, txn_id, txn_id_size);
+    version->state = (int32_t)((state[0] << 8) | state[1]);
+    ++entry->count;
+
+    table->height = height;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Double the number of entries in the table.
+ *
+ * \param table             The table to grow.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int vccert_artifact_state_table_grow(
+    vccert_artifact_state_table_t* table)
+{
+    vccert_artifact_state_table_t grown;
+    size_t entries = 2 * (table->mask + 1);
+
+    grown.mask = entries - 1;
+    grown.entries =
+        (vccert_artifact_state_entry_t*)
+            allocate(
+                table->alloc_opts,
+                entries * sizeof(vccert_artifact_state_entry_t));
+    if (NULL == grown.entries)
+    {
+        return VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_OUT_OF_MEMORY;
+    }
+
+    memset(grown.entries, 0, entries * sizeof(vccert_artifact_state_entry_t));
+
+    /* move each history to its place in the larger table. */
+    for (size_t i = 0; i <= table->mask; ++i)
+    {
+        if (NULL != table->entries[i].versions)
+        {
+            *vccert_artifact_state_table_entry(
+                &grown, table->entries[i].artifact_id) = table->entries[i];
+        }
+    }
+
+    release(table->alloc_opts, table->entries);
+    table->entries = grown.entries;
+    table->mask = grown.mask;
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,51 @@
+/**
+ * \file vccert_artifact_state_table_entry.c
+ *
+ * Find the entry for an artifact in an artifact state table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "artifact_state_internal.h"
+
+/**
+ * Find the entry for an artifact, or the empty entry where it belongs.
+ *
+ * The table is open addressed with linear probing, and is never more than
+ * half full, so the probe always ends.
+ *
+ * \param table         The table to search.
+ * \param artifact_id   The 128-bit artifact id to find.
+ *
+ * \returns the entry for this artifact, or an empty entry.
+ */
+vccert_artifact_state_entry_t* vccert_artifact_state_table_entry(
+    const vccert_artifact_state_table_t* table, const uint8_t* artifact_id)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    MODEL_ASSERT(table != NULL);
+    MODEL_ASSERT(table->entries != NULL);
+    MODEL_ASSERT(artifact_id != NULL);
+
+    /* FNV-1a over the artifact id. */
+    for (size_t i = 0; i < sizeof(table->entries->artifact_id); ++i)
+    {
+        hash ^= artifact_id[i];
+        hash *= 1099511628211ULL;
+    }
+
+    size_t e = (size_t)hash & table->mask;
+    while (NULL != table->entries[e].versions
+        && memcmp(
+            table->entries[e].artifact_id, artifact_id,
+            sizeof(table->entries->artifact_id)))
+    {
+        e = (e + 1) & table->mask;
+    }
+
+    return &table->entries[e];
+}
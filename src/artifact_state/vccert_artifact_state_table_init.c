@@ -0,0 +1,89 @@
+/**
+ * \file vccert_artifact_state_table_init.c
+ *
+ * Initialize an artifact state table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "artifact_state_internal.h"
+
+/* forward decls */
+static void vccert_artifact_state_table_dispose(void* disposable);
+
+/**
+ * \brief Initialize an empty artifact state table.
+ *
+ * The table is owned by the caller and must be disposed by calling dispose()
+ * when no longer needed.
+ *
+ * \param table             The table to initialize.
+ * \param alloc_opts        The allocator to use for this table.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_TABLE_INIT_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_ARTIFACT_STATE_TABLE_INIT_OUT_OF_MEMORY if the table
+ *        could not be allocated.
+ */
+int vccert_artifact_state_table_init(
+    vccert_artifact_state_table_t* table, allocator_options_t* alloc_opts)
+{
+    MODEL_ASSERT(table != NULL);
+    MODEL_ASSERT(alloc_opts != NULL);
+
+    /* parameter sanity check */
+    if (NULL == table || NULL == alloc_opts)
+    {
+        return VCCERT_ERROR_ARTIFACT_STATE_TABLE_INIT_INVALID_ARG;
+    }
+
+    memset(table, 0, sizeof(vccert_artifact_state_table_t));
+
+    size_t size =
+        VCCERT_ARTIFACT_STATE_INITIAL_ENTRIES
+            * sizeof(vccert_artifact_state_entry_t);
+    table->entries = (vccert_artifact_state_entry_t*)allocate(alloc_opts, size);
+    if (NULL == table->entries)
+    {
+        return VCCERT_ERROR_ARTIFACT_STATE_TABLE_INIT_OUT_OF_MEMORY;
+    }
+
+    memset(table->entries, 0, size);
+
+    table->hdr.dispose = &vccert_artifact_state_table_dispose;
+    table->alloc_opts = alloc_opts;
+    table->mask = VCCERT_ARTIFACT_STATE_INITIAL_ENTRIES - 1;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of an artifact state table.
+ *
+ * \param disposable        The table to dispose.
+ */
+static void vccert_artifact_state_table_dispose(void* disposable)
+{
+    vccert_artifact_state_table_t* table =
+        (vccert_artifact_state_table_t*)disposable;
+
+    MODEL_ASSERT(table != NULL);
+
+    for (size_t i = 0; i <= table->mask; ++i)
+    {
+        if (NULL != table->entries[i].versions)
+        {
+            release(table->alloc_opts, table->entries[i].versions);
+        }
+    }
+
+    release(table->alloc_opts, table->entries);
+
+    memset(table, 0, sizeof(vccert_artifact_state_table_t));
+}
@@ -0,0 +1,32 @@
+/**
+ * \file vccert_artifact_state_table_snapshot.c
+ *
+ * Take a snapshot of an artifact state table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "artifact_state_internal.h"
+
+/**
+ * \brief Take a snapshot of an artifact state table as of a block height.
+ *
+ * Taking a snapshot copies nothing.  The snapshot is valid for as long as the
+ * table is.
+ *
+ * \param snapshot          The snapshot to initialize.
+ * \param table             The table to view.
+ * \param height            The height to view the table at.
+ */
+void vccert_artifact_state_table_snapshot(
+    vccert_artifact_state_snapshot_t* snapshot,
+    const vccert_artifact_state_table_t* table, uint64_t height)
+{
+    MODEL_ASSERT(snapshot != NULL);
+    MODEL_ASSERT(table != NULL);
+
+    snapshot->table = table;
+    snapshot->height = height;
+}
@@ -0,0 +1,86 @@
+/**
+ * \file block_filter_internal.h
+ *
+ * Internal helpers for block filters.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_PRIVATE_BLOCK_FILTER_INTERNAL_HEADER_GUARD
+#define VCCERT_PRIVATE_BLOCK_FILTER_INTERNAL_HEADER_GUARD
+
+#include <vccert/block.h>
+#include <vccert/error_codes.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * The block filter magic number.
+ */
+#define VCCERT_BLOCK_FILTER_MAGIC "VCBF"
+
+/**
+ * The number of probes and bits per id, which give a false positive rate of
+ * just under one percent.
+ */
+#define VCCERT_BLOCK_FILTER_PROBES 7
+#define VCCERT_BLOCK_FILTER_BITS_PER_ID 10
+
+/**
+ * The largest number of probes accepted from a filter.
+ */
+#define VCCERT_BLOCK_FILTER_MAX_PROBES 32
+
+/**
+ * \brief Hash an id for a block filter.
+ *
+ * The field type is hashed with the id, so that artifact and certificate ids
+ * set different bits.
+ *
+ * \param field             The field type the id was found in.
+ * \param id                The 128-bit id.
+ *
+ * \returns the hash.
+ */
+uint64_t vccert_block_filter_hash(uint16_t field, const uint8_t* id);
+
+/**
+ * \brief Get the bit for a given probe of a hash.
+ *
+ * \param hash              The hash from vccert_block_filter_hash().
+ * \param probe             The probe number.
+ * \param bits              The number of bits in the filter.
+ *
+ * \returns the bit index.
+ */
+static inline uint64_t vccert_block_filter_bit(
+    uint64_t hash, unsigned int probe, uint64_t bits)
+{
+    /* derive the remaining probes from two halves of one hash. */
+    uint64_t step = ((hash >> 29) | (hash << 35)) | 1;
+
+    return (hash + probe * step) % bits;
+}
+
+/**
+ * \brief Check an id against a block filter.
+ *
+ * \param filter            The block filter.
+ * \param size              The size of the block filter.
+ * \param field             The field type the id would be found in.
+ * \param id                The 128-bit id.
+ *
+ * \returns false if the id is definitely not in the block, and true otherwise.
+ */
+bool vccert_block_filter_test(
+    const uint8_t* filter, size_t size, uint16_t field, const uint8_t* id);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_PRIVATE_BLOCK_FILTER_INTERNAL_HEADER_GUARD
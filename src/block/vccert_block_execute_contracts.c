@@ -0,0 +1,225 @@
+/**
+ * \file vccert_block_execute_contracts.c
+ *
+ * Run the contracts for the transactions in a block, partitioned by artifact.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/block.h>
+#include <vccert/fields.h>
+#include <vpr/parameters.h>
+
+#include "../parser/parser_internal.h"
+
+/* the number of partitions per worker, so that uneven partitions balance. */
+#define BLOCK_EXECUTE_PARTITIONS_PER_WORKER 4
+
+/**
+ * Partition table shared by every worker.  Each partition is a singly linked
+ * list of transaction indices in block order.
+ */
+typedef struct block_partitions
+{
+    vccert_parser_context_t* txns;
+    int* statuses;
+    size_t* heads;
+    size_t* next;
+} block_partitions_t;
+
+/* forward decls */
+static size_t block_partition_of(
+    vccert_parser_context_t* txn, size_t partitions);
+static void block_execute_partition(
+    void* context, size_t index, size_t worker);
+
+/**
+ * \brief Run the contracts for a set of attested transactions, in parallel
+ * where they touch different artifacts.
+ *
+ * Transactions are partitioned by \ref VCCERT_FIELD_TYPE_ARTIFACT_ID.  Each
+ * partition runs on one worker, in block order, while independent partitions
+ * run concurrently.  Every contract is run, even after a failure, so the
+ * status reported for each transaction is the same as that of a sequential
+ * loop calling each contract in block order, provided that a contract only
+ * reads and writes the state of its own artifact.
+ *
+ * Resolvers and contracts are called from worker threads and must be safe to
+ * call concurrently for different artifacts.
+ *
+ * \param txns              Array of parser contexts for the transactions, in
+ *                          block order.  Each must already have passed
+ *                          vccert_parser_attest().
+ * \param count             The number of transactions.
+ * \param pool              The thread pool to use, or NULL to run every
+ *                          contract on the calling thread.
+ * \param statuses          Array of count entries to receive the contract
+ *                          status of each transaction.
+ * \param failed_txn        Pointer to receive the index of the first
+ *                          transaction, in block order, whose contract
+ *                          failed, or \ref VCCERT_BLOCK_NO_TXN.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS if every contract passed.
+ *      - \ref VCCERT_ERROR_BLOCK_EXECUTE_CONTRACTS_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_EXECUTE_CONTRACTS_OUT_OF_MEMORY if the
+ *        partition table could not be allocated.
+ *      - the status of the first failing transaction.
+ */
+int vccert_block_execute_contracts(
+    vccert_parser_context_t* txns, size_t count, vccert_thread_pool_t* pool,
+    int* statuses, size_t* failed_txn)
+{
+    int retval;
+    size_t i, partitions;
+    block_partitions_t table;
+
+    MODEL_ASSERT(count == 0 || txns != NULL);
+    MODEL_ASSERT(count == 0 || statuses != NULL);
+    MODEL_ASSERT(failed_txn != NULL);
+
+    /* parameter sanity check */
+    if ((count > 0 && (NULL == txns || NULL == statuses))
+     || NULL == failed_txn)
+    {
+        return VCCERT_ERROR_BLOCK_EXECUTE_CONTRACTS_INVALID_ARG;
+    }
+
+    *failed_txn = VCCERT_BLOCK_NO_TXN;
+
+    if (0 == count)
+    {
+        return VCCERT_STATUS_SUCCESS;
+    }
+
+    allocator_options_t* alloc_opts = txns[0].options->alloc_opts;
+
+    /* there is no point in having more partitions than transactions. */
+    partitions =
+        BLOCK_EXECUTE_PARTITIONS_PER_WORKER
+            * ((NULL == pool) ? 1 : pool->worker_count);
+    if (partitions > count)
+    {
+        partitions = count;
+    }
+
+    /* the heads, the tails, and the next links share one allocation. */
+    size_t* links =
+        (size_t*)allocate(
+            alloc_opts, (2 * partitions + count) * sizeof(size_t));
+    if (NULL == links)
+    {
+        return VCCERT_ERROR_BLOCK_EXECUTE_CONTRACTS_OUT_OF_MEMORY;
+    }
+
+    table.txns = txns;
+    table.statuses = statuses;
+    table.heads = links;
+    table.next = links + 2 * partitions;
+    size_t* tails = links + partitions;
+
+    for (i = 0; i < partitions; ++i)
+    {
+        table.heads[i] = VCCERT_BLOCK_NO_TXN;
+    }
+
+    /* append each transaction to its partition, preserving block order. */
+    for (i = 0; i < count; ++i)
+    {
+        size_t p = block_partition_of(&txns[i], partitions);
+
+        table.next[i] = VCCERT_BLOCK_NO_TXN;
+        if (VCCERT_BLOCK_NO_TXN == table.heads[p])
+        {
+            table.heads[p] = i;
+        }
+        else
+        {
+            table.next[tails[p]] = i;
+        }
+
+        tails[p] = i;
+    }
+
+    /* run each partition as a separate task. */
+    retval =
+        vccert_thread_pool_run(
+            pool, &block_execute_partition, &table, partitions);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_links;
+    }
+
+    /* report the first failure in block order. */
+    for (i = 0; i < count; ++i)
+    {
+        if (VCCERT_STATUS_SUCCESS != statuses[i])
+        {
+            *failed_txn = i;
+            retval = statuses[i];
+            goto cleanup_links;
+        }
+    }
+
+    retval = VCCERT_STATUS_SUCCESS;
+
+cleanup_links:
+    memset(links, 0, (2 * partitions + count) * sizeof(size_t));
+    release(alloc_opts, links);
+
+    return retval;
+}
+
+/**
+ * Map the artifact of a transaction to a partition.  A transaction without an
+ * artifact id goes to the first partition; its contract fails anyway.
+ */
+static size_t block_partition_of(
+    vccert_parser_context_t* txn, size_t partitions)
+{
+    const uint8_t* artifact_id;
+    size_t artifact_id_size;
+    uint64_t hash = 14695981039346656037ULL;
+
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_parser_find_short(
+                txn, VCCERT_FIELD_TYPE_ARTIFACT_ID, &artifact_id,
+                &artifact_id_size))
+    {
+        return 0;
+    }
+
+    /* FNV-1a, so that artifacts spread evenly whatever their UUID version. */
+    for (size_t i = 0; i < artifact_id_size; ++i)
+    {
+        hash ^= artifact_id[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return (size_t)(hash % partitions);
+}
+
+/**
+ * Run the contracts in one partition, in block order.
+ *
+ * \param context       The block_partitions_t for this block.
+ * \param index         The partition to run.
+ * \param worker        The id of the worker running this partition.
+ */
+static void block_execute_partition(
+    void* context, size_t index, size_t worker)
+{
+    block_partitions_t* table = (block_partitions_t*)context;
+
+    (void)worker;
+
+    for (size_t i = table->heads[index];
+         VCCERT_BLOCK_NO_TXN != i;
+         i = table->next[i])
+    {
+        table->statuses[i] = vccert_parser_attest_contract(&table->txns[i]);
+    }
+}
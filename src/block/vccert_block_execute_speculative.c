@@ -0,0 +1,532 @@
+/**
+ * \file vccert_block_execute_speculative.c
+ *
+ * Run the contracts for the transactions in a block optimistically, against
+ * a versioned view of artifact state.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/block.h>
+#include <vccert/fields.h>
+#include <vpr/parameters.h>
+
+#include "../parser/parser_internal.h"
+
+/* the size of an artifact UUID. */
+#define SPEC_ARTIFACT_ID_SIZE 16
+
+/* the initial size of a transaction's read set. */
+#define SPEC_INITIAL_READS 4
+
+/**
+ * An artifact state read by a contract, and the transaction whose version it
+ * saw, or VCCERT_BLOCK_NO_TXN for the state before the block.
+ */
+typedef struct spec_read
+{
+    uint8_t artifact_id[SPEC_ARTIFACT_ID_SIZE];
+    size_t version;
+} spec_read_t;
+
+/**
+ * Speculation state for one transaction.  The parser must be the first
+ * member, so that the resolver can map a parser back to its transaction.
+ */
+typedef struct spec_txn
+{
+    vccert_parser_context_t parser;
+    bool initialized;
+
+    /* the version this transaction writes, if any. */
+    const uint8_t* artifact_id;
+    const uint8_t* txn_id;
+    int32_t new_state;
+    size_t prev_writer;
+
+    /* the reads made during the last run of this contract. */
+    spec_read_t* reads;
+    size_t read_count;
+    size_t read_capacity;
+    bool out_of_memory;
+
+    /* the outcome of the last run, and of the run in progress. */
+    bool valid;
+    int status;
+    int next_status;
+} spec_txn_t;
+
+/**
+ * An entry in the artifact table, pointing at the last transaction in the
+ * block to write that artifact.
+ */
+typedef struct spec_bucket
+{
+    const uint8_t* artifact_id;
+    size_t last_writer;
+} spec_bucket_t;
+
+/**
+ * The executor.  The shadow options must be the first member, so that the
+ * resolver can map the options back to the executor.
+ */
+typedef struct block_speculation
+{
+    vccert_parser_options_t options;
+    vccert_parser_options_t* base;
+    allocator_options_t* alloc_opts;
+    spec_txn_t* txns;
+    size_t count;
+    spec_bucket_t* buckets;
+    size_t mask;
+    size_t* dirty;
+    size_t dirty_count;
+} block_speculation_t;
+
+/* forward decls */
+static int spec_build(
+    block_speculation_t* spec, vccert_parser_context_t* txns);
+static size_t spec_version_at(
+    block_speculation_t* spec, const uint8_t* artifact_id, size_t index);
+static int32_t spec_artifact_state_resolver(
+    void* options, void* parser, const uint8_t* artifact_id,
+    vccrypt_buffer_t* txn_id);
+static void spec_run(void* context, size_t index, size_t worker);
+static void spec_cleanup(block_speculation_t* spec);
+
+/**
+ * \brief Run the contracts for a set of attested transactions optimistically,
+ * re-running only those that read an artifact state that changed.
+ *
+ * Every contract first runs in parallel against a versioned view of artifact
+ * state: each transaction's \ref VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE is a
+ * version of its artifact, and a read through the artifact state resolver
+ * sees the latest version written earlier in the block, or the state given
+ * by the caller's resolver if there is none.  The version each contract read
+ * is recorded.  Once a round completes, the reads are checked in block order
+ * against the versions written by transactions that actually passed, and only
+ * the transactions that read a stale version run again.  Rounds repeat until
+ * every read is current, which gives the same statuses as running each
+ * contract in block order and applying each passing transaction's new state.
+ *
+ * Contracts are run with a copy of the transactions' parser options in which
+ * the artifact state resolver is replaced; every other resolver, and the
+ * options context, are unchanged.  Resolvers and contracts are called from
+ * worker threads and must be safe to call concurrently.
+ *
+ * \param txns              Array of parser contexts for the transactions, in
+ *                          block order.  Each must already have passed
+ *                          vccert_parser_attest(), and all must share the same
+ *                          parser options.
+ * \param count             The number of transactions.
+ * \param pool              The thread pool to use, or NULL to run every
+ *                          contract on the calling thread.
+ * \param statuses          Array of count entries to receive the contract
+ *                          status of each transaction.
+ * \param failed_txn        Pointer to receive the index of the first
+ *                          transaction, in block order, whose contract
+ *                          failed, or \ref VCCERT_BLOCK_NO_TXN.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS if every contract passed.
+ *      - \ref VCCERT_ERROR_BLOCK_EXECUTE_SPECULATIVE_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_EXECUTE_SPECULATIVE_OUT_OF_MEMORY if the
+ *        version table or a read set could not be allocated.
+ *      - the status of the first failing transaction.
+ */
+int vccert_block_execute_speculative(
+    vccert_parser_context_t* txns, size_t count, vccert_thread_pool_t* pool,
+    int* statuses, size_t* failed_txn)
+{
+    int retval;
+    size_t i, k, r;
+    block_speculation_t spec;
+
+    MODEL_ASSERT(count == 0 || txns != NULL);
+    MODEL_ASSERT(count == 0 || statuses != NULL);
+    MODEL_ASSERT(failed_txn != NULL);
+
+    /* parameter sanity check */
+    if ((count > 0 && (NULL == txns || NULL == statuses))
+     || NULL == failed_txn)
+    {
+        return VCCERT_ERROR_BLOCK_EXECUTE_SPECULATIVE_INVALID_ARG;
+    }
+
+    *failed_txn = VCCERT_BLOCK_NO_TXN;
+
+    if (0 == count)
+    {
+        return VCCERT_STATUS_SUCCESS;
+    }
+
+    /* the shadow options differ only in the artifact state resolver. */
+    memset(&spec, 0, sizeof(spec));
+    memcpy(&spec.options, txns[0].options, sizeof(spec.options));
+    spec.options.parser_options_artifact_state_resolver =
+        &spec_artifact_state_resolver;
+    spec.base = txns[0].options;
+    spec.alloc_opts = txns[0].options->alloc_opts;
+    spec.count = count;
+
+    retval = spec_build(&spec, txns);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_spec;
+    }
+
+    /* the first round runs every transaction. */
+    for (i = 0; i < count; ++i)
+    {
+        spec.dirty[i] = i;
+    }
+
+    spec.dirty_count = count;
+
+    /* Each round leaves the first stale transaction, and every one before
+     * it, consistent, so this runs at most count rounds. */
+    while (spec.dirty_count > 0)
+    {
+        retval =
+            vccert_thread_pool_run(
+                pool, &spec_run, &spec, spec.dirty_count);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            goto cleanup_spec;
+        }
+
+        /* publish the outcome of this round. */
+        for (k = 0; k < spec.dirty_count; ++k)
+        {
+            spec_txn_t* t = &spec.txns[spec.dirty[k]];
+
+            if (t->out_of_memory)
+            {
+                retval = VCCERT_ERROR_BLOCK_EXECUTE_SPECULATIVE_OUT_OF_MEMORY;
+                goto cleanup_spec;
+            }
+
+            t->status = t->next_status;
+            t->valid = (VCCERT_STATUS_SUCCESS == t->status);
+        }
+
+        /* re-run every transaction that read a stale version. */
+        spec.dirty_count = 0;
+        for (i = 0; i < count; ++i)
+        {
+            spec_txn_t* t = &spec.txns[i];
+
+            for (r = 0; r < t->read_count; ++r)
+            {
+                if (t->reads[r].version
+                        != spec_version_at(&spec, t->reads[r].artifact_id, i))
+                {
+                    spec.dirty[spec.dirty_count++] = i;
+                    break;
+                }
+            }
+        }
+    }
+
+    /* report every status, and the first failure in block order. */
+    retval = VCCERT_STATUS_SUCCESS;
+    for (i = 0; i < count; ++i)
+    {
+        statuses[i] = spec.txns[i].status;
+        if (VCCERT_STATUS_SUCCESS != statuses[i]
+         && VCCERT_BLOCK_NO_TXN == *failed_txn)
+        {
+            *failed_txn = i;
+            retval = statuses[i];
+        }
+    }
+
+cleanup_spec:
+    spec_cleanup(&spec);
+
+    return retval;
+}
+
+/**
+ * Hash an artifact UUID.
+ */
+static size_t spec_hash(const uint8_t* artifact_id)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (size_t i = 0; i < SPEC_ARTIFACT_ID_SIZE; ++i)
+    {
+        hash ^= artifact_id[i];
+        hash *= 1099511628211ULL;
+    }
+
+    return (size_t)hash;
+}
+
+/**
+ * Find the bucket for an artifact, or the empty bucket where it belongs.
+ */
+static spec_bucket_t* spec_find(
+    block_speculation_t* spec, const uint8_t* artifact_id)
+{
+    size_t b = spec_hash(artifact_id) & spec->mask;
+
+    while (NULL != spec->buckets[b].artifact_id
+        && memcmp(
+            spec->buckets[b].artifact_id, artifact_id, SPEC_ARTIFACT_ID_SIZE))
+    {
+        b = (b + 1) & spec->mask;
+    }
+
+    return &spec->buckets[b];
+}
+
+/**
+ * Allocate the executor state, create a shadow parser for each transaction,
+ * and index the version each transaction writes.
+ */
+static int spec_build(
+    block_speculation_t* spec, vccert_parser_context_t* txns)
+{
+    int retval;
+    size_t i, buckets;
+    const uint8_t* value;
+    size_t size;
+
+    /* keep the artifact table at most half full. */
+    for (buckets = 2; buckets < 2 * spec->count; buckets <<= 1)
+        ;
+
+    spec->txns =
+        (spec_txn_t*)allocate(
+            spec->alloc_opts, spec->count * sizeof(spec_txn_t));
+    spec->buckets =
+        (spec_bucket_t*)allocate(
+            spec->alloc_opts, buckets * sizeof(spec_bucket_t));
+    spec->dirty =
+        (size_t*)allocate(spec->alloc_opts, spec->count * sizeof(size_t));
+    if (NULL == spec->txns || NULL == spec->buckets || NULL == spec->dirty)
+    {
+        return VCCERT_ERROR_BLOCK_EXECUTE_SPECULATIVE_OUT_OF_MEMORY;
+    }
+
+    memset(spec->txns, 0, spec->count * sizeof(spec_txn_t));
+    memset(spec->buckets, 0, buckets * sizeof(spec_bucket_t));
+    spec->mask = buckets - 1;
+
+    for (i = 0; i < spec->count; ++i)
+    {
+        spec_txn_t* t = &spec->txns[i];
+
+        /* the shadow parser covers the same attested bytes. */
+        retval =
+            vccert_parser_init(
+                &spec->options, &t->parser, txns[i].cert, txns[i].raw_size);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        t->initialized = true;
+        t->parser.size = txns[i].size;
+        t->prev_writer = VCCERT_BLOCK_NO_TXN;
+        t->valid = true;
+
+        t->reads =
+            (spec_read_t*)allocate(
+                spec->alloc_opts, SPEC_INITIAL_READS * sizeof(spec_read_t));
+        if (NULL == t->reads)
+        {
+            return VCCERT_ERROR_BLOCK_EXECUTE_SPECULATIVE_OUT_OF_MEMORY;
+        }
+
+        t->read_capacity = SPEC_INITIAL_READS;
+
+        /* a transaction writes a version only if it names the new state. */
+        if (VCCERT_STATUS_SUCCESS !=
+                vccert_parser_find_short(
+                    &txns[i], VCCERT_FIELD_TYPE_ARTIFACT_ID, &t->artifact_id,
+                    &size)
+         || SPEC_ARTIFACT_ID_SIZE != size
+         || VCCERT_STATUS_SUCCESS !=
+                vccert_parser_find_short(
+                    &txns[i], VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE, &value,
+                    &size)
+         || sizeof(uint16_t) != size)
+        {
+            t->artifact_id = NULL;
+            continue;
+        }
+
+        t->new_state = (int32_t)((value[0] << 8) | value[1]);
+
+        if (VCCERT_STATUS_SUCCESS !=
+                vccert_parser_find_short(
+                    &txns[i], VCCERT_FIELD_TYPE_CERTIFICATE_ID, &t->txn_id,
+                    &size)
+         || SPEC_ARTIFACT_ID_SIZE != size)
+        {
+            t->txn_id = NULL;
+        }
+
+        /* chain this version onto the previous one for its artifact. */
+        spec_bucket_t* bucket = spec_find(spec, t->artifact_id);
+        if (NULL == bucket->artifact_id)
+        {
+            bucket->artifact_id = t->artifact_id;
+        }
+        else
+        {
+            t->prev_writer = bucket->last_writer;
+        }
+
+        bucket->last_writer = i;
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Get the version of an artifact seen by the transaction at index: the last
+ * passing transaction before it that wrote the artifact.
+ */
+static size_t spec_version_at(
+    block_speculation_t* spec, const uint8_t* artifact_id, size_t index)
+{
+    spec_bucket_t* bucket = spec_find(spec, artifact_id);
+    if (NULL == bucket->artifact_id)
+    {
+        return VCCERT_BLOCK_NO_TXN;
+    }
+
+    size_t j = bucket->last_writer;
+    while (VCCERT_BLOCK_NO_TXN != j && (j >= index || !spec->txns[j].valid))
+    {
+        j = spec->txns[j].prev_writer;
+    }
+
+    return j;
+}
+
+/**
+ * Artifact state resolver used by contracts under speculation.  Reads made by
+ * a transaction in the block are recorded and served from the versioned
+ * view; any other read goes to the caller's resolver.
+ */
+static int32_t spec_artifact_state_resolver(
+    void* options, void* parser, const uint8_t* artifact_id,
+    vccrypt_buffer_t* txn_id)
+{
+    block_speculation_t* spec = (block_speculation_t*)options;
+    uintptr_t offset = (uintptr_t)parser - (uintptr_t)spec->txns;
+
+    /* reads from a nested parser see the state before the block. */
+    if ((uintptr_t)parser < (uintptr_t)spec->txns
+     || offset >= spec->count * sizeof(spec_txn_t)
+     || 0 != offset % sizeof(spec_txn_t))
+    {
+        return
+            spec->base->parser_options_artifact_state_resolver(
+                spec->base, parser, artifact_id, txn_id);
+    }
+
+    spec_txn_t* t = &spec->txns[offset / sizeof(spec_txn_t)];
+    size_t version =
+        spec_version_at(spec, artifact_id, offset / sizeof(spec_txn_t));
+
+    /* record the read, growing the read set if needed. */
+    if (t->read_count == t->read_capacity)
+    {
+        spec_read_t* reads =
+            (spec_read_t*)reallocate(
+                spec->alloc_opts, t->reads,
+                t->read_capacity * sizeof(spec_read_t),
+                2 * t->read_capacity * sizeof(spec_read_t));
+        if (NULL == reads)
+        {
+            t->out_of_memory = true;
+            return -1;
+        }
+
+        t->reads = reads;
+        t->read_capacity *= 2;
+    }
+
+    memcpy(t->reads[t->read_count].artifact_id, artifact_id,
+        SPEC_ARTIFACT_ID_SIZE);
+    t->reads[t->read_count].version = version;
+    ++t->read_count;
+
+    if (VCCERT_BLOCK_NO_TXN == version)
+    {
+        return
+            spec->base->parser_options_artifact_state_resolver(
+                spec->base, parser, artifact_id, txn_id);
+    }
+
+    spec_txn_t* writer = &spec->txns[version];
+    if (NULL != txn_id && NULL != writer->txn_id
+     && txn_id->size >= SPEC_ARTIFACT_ID_SIZE)
+    {
+        memcpy(txn_id->data, writer->txn_id, SPEC_ARTIFACT_ID_SIZE);
+    }
+
+    return writer->new_state;
+}
+
+/**
+ * Run one stale contract.
+ *
+ * \param context       The block_speculation_t for this block.
+ * \param index         The index into the dirty list.
+ * \param worker        The id of the worker running this contract.
+ */
+static void spec_run(void* context, size_t index, size_t worker)
+{
+    block_speculation_t* spec = (block_speculation_t*)context;
+    spec_txn_t* t = &spec->txns[spec->dirty[index]];
+
+    (void)worker;
+
+    t->read_count = 0;
+    t->next_status = vccert_parser_attest_contract(&t->parser);
+}
+
+/**
+ * Release the executor state.
+ */
+static void spec_cleanup(block_speculation_t* spec)
+{
+    if (NULL != spec->txns)
+    {
+        for (size_t i = 0; i < spec->count; ++i)
+        {
+            if (spec->txns[i].initialized)
+            {
+                dispose((disposable_t*)&spec->txns[i].parser);
+            }
+
+            if (NULL != spec->txns[i].reads)
+            {
+                release(spec->alloc_opts, spec->txns[i].reads);
+            }
+        }
+
+        release(spec->alloc_opts, spec->txns);
+    }
+
+    if (NULL != spec->buckets)
+    {
+        release(spec->alloc_opts, spec->buckets);
+    }
+
+    if (NULL != spec->dirty)
+    {
+        release(spec->alloc_opts, spec->dirty);
+    }
+
+    memset(spec, 0, sizeof(block_speculation_t));
+}
@@ -0,0 +1,46 @@
+/**
+ * \file vccert_block_filter_hash.c
+ *
+ * Hash an id for a block filter.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "block_filter_internal.h"
+
+/**
+ * \brief Hash an id for a block filter.
+ *
+ * The field type is hashed with the id, so that artifact and certificate ids
+ * set different bits.
+ *
+ * \param field             The field type the id was found in.
+ * \param id                The 128-bit id.
+ *
+ * \returns the hash.
+ */
+uint64_t vccert_block_filter_hash(uint16_t field, const uint8_t* id)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    MODEL_ASSERT(id != NULL);
+
+    /* FNV-1a over the field type and the id. */
+    hash = (hash ^ (uint8_t)(field >> 8)) * 1099511628211ULL;
+    hash = (hash ^ (uint8_t)field) * 1099511628211ULL;
+    for (int i = 0; i < 16; ++i)
+    {
+        hash = (hash ^ id[i]) * 1099511628211ULL;
+    }
+
+    /* mix, so that every bit of the result depends on every bit of the id. */
+    hash ^= hash >> 30;
+    hash *= 0xBF58476D1CE4E5B9ULL;
+    hash ^= hash >> 27;
+    hash *= 0x94D049BB133111EBULL;
+    hash ^= hash >> 31;
+
+    return hash;
+}
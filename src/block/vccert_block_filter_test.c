@@ -0,0 +1,70 @@
+/**
+ * \file vccert_block_filter_test.c
+ *
+ * Check an id against a block filter.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "block_filter_internal.h"
+
+/**
+ * \brief Check an id against a block filter.
+ *
+ * \param filter            The block filter.
+ * \param size              The size of the block filter.
+ * \param field             The field type the id would be found in.
+ * \param id                The 128-bit id.
+ *
+ * \returns false if the id is definitely not in the block, and true otherwise.
+ */
+bool vccert_block_filter_test(
+    const uint8_t* filter, size_t size, uint16_t field, const uint8_t* id)
+{
+    uint32_t probes = 0;
+    uint64_t bits = 0;
+
+    MODEL_ASSERT(id != NULL);
+
+    /* without a usable filter, nothing can be ruled out. */
+    if (NULL == filter || NULL == id || size < VCCERT_BLOCK_FILTER_HEADER_SIZE
+     || memcmp(
+            filter, VCCERT_BLOCK_FILTER_MAGIC,
+            strlen(VCCERT_BLOCK_FILTER_MAGIC)))
+    {
+        return true;
+    }
+
+    for (int i = 4; i < 8; ++i)
+    {
+        probes = (probes << 8) | filter[i];
+    }
+
+    for (int i = 8; i < 16; ++i)
+    {
+        bits = (bits << 8) | filter[i];
+    }
+
+    if (0 == probes || probes > VCCERT_BLOCK_FILTER_MAX_PROBES || 0 == bits
+     || 0 != bits % 64
+     || bits / 8 != size - VCCERT_BLOCK_FILTER_HEADER_SIZE)
+    {
+        return true;
+    }
+
+    const uint8_t* set = filter + VCCERT_BLOCK_FILTER_HEADER_SIZE;
+    uint64_t hash = vccert_block_filter_hash(field, id);
+    for (unsigned int i = 0; i < probes; ++i)
+    {
+        uint64_t bit = vccert_block_filter_bit(hash, i, bits);
+        if (0 == (set[bit / 8] & (1U << (bit % 8))))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
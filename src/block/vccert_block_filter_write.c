@@ -0,0 +1,160 @@
+/**
+ * \file vccert_block_filter_write.c
+ *
+ * Write a filter over the ids in a block.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/fields.h>
+
+#include "block_filter_internal.h"
+#include "../parser/parser_internal.h"
+
+/* forward decls */
+static int vccert_block_filter_walk(
+    const vccert_block_view_t* view, uint8_t* set, uint64_t bits,
+    size_t* ids);
+
+/**
+ * \brief Write a filter over the artifact and certificate ids of the wrapped
+ * transactions in a block.
+ *
+ * The filter is sized for a false positive rate of about one percent.  Call
+ * this first with a NULL buffer to get the size of the filter.
+ *
+ * \param view              The block view.
+ * \param buffer            The buffer to receive the filter, or NULL.
+ * \param size              The size of the buffer.
+ * \param required          Pointer to receive the size of the filter.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BLOCK_FILTER_WRITE_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_FILTER_WRITE_BUFFER_TOO_SMALL if the buffer
+ *        is too small.
+ *      - \ref VCCERT_ERROR_BLOCK_FILTER_WRITE_BAD_TXN if a wrapped transaction
+ *        is malformed.
+ */
+int vccert_block_filter_write(
+    const vccert_block_view_t* view, uint8_t* buffer, size_t size,
+    size_t* required)
+{
+    int retval;
+    size_t ids;
+
+    MODEL_ASSERT(view != NULL);
+    MODEL_ASSERT(view->block != NULL);
+    MODEL_ASSERT(required != NULL);
+
+    /* parameter sanity check */
+    if (NULL == view || NULL == view->block || NULL == required)
+    {
+        return VCCERT_ERROR_BLOCK_FILTER_WRITE_INVALID_ARG;
+    }
+
+    /* count the ids to size the filter. */
+    retval = vccert_block_filter_walk(view, NULL, 0, &ids);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    uint64_t bits = (uint64_t)ids * VCCERT_BLOCK_FILTER_BITS_PER_ID;
+    bits = bits < 64 ? 64 : (bits + 63) & ~(uint64_t)63;
+    *required = VCCERT_BLOCK_FILTER_HEADER_SIZE + (size_t)(bits / 8);
+
+    /* the caller only wants the size. */
+    if (NULL == buffer)
+    {
+        return VCCERT_STATUS_SUCCESS;
+    }
+
+    if (size < *required)
+    {
+        return VCCERT_ERROR_BLOCK_FILTER_WRITE_BUFFER_TOO_SMALL;
+    }
+
+    /* write the header. */
+    memset(buffer, 0, *required);
+    memcpy(
+        buffer, VCCERT_BLOCK_FILTER_MAGIC, strlen(VCCERT_BLOCK_FILTER_MAGIC));
+    for (int i = 0; i < 4; ++i)
+    {
+        buffer[7 - i] = (uint8_t)(VCCERT_BLOCK_FILTER_PROBES >> (8 * i));
+    }
+
+    for (int i = 0; i < 8; ++i)
+    {
+        buffer[15 - i] = (uint8_t)(bits >> (8 * i));
+    }
+
+    return
+        vccert_block_filter_walk(
+            view, buffer + VCCERT_BLOCK_FILTER_HEADER_SIZE, bits, &ids);
+}
+
+/**
+ * Walk the ids in every wrapped transaction of a block, counting them and,
+ * if given a bit set, adding them to it.
+ *
+ * \param view              The block view.
+ * \param set               The filter bits, or NULL to only count.
+ * \param bits              The number of filter bits.
+ * \param ids               Pointer to receive the number of ids.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int vccert_block_filter_walk(
+    const vccert_block_view_t* view, uint8_t* set, uint64_t bits,
+    size_t* ids)
+{
+    *ids = 0;
+
+    for (size_t i = 0; i < view->count; ++i)
+    {
+        const uint8_t* txn = view->block->cert + view->txns[i].offset;
+        size_t txn_size = view->txns[i].size;
+        size_t offset = 0;
+
+        while (offset < txn_size)
+        {
+            uint16_t field_type;
+            size_t field_size;
+            const uint8_t* field;
+
+            if (VCCERT_STATUS_SUCCESS !=
+                    vccert_parser_field(
+                        txn, txn_size, offset, &field_type, &field_size,
+                        &field, &offset))
+            {
+                return VCCERT_ERROR_BLOCK_FILTER_WRITE_BAD_TXN;
+            }
+
+            if (16 != field_size
+             || (VCCERT_FIELD_TYPE_ARTIFACT_ID != field_type
+              && VCCERT_FIELD_TYPE_CERTIFICATE_ID != field_type))
+            {
+                continue;
+            }
+
+            ++*ids;
+            if (NULL == set)
+            {
+                continue;
+            }
+
+            uint64_t hash = vccert_block_filter_hash(field_type, field);
+            for (unsigned int p = 0; p < VCCERT_BLOCK_FILTER_PROBES; ++p)
+            {
+                uint64_t bit = vccert_block_filter_bit(hash, p, bits);
+                set[bit / 8] |= (uint8_t)(1U << (bit % 8));
+            }
+        }
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
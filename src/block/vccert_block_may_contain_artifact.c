@@ -0,0 +1,32 @@
+/**
+ * \file vccert_block_may_contain_artifact.c
+ *
+ * Check a block filter for an artifact id.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccert/fields.h>
+
+#include "block_filter_internal.h"
+
+/**
+ * \brief Check whether a block may hold a transaction for an artifact.
+ *
+ * \param filter            The block filter.
+ * \param size              The size of the block filter.
+ * \param artifact_id       The 128-bit artifact id.
+ *
+ * \returns false if no wrapped transaction in the block has this artifact
+ * id, and true if one may.
+ */
+bool vccert_block_may_contain_artifact(
+    const uint8_t* filter, size_t size, const uint8_t* artifact_id)
+{
+    MODEL_ASSERT(artifact_id != NULL);
+
+    return
+        vccert_block_filter_test(
+            filter, size, VCCERT_FIELD_TYPE_ARTIFACT_ID, artifact_id);
+}
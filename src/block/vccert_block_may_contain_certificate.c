@@ -0,0 +1,32 @@
+/**
+ * \file vccert_block_may_contain_certificate.c
+ *
+ * Check a block filter for a certificate id.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccert/fields.h>
+
+#include "block_filter_internal.h"
+
+/**
+ * \brief Check whether a block may hold a transaction with a certificate id.
+ *
+ * \param filter            The block filter.
+ * \param size              The size of the block filter.
+ * \param certificate_id    The 128-bit certificate id.
+ *
+ * \returns false if no wrapped transaction in the block has this certificate
+ * id, and true if one may.
+ */
+bool vccert_block_may_contain_certificate(
+    const uint8_t* filter, size_t size, const uint8_t* certificate_id)
+{
+    MODEL_ASSERT(certificate_id != NULL);
+
+    return
+        vccert_block_filter_test(
+            filter, size, VCCERT_FIELD_TYPE_CERTIFICATE_ID, certificate_id);
+}
@@ -0,0 +1,51 @@
+/**
+ * \file vccert_block_txn_at.c
+ *
+ * Get a wrapped transaction from a block by index.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccert/block.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Get the wrapped transaction certificate at the given index.
+ *
+ * \param view              The block view.
+ * \param index             The index of the transaction, in block order.
+ * \param value             Pointer to receive the transaction certificate.
+ * \param size              Pointer to receive the transaction size.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BLOCK_TXN_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_TXN_OUT_OF_RANGE if the index is past the end
+ *        of the block.
+ */
+int vccert_block_txn_at(
+    const vccert_block_view_t* view, size_t index, const uint8_t** value,
+    size_t* size)
+{
+    MODEL_ASSERT(view != NULL);
+    MODEL_ASSERT(view->block != NULL);
+    MODEL_ASSERT(value != NULL);
+    MODEL_ASSERT(size != NULL);
+
+    if (view == NULL || view->block == NULL || value == NULL || size == NULL)
+    {
+        return VCCERT_ERROR_BLOCK_TXN_INVALID_ARG;
+    }
+
+    if (index >= view->count)
+    {
+        return VCCERT_ERROR_BLOCK_TXN_OUT_OF_RANGE;
+    }
+
+    *value = view->block->cert + view->txns[index].offset;
+    *size = view->txns[index].size;
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,25 @@
+/**
+ * \file vccert_block_txn_count.c
+ *
+ * Get the number of wrapped transactions in a block.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccert/block.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Return the number of wrapped transactions in a block.
+ *
+ * \param view              The block view.
+ *
+ * \returns the number of wrapped transactions.
+ */
+size_t vccert_block_txn_count(const vccert_block_view_t* view)
+{
+    MODEL_ASSERT(view != NULL);
+
+    return (NULL == view) ? 0 : view->count;
+}
@@ -0,0 +1,56 @@
+/**
+ * \file vccert_block_txn_parser_init.c
+ *
+ * Initialize a parser for a wrapped transaction in a block.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccert/block.h>
+#include <vpr/parameters.h>
+
+/**
+ * \brief Initialize a parser context for the wrapped transaction at the given
+ * index.
+ *
+ * The parser uses the block parser's options and can be attested like any
+ * other certificate.  The transaction bytes are not copied.  This parser
+ * context is owned by the caller and must be disposed of when no longer needed
+ * by calling dispose().
+ *
+ * \param view              The block view.
+ * \param index             The index of the transaction, in block order.
+ * \param txn               The parser context to initialize.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BLOCK_TXN_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_TXN_OUT_OF_RANGE if the index is past the end
+ *        of the block.
+ *      - a non-zero error code on failure.
+ */
+int vccert_block_txn_parser_init(
+    const vccert_block_view_t* view, size_t index,
+    vccert_parser_context_t* txn)
+{
+    int retval;
+    const uint8_t* value;
+    size_t size;
+
+    MODEL_ASSERT(txn != NULL);
+
+    if (txn == NULL)
+    {
+        return VCCERT_ERROR_BLOCK_TXN_INVALID_ARG;
+    }
+
+    retval = vccert_block_txn_at(view, index, &value, &size);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return vccert_parser_init(view->block->options, txn, value, size);
+}
@@ -0,0 +1,450 @@
+/**
+ * \file vccert_block_validate.c
+ *
+ * Validate a block certificate and its wrapped transactions using a pipeline
+ * of worker threads.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/block.h>
+#include <vpr/parameters.h>
+
+#include "../parser/parser_internal.h"
+#include "../thread_pool/thread_pool_internal.h"
+
+/* the number of queue entries per worker between two stages. */
+#define BLOCK_VALIDATE_QUEUE_DEPTH 4
+
+/**
+ * Per-transaction pipeline state.
+ */
+typedef struct block_txn_slot
+{
+    vccert_parser_context_t parser;
+    int status;
+    bool initialized;
+    bool ready;
+} block_txn_slot_t;
+
+/**
+ * Pipeline state shared by every worker.
+ *
+ * The split and contract stages are each run by one worker at a time; a
+ * worker becomes the owner of a stage by setting its owner flag.  The
+ * signature stage is run by any number of workers at once.
+ */
+typedef struct block_pipeline
+{
+    vccert_parser_context_t* block;
+    uint64_t height;
+    bool verify_contracts;
+    vccert_block_view_t view;
+    block_txn_slot_t* slots;
+    vccert_queue_t verify_queue;
+    vccert_queue_t contract_queue;
+
+    /* block signature stage */
+    int block_claimed;
+    int block_done;
+    int block_status;
+
+    /* split stage, guarded by split_owner */
+    int split_owner;
+    size_t next_split;
+
+    /* contract stage, guarded by contract_owner */
+    int contract_owner;
+    size_t next_contract;
+    bool contract_failed;
+
+    /* the number of transactions that have left the pipeline. */
+    size_t finished;
+} block_pipeline_t;
+
+/* forward decls */
+static void block_validate_worker(void* context, size_t index, size_t worker);
+
+/**
+ * \brief Validate a block certificate and every transaction it wraps.
+ *
+ * The block is walked once to find its wrapped transactions.  Worker threads
+ * from the pool then run the remaining stages as a pipeline connected by
+ * bounded lock-free queues: each transaction is split out into its own parser
+ * context, its signature is verified with vccert_parser_attest(), and, if
+ * requested, its contract is run.  Signatures are verified in parallel, but
+ * contracts run one at a time in block order, so contracts see the same
+ * sequence of calls as a sequential loop.  The block's own signature is
+ * checked concurrently, and every transaction must lie within the signed part
+ * of the block.
+ *
+ * All resolvers in the block parser's options are called from worker threads
+ * and must be safe to call concurrently.
+ *
+ * \param block             The parser context for the block certificate.
+ * \param height            The current height of the blockchain.
+ * \param verify_contracts  Set to true if the contract for each wrapped
+ *                          transaction should be verified.
+ * \param pool              The thread pool to use, or NULL to validate on the
+ *                          calling thread.
+ * \param failed_txn        Pointer to receive the index of the first
+ *                          transaction, in block order, that failed, or
+ *                          \ref VCCERT_BLOCK_NO_TXN.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BLOCK_VALIDATE_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_VALIDATE_OUT_OF_MEMORY if the pipeline state
+ *        could not be allocated.
+ *      - \ref VCCERT_ERROR_BLOCK_VALIDATE_UNSIGNED_TXN if a transaction lies
+ *        outside of the signed part of the block.
+ *      - the error returned by vccert_parser_attest() for the block, or for
+ *        the first failing transaction.
+ *      - a non-zero error code on failure.
+ */
+int vccert_block_validate(
+    vccert_parser_context_t* block, uint64_t height, bool verify_contracts,
+    vccert_thread_pool_t* pool, size_t* failed_txn)
+{
+    int retval;
+    size_t i, workers, depth;
+    block_pipeline_t p;
+
+    MODEL_ASSERT(block != NULL);
+    MODEL_ASSERT(block->options != NULL);
+    MODEL_ASSERT(block->options->alloc_opts != NULL);
+    MODEL_ASSERT(failed_txn != NULL);
+
+    /* parameter sanity check */
+    if (block == NULL || block->options == NULL
+     || block->options->alloc_opts == NULL || failed_txn == NULL)
+    {
+        return VCCERT_ERROR_BLOCK_VALIDATE_INVALID_ARG;
+    }
+
+    *failed_txn = VCCERT_BLOCK_NO_TXN;
+
+    allocator_options_t* alloc_opts = block->options->alloc_opts;
+    workers = (NULL == pool) ? 1 : pool->worker_count;
+    depth = BLOCK_VALIDATE_QUEUE_DEPTH * workers;
+
+    memset(&p, 0, sizeof(p));
+    p.block = block;
+    p.height = height;
+    p.verify_contracts = verify_contracts;
+
+    /* structural walk: index the wrapped transactions in the raw block. */
+    block->size = block->raw_size;
+    retval = vccert_block_view_init(&p.view, alloc_opts, block);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (p.view.count > 0)
+    {
+        p.slots = (block_txn_slot_t*)
+            allocate(alloc_opts, p.view.count * sizeof(block_txn_slot_t));
+        if (NULL == p.slots)
+        {
+            retval = VCCERT_ERROR_BLOCK_VALIDATE_OUT_OF_MEMORY;
+            goto dispose_view;
+        }
+
+        memset(p.slots, 0, p.view.count * sizeof(block_txn_slot_t));
+    }
+
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_queue_init(&p.verify_queue, alloc_opts, depth))
+    {
+        retval = VCCERT_ERROR_BLOCK_VALIDATE_OUT_OF_MEMORY;
+        goto release_slots;
+    }
+
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_queue_init(&p.contract_queue, alloc_opts, depth))
+    {
+        retval = VCCERT_ERROR_BLOCK_VALIDATE_OUT_OF_MEMORY;
+        goto dispose_verify_queue;
+    }
+
+    /* every worker runs the same loop until the pipeline drains. */
+    retval = vccert_thread_pool_run(pool, &block_validate_worker, &p, workers);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        goto dispose_contract_queue;
+    }
+
+    /* the block itself must be signed... */
+    if (VCCERT_STATUS_SUCCESS != p.block_status)
+    {
+        retval = p.block_status;
+        goto dispose_contract_queue;
+    }
+
+    /* ...and, in block order, every transaction must be covered by that
+     * signature and must have passed each stage. */
+    for (i = 0; i < p.view.count; ++i)
+    {
+        if (p.view.txns[i].offset + p.view.txns[i].size > block->size)
+        {
+            *failed_txn = i;
+            retval = VCCERT_ERROR_BLOCK_VALIDATE_UNSIGNED_TXN;
+            goto dispose_contract_queue;
+        }
+
+        if (VCCERT_STATUS_SUCCESS != p.slots[i].status)
+        {
+            *failed_txn = i;
+            retval = p.slots[i].status;
+            goto dispose_contract_queue;
+        }
+    }
+
+    retval = VCCERT_STATUS_SUCCESS;
+
+dispose_contract_queue:
+    dispose((disposable_t*)&p.contract_queue);
+
+dispose_verify_queue:
+    dispose((disposable_t*)&p.verify_queue);
+
+release_slots:
+    for (i = 0; NULL != p.slots && i < p.view.count; ++i)
+    {
+        if (p.slots[i].initialized)
+        {
+            dispose((disposable_t*)&p.slots[i].parser);
+        }
+    }
+
+    if (NULL != p.slots)
+    {
+        release(alloc_opts, p.slots);
+    }
+
+dispose_view:
+    dispose((disposable_t*)&p.view);
+
+    return retval;
+}
+
+/**
+ * Try to become the only worker running a stage.
+ */
+static bool claim(int* owner)
+{
+    int expected = 0;
+
+    return __atomic_compare_exchange_n(
+        owner, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+}
+
+/**
+ * Give up ownership of a stage.
+ */
+static void unclaim(int* owner)
+{
+    __atomic_store_n(owner, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * Split stage: give each transaction its own parser and queue it for
+ * signature verification, until the queue is full.
+ */
+static bool split_stage(block_pipeline_t* p)
+{
+    bool progress = false;
+
+    if (!claim(&p->split_owner))
+    {
+        return false;
+    }
+
+    while (p->next_split < p->view.count)
+    {
+        block_txn_slot_t* slot = &p->slots[p->next_split];
+
+        if (!slot->initialized)
+        {
+            slot->status =
+                vccert_block_txn_parser_init(
+                    &p->view, p->next_split, &slot->parser);
+            slot->initialized = (VCCERT_STATUS_SUCCESS == slot->status);
+        }
+
+        if (!vccert_queue_push(&p->verify_queue, p->next_split))
+        {
+            break;
+        }
+
+        ++p->next_split;
+        progress = true;
+    }
+
+    unclaim(&p->split_owner);
+
+    return progress;
+}
+
+/**
+ * Return true if the block's own signature stage has finished and rejects the
+ * given transaction, either because the block is not signed or because the
+ * transaction lies outside the signed part of the block.
+ */
+static bool block_rejects(block_pipeline_t* p, size_t index)
+{
+    if (!__atomic_load_n(&p->block_done, __ATOMIC_ACQUIRE))
+    {
+        return false;
+    }
+
+    return VCCERT_STATUS_SUCCESS != p->block_status
+        || p->view.txns[index].offset + p->view.txns[index].size
+                > p->block->size;
+}
+
+/**
+ * Contract stage: collect verified transactions from the queue and run their
+ * contracts strictly in block order.  After the first failure, no further
+ * contracts are run, just as in a sequential loop.  Once the block itself is
+ * known to be rejected, no further contracts are run either.
+ */
+static bool contract_stage(block_pipeline_t* p)
+{
+    bool progress = false;
+    size_t index;
+
+    if (!claim(&p->contract_owner))
+    {
+        return false;
+    }
+
+    while (vccert_queue_pop(&p->contract_queue, &index))
+    {
+        p->slots[index].ready = true;
+        progress = true;
+    }
+
+    while (p->next_contract < p->view.count
+        && p->slots[p->next_contract].ready)
+    {
+        block_txn_slot_t* slot = &p->slots[p->next_contract];
+
+        if (p->contract_failed || VCCERT_STATUS_SUCCESS != slot->status
+         || block_rejects(p, p->next_contract))
+        {
+            p->contract_failed = true;
+        }
+        else
+        {
+            slot->status = vccert_parser_attest_contract(&slot->parser);
+            p->contract_failed = (VCCERT_STATUS_SUCCESS != slot->status);
+        }
+
+        ++p->next_contract;
+        __atomic_add_fetch(&p->finished, 1, __ATOMIC_RELEASE);
+        progress = true;
+    }
+
+    unclaim(&p->contract_owner);
+
+    return progress;
+}
+
+/**
+ * Signature stage: verify one queued transaction and hand it to the contract
+ * stage.
+ */
+static bool verify_stage(block_pipeline_t* p)
+{
+    size_t index;
+
+    if (!vccert_queue_pop(&p->verify_queue, &index))
+    {
+        return false;
+    }
+
+    block_txn_slot_t* slot = &p->slots[index];
+    if (VCCERT_STATUS_SUCCESS == slot->status)
+    {
+        slot->status = vccert_parser_attest(&slot->parser, p->height, false);
+    }
+
+    if (!p->verify_contracts)
+    {
+        __atomic_add_fetch(&p->finished, 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    /* if the contract queue is full, help drain it. */
+    while (!vccert_queue_push(&p->contract_queue, index))
+    {
+        if (!contract_stage(p))
+        {
+            vccert_thread_pool_yield();
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Block signature stage: verify the block's own signature.  This is claimed by
+ * the first worker to get here.
+ */
+static bool block_stage(block_pipeline_t* p)
+{
+    if (!claim(&p->block_claimed))
+    {
+        return false;
+    }
+
+    p->block_status = vccert_parser_attest(p->block, p->height, false);
+    __atomic_store_n(&p->block_done, 1, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+/**
+ * The loop run by every worker.  Each pass tries every stage, so a single
+ * worker can drive the whole pipeline on its own.
+ *
+ * \param context       The block_pipeline_t for this block.
+ * \param index         The index of this worker loop.
+ * \param worker        The id of the worker running this loop.
+ */
+static void block_validate_worker(void* context, size_t index, size_t worker)
+{
+    block_pipeline_t* p = (block_pipeline_t*)context;
+
+    (void)index;
+    (void)worker;
+
+    for (;;)
+    {
+        bool progress = block_stage(p);
+
+        progress |= split_stage(p);
+        progress |= verify_stage(p);
+
+        if (p->verify_contracts)
+        {
+            progress |= contract_stage(p);
+        }
+
+        if (__atomic_load_n(&p->finished, __ATOMIC_ACQUIRE) == p->view.count
+         && __atomic_load_n(&p->block_done, __ATOMIC_ACQUIRE))
+        {
+            return;
+        }
+
+        if (!progress)
+        {
+            vccert_thread_pool_yield();
+        }
+    }
+}
@@ -0,0 +1,142 @@
+/**
+ * \file vccert_block_view_init.c
+ *
+ * Index the wrapped transactions in a block certificate.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/block.h>
+#include <vccert/fields.h>
+#include <vpr/parameters.h>
+
+#include "../parser/parser_internal.h"
+
+/* the initial number of entries in the offset table. */
+#define BLOCK_VIEW_INITIAL_CAPACITY 16
+
+/* forward decls */
+static void vccert_block_view_dispose(void* view);
+
+/**
+ * \brief Initialize a block view by indexing the wrapped transactions in a
+ * block certificate.
+ *
+ * The block is walked within its attested bounds if it has been attested, and
+ * within its raw bounds otherwise.  This view is owned by the caller and must
+ * be disposed of when no longer needed by calling dispose().
+ *
+ * \param view              The block view to initialize.
+ * \param alloc_opts        The allocator options to use for the offset table.
+ * \param block             The parser context for the block certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BLOCK_VIEW_INIT_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_BLOCK_VIEW_INIT_OUT_OF_MEMORY if the offset table
+ *        could not be allocated.
+ *      - \ref VCCERT_ERROR_BLOCK_VIEW_INIT_INVALID_FIELD_SIZE if the block
+ *        certificate is malformed.
+ */
+int vccert_block_view_init(
+    vccert_block_view_t* view, allocator_options_t* alloc_opts,
+    const vccert_parser_context_t* block)
+{
+    int retval;
+    size_t offset, next_offset, field_size;
+    uint16_t field_type;
+    const uint8_t* field;
+
+    MODEL_ASSERT(view != NULL);
+    MODEL_ASSERT(alloc_opts != NULL);
+    MODEL_ASSERT(block != NULL);
+    MODEL_ASSERT(block->cert != NULL);
+
+    /* parameter sanity check */
+    if (view == NULL || alloc_opts == NULL || block == NULL
+     || block->cert == NULL)
+    {
+        return VCCERT_ERROR_BLOCK_VIEW_INIT_INVALID_ARG;
+    }
+
+    memset(view, 0, sizeof(vccert_block_view_t));
+
+    view->txns = (vccert_block_txn_entry_t*)
+        allocate(alloc_opts,
+            BLOCK_VIEW_INITIAL_CAPACITY * sizeof(vccert_block_txn_entry_t));
+    if (NULL == view->txns)
+    {
+        return VCCERT_ERROR_BLOCK_VIEW_INIT_OUT_OF_MEMORY;
+    }
+
+    view->capacity = BLOCK_VIEW_INITIAL_CAPACITY;
+
+    /* walk every field in the block once, recording each wrapped txn. */
+    for (offset = 0; offset < block->size; offset = next_offset)
+    {
+        retval = vccert_parser_field(
+            block->cert, block->size, offset, &field_type, &field_size,
+            &field, &next_offset);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            retval = VCCERT_ERROR_BLOCK_VIEW_INIT_INVALID_FIELD_SIZE;
+            goto release_txns;
+        }
+
+        if (VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE != field_type)
+        {
+            continue;
+        }
+
+        /* grow the table by doubling when it is full. */
+        if (view->count == view->capacity)
+        {
+            vccert_block_txn_entry_t* txns = (vccert_block_txn_entry_t*)
+                reallocate(alloc_opts, view->txns,
+                    view->capacity * sizeof(vccert_block_txn_entry_t),
+                    2 * view->capacity * sizeof(vccert_block_txn_entry_t));
+            if (NULL == txns)
+            {
+                retval = VCCERT_ERROR_BLOCK_VIEW_INIT_OUT_OF_MEMORY;
+                goto release_txns;
+            }
+
+            view->txns = txns;
+            view->capacity *= 2;
+        }
+
+        view->txns[view->count].offset = (size_t)(field - block->cert);
+        view->txns[view->count].size = field_size;
+        ++view->count;
+    }
+
+    view->hdr.dispose = &vccert_block_view_dispose;
+    view->alloc_opts = alloc_opts;
+    view->block = block;
+
+    /* success */
+    return VCCERT_STATUS_SUCCESS;
+
+release_txns:
+    release(alloc_opts, view->txns);
+    memset(view, 0, sizeof(vccert_block_view_t));
+
+    return retval;
+}
+
+/**
+ * Dispose of a block view, releasing its offset table.
+ *
+ * \param view          The block view to dispose.
+ */
+static void vccert_block_view_dispose(void* view)
+{
+    vccert_block_view_t* v = (vccert_block_view_t*)view;
+
+    release(v->alloc_opts, v->txns);
+
+    memset(v, 0, sizeof(vccert_block_view_t));
+}
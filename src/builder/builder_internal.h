@@ -11,6 +11,15 @@
 
 #include <vccert/builder.h>
 
+/* Pick a byte-shuffle kernel for the array encoders, if one is available. */
+#if defined(__GNUC__) && __STDC_HOSTED__ \
+ && (defined(__x86_64__) || defined(__i386__))
+# define VCCERT_BUILDER_ENCODE_SSSE3 1
+#elif defined(__ARM_NEON) && defined(__BYTE_ORDER__) \
+ && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+# define VCCERT_BUILDER_ENCODE_NEON 1
+#endif
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 extern "C" {
@@ -27,6 +36,59 @@ void vccert_builder_write_fieldheader(
     vccert_builder_context_t* context, uint16_t field_type,
     size_t field_size);
 
+/**
+ * Append the signer ID and signature fields to a certificate using the given
+ * signing resources.
+ *
+ * \param context           The builder context.
+ * \param signer_id         The 128-bit signer UUID.
+ * \param sign              The digital signature context to use.
+ * \param private_key       The private key buffer to use.
+ * \param signature         Scratch buffer to receive the signature.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGN_INVALID_FIELD_SIZE if the signature
+ *             would overwrite memory.
+ *      - a nonzero value indicating error.
+ */
+int vccert_builder_sign_internal(
+    vccert_builder_context_t* context, const uint8_t* signer_id,
+    vccrypt_digital_signature_context_t* sign,
+    const vccrypt_buffer_t* private_key, vccrypt_buffer_t* signature);
+
+/**
+ * Encode an array of uint32_t fields as consecutive Big Endian records.
+ *
+ * Each record is the 16-bit field type, the 16-bit size (4), and the value,
+ * for 8 bytes per record.  The caller must ensure out has room for all
+ * records.
+ *
+ * \param out               The output buffer.
+ * \param fields            The short field ID of each record.
+ * \param values            The value of each record.
+ * \param count             The number of records to encode.
+ */
+void vccert_builder_encode_uint32_records(
+    uint8_t* out, const uint16_t* fields, const uint32_t* values,
+    size_t count);
+
+/**
+ * Encode an array of uint64_t fields as consecutive Big Endian records.
+ *
+ * Each record is the 16-bit field type, the 16-bit size (8), and the value,
+ * for 12 bytes per record.  The caller must ensure out has room for all
+ * records.
+ *
+ * \param out               The output buffer.
+ * \param fields            The short field ID of each record.
+ * \param values            The value of each record.
+ * \param count             The number of records to encode.
+ */
+void vccert_builder_encode_uint64_records(
+    uint8_t* out, const uint16_t* fields, const uint64_t* values,
+    size_t count);
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
@@ -0,0 +1,178 @@
+/**
+ * \file vccert_builder_add_field_index.c
+ *
+ * Add a field index covering the fields written so far.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/fields.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/* forward decls */
+static void field_index_sort(uint8_t* records, size_t count);
+static void field_index_sift(uint8_t* records, size_t root, size_t count);
+static void field_index_swap(uint8_t* records, size_t i, size_t j);
+
+/**
+ * \brief Add a field index covering every field added so far.
+ *
+ * The index records the type and header offset of each field, so that a parser
+ * can find fields in the attested certificate without walking it.  It should be
+ * added after the last data field and immediately before signing, so that it
+ * sits just before the signer ID and is covered by the signature.
+ *
+ * \param context           The builder context to use for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_ADD_INVALID_ARG if one of the arguments to
+ *              this method is invalid, or the index would not fit in the
+ *              certificate.
+ *      - \ref VCCERT_ERROR_BUILDER_ADD_TOO_BIG if the index would exceed the
+ *              max supported field size.
+ */
+int vccert_builder_add_field_index(vccert_builder_context_t* context)
+{
+    const size_t header_size = FIELD_TYPE_SIZE + FIELD_SIZE_SIZE;
+
+    MODEL_ASSERT(context != NULL);
+    MODEL_ASSERT(context->buffer.data != NULL);
+
+    /* verify that the parameters are valid. */
+    if (context == NULL || context->buffer.data == NULL
+     || context->offset > UINT32_MAX)
+    {
+        return VCCERT_ERROR_BUILDER_ADD_INVALID_ARG;
+    }
+
+    uint8_t* cert = (uint8_t*)context->buffer.data;
+
+    /* count the fields written so far. */
+    size_t count = 0;
+    for (size_t offset = 0; offset + header_size <= context->offset; ++count)
+    {
+        offset += header_size + (((size_t)cert[offset + 2] << 8)
+                                | cert[offset + 3]);
+    }
+
+    /* verify that the index does not exceed the max supported field size. */
+    if (count > (VCCERT_MAX_FIELD_SIZE - header_size)
+                    / VCCERT_FIELD_INDEX_RECORD_SIZE)
+    {
+        return VCCERT_ERROR_BUILDER_ADD_TOO_BIG;
+    }
+
+    /* verify that the index fits in the certificate. */
+    size_t index_size = count * VCCERT_FIELD_INDEX_RECORD_SIZE;
+    if (context->buffer.size < context->offset + header_size + index_size)
+    {
+        return VCCERT_ERROR_BUILDER_ADD_INVALID_ARG;
+    }
+
+    /* write one record per field, in certificate order. */
+    uint8_t* records = cert + context->offset + header_size;
+    uint8_t* out = records;
+    for (size_t offset = 0; out < records + index_size;
+         out += VCCERT_FIELD_INDEX_RECORD_SIZE)
+    {
+        out[0] = cert[offset];
+        out[1] = cert[offset + 1];
+        out[2] = (uint8_t)(offset >> 24);
+        out[3] = (uint8_t)(offset >> 16);
+        out[4] = (uint8_t)(offset >> 8);
+        out[5] = (uint8_t)offset;
+
+        offset += header_size + (((size_t)cert[offset + 2] << 8)
+                                | cert[offset + 3]);
+    }
+
+    /* Big Endian records sort bytewise by type, then by offset. */
+    field_index_sort(records, count);
+
+    /* write the field header in front of the records. */
+    vccert_builder_write_fieldheader(
+        context, VCCERT_FIELD_TYPE_FIELD_INDEX, index_size);
+    context->offset += index_size;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Sort index records in place with a heap sort, which needs no scratch space.
+ *
+ * \param records           The records to sort.
+ * \param count             The number of records.
+ */
+static void field_index_sort(uint8_t* records, size_t count)
+{
+    /* build a max heap. */
+    for (size_t i = count / 2; i > 0; --i)
+    {
+        field_index_sift(records, i - 1, count);
+    }
+
+    /* repeatedly move the largest record to the end. */
+    for (size_t end = count; end > 1; --end)
+    {
+        field_index_swap(records, 0, end - 1);
+        field_index_sift(records, 0, end - 1);
+    }
+}
+
+/**
+ * Sift a record down the heap until both of its children are smaller.
+ *
+ * \param records           The heap.
+ * \param root              The record to sift down.
+ * \param count             The number of records in the heap.
+ */
+static void field_index_sift(uint8_t* records, size_t root, size_t count)
+{
+    for (size_t child = 2 * root + 1; child < count; child = 2 * root + 1)
+    {
+        /* pick the larger child. */
+        if (child + 1 < count
+         && 0 > memcmp(
+                    records + child * VCCERT_FIELD_INDEX_RECORD_SIZE,
+                    records + (child + 1) * VCCERT_FIELD_INDEX_RECORD_SIZE,
+                    VCCERT_FIELD_INDEX_RECORD_SIZE))
+        {
+            ++child;
+        }
+
+        /* stop once the root is no smaller than its children. */
+        if (0 <= memcmp(
+                    records + root * VCCERT_FIELD_INDEX_RECORD_SIZE,
+                    records + child * VCCERT_FIELD_INDEX_RECORD_SIZE,
+                    VCCERT_FIELD_INDEX_RECORD_SIZE))
+        {
+            return;
+        }
+
+        field_index_swap(records, root, child);
+        root = child;
+    }
+}
+
+/**
+ * Swap two index records.
+ *
+ * \param records           The records.
+ * \param i                 The first record to swap.
+ * \param j                 The second record to swap.
+ */
+static void field_index_swap(uint8_t* records, size_t i, size_t j)
+{
+    uint8_t tmp[VCCERT_FIELD_INDEX_RECORD_SIZE];
+
+    memcpy(tmp, records + i * VCCERT_FIELD_INDEX_RECORD_SIZE, sizeof(tmp));
+    memcpy(
+        records + i * VCCERT_FIELD_INDEX_RECORD_SIZE,
+        records + j * VCCERT_FIELD_INDEX_RECORD_SIZE, sizeof(tmp));
+    memcpy(records + j * VCCERT_FIELD_INDEX_RECORD_SIZE, tmp, sizeof(tmp));
+}
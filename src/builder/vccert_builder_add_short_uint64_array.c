@@ -0,0 +1,60 @@
+/**
+ * \file vccert_builder_add_short_uint64_array.c
+ *
+ * Add an array of uint64_t fields to a certificate.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/**
+ * \brief Add an array of uint64_t fields to the certificate with short field
+ * IDs.
+ *
+ * This produces the same certificate bytes as calling
+ * vccert_builder_add_short_uint64() once for each field, in order, but
+ * encodes every field in a single pass.  Either every field is added or, on
+ * error, none are.
+ *
+ * \param context           The builder context to use for this operation.
+ * \param fields            The short field ID of each field to add.
+ * \param values            The uint64_t value of each field.
+ * \param count             The number of fields to add.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_ADD_INVALID_ARG if one of the arguments to
+ *              this method is invalid.
+ */
+int vccert_builder_add_short_uint64_array(
+    vccert_builder_context_t* context, const uint16_t* fields,
+    const uint64_t* values, size_t count)
+{
+    size_t field_size = FIELD_TYPE_SIZE + FIELD_SIZE_SIZE + sizeof(uint64_t);
+
+    MODEL_ASSERT(context != NULL);
+    MODEL_ASSERT(context->buffer.data != NULL);
+    MODEL_ASSERT(count == 0 || (fields != NULL && values != NULL));
+    MODEL_ASSERT(context->offset + count * field_size <= context->buffer.size);
+
+    if (context == NULL || context->buffer.data == NULL
+     || (count > 0 && (fields == NULL || values == NULL))
+     || context->offset > context->buffer.size
+     || count > (context->buffer.size - context->offset) / field_size)
+    {
+        return VCCERT_ERROR_BUILDER_ADD_INVALID_ARG;
+    }
+
+    //encode every field at once
+    uint8_t* out = ((uint8_t*)context->buffer.data) + context->offset;
+    vccert_builder_encode_uint64_records(out, fields, values, count);
+
+    //increment the offset
+    context->offset += count * field_size;
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,145 @@
+/**
+ * \file vccert_builder_encode_uint32_records.c
+ *
+ * Encode an array of uint32_t fields, using a byte-shuffle kernel where the
+ * platform has one.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+#if defined(VCCERT_BUILDER_ENCODE_SSSE3)
+# include <tmmintrin.h>
+#elif defined(VCCERT_BUILDER_ENCODE_NEON)
+# include <arm_neon.h>
+#endif
+
+#define RECORD_SIZE (FIELD_TYPE_SIZE + FIELD_SIZE_SIZE + sizeof(uint32_t))
+
+/**
+ * Encode records one at a time.
+ */
+static void encode_scalar(
+    uint8_t* out, const uint16_t* fields, const uint32_t* values,
+    size_t count)
+{
+    for (size_t i = 0; i < count; ++i, out += RECORD_SIZE)
+    {
+        out[0] = (uint8_t)((fields[i] & 0xFF00) >> 8);
+        out[1] = (uint8_t)((fields[i] & 0x00FF));
+        out[2] = 0x00;
+        out[3] = (uint8_t)sizeof(uint32_t);
+        out[4] = (uint8_t)((values[i] & 0xFF000000) >> 24);
+        out[5] = (uint8_t)((values[i] & 0x00FF0000) >> 16);
+        out[6] = (uint8_t)((values[i] & 0x0000FF00) >> 8);
+        out[7] = (uint8_t)((values[i] & 0x000000FF));
+    }
+}
+
+#if defined(VCCERT_BUILDER_ENCODE_SSSE3)
+
+/**
+ * Encode four records per iteration: swap the field IDs and values, then
+ * interleave them with the constant size to form whole records.
+ */
+__attribute__((target("ssse3")))
+static void encode_ssse3(
+    uint8_t* out, const uint16_t* fields, const uint32_t* values,
+    size_t count)
+{
+    const __m128i swap16 =
+        _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const __m128i swap32 =
+        _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    /* bytes 00 04: the Big Endian size of a uint32_t. */
+    const __m128i size = _mm_set1_epi16(0x0400);
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4, out += 4 * RECORD_SIZE)
+    {
+        __m128i f = _mm_loadl_epi64((const __m128i*)(fields + i));
+        __m128i v = _mm_loadu_si128((const __m128i*)(values + i));
+
+        f = _mm_shuffle_epi8(f, swap16);
+        v = _mm_shuffle_epi8(v, swap32);
+
+        __m128i hdr = _mm_unpacklo_epi16(f, size);
+        _mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi32(hdr, v));
+        _mm_storeu_si128((__m128i*)(out + 16), _mm_unpackhi_epi32(hdr, v));
+    }
+
+    encode_scalar(out, fields + i, values + i, count - i);
+}
+
+#elif defined(VCCERT_BUILDER_ENCODE_NEON)
+
+/**
+ * Encode four records per iteration: reverse the field IDs and values, then
+ * interleave them with the constant size to form whole records.
+ */
+static void encode_neon(
+    uint8_t* out, const uint16_t* fields, const uint32_t* values,
+    size_t count)
+{
+    /* bytes 00 04: the Big Endian size of a uint32_t. */
+    const uint16x4_t size = vdup_n_u16(0x0400);
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4, out += 4 * RECORD_SIZE)
+    {
+        uint16x4_t f = vreinterpret_u16_u8(
+            vrev16_u8(vreinterpret_u8_u16(vld1_u16(fields + i))));
+        uint32x4_t v = vreinterpretq_u32_u8(
+            vrev32q_u8(vreinterpretq_u8_u32(vld1q_u32(values + i))));
+
+        uint16x4x2_t hdr = vzip_u16(f, size);
+        uint32x4_t h = vreinterpretq_u32_u16(
+            vcombine_u16(hdr.val[0], hdr.val[1]));
+        uint32x4x2_t rec = vzipq_u32(h, v);
+
+        vst1q_u8(out, vreinterpretq_u8_u32(rec.val[0]));
+        vst1q_u8(out + 16, vreinterpretq_u8_u32(rec.val[1]));
+    }
+
+    encode_scalar(out, fields + i, values + i, count - i);
+}
+
+#endif
+
+/**
+ * Encode an array of uint32_t fields as consecutive Big Endian records.
+ *
+ * Each record is the 16-bit field type, the 16-bit size (4), and the value,
+ * for 8 bytes per record.  The caller must ensure out has room for all
+ * records.
+ *
+ * \param out               The output buffer.
+ * \param fields            The short field ID of each record.
+ * \param values            The value of each record.
+ * \param count             The number of records to encode.
+ */
+void vccert_builder_encode_uint32_records(
+    uint8_t* out, const uint16_t* fields, const uint32_t* values,
+    size_t count)
+{
+    MODEL_ASSERT(out != NULL);
+    MODEL_ASSERT(fields != NULL);
+    MODEL_ASSERT(values != NULL);
+
+#if defined(VCCERT_BUILDER_ENCODE_SSSE3)
+    if (__builtin_cpu_supports("ssse3"))
+    {
+        encode_ssse3(out, fields, values, count);
+        return;
+    }
+#elif defined(VCCERT_BUILDER_ENCODE_NEON)
+    encode_neon(out, fields, values, count);
+    return;
+#endif
+
+    encode_scalar(out, fields, values, count);
+}
@@ -0,0 +1,147 @@
+/**
+ * \file vccert_builder_encode_uint64_records.c
+ *
+ * Encode an array of uint64_t fields, using a byte-shuffle kernel where the
+ * platform has one.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+#if defined(VCCERT_BUILDER_ENCODE_SSSE3)
+# include <tmmintrin.h>
+#elif defined(VCCERT_BUILDER_ENCODE_NEON)
+# include <arm_neon.h>
+#endif
+
+#define HEADER_SIZE (FIELD_TYPE_SIZE + FIELD_SIZE_SIZE)
+#define RECORD_SIZE (HEADER_SIZE + sizeof(uint64_t))
+
+/**
+ * Write a single record header.
+ */
+static inline void encode_header(uint8_t* out, uint16_t field)
+{
+    out[0] = (uint8_t)((field & 0xFF00) >> 8);
+    out[1] = (uint8_t)((field & 0x00FF));
+    out[2] = 0x00;
+    out[3] = (uint8_t)sizeof(uint64_t);
+}
+
+/**
+ * Encode records one at a time.
+ */
+static void encode_scalar(
+    uint8_t* out, const uint16_t* fields, const uint64_t* values,
+    size_t count)
+{
+    for (size_t i = 0; i < count; ++i, out += RECORD_SIZE)
+    {
+        uint64_t value = values[i];
+
+        encode_header(out, fields[i]);
+        out[4] = (uint8_t)((value & 0xFF00000000000000) >> 56);
+        out[5] = (uint8_t)((value & 0x00FF000000000000) >> 48);
+        out[6] = (uint8_t)((value & 0x0000FF0000000000) >> 40);
+        out[7] = (uint8_t)((value & 0x000000FF00000000) >> 32);
+        out[8] = (uint8_t)((value & 0x00000000FF000000) >> 24);
+        out[9] = (uint8_t)((value & 0x0000000000FF0000) >> 16);
+        out[10] = (uint8_t)((value & 0x000000000000FF00) >> 8);
+        out[11] = (uint8_t)((value & 0x00000000000000FF));
+    }
+}
+
+#if defined(VCCERT_BUILDER_ENCODE_SSSE3)
+
+/**
+ * Encode two records per iteration, swapping both values with one shuffle.
+ */
+__attribute__((target("ssse3")))
+static void encode_ssse3(
+    uint8_t* out, const uint16_t* fields, const uint64_t* values,
+    size_t count)
+{
+    const __m128i swap64 =
+        _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    size_t i = 0;
+
+    for (; i + 2 <= count; i += 2, out += 2 * RECORD_SIZE)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(values + i));
+        v = _mm_shuffle_epi8(v, swap64);
+
+        encode_header(out, fields[i]);
+        _mm_storel_epi64((__m128i*)(out + HEADER_SIZE), v);
+        encode_header(out + RECORD_SIZE, fields[i + 1]);
+        _mm_storel_epi64(
+            (__m128i*)(out + RECORD_SIZE + HEADER_SIZE),
+            _mm_unpackhi_epi64(v, v));
+    }
+
+    encode_scalar(out, fields + i, values + i, count - i);
+}
+
+#elif defined(VCCERT_BUILDER_ENCODE_NEON)
+
+/**
+ * Encode two records per iteration, reversing both values at once.
+ */
+static void encode_neon(
+    uint8_t* out, const uint16_t* fields, const uint64_t* values,
+    size_t count)
+{
+    size_t i = 0;
+
+    for (; i + 2 <= count; i += 2, out += 2 * RECORD_SIZE)
+    {
+        uint8x16_t v =
+            vrev64q_u8(vreinterpretq_u8_u64(vld1q_u64(values + i)));
+
+        encode_header(out, fields[i]);
+        vst1_u8(out + HEADER_SIZE, vget_low_u8(v));
+        encode_header(out + RECORD_SIZE, fields[i + 1]);
+        vst1_u8(out + RECORD_SIZE + HEADER_SIZE, vget_high_u8(v));
+    }
+
+    encode_scalar(out, fields + i, values + i, count - i);
+}
+
+#endif
+
+/**
+ * Encode an array of uint64_t fields as consecutive Big Endian records.
+ *
+ * Each record is the 16-bit field type, the 16-bit size (8), and the value,
+ * for 12 bytes per record.  The caller must ensure out has room for all
+ * records.
+ *
+ * \param out               The output buffer.
+ * \param fields            The short field ID of each record.
+ * \param values            The value of each record.
+ * \param count             The number of records to encode.
+ */
+void vccert_builder_encode_uint64_records(
+    uint8_t* out, const uint16_t* fields, const uint64_t* values,
+    size_t count)
+{
+    MODEL_ASSERT(out != NULL);
+    MODEL_ASSERT(fields != NULL);
+    MODEL_ASSERT(values != NULL);
+
+#if defined(VCCERT_BUILDER_ENCODE_SSSE3)
+    if (__builtin_cpu_supports("ssse3"))
+    {
+        encode_ssse3(out, fields, values, count);
+        return;
+    }
+#elif defined(VCCERT_BUILDER_ENCODE_NEON)
+    encode_neon(out, fields, values, count);
+    return;
+#endif
+
+    encode_scalar(out, fields, values, count);
+}
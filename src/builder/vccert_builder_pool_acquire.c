@@ -0,0 +1,56 @@
+/**
+ * \file vccert_builder_pool_acquire.c
+ *
+ * Acquire a builder context from a builder pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/**
+ * \brief Acquire an empty builder context from the pool.
+ *
+ * The context remains owned by the pool and must be returned to it by calling
+ * vccert_builder_pool_release().  It must not be disposed by the caller.
+ *
+ * \param pool              The builder pool from which a context is acquired.
+ * \param context           Pointer to receive the builder context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_POOL_INVALID_ARG if one of the arguments to
+ *             this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_POOL_EXHAUSTED if every context in this
+ *             pool is currently acquired.
+ */
+int vccert_builder_pool_acquire(
+    vccert_builder_pool_t* pool, vccert_builder_context_t** context)
+{
+    MODEL_ASSERT(pool != NULL);
+    MODEL_ASSERT(pool->free_list != NULL);
+    MODEL_ASSERT(context != NULL);
+
+    /* parameter sanity check */
+    if (pool == NULL || pool->free_list == NULL || context == NULL)
+    {
+        return VCCERT_ERROR_BUILDER_POOL_INVALID_ARG;
+    }
+
+    /* verify that a context is available */
+    if (0 == pool->available)
+    {
+        return VCCERT_ERROR_BUILDER_POOL_EXHAUSTED;
+    }
+
+    /* pop the most recently released context, which is likely still cached. */
+    pool->available -= 1;
+    *context = pool->free_list[pool->available];
+    pool->in_use[*context - pool->contexts] = true;
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,152 @@
+/**
+ * \file vccert_builder_pool_init.c
+ *
+ * Initialize a pool of reusable certificate builder contexts.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/* forward decls */
+static void vccert_builder_pool_dispose(void* pool);
+
+/**
+ * \brief Initialize a builder pool holding the given number of builder
+ * contexts, each of which can build a certificate up to the given size.
+ *
+ * This pool is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().  All contexts must be released back to the pool
+ * before it is disposed.
+ *
+ * \param options           The builder options to use for each context.
+ * \param pool              The builder pool to initialize.
+ * \param capacity          The number of builder contexts in this pool.
+ * \param size              The maximum size of each certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_POOL_INIT_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_POOL_INIT_OUT_OF_MEMORY if the pool could
+ *             not be allocated.
+ *      - a non-zero value on error.
+ */
+int vccert_builder_pool_init(
+    vccert_builder_options_t* options, vccert_builder_pool_t* pool,
+    size_t capacity, size_t size)
+{
+    int retval;
+    size_t i;
+
+    MODEL_ASSERT(options != NULL);
+    MODEL_ASSERT(options->alloc_opts != NULL);
+    MODEL_ASSERT(pool != NULL);
+    MODEL_ASSERT(capacity > 0);
+    MODEL_ASSERT(size > 0);
+
+    /* parameter sanity check */
+    if (options == NULL || options->alloc_opts == NULL || pool == NULL
+     || capacity == 0 || size == 0)
+    {
+        return VCCERT_ERROR_BUILDER_POOL_INIT_INVALID_ARG;
+    }
+
+    memset(pool, 0, sizeof(vccert_builder_pool_t));
+
+    /* allocate the context array */
+    pool->contexts = (vccert_builder_context_t*)
+        allocate(options->alloc_opts,
+            capacity * sizeof(vccert_builder_context_t));
+    if (NULL == pool->contexts)
+    {
+        return VCCERT_ERROR_BUILDER_POOL_INIT_OUT_OF_MEMORY;
+    }
+
+    /* allocate the free list */
+    pool->free_list = (vccert_builder_context_t**)
+        allocate(options->alloc_opts,
+            capacity * sizeof(vccert_builder_context_t*));
+    if (NULL == pool->free_list)
+    {
+        retval = VCCERT_ERROR_BUILDER_POOL_INIT_OUT_OF_MEMORY;
+        goto release_contexts;
+    }
+
+    /* allocate the in-use flags; every context starts out free. */
+    pool->in_use = (bool*)
+        allocate(options->alloc_opts, capacity * sizeof(bool));
+    if (NULL == pool->in_use)
+    {
+        retval = VCCERT_ERROR_BUILDER_POOL_INIT_OUT_OF_MEMORY;
+        goto release_free_list;
+    }
+
+    memset(pool->in_use, 0, capacity * sizeof(bool));
+
+    /* initialize every context up front so acquisition never allocates. */
+    for (i = 0; i < capacity; ++i)
+    {
+        retval = vccert_builder_init(options, &pool->contexts[i], size);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            goto dispose_contexts;
+        }
+
+        pool->free_list[i] = &pool->contexts[i];
+    }
+
+    pool->hdr.dispose = &vccert_builder_pool_dispose;
+    pool->options = options;
+    pool->capacity = capacity;
+    pool->available = capacity;
+
+    /* success */
+    return VCCERT_STATUS_SUCCESS;
+
+dispose_contexts:
+    while (i > 0)
+    {
+        --i;
+        dispose((disposable_t*)&pool->contexts[i]);
+    }
+
+    release(options->alloc_opts, pool->in_use);
+
+release_free_list:
+    release(options->alloc_opts, pool->free_list);
+
+release_contexts:
+    release(options->alloc_opts, pool->contexts);
+
+    memset(pool, 0, sizeof(vccert_builder_pool_t));
+
+    return retval;
+}
+
+/**
+ * Dispose of the builder pool and every builder context it owns.
+ *
+ * \param pool          The builder pool to dispose.
+ */
+static void vccert_builder_pool_dispose(void* pool)
+{
+    vccert_builder_pool_t* p = (vccert_builder_pool_t*)pool;
+
+    MODEL_ASSERT(p->available == p->capacity);
+
+    for (size_t i = 0; i < p->capacity; ++i)
+    {
+        dispose((disposable_t*)&p->contexts[i]);
+    }
+
+    release(p->options->alloc_opts, p->in_use);
+    release(p->options->alloc_opts, p->free_list);
+    release(p->options->alloc_opts, p->contexts);
+
+    memset(p, 0, sizeof(vccert_builder_pool_t));
+}
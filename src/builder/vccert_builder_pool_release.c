@@ -0,0 +1,73 @@
+/**
+ * \file vccert_builder_pool_release.c
+ *
+ * Release a builder context back to a builder pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/**
+ * \brief Release a builder context back to the pool.
+ *
+ * The context is reset before it is made available again.  Any pointer
+ * previously returned by vccert_builder_emit() for this context is no longer
+ * valid.
+ *
+ * \param pool              The builder pool that owns this context.
+ * \param context           The builder context to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_POOL_INVALID_ARG if one of the arguments to
+ *             this method is invalid, if the context is not owned by this
+ *             pool, or if it is not currently acquired.
+ */
+int vccert_builder_pool_release(
+    vccert_builder_pool_t* pool, vccert_builder_context_t* context)
+{
+    MODEL_ASSERT(pool != NULL);
+    MODEL_ASSERT(pool->contexts != NULL);
+    MODEL_ASSERT(pool->in_use != NULL);
+    MODEL_ASSERT(context != NULL);
+
+    /* parameter sanity check */
+    if (pool == NULL || pool->contexts == NULL || pool->in_use == NULL
+     || context == NULL)
+    {
+        return VCCERT_ERROR_BUILDER_POOL_INVALID_ARG;
+    }
+
+    /* verify that this context is one of the pool's slots. */
+    uintptr_t base = (uintptr_t)pool->contexts;
+    uintptr_t addr = (uintptr_t)context;
+    if (addr < base
+     || 0 != (addr - base) % sizeof(vccert_builder_context_t)
+     || (addr - base) / sizeof(vccert_builder_context_t) >= pool->capacity)
+    {
+        return VCCERT_ERROR_BUILDER_POOL_INVALID_ARG;
+    }
+
+    /* verify that this context is acquired, so that it is never on the free
+     * list twice. */
+    size_t slot = (addr - base) / sizeof(vccert_builder_context_t);
+    if (!pool->in_use[slot])
+    {
+        return VCCERT_ERROR_BUILDER_POOL_INVALID_ARG;
+    }
+
+    /* clear the previous certificate so the context is ready for reuse. */
+    vccert_builder_reset(context);
+
+    /* push this context onto the free list */
+    pool->in_use[slot] = false;
+    pool->free_list[pool->available] = context;
+    pool->available += 1;
+
+    return VCCERT_STATUS_SUCCESS;
+}
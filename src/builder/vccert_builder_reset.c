@@ -0,0 +1,50 @@
+/**
+ * \file vccert_builder_reset.c
+ *
+ * Reset a certificate builder so that it can be reused.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/**
+ * \brief Reset a builder context so that it can be used to build another
+ * certificate.
+ *
+ * The certificate buffer is retained and cleared, and the offset is rewound to
+ * the beginning of the buffer.  Any pointer previously returned by
+ * vccert_builder_emit() for this context is no longer valid.
+ *
+ * \param context           The builder context to reset.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_RESET_INVALID_ARG if one of the arguments to
+ *             this method is invalid.
+ */
+int vccert_builder_reset(vccert_builder_context_t* context)
+{
+    MODEL_ASSERT(context != NULL);
+    MODEL_ASSERT(context->buffer.data != NULL);
+    MODEL_ASSERT(context->buffer.size >= context->offset);
+
+    /* parameter sanity check */
+    if (context == NULL || context->buffer.data == NULL
+     || context->buffer.size < context->offset)
+    {
+        return VCCERT_ERROR_BUILDER_RESET_INVALID_ARG;
+    }
+
+    /* only the written portion of the buffer needs to be cleared. */
+    memset(context->buffer.data, 0, context->offset);
+
+    /* rewind the offset */
+    context->offset = 0;
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -8,8 +8,6 @@
  */
 
 #include <cbmc/model_assert.h>
-#include <string.h>
-#include <vccert/fields.h>
 #include <vpr/parameters.h>
 
 #include "builder_internal.h"
@@ -48,24 +46,6 @@ int vccert_builder_sign(
         return VCCERT_ERROR_BUILDER_SIGN_INVALID_ARG;
     }
 
-    /* buffer size check */
-    size_t field_size =
-        FIELD_TYPE_SIZE * 2 + FIELD_SIZE_SIZE * 2 + 16 +
-        context->options->crypto_suite->sign_opts.signature_size;
-    MODEL_ASSERT(context->buffer.size >= context->offset + field_size);
-    if (context->buffer.size < context->offset + field_size)
-    {
-        return VCCERT_ERROR_BUILDER_SIGN_INVALID_FIELD_SIZE;
-    }
-
-    /* write the signer ID */
-    retval = vccert_builder_add_short_UUID(
-        context, VCCERT_FIELD_TYPE_SIGNER_ID, signer_id);
-    if (VCCERT_STATUS_SUCCESS != retval)
-    {
-        return retval;
-    }
-
     /* create a buffer for the signature */
     vccrypt_buffer_t signature;
     retval = vccrypt_suite_buffer_init_for_signature(
@@ -75,10 +55,6 @@ int vccert_builder_sign(
         return retval;
     }
 
-    /* write signature field header */
-    vccert_builder_write_fieldheader(
-        context, VCCERT_FIELD_TYPE_SIGNATURE, signature.size);
-
     /* create the digital signature context */
     vccrypt_digital_signature_context_t sign;
     retval = vccrypt_suite_digital_signature_init(
@@ -88,25 +64,10 @@ int vccert_builder_sign(
         goto dispose_signature;
     }
 
-    /* sign the certificate */
-    retval = vccrypt_digital_signature_sign(
-        &sign, &signature, private_key,
-        (const uint8_t*)context->buffer.data, context->offset);
-    if (VCCERT_STATUS_SUCCESS != retval)
-    {
-        goto dispose_sign_context;
-    }
-
-    /* write the signature to the buffer */
-    uint8_t* out = ((uint8_t*)context->buffer.data) + context->offset;
-    memcpy(out, signature.data, signature.size);
-
-    /* increment the offset */
-    context->offset += signature.size;
-
-    retval = VCCERT_STATUS_SUCCESS;
+    /* write the signer ID and signature */
+    retval = vccert_builder_sign_internal(
+        context, signer_id, &sign, private_key, &signature);
 
-dispose_sign_context:
     dispose((disposable_t*)&sign);
 
 dispose_signature:
@@ -0,0 +1,193 @@
+/**
+ * \file vccert_builder_sign_batch.c
+ *
+ * Sign a batch of certificates across a thread pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/**
+ * Signing scratch space for one extra worker.
+ */
+typedef struct sign_batch_scratch
+{
+    vccrypt_buffer_t signature;
+    vccrypt_digital_signature_context_t sign;
+} sign_batch_scratch_t;
+
+/**
+ * Shared state for one batch.
+ */
+typedef struct sign_batch
+{
+    vccert_builder_context_t** contexts;
+    vccert_builder_signer_t* signer;
+    sign_batch_scratch_t* scratch;
+    int* status;
+} sign_batch_t;
+
+/* forward decls */
+static void sign_batch_task(void* context, size_t index, size_t worker);
+
+/**
+ * \brief Sign a batch of finished certificates using a prepared signer,
+ * spreading the work across a thread pool.
+ *
+ * Each certificate is signed exactly as vccert_builder_sign_prepared() would
+ * sign it.  The signer's key and UUID are shared by every worker; each worker
+ * gets its own signature context and scratch buffer.  Failure to sign one
+ * certificate does not stop the others from being signed.
+ *
+ * \param contexts          The builder contexts to sign.
+ * \param count             The number of builder contexts.
+ * \param signer            The prepared signer to use.
+ * \param pool              The thread pool to use, or NULL to sign on the
+ *                          calling thread.
+ * \param status            Array of count entries that receives the status
+ *                          of signing each context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS if every certificate was signed.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGN_BATCH_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGN_BATCH_OUT_OF_MEMORY if per-worker
+ *             scratch space could not be allocated.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGN_BATCH_FAILED if any certificate
+ *             could not be signed.
+ *      - a nonzero value indicating error.
+ */
+int vccert_builder_sign_batch(
+    vccert_builder_context_t** contexts, size_t count,
+    vccert_builder_signer_t* signer, vccert_thread_pool_t* pool,
+    int* status)
+{
+    int retval;
+    size_t i, extra, initialized = 0;
+    sign_batch_t batch;
+
+    MODEL_ASSERT(contexts != NULL || count == 0);
+    MODEL_ASSERT(signer != NULL);
+    MODEL_ASSERT(signer->options != NULL);
+    MODEL_ASSERT(status != NULL || count == 0);
+
+    /* parameter sanity check */
+    if ((contexts == NULL && count > 0) || signer == NULL
+     || signer->options == NULL || (status == NULL && count > 0))
+    {
+        return VCCERT_ERROR_BUILDER_SIGN_BATCH_INVALID_ARG;
+    }
+
+    /* worker 0 uses the signer's own scratch; the rest need their own. */
+    extra = (NULL == pool || count < 2) ? 0 : pool->worker_count - 1;
+
+    memset(&batch, 0, sizeof(batch));
+    batch.contexts = contexts;
+    batch.signer = signer;
+    batch.status = status;
+
+    if (extra > 0)
+    {
+        batch.scratch = (sign_batch_scratch_t*)
+            allocate(signer->options->alloc_opts,
+                extra * sizeof(sign_batch_scratch_t));
+        if (NULL == batch.scratch)
+        {
+            return VCCERT_ERROR_BUILDER_SIGN_BATCH_OUT_OF_MEMORY;
+        }
+
+        for (initialized = 0; initialized < extra; ++initialized)
+        {
+            sign_batch_scratch_t* s = &batch.scratch[initialized];
+
+            retval = vccrypt_suite_buffer_init_for_signature(
+                signer->options->crypto_suite, &s->signature);
+            if (VCCERT_STATUS_SUCCESS != retval)
+            {
+                goto dispose_scratch;
+            }
+
+            retval = vccrypt_suite_digital_signature_init(
+                signer->options->crypto_suite, &s->sign);
+            if (VCCERT_STATUS_SUCCESS != retval)
+            {
+                dispose((disposable_t*)&s->signature);
+                goto dispose_scratch;
+            }
+        }
+    }
+
+    retval = vccert_thread_pool_run(pool, &sign_batch_task, &batch, count);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        goto dispose_scratch;
+    }
+
+    /* report a failure if any context could not be signed. */
+    for (i = 0; i < count; ++i)
+    {
+        if (VCCERT_STATUS_SUCCESS != status[i])
+        {
+            retval = VCCERT_ERROR_BUILDER_SIGN_BATCH_FAILED;
+            break;
+        }
+    }
+
+dispose_scratch:
+    while (initialized > 0)
+    {
+        --initialized;
+        dispose((disposable_t*)&batch.scratch[initialized].sign);
+        dispose((disposable_t*)&batch.scratch[initialized].signature);
+    }
+
+    if (NULL != batch.scratch)
+    {
+        release(signer->options->alloc_opts, batch.scratch);
+    }
+
+    return retval;
+}
+
+/**
+ * Sign a single context in the batch using the scratch space owned by the
+ * given worker.
+ *
+ * \param context       The sign_batch_t for this batch.
+ * \param index         The index of the context to sign.
+ * \param worker        The id of the worker running this task.
+ */
+static void sign_batch_task(void* context, size_t index, size_t worker)
+{
+    sign_batch_t* batch = (sign_batch_t*)context;
+    vccert_builder_signer_t* signer = batch->signer;
+    vccert_builder_context_t* builder = batch->contexts[index];
+
+    if (NULL == builder || NULL == builder->buffer.data)
+    {
+        batch->status[index] = VCCERT_ERROR_BUILDER_SIGN_BATCH_INVALID_ARG;
+        return;
+    }
+
+    if (0 == worker)
+    {
+        batch->status[index] =
+            vccert_builder_sign_internal(
+                builder, signer->signer_id, &signer->sign,
+                &signer->private_key, &signer->signature);
+    }
+    else
+    {
+        sign_batch_scratch_t* s = &batch->scratch[worker - 1];
+
+        batch->status[index] =
+            vccert_builder_sign_internal(
+                builder, signer->signer_id, &s->sign, &signer->private_key,
+                &s->signature);
+    }
+}
@@ -0,0 +1,85 @@
+/**
+ * \file vccert_builder_sign_internal.c
+ *
+ * Append the signer ID and signature fields to a certificate using caller
+ * supplied signing resources.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/fields.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/**
+ * Append the signer ID and signature fields to a certificate using the given
+ * signing resources.
+ *
+ * \param context           The builder context.
+ * \param signer_id         The 128-bit signer UUID.
+ * \param sign              The digital signature context to use.
+ * \param private_key       The private key buffer to use.
+ * \param signature         Scratch buffer to receive the signature.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGN_INVALID_FIELD_SIZE if the signature
+ *             would overwrite memory.
+ *      - a nonzero value indicating error.
+ */
+int vccert_builder_sign_internal(
+    vccert_builder_context_t* context, const uint8_t* signer_id,
+    vccrypt_digital_signature_context_t* sign,
+    const vccrypt_buffer_t* private_key, vccrypt_buffer_t* signature)
+{
+    int retval;
+
+    MODEL_ASSERT(context != NULL);
+    MODEL_ASSERT(context->buffer.data != NULL);
+    MODEL_ASSERT(signer_id != NULL);
+    MODEL_ASSERT(sign != NULL);
+    MODEL_ASSERT(private_key != NULL);
+    MODEL_ASSERT(signature != NULL);
+
+    /* buffer size check */
+    size_t field_size =
+        FIELD_TYPE_SIZE * 2 + FIELD_SIZE_SIZE * 2 + 16 + signature->size;
+    MODEL_ASSERT(context->buffer.size >= context->offset + field_size);
+    if (context->buffer.size < context->offset + field_size)
+    {
+        return VCCERT_ERROR_BUILDER_SIGN_INVALID_FIELD_SIZE;
+    }
+
+    /* write the signer ID */
+    retval = vccert_builder_add_short_UUID(
+        context, VCCERT_FIELD_TYPE_SIGNER_ID, signer_id);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* write signature field header */
+    vccert_builder_write_fieldheader(
+        context, VCCERT_FIELD_TYPE_SIGNATURE, signature->size);
+
+    /* sign the certificate */
+    retval = vccrypt_digital_signature_sign(
+        sign, signature, private_key,
+        (const uint8_t*)context->buffer.data, context->offset);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* write the signature to the buffer */
+    uint8_t* out = ((uint8_t*)context->buffer.data) + context->offset;
+    memcpy(out, signature->data, signature->size);
+
+    /* increment the offset */
+    context->offset += signature->size;
+
+    return VCCERT_STATUS_SUCCESS;
+}
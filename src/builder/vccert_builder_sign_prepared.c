@@ -0,0 +1,50 @@
+/**
+ * \file vccert_builder_sign_prepared.c
+ *
+ * Sign a certificate using a prepared signer and add this signature to the end
+ * of the certificate.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/**
+ * \brief Sign the certificate using a prepared signer.
+ *
+ * This produces the same certificate as vccert_builder_sign() called with the
+ * signer's UUID and private key.
+ *
+ * \param context           The builder context to use for this operation.
+ * \param signer            The prepared signer to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGN_PREPARED_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGN_INVALID_FIELD_SIZE if the signature
+ *             would overwrite memory.
+ *      - a nonzero value indicating error.
+ */
+int vccert_builder_sign_prepared(
+    vccert_builder_context_t* context, vccert_builder_signer_t* signer)
+{
+    MODEL_ASSERT(context != NULL);
+    MODEL_ASSERT(context->buffer.data != NULL);
+    MODEL_ASSERT(signer != NULL);
+    MODEL_ASSERT(signer->options != NULL);
+
+    /* parameter sanity check */
+    if (context == NULL || context->buffer.data == NULL || signer == NULL
+     || signer->options == NULL)
+    {
+        return VCCERT_ERROR_BUILDER_SIGN_PREPARED_INVALID_ARG;
+    }
+
+    return vccert_builder_sign_internal(
+        context, signer->signer_id, &signer->sign, &signer->private_key,
+        &signer->signature);
+}
@@ -0,0 +1,126 @@
+/**
+ * \file vccert_builder_signer_init.c
+ *
+ * Initialize a prepared signer that can be reused to sign many certificates.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/* forward decls */
+static void vccert_builder_signer_dispose(void* signer);
+
+/**
+ * \brief Initialize a prepared signer for the given signer UUID and private
+ * key.
+ *
+ * The private key is copied into the signer, so the caller's key buffer may be
+ * disposed once this call returns.  This signer is owned by the caller and
+ * must be disposed of when no longer needed by calling dispose().
+ *
+ * Note that the signer_id is expected as a Big Endian representation of a UUID.
+ *
+ * \param options           The builder options to use for this signer.
+ * \param signer            The signer to initialize.
+ * \param signer_id         The 128-bit signer UUID.
+ * \param private_key       The private key buffer to use to sign
+ *                          certificates.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_SIGNER_INIT_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - a nonzero value indicating error.
+ */
+int vccert_builder_signer_init(
+    vccert_builder_options_t* options, vccert_builder_signer_t* signer,
+    const uint8_t* signer_id, const vccrypt_buffer_t* private_key)
+{
+    int retval;
+
+    MODEL_ASSERT(options != NULL);
+    MODEL_ASSERT(options->alloc_opts != NULL);
+    MODEL_ASSERT(options->crypto_suite != NULL);
+    MODEL_ASSERT(signer != NULL);
+    MODEL_ASSERT(signer_id != NULL);
+    MODEL_ASSERT(private_key != NULL);
+    MODEL_ASSERT(private_key->data != NULL);
+
+    /* parameter sanity check */
+    if (options == NULL || options->alloc_opts == NULL
+     || options->crypto_suite == NULL || signer == NULL || signer_id == NULL
+     || private_key == NULL || private_key->data == NULL)
+    {
+        return VCCERT_ERROR_BUILDER_SIGNER_INIT_INVALID_ARG;
+    }
+
+    memset(signer, 0, sizeof(vccert_builder_signer_t));
+
+    /* copy the private key */
+    retval = vccrypt_buffer_init(
+        &signer->private_key, options->alloc_opts, private_key->size);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = vccrypt_buffer_copy(&signer->private_key, private_key);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        goto dispose_private_key;
+    }
+
+    /* create the signature scratch buffer */
+    retval = vccrypt_suite_buffer_init_for_signature(
+        options->crypto_suite, &signer->signature);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        goto dispose_private_key;
+    }
+
+    /* create the digital signature context */
+    retval = vccrypt_suite_digital_signature_init(
+        options->crypto_suite, &signer->sign);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        goto dispose_signature;
+    }
+
+    memcpy(signer->signer_id, signer_id, sizeof(signer->signer_id));
+    signer->hdr.dispose = &vccert_builder_signer_dispose;
+    signer->options = options;
+
+    /* success */
+    return VCCERT_STATUS_SUCCESS;
+
+dispose_signature:
+    dispose((disposable_t*)&signer->signature);
+
+dispose_private_key:
+    dispose((disposable_t*)&signer->private_key);
+
+    memset(signer, 0, sizeof(vccert_builder_signer_t));
+
+    return retval;
+}
+
+/**
+ * Dispose of a prepared signer, scrubbing its copy of the private key.
+ *
+ * \param signer        The signer to dispose.
+ */
+static void vccert_builder_signer_dispose(void* signer)
+{
+    vccert_builder_signer_t* s = (vccert_builder_signer_t*)signer;
+
+    dispose((disposable_t*)&s->sign);
+    dispose((disposable_t*)&s->signature);
+    dispose((disposable_t*)&s->private_key);
+
+    memset(s, 0, sizeof(vccert_builder_signer_t));
+}
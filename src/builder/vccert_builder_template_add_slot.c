@@ -0,0 +1,81 @@
+/**
+ * \file vccert_builder_template_add_slot.c
+ *
+ * Reserve a variable field slot in a certificate builder template.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/**
+ * \brief Reserve a variable field slot at the end of the template prefix.
+ *
+ * The field header is encoded in the template and the value is zero-filled.
+ * The value is supplied later by patching the slot.
+ *
+ * \param tmpl              The builder template to update.
+ * \param field             The short field ID of this slot.
+ * \param size              The size of the field value in bytes.
+ * \param slot              Pointer to receive the slot index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_ADD_TOO_BIG if the field exceeds the
+ *             maximum supported field size.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_TOO_MANY_SLOTS if this template
+ *             has no room for another slot.
+ */
+int vccert_builder_template_add_slot(
+    vccert_builder_template_t* tmpl, uint16_t field, size_t size,
+    size_t* slot)
+{
+    size_t field_size = FIELD_TYPE_SIZE + FIELD_SIZE_SIZE + size;
+
+    MODEL_ASSERT(tmpl != NULL);
+    MODEL_ASSERT(tmpl->builder.buffer.data != NULL);
+    MODEL_ASSERT(slot != NULL);
+
+    /* parameter sanity check */
+    if (tmpl == NULL || tmpl->builder.buffer.data == NULL || slot == NULL
+     || tmpl->builder.buffer.size < tmpl->builder.offset + field_size)
+    {
+        return VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG;
+    }
+
+    /* verify that the field does not exceed the max supported field size. */
+    if (field_size > VCCERT_MAX_FIELD_SIZE)
+    {
+        return VCCERT_ERROR_BUILDER_ADD_TOO_BIG;
+    }
+
+    /* verify that there is room for another slot */
+    if (tmpl->slot_count >= VCCERT_BUILDER_TEMPLATE_MAX_SLOTS)
+    {
+        return VCCERT_ERROR_BUILDER_TEMPLATE_TOO_MANY_SLOTS;
+    }
+
+    /* write field header. */
+    vccert_builder_write_fieldheader(&tmpl->builder, field, size);
+
+    /* the value is zero-filled until the slot is patched. */
+    size_t value_offset = tmpl->builder.offset;
+    memset(
+        ((uint8_t*)tmpl->builder.buffer.data) + value_offset, 0, size);
+    tmpl->builder.offset += size;
+
+    /* record the slot */
+    *slot = tmpl->slot_count;
+    tmpl->slots[*slot].field = field;
+    tmpl->slots[*slot].offset = value_offset;
+    tmpl->slots[*slot].size = size;
+    tmpl->slot_count += 1;
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,54 @@
+/**
+ * \file vccert_builder_template_apply.c
+ *
+ * Copy a builder template prefix into a builder context.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/**
+ * \brief Copy the template prefix into the given builder context.
+ *
+ * This replaces the current contents of the builder context.  Additional
+ * fields can be added after the prefix, and the slots can be patched with
+ * vccert_builder_template_patch() until the certificate is signed.
+ *
+ * \param tmpl              The builder template to apply.
+ * \param context           The builder context to receive the prefix.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG if one of the
+ *             arguments to this method is invalid, or if the builder context
+ *             is too small to hold the prefix.
+ */
+int vccert_builder_template_apply(
+    const vccert_builder_template_t* tmpl, vccert_builder_context_t* context)
+{
+    MODEL_ASSERT(tmpl != NULL);
+    MODEL_ASSERT(tmpl->builder.buffer.data != NULL);
+    MODEL_ASSERT(context != NULL);
+    MODEL_ASSERT(context->buffer.data != NULL);
+    MODEL_ASSERT(context->buffer.size >= tmpl->builder.offset);
+
+    /* parameter sanity check */
+    if (tmpl == NULL || tmpl->builder.buffer.data == NULL || context == NULL
+     || context->buffer.data == NULL
+     || context->buffer.size < tmpl->builder.offset)
+    {
+        return VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG;
+    }
+
+    /* the prefix is copied as a single block. */
+    memcpy(context->buffer.data, tmpl->builder.buffer.data,
+        tmpl->builder.offset);
+    context->offset = tmpl->builder.offset;
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,77 @@
+/**
+ * \file vccert_builder_template_init.c
+ *
+ * Initialize a certificate builder template.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/* forward decls */
+static void vccert_builder_template_dispose(void* tmpl);
+
+/**
+ * \brief Initialize a builder template that can hold a certificate prefix up
+ * to the given size.
+ *
+ * This template is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().
+ *
+ * \param options           The builder options to use for this template.
+ * \param tmpl              The builder template to initialize.
+ * \param size              The maximum size of the certificate prefix.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INIT_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - a non-zero value on error.
+ */
+int vccert_builder_template_init(
+    vccert_builder_options_t* options, vccert_builder_template_t* tmpl,
+    size_t size)
+{
+    int retval;
+
+    MODEL_ASSERT(options != NULL);
+    MODEL_ASSERT(tmpl != NULL);
+    MODEL_ASSERT(size > 0);
+
+    /* parameter sanity check */
+    if (options == NULL || tmpl == NULL || size == 0)
+    {
+        return VCCERT_ERROR_BUILDER_TEMPLATE_INIT_INVALID_ARG;
+    }
+
+    memset(tmpl, 0, sizeof(vccert_builder_template_t));
+
+    /* the template prefix is encoded with a regular builder. */
+    retval = vccert_builder_init(options, &tmpl->builder, size);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    tmpl->hdr.dispose = &vccert_builder_template_dispose;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of the builder template.
+ *
+ * \param tmpl          The builder template to dispose.
+ */
+static void vccert_builder_template_dispose(void* tmpl)
+{
+    vccert_builder_template_t* t = (vccert_builder_template_t*)tmpl;
+
+    dispose((disposable_t*)&t->builder);
+
+    memset(t, 0, sizeof(vccert_builder_template_t));
+}
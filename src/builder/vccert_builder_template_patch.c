@@ -0,0 +1,68 @@
+/**
+ * \file vccert_builder_template_patch.c
+ *
+ * Patch the value of a builder template slot in a builder context.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/**
+ * \brief Patch the value of a template slot in a builder context.
+ *
+ * \param tmpl              The builder template that was applied to this
+ *                          builder context.
+ * \param context           The builder context to patch.
+ * \param slot              The slot index to patch.
+ * \param value             The new value of this slot.
+ * \param size              The size of the value, which must match the slot
+ *                          size.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_SLOT_SIZE_MISMATCH if the value
+ *             size does not match the slot size.
+ */
+int vccert_builder_template_patch(
+    const vccert_builder_template_t* tmpl, vccert_builder_context_t* context,
+    size_t slot, const uint8_t* value, size_t size)
+{
+    MODEL_ASSERT(tmpl != NULL);
+    MODEL_ASSERT(slot < tmpl->slot_count);
+    MODEL_ASSERT(context != NULL);
+    MODEL_ASSERT(context->buffer.data != NULL);
+    MODEL_ASSERT(value != NULL);
+
+    /* parameter sanity check */
+    if (tmpl == NULL || slot >= tmpl->slot_count || context == NULL
+     || context->buffer.data == NULL || value == NULL)
+    {
+        return VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG;
+    }
+
+    const vccert_builder_template_slot_t* s = &tmpl->slots[slot];
+
+    /* the template must have been applied to this context. */
+    if (context->offset < s->offset + s->size)
+    {
+        return VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG;
+    }
+
+    /* the value must exactly fill the slot. */
+    if (size != s->size)
+    {
+        return VCCERT_ERROR_BUILDER_TEMPLATE_SLOT_SIZE_MISMATCH;
+    }
+
+    /* write the value in place. */
+    memcpy(((uint8_t*)context->buffer.data) + s->offset, value, size);
+
+    return VCCERT_STATUS_SUCCESS;
+}
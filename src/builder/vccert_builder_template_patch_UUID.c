@@ -0,0 +1,38 @@
+/**
+ * \file vccert_builder_template_patch_UUID.c
+ *
+ * Patch a UUID builder template slot in a builder context.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/**
+ * \brief Patch a UUID template slot in a builder context.
+ *
+ * Note that this value is expected as a Big Endian representation of a UUID.
+ *
+ * \param tmpl              The builder template that was applied to this
+ *                          builder context.
+ * \param context           The builder context to patch.
+ * \param slot              The slot index to patch.
+ * \param value             The 128-bit UUID.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_SLOT_SIZE_MISMATCH if the slot
+ *             does not hold a UUID.
+ */
+int vccert_builder_template_patch_UUID(
+    const vccert_builder_template_t* tmpl, vccert_builder_context_t* context,
+    size_t slot, const uint8_t* value)
+{
+    return vccert_builder_template_patch(tmpl, context, slot, value, 16);
+}
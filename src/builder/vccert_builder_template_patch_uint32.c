@@ -0,0 +1,47 @@
+/**
+ * \file vccert_builder_template_patch_uint32.c
+ *
+ * Patch a uint32_t builder template slot in a builder context.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/**
+ * \brief Patch a uint32_t template slot in a builder context.
+ *
+ * Note that this value will be written as a Big Endian integer value.
+ *
+ * \param tmpl              The builder template that was applied to this
+ *                          builder context.
+ * \param context           The builder context to patch.
+ * \param slot              The slot index to patch.
+ * \param value             The new value of this slot.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_SLOT_SIZE_MISMATCH if the slot
+ *             does not hold a 32-bit value.
+ */
+int vccert_builder_template_patch_uint32(
+    const vccert_builder_template_t* tmpl, vccert_builder_context_t* context,
+    size_t slot, uint32_t value)
+{
+    uint8_t out[sizeof(value)];
+
+    //encode the value as a Big Endian integer
+    out[0] = (uint8_t)((value & 0xFF000000) >> 24);
+    out[1] = (uint8_t)((value & 0x00FF0000) >> 16);
+    out[2] = (uint8_t)((value & 0x0000FF00) >> 8);
+    out[3] = (uint8_t)((value & 0x000000FF));
+
+    return
+        vccert_builder_template_patch(tmpl, context, slot, out, sizeof(out));
+}
@@ -0,0 +1,51 @@
+/**
+ * \file vccert_builder_template_patch_uint64.c
+ *
+ * Patch a uint64_t builder template slot in a builder context.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "builder_internal.h"
+
+/**
+ * \brief Patch a uint64_t template slot in a builder context.
+ *
+ * Note that this value will be written as a Big Endian integer value.
+ *
+ * \param tmpl              The builder template that was applied to this
+ *                          builder context.
+ * \param context           The builder context to patch.
+ * \param slot              The slot index to patch.
+ * \param value             The new value of this slot.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_BUILDER_TEMPLATE_SLOT_SIZE_MISMATCH if the slot
+ *             does not hold a 64-bit value.
+ */
+int vccert_builder_template_patch_uint64(
+    const vccert_builder_template_t* tmpl, vccert_builder_context_t* context,
+    size_t slot, uint64_t value)
+{
+    uint8_t out[sizeof(value)];
+
+    //encode the value as a Big Endian integer
+    out[0] = (uint8_t)((value & 0xFF00000000000000) >> 56);
+    out[1] = (uint8_t)((value & 0x00FF000000000000) >> 48);
+    out[2] = (uint8_t)((value & 0x0000FF0000000000) >> 40);
+    out[3] = (uint8_t)((value & 0x000000FF00000000) >> 32);
+    out[4] = (uint8_t)((value & 0x00000000FF000000) >> 24);
+    out[5] = (uint8_t)((value & 0x0000000000FF0000) >> 16);
+    out[6] = (uint8_t)((value & 0x000000000000FF00) >> 8);
+    out[7] = (uint8_t)((value & 0x00000000000000FF));
+
+    return
+        vccert_builder_template_patch(tmpl, context, slot, out, sizeof(out));
+}
@@ -0,0 +1,123 @@
+/**
+ * \file columns_internal.h
+ *
+ * Internal helpers for column extraction.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_PRIVATE_COLUMNS_INTERNAL_HEADER_GUARD
+#define VCCERT_PRIVATE_COLUMNS_INTERNAL_HEADER_GUARD
+
+#include <vccert/columns.h>
+#include <vccert/error_codes.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * The number of partitions per worker, so that uneven partitions balance.
+ */
+#define VCCERT_COLUMNS_PARTITIONS_PER_WORKER 4
+
+/**
+ * The largest number of partitions in one extraction.
+ */
+#define VCCERT_COLUMNS_MAX_PARTITIONS 128
+
+/**
+ * \brief Get the certificate for a row.
+ *
+ * \param source            The row source.
+ * \param row               The row.
+ * \param cert              Pointer to receive the certificate.
+ * \param size              Pointer to receive the certificate size.
+ *
+ * \returns a status code indicating success or failure.
+ */
+typedef int (*vccert_columns_source_t)(
+    const void* source, size_t row, const uint8_t** cert, size_t* size);
+
+/**
+ * \brief Extract columns from every row of a source, in parallel.
+ *
+ * \param columns           The columns to extract.
+ * \param column_count      The number of columns.
+ * \param source_fn         The function that gets each row's certificate.
+ * \param source            The row source.
+ * \param rows              The number of rows.
+ * \param pool              The thread pool to use, or NULL.
+ * \param missing           Optional array to receive the missing bitmaps.
+ * \param failed            Optional pointer to receive the first failed row.
+ *
+ * \returns a status code indicating success or failure.
+ */
+int vccert_columns_run(
+    const vccert_column_t* columns, size_t column_count,
+    vccert_columns_source_t source_fn, const void* source, size_t rows,
+    vccert_thread_pool_t* pool, uint64_t* missing, size_t* failed);
+
+/**
+ * \brief Extract columns from a single certificate.
+ *
+ * On failure, every column of the row is zeroed and reported missing.
+ *
+ * \param columns           The columns to extract.
+ * \param column_count      The number of columns.
+ * \param cert              The certificate, or NULL if it could not be read.
+ * \param size              The size of the certificate.
+ * \param row               The row to fill.
+ * \param missing           Pointer to receive the row's missing bitmap.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE if the certificate
+ *        could not be walked.
+ */
+int vccert_columns_extract_row(
+    const vccert_column_t* columns, size_t column_count, const uint8_t* cert,
+    size_t size, size_t row, uint64_t* missing);
+
+/**
+ * \brief Get the width of the values of a column type.
+ *
+ * \param type              The schema type.
+ *
+ * \returns the value width in bytes, or 0 for a span column.
+ */
+static inline size_t vccert_columns_width(vccert_schema_type_t type)
+{
+    switch (type)
+    {
+        case VCCERT_SCHEMA_TYPE_BYTE:
+        case VCCERT_SCHEMA_TYPE_BOOLEAN:
+        case VCCERT_SCHEMA_TYPE_INT8:
+        case VCCERT_SCHEMA_TYPE_UINT8:
+            return 1;
+
+        case VCCERT_SCHEMA_TYPE_INT16:
+        case VCCERT_SCHEMA_TYPE_UINT16:
+            return 2;
+
+        case VCCERT_SCHEMA_TYPE_INT32:
+        case VCCERT_SCHEMA_TYPE_UINT32:
+            return 4;
+
+        case VCCERT_SCHEMA_TYPE_INT64:
+        case VCCERT_SCHEMA_TYPE_UINT64:
+        case VCCERT_SCHEMA_TYPE_C_STYLE_DATE:
+            return 8;
+
+        default:
+            return 0;
+    }
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_PRIVATE_COLUMNS_INTERNAL_HEADER_GUARD
@@ -0,0 +1,116 @@
+/**
+ * \file vccert_columns_extract.c
+ *
+ * Extract columns from a batch of certificates.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "columns_internal.h"
+
+/**
+ * A batch of certificates held in two arrays.
+ */
+typedef struct columns_batch
+{
+    const uint8_t* const* certs;
+    const size_t* sizes;
+} columns_batch_t;
+
+/* forward decls */
+static int columns_batch_row(
+    const void* source, size_t row, const uint8_t** cert, size_t* size);
+
+/**
+ * \brief Extract columns from a batch of certificates.
+ *
+ * The first occurrence of each field is used.  A field that is absent, or
+ * whose size does not match a fixed-width type, is reported as missing and
+ * its value is zeroed.  A certificate that cannot be walked has every column
+ * reported as missing, and extraction carries on with the remaining rows.
+ *
+ * Rows are split into contiguous partitions, several per worker.
+ *
+ * \param columns           The columns to extract.
+ * \param column_count      The number of columns, at most \ref
+ *                          VCCERT_COLUMNS_MAX.
+ * \param certs             The certificate of each row.
+ * \param sizes             The size of each row's certificate.
+ * \param rows              The number of rows.
+ * \param pool              The thread pool to use, or NULL to extract every
+ *                          row on the calling thread.
+ * \param missing           Optional array to receive, for each row, a bitmap
+ *                          with bit n set if column n was missing.
+ * \param failed            Optional pointer to receive the first row that
+ *                          could not be walked, or \ref VCCERT_COLUMNS_NO_ROW.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE if a certificate
+ *        could not be walked.
+ */
+int vccert_columns_extract(
+    const vccert_column_t* columns, size_t column_count,
+    const uint8_t* const* certs, const size_t* sizes, size_t rows,
+    vccert_thread_pool_t* pool, uint64_t* missing, size_t* failed)
+{
+    columns_batch_t batch;
+
+    MODEL_ASSERT(columns != NULL);
+    MODEL_ASSERT(column_count <= VCCERT_COLUMNS_MAX);
+    MODEL_ASSERT(rows == 0 || certs != NULL);
+    MODEL_ASSERT(rows == 0 || sizes != NULL);
+
+    /* parameter sanity check */
+    if (NULL == columns || column_count > VCCERT_COLUMNS_MAX
+     || (rows > 0 && (NULL == certs || NULL == sizes)))
+    {
+        return VCCERT_ERROR_COLUMNS_EXTRACT_INVALID_ARG;
+    }
+
+    for (size_t c = 0; c < column_count; ++c)
+    {
+        if (NULL == columns[c].values)
+        {
+            return VCCERT_ERROR_COLUMNS_EXTRACT_INVALID_ARG;
+        }
+    }
+
+    batch.certs = certs;
+    batch.sizes = sizes;
+
+    return
+        vccert_columns_run(
+            columns, column_count, &columns_batch_row, &batch, rows, pool,
+            missing, failed);
+}
+
+/**
+ * Get the certificate for a row of a batch.
+ *
+ * \param source            The batch.
+ * \param row               The row.
+ * \param cert              Pointer to receive the certificate.
+ * \param size              Pointer to receive the certificate size.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int columns_batch_row(
+    const void* source, size_t row, const uint8_t** cert, size_t* size)
+{
+    const columns_batch_t* batch = (const columns_batch_t*)source;
+
+    if (NULL == batch->certs[row])
+    {
+        return VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE;
+    }
+
+    *cert = batch->certs[row];
+    *size = batch->sizes[row];
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,152 @@
+/**
+ * \file vccert_columns_extract_row.c
+ *
+ * Extract columns from a single certificate.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "columns_internal.h"
+#include "../parser/parser_internal.h"
+
+/* forward decls */
+static void vccert_columns_set(
+    const vccert_column_t* column, size_t row, const uint8_t* value,
+    size_t offset, size_t size);
+
+/**
+ * \brief Extract columns from a single certificate.
+ *
+ * On failure, every column of the row is zeroed and reported missing.
+ *
+ * \param columns           The columns to extract.
+ * \param column_count      The number of columns.
+ * \param cert              The certificate, or NULL if it could not be read.
+ * \param size              The size of the certificate.
+ * \param row               The row to fill.
+ * \param missing           Pointer to receive the row's missing bitmap.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE if the certificate
+ *        could not be walked.
+ */
+int vccert_columns_extract_row(
+    const vccert_column_t* columns, size_t column_count, const uint8_t* cert,
+    size_t size, size_t row, uint64_t* missing)
+{
+    uint64_t all =
+        VCCERT_COLUMNS_MAX == column_count
+            ? UINT64_MAX
+            : ((uint64_t)1 << column_count) - 1;
+    uint64_t remaining = all;
+    int retval = VCCERT_STATUS_SUCCESS;
+
+    MODEL_ASSERT(columns != NULL);
+    MODEL_ASSERT(column_count <= VCCERT_COLUMNS_MAX);
+    MODEL_ASSERT(missing != NULL);
+
+    /* walk the fields once, stopping when every column is found. */
+    size_t offset = 0;
+    while (NULL != cert && 0 != remaining && offset < size)
+    {
+        uint16_t field_type;
+        size_t field_size;
+        const uint8_t* field;
+
+        retval =
+            vccert_parser_field(
+                cert, size, offset, &field_type, &field_size, &field,
+                &offset);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            break;
+        }
+
+        for (size_t c = 0; c < column_count; ++c)
+        {
+            uint64_t bit = (uint64_t)1 << c;
+            size_t width = vccert_columns_width(columns[c].type);
+
+            if ((remaining & bit) && field_type == columns[c].field
+             && (0 == width || width == field_size))
+            {
+                vccert_columns_set(
+                    &columns[c], row, field, (size_t)(field - cert),
+                    field_size);
+                remaining &= ~bit;
+            }
+        }
+    }
+
+    if (NULL == cert || VCCERT_STATUS_SUCCESS != retval)
+    {
+        remaining = all;
+        retval = VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE;
+    }
+
+    /* zero the columns that were not found. */
+    for (size_t c = 0; c < column_count; ++c)
+    {
+        if (remaining & ((uint64_t)1 << c))
+        {
+            vccert_columns_set(&columns[c], row, NULL, 0, 0);
+        }
+    }
+
+    *missing = remaining;
+
+    return retval;
+}
+
+/**
+ * Set one value of a column.
+ *
+ * \param column            The column.
+ * \param row               The row.
+ * \param value             The big endian field value, or NULL to zero the
+ *                          value.
+ * \param offset            The offset of the value in the certificate.
+ * \param size              The size of the value.
+ */
+static void vccert_columns_set(
+    const vccert_column_t* column, size_t row, const uint8_t* value,
+    size_t offset, size_t size)
+{
+    size_t width = vccert_columns_width(column->type);
+    uint64_t decoded = 0;
+
+    if (0 == width)
+    {
+        vccert_column_span_t* span = (vccert_column_span_t*)column->values;
+        span[row].offset = offset;
+        span[row].size = size;
+        return;
+    }
+
+    for (size_t i = 0; NULL != value && i < width; ++i)
+    {
+        decoded = (decoded << 8) | value[i];
+    }
+
+    switch (width)
+    {
+        case 1:
+            ((uint8_t*)column->values)[row] = (uint8_t)decoded;
+            break;
+
+        case 2:
+            ((uint16_t*)column->values)[row] = (uint16_t)decoded;
+            break;
+
+        case 4:
+            ((uint32_t*)column->values)[row] = (uint32_t)decoded;
+            break;
+
+        default:
+            ((uint64_t*)column->values)[row] = decoded;
+            break;
+    }
+}
@@ -0,0 +1,87 @@
+/**
+ * \file vccert_columns_extract_store.c
+ *
+ * Extract columns from every certificate in a store.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "columns_internal.h"
+
+/* forward decls */
+static int columns_store_row(
+    const void* source, size_t row, const uint8_t** cert, size_t* size);
+
+/**
+ * \brief Extract columns from every certificate in a store.
+ *
+ * This behaves as vccert_columns_extract(), with one row per certificate in
+ * store order.  Spans are relative to each certificate.
+ *
+ * \param columns           The columns to extract.
+ * \param column_count      The number of columns, at most \ref
+ *                          VCCERT_COLUMNS_MAX.
+ * \param store             The store view.
+ * \param pool              The thread pool to use, or NULL to extract every
+ *                          row on the calling thread.
+ * \param missing           Optional array to receive, for each row, a bitmap
+ *                          with bit n set if column n was missing.
+ * \param failed            Optional pointer to receive the first row that
+ *                          could not be read, or \ref VCCERT_COLUMNS_NO_ROW.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE if a certificate
+ *        could not be walked.
+ *      - the error returned by vccert_store_at() for the first frame that
+ *        could not be read.
+ */
+int vccert_columns_extract_store(
+    const vccert_column_t* columns, size_t column_count,
+    const vccert_store_t* store, vccert_thread_pool_t* pool,
+    uint64_t* missing, size_t* failed)
+{
+    MODEL_ASSERT(columns != NULL);
+    MODEL_ASSERT(column_count <= VCCERT_COLUMNS_MAX);
+    MODEL_ASSERT(store != NULL);
+
+    /* parameter sanity check */
+    if (NULL == columns || column_count > VCCERT_COLUMNS_MAX
+     || NULL == store || NULL == store->data)
+    {
+        return VCCERT_ERROR_COLUMNS_EXTRACT_INVALID_ARG;
+    }
+
+    for (size_t c = 0; c < column_count; ++c)
+    {
+        if (NULL == columns[c].values)
+        {
+            return VCCERT_ERROR_COLUMNS_EXTRACT_INVALID_ARG;
+        }
+    }
+
+    return
+        vccert_columns_run(
+            columns, column_count, &columns_store_row, store, store->count,
+            pool, missing, failed);
+}
+
+/**
+ * Get the certificate for a row of a store.
+ *
+ * \param source            The store.
+ * \param row               The row.
+ * \param cert              Pointer to receive the certificate.
+ * \param size              Pointer to receive the certificate size.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int columns_store_row(
+    const void* source, size_t row, const uint8_t** cert, size_t* size)
+{
+    return vccert_store_at((const vccert_store_t*)source, row, cert, size);
+}
@@ -0,0 +1,175 @@
+/**
+ * \file vccert_columns_run.c
+ *
+ * Extract columns from every row of a source, in parallel.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "columns_internal.h"
+
+/**
+ * The outcome of extracting a single partition.
+ */
+typedef struct columns_partition_result
+{
+    int status;
+    size_t failed;
+} columns_partition_result_t;
+
+/**
+ * The state shared by every worker.
+ */
+typedef struct columns_run
+{
+    const vccert_column_t* columns;
+    size_t column_count;
+    vccert_columns_source_t source_fn;
+    const void* source;
+    size_t rows;
+    uint64_t* missing;
+    size_t partitions;
+    columns_partition_result_t results[VCCERT_COLUMNS_MAX_PARTITIONS];
+} columns_run_t;
+
+/* forward decls */
+static void columns_extract_partition(
+    void* context, size_t index, size_t worker);
+
+/**
+ * \brief Extract columns from every row of a source, in parallel.
+ *
+ * \param columns           The columns to extract.
+ * \param column_count      The number of columns.
+ * \param source_fn         The function that gets each row's certificate.
+ * \param source            The row source.
+ * \param rows              The number of rows.
+ * \param pool              The thread pool to use, or NULL.
+ * \param missing           Optional array to receive the missing bitmaps.
+ * \param failed            Optional pointer to receive the first failed row.
+ *
+ * \returns a status code indicating success or failure.
+ */
+int vccert_columns_run(
+    const vccert_column_t* columns, size_t column_count,
+    vccert_columns_source_t source_fn, const void* source, size_t rows,
+    vccert_thread_pool_t* pool, uint64_t* missing, size_t* failed)
+{
+    int retval;
+    columns_run_t run;
+
+    MODEL_ASSERT(columns != NULL);
+    MODEL_ASSERT(source_fn != NULL);
+
+    if (NULL != failed)
+    {
+        *failed = VCCERT_COLUMNS_NO_ROW;
+    }
+
+    if (0 == rows)
+    {
+        return VCCERT_STATUS_SUCCESS;
+    }
+
+    run.columns = columns;
+    run.column_count = column_count;
+    run.source_fn = source_fn;
+    run.source = source;
+    run.rows = rows;
+    run.missing = missing;
+    run.partitions =
+        NULL == pool
+            ? 1
+            : pool->worker_count * VCCERT_COLUMNS_PARTITIONS_PER_WORKER;
+    if (run.partitions > VCCERT_COLUMNS_MAX_PARTITIONS)
+    {
+        run.partitions = VCCERT_COLUMNS_MAX_PARTITIONS;
+    }
+
+    if (run.partitions > rows)
+    {
+        run.partitions = rows;
+    }
+
+    memset(
+        run.results, 0, run.partitions * sizeof(columns_partition_result_t));
+
+    retval =
+        vccert_thread_pool_run(
+            pool, &columns_extract_partition, &run, run.partitions);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* partitions are in row order, so the first failure is the earliest. */
+    for (size_t i = 0; i < run.partitions; ++i)
+    {
+        if (VCCERT_STATUS_SUCCESS != run.results[i].status)
+        {
+            if (NULL != failed)
+            {
+                *failed = run.results[i].failed;
+            }
+
+            return run.results[i].status;
+        }
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Extract the rows in one partition, in order, recording the first failure
+ * but carrying on past it.
+ *
+ * \param context           The shared state.
+ * \param index             The partition to extract.
+ * \param worker            The worker extracting this partition.
+ */
+static void columns_extract_partition(
+    void* context, size_t index, size_t worker)
+{
+    columns_run_t* run = (columns_run_t*)context;
+    columns_partition_result_t* result = &run->results[index];
+    size_t begin = run->rows / run->partitions * index
+                 + (index < run->rows % run->partitions
+                        ? index : run->rows % run->partitions);
+    size_t end = begin + run->rows / run->partitions
+               + (index < run->rows % run->partitions ? 1 : 0);
+
+    (void)worker;
+
+    for (size_t row = begin; row < end; ++row)
+    {
+        const uint8_t* cert = NULL;
+        size_t size = 0;
+        uint64_t missing;
+
+        int retval = run->source_fn(run->source, row, &cert, &size);
+        int extracted =
+            vccert_columns_extract_row(
+                run->columns, run->column_count,
+                VCCERT_STATUS_SUCCESS == retval ? cert : NULL, size, row,
+                &missing);
+        if (VCCERT_STATUS_SUCCESS == retval)
+        {
+            retval = extracted;
+        }
+
+        if (NULL != run->missing)
+        {
+            run->missing[row] = missing;
+        }
+
+        if (VCCERT_STATUS_SUCCESS != retval
+         && VCCERT_STATUS_SUCCESS == result->status)
+        {
+            result->status = retval;
+            result->failed = row;
+        }
+    }
+}
@@ -0,0 +1,274 @@
+/**
+ * \file vccert_decoded_init.c
+ *
+ * Decode a certificate into plain memory.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <stddef.h>
+#include <string.h>
+#include <vccert/decoded.h>
+#include <vccert/fields.h>
+#include <vpr/parameters.h>
+
+#include "../parser/parser_internal.h"
+
+/* the initial number of entries in the overflow table. */
+#define DECODED_INITIAL_CAPACITY 8
+
+/**
+ * \brief Where a known field is decoded to.
+ */
+typedef struct decoded_slot
+{
+    uint16_t field;
+    uint32_t flag;
+    size_t size;
+    size_t offset;
+} decoded_slot_t;
+
+/* the known fields, each with its flag, its size, and its slot. */
+static const decoded_slot_t decoded_slots[] = {
+    { VCCERT_FIELD_TYPE_CERTIFICATE_VERSION,
+      VCCERT_DECODED_HAS_CERTIFICATE_VERSION, 4,
+      offsetof(vccert_decoded_t, certificate_version) },
+    { VCCERT_FIELD_TYPE_CERTIFICATE_VALID_FROM,
+      VCCERT_DECODED_HAS_VALID_FROM, 8,
+      offsetof(vccert_decoded_t, valid_from) },
+    { VCCERT_FIELD_TYPE_CERTIFICATE_VALID_TO,
+      VCCERT_DECODED_HAS_VALID_TO, 8,
+      offsetof(vccert_decoded_t, valid_to) },
+    { VCCERT_FIELD_TYPE_CERTIFICATE_CRYPTO_SUITE,
+      VCCERT_DECODED_HAS_CRYPTO_SUITE, 2,
+      offsetof(vccert_decoded_t, crypto_suite) },
+    { VCCERT_FIELD_TYPE_CERTIFICATE_TYPE,
+      VCCERT_DECODED_HAS_CERTIFICATE_TYPE, 16,
+      offsetof(vccert_decoded_t, certificate_type) },
+    { VCCERT_FIELD_TYPE_CERTIFICATE_ID,
+      VCCERT_DECODED_HAS_CERTIFICATE_ID, 16,
+      offsetof(vccert_decoded_t, certificate_id) },
+    { VCCERT_FIELD_TYPE_PREVIOUS_CERTIFICATE_ID,
+      VCCERT_DECODED_HAS_PREVIOUS_CERTIFICATE_ID, 16,
+      offsetof(vccert_decoded_t, previous_certificate_id) },
+    { VCCERT_FIELD_TYPE_NEXT_CERTIFICATE_ID,
+      VCCERT_DECODED_HAS_NEXT_CERTIFICATE_ID, 16,
+      offsetof(vccert_decoded_t, next_certificate_id) },
+    { VCCERT_FIELD_TYPE_ARTIFACT_TYPE,
+      VCCERT_DECODED_HAS_ARTIFACT_TYPE, 16,
+      offsetof(vccert_decoded_t, artifact_type) },
+    { VCCERT_FIELD_TYPE_ARTIFACT_ID,
+      VCCERT_DECODED_HAS_ARTIFACT_ID, 16,
+      offsetof(vccert_decoded_t, artifact_id) },
+    { VCCERT_FIELD_TYPE_PREVIOUS_ARTIFACT_STATE,
+      VCCERT_DECODED_HAS_PREVIOUS_ARTIFACT_STATE, 2,
+      offsetof(vccert_decoded_t, previous_artifact_state) },
+    { VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE,
+      VCCERT_DECODED_HAS_NEW_ARTIFACT_STATE, 2,
+      offsetof(vccert_decoded_t, new_artifact_state) },
+    { VCCERT_FIELD_TYPE_SIGNER_ID,
+      VCCERT_DECODED_HAS_SIGNER_ID, 16,
+      offsetof(vccert_decoded_t, signer_id) },
+    { VCCERT_FIELD_TYPE_BLOCK_UUID,
+      VCCERT_DECODED_HAS_BLOCK_UUID, 16,
+      offsetof(vccert_decoded_t, block_uuid) },
+    { VCCERT_FIELD_TYPE_PREVIOUS_BLOCK_UUID,
+      VCCERT_DECODED_HAS_PREVIOUS_BLOCK_UUID, 16,
+      offsetof(vccert_decoded_t, previous_block_uuid) },
+    { VCCERT_FIELD_TYPE_BLOCK_HEIGHT,
+      VCCERT_DECODED_HAS_BLOCK_HEIGHT, 8,
+      offsetof(vccert_decoded_t, block_height) },
+};
+
+#define DECODED_SLOT_COUNT (sizeof(decoded_slots) / sizeof(decoded_slots[0]))
+
+/* forward decls */
+static void vccert_decoded_dispose(void* decoded);
+static void decoded_store(
+    vccert_decoded_t* decoded, const decoded_slot_t* slot,
+    const uint8_t* field);
+
+/**
+ * \brief Decode a certificate into plain memory.
+ *
+ * The certificate is walked once, within its attested bounds if it has been
+ * attested, and within its raw bounds otherwise.  Overflow values point into
+ * the certificate, which must outlive the decoded certificate.  The decoded
+ * certificate is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().
+ *
+ * \param decoded           The decoded certificate to initialize.
+ * \param alloc_opts        The allocator options to use for the overflow
+ *                          table.
+ * \param parser            The parser context for the certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_DECODED_INIT_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_DECODED_INIT_OUT_OF_MEMORY if the overflow table
+ *        could not be allocated.
+ *      - \ref VCCERT_ERROR_DECODED_INIT_INVALID_FIELD_SIZE if the certificate
+ *        is malformed, or a known field has the wrong size.
+ */
+int vccert_decoded_init(
+    vccert_decoded_t* decoded, allocator_options_t* alloc_opts,
+    const vccert_parser_context_t* parser)
+{
+    int retval;
+    size_t offset, next_offset, field_size, i;
+    uint16_t field_type;
+    const uint8_t* field;
+
+    MODEL_ASSERT(decoded != NULL);
+    MODEL_ASSERT(alloc_opts != NULL);
+    MODEL_ASSERT(parser != NULL);
+    MODEL_ASSERT(parser->cert != NULL);
+
+    /* parameter sanity check */
+    if (decoded == NULL || alloc_opts == NULL || parser == NULL
+     || parser->cert == NULL)
+    {
+        return VCCERT_ERROR_DECODED_INIT_INVALID_ARG;
+    }
+
+    memset(decoded, 0, sizeof(vccert_decoded_t));
+
+    decoded->overflow = (vccert_decoded_field_t*)
+        allocate(alloc_opts,
+            DECODED_INITIAL_CAPACITY * sizeof(vccert_decoded_field_t));
+    if (NULL == decoded->overflow)
+    {
+        return VCCERT_ERROR_DECODED_INIT_OUT_OF_MEMORY;
+    }
+
+    decoded->overflow_capacity = DECODED_INITIAL_CAPACITY;
+
+    /* walk every field once, decoding the first of each known field. */
+    for (offset = 0; offset < parser->size; offset = next_offset)
+    {
+        retval = vccert_parser_field(
+            parser->cert, parser->size, offset, &field_type, &field_size,
+            &field, &next_offset);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            retval = VCCERT_ERROR_DECODED_INIT_INVALID_FIELD_SIZE;
+            goto release_overflow;
+        }
+
+        for (i = 0; i < DECODED_SLOT_COUNT; ++i)
+        {
+            if (decoded_slots[i].field == field_type)
+                break;
+        }
+
+        /* a known field must have the size of its slot. */
+        if (i < DECODED_SLOT_COUNT && decoded_slots[i].size != field_size)
+        {
+            retval = VCCERT_ERROR_DECODED_INIT_INVALID_FIELD_SIZE;
+            goto release_overflow;
+        }
+
+        if (i < DECODED_SLOT_COUNT
+         && 0 == (decoded->present & decoded_slots[i].flag))
+        {
+            decoded_store(decoded, &decoded_slots[i], field);
+            continue;
+        }
+
+        /* grow the table by doubling when it is full. */
+        if (decoded->overflow_count == decoded->overflow_capacity)
+        {
+            vccert_decoded_field_t* overflow = (vccert_decoded_field_t*)
+                reallocate(alloc_opts, decoded->overflow,
+                    decoded->overflow_capacity
+                        * sizeof(vccert_decoded_field_t),
+                    2 * decoded->overflow_capacity
+                        * sizeof(vccert_decoded_field_t));
+            if (NULL == overflow)
+            {
+                retval = VCCERT_ERROR_DECODED_INIT_OUT_OF_MEMORY;
+                goto release_overflow;
+            }
+
+            decoded->overflow = overflow;
+            decoded->overflow_capacity *= 2;
+        }
+
+        decoded->overflow[decoded->overflow_count].value = field;
+        decoded->overflow[decoded->overflow_count].size = field_size;
+        decoded->overflow[decoded->overflow_count].field = field_type;
+        ++decoded->overflow_count;
+    }
+
+    decoded->hdr.dispose = &vccert_decoded_dispose;
+    decoded->alloc_opts = alloc_opts;
+
+    /* success */
+    return VCCERT_STATUS_SUCCESS;
+
+release_overflow:
+    release(alloc_opts, decoded->overflow);
+    memset(decoded, 0, sizeof(vccert_decoded_t));
+
+    return retval;
+}
+
+/**
+ * Decode a Big Endian field value into its native slot and mark it present.
+ *
+ * \param decoded       The decoded certificate.
+ * \param slot          The slot for this field.
+ * \param field         The field value, which is slot->size bytes.
+ */
+static void decoded_store(
+    vccert_decoded_t* decoded, const decoded_slot_t* slot,
+    const uint8_t* field)
+{
+    uint8_t* out = (uint8_t*)decoded + slot->offset;
+    uint64_t value = 0;
+
+    decoded->present |= slot->flag;
+
+    /* UUIDs are kept in their Big Endian byte order. */
+    if (16 == slot->size)
+    {
+        memcpy(out, field, 16);
+        return;
+    }
+
+    for (size_t i = 0; i < slot->size; ++i)
+    {
+        value = (value << 8) | field[i];
+    }
+
+    switch (slot->size)
+    {
+        case 2:
+            *(uint16_t*)out = (uint16_t)value;
+            break;
+
+        case 4:
+            *(uint32_t*)out = (uint32_t)value;
+            break;
+
+        default:
+            *(uint64_t*)out = value;
+            break;
+    }
+}
+
+/**
+ * Dispose of a decoded certificate, releasing its overflow table.
+ *
+ * \param decoded       The decoded certificate to dispose.
+ */
+static void vccert_decoded_dispose(void* decoded)
+{
+    vccert_decoded_t* d = (vccert_decoded_t*)decoded;
+
+    release(d->alloc_opts, d->overflow);
+
+    memset(d, 0, sizeof(vccert_decoded_t));
+}
@@ -0,0 +1,124 @@
+/**
+ * \file filter_internal.h
+ *
+ * Internal helpers for the filter engine.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_PRIVATE_FILTER_INTERNAL_HEADER_GUARD
+#define VCCERT_PRIVATE_FILTER_INTERNAL_HEADER_GUARD
+
+#include <stdbool.h>
+#include <vccert/error_codes.h>
+#include <vccert/filter.h>
+
+#include "../columns/columns_internal.h"
+
+/* Pick a 64-bit compare kernel for range predicates, if one is available. */
+#if defined(__GNUC__) && __STDC_HOSTED__ \
+ && (defined(__x86_64__) || defined(__i386__))
+# define VCCERT_FILTER_RANGE_SSE42 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+# define VCCERT_FILTER_RANGE_NEON 1
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * The bit that is flipped to give signed values an unsigned order.
+ */
+#define VCCERT_FILTER_SIGN_BIT ((uint64_t)1 << 63)
+
+/**
+ * \brief Clear the selection bits of the rows whose key is out of range.
+ *
+ * \param keys              The key of each row.
+ * \param count             The number of rows.
+ * \param min               The smallest matching key.
+ * \param max               The largest matching key.
+ * \param words             The selection bitmap.
+ */
+void vccert_filter_match_range(
+    const uint64_t* keys, size_t count, uint64_t min, uint64_t max,
+    uint64_t* words);
+
+/**
+ * \brief Extract and test one chunk of certificates.
+ *
+ * \param filter            The filter.
+ * \param certs             The certificates in the chunk.
+ * \param sizes             The size of each certificate.
+ * \param rows              The number of certificates, at most \ref
+ *                          VCCERT_FILTER_CHUNK_ROWS.
+ * \param pool              The thread pool to extract fields with, or NULL.
+ * \param column_count      The number of columns to extract, which includes
+ *                          the group column if it is needed.
+ * \param words             The (rows + 63) / 64 words to receive the
+ *                          selection bitmap.
+ * \param failed            Pointer to receive the first certificate that
+ *                          could not be walked.
+ *
+ * \returns a status code indicating success or failure.
+ */
+int vccert_filter_select(
+    vccert_filter_t* filter, const uint8_t* const* certs,
+    const size_t* sizes, size_t rows, vccert_thread_pool_t* pool,
+    size_t column_count, uint64_t* words, size_t* failed);
+
+/**
+ * \brief Check whether a schema type is signed.
+ *
+ * \param type              The schema type.
+ *
+ * \returns true if values of this type are signed.
+ */
+static inline bool vccert_filter_signed(vccert_schema_type_t type)
+{
+    switch (type)
+    {
+        case VCCERT_SCHEMA_TYPE_INT8:
+        case VCCERT_SCHEMA_TYPE_INT16:
+        case VCCERT_SCHEMA_TYPE_INT32:
+        case VCCERT_SCHEMA_TYPE_INT64:
+        case VCCERT_SCHEMA_TYPE_C_STYLE_DATE:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * \brief Get the number of selected rows in a bitmap.
+ *
+ * \param words             The selection bitmap.
+ * \param count             The number of words.
+ *
+ * \returns the number of bits set.
+ */
+static inline size_t vccert_filter_popcount(
+    const uint64_t* words, size_t count)
+{
+    size_t total = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (uint64_t word = words[i]; 0 != word; word &= word - 1)
+        {
+            ++total;
+        }
+    }
+
+    return total;
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_PRIVATE_FILTER_INTERNAL_HEADER_GUARD
@@ -0,0 +1,224 @@
+/**
+ * \file vccert_filter_count_by.c
+ *
+ * Count the certificates that match a filter, grouped by a field.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "filter_internal.h"
+
+/* forward decls */
+static size_t* vccert_filter_group_slot(
+    size_t* slots, size_t mask, const vccert_filter_group_t* groups,
+    const uint8_t* key, size_t key_size);
+
+/**
+ * \brief Count the certificates in a batch that match a filter, grouped by
+ * the value of a short field.
+ *
+ * Groups are reported in the order that their first certificate appears in
+ * the batch.  Selected certificates without the group field are counted in a
+ * group with an empty key.
+ *
+ * \param filter            The filter.
+ * \param certs             The certificates.
+ * \param sizes             The size of each certificate.
+ * \param rows              The number of certificates.
+ * \param pool              The thread pool to extract fields with, or NULL.
+ * \param group_field       The short field id to group by.
+ * \param groups            Array to receive the groups.
+ * \param capacity          The number of entries in groups.
+ * \param group_count       Pointer to receive the number of groups.
+ * \param failed            Optional pointer to receive the first certificate
+ *                          that could not be walked, or \ref
+ *                          VCCERT_COLUMNS_NO_ROW.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_FILTER_COUNT_BY_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_FILTER_COUNT_BY_OUT_OF_MEMORY if the group table
+ *        could not be allocated.
+ *      - \ref VCCERT_ERROR_FILTER_COUNT_BY_TOO_MANY_GROUPS if there are more
+ *        than capacity groups.
+ *      - \ref VCCERT_ERROR_FILTER_COUNT_BY_KEY_TOO_LARGE if a selected
+ *        certificate's group field is larger than \ref
+ *        VCCERT_FILTER_MAX_KEY_SIZE.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE if a certificate
+ *        could not be walked.
+ */
+int vccert_filter_count_by(
+    vccert_filter_t* filter, const uint8_t* const* certs,
+    const size_t* sizes, size_t rows, vccert_thread_pool_t* pool,
+    uint16_t group_field, vccert_filter_group_t* groups, size_t capacity,
+    size_t* group_count, size_t* failed)
+{
+    uint64_t words[VCCERT_FILTER_CHUNK_ROWS / 64];
+    int retval = VCCERT_STATUS_SUCCESS;
+    size_t slot_count = 16;
+
+    MODEL_ASSERT(filter != NULL);
+    MODEL_ASSERT(rows == 0 || certs != NULL);
+    MODEL_ASSERT(rows == 0 || sizes != NULL);
+    MODEL_ASSERT(groups != NULL);
+    MODEL_ASSERT(capacity > 0);
+    MODEL_ASSERT(group_count != NULL);
+
+    /* parameter sanity check */
+    if (NULL == filter || NULL == filter->scratch
+     || (rows > 0 && (NULL == certs || NULL == sizes)) || NULL == groups
+     || 0 == capacity || NULL == group_count)
+    {
+        return VCCERT_ERROR_FILTER_COUNT_BY_INVALID_ARG;
+    }
+
+    *group_count = 0;
+    if (NULL != failed)
+    {
+        *failed = VCCERT_COLUMNS_NO_ROW;
+    }
+
+    /* keep the group table at most half full. */
+    while (slot_count < 2 * capacity)
+    {
+        slot_count *= 2;
+    }
+
+    size_t* slots =
+        (size_t*)allocate(filter->alloc_opts, slot_count * sizeof(size_t));
+    if (NULL == slots)
+    {
+        return VCCERT_ERROR_FILTER_COUNT_BY_OUT_OF_MEMORY;
+    }
+
+    memset(slots, 0, slot_count * sizeof(size_t));
+
+    /* the group column follows the predicate columns. */
+    size_t group_column = filter->predicate_count;
+    const vccert_column_span_t* spans =
+        (const vccert_column_span_t*)filter->columns[group_column].values;
+    filter->columns[group_column].field = group_field;
+
+    for (size_t begin = 0; begin < rows; begin += VCCERT_FILTER_CHUNK_ROWS)
+    {
+        size_t count =
+            rows - begin < VCCERT_FILTER_CHUNK_ROWS
+                ? rows - begin
+                : VCCERT_FILTER_CHUNK_ROWS;
+        size_t chunk_failed;
+
+        int chunk_retval =
+            vccert_filter_select(
+                filter, certs + begin, sizes + begin, count, pool,
+                group_column + 1, words, &chunk_failed);
+        if (VCCERT_STATUS_SUCCESS != chunk_retval
+         && VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE != chunk_retval)
+        {
+            retval = chunk_retval;
+            goto cleanup_slots;
+        }
+
+        /* keep the earliest damaged certificate. */
+        if (VCCERT_STATUS_SUCCESS != chunk_retval
+         && VCCERT_STATUS_SUCCESS == retval)
+        {
+            retval = chunk_retval;
+            if (NULL != failed)
+            {
+                *failed = begin + chunk_failed;
+            }
+        }
+
+        for (size_t row = 0; row < count; ++row)
+        {
+            if (0 == (words[row / 64] & ((uint64_t)1 << (row % 64))))
+            {
+                continue;
+            }
+
+            /* a missing group field has an empty span. */
+            const uint8_t* key = certs[begin + row] + spans[row].offset;
+            size_t key_size = spans[row].size;
+            if (key_size > VCCERT_FILTER_MAX_KEY_SIZE)
+            {
+                retval = VCCERT_ERROR_FILTER_COUNT_BY_KEY_TOO_LARGE;
+                goto cleanup_slots;
+            }
+
+            size_t* slot =
+                vccert_filter_group_slot(
+                    slots, slot_count - 1, groups, key, key_size);
+            if (0 == *slot)
+            {
+                if (*group_count == capacity)
+                {
+                    retval = VCCERT_ERROR_FILTER_COUNT_BY_TOO_MANY_GROUPS;
+                    goto cleanup_slots;
+                }
+
+                vccert_filter_group_t* group = &groups[*group_count];
+                memset(group, 0, sizeof(vccert_filter_group_t));
+                if (0 != key_size)
+                {
+                    memcpy(group->key, key, key_size);
+                }
+
+                group->key_size = key_size;
+                *slot = ++*group_count;
+            }
+
+            ++groups[*slot - 1].count;
+        }
+    }
+
+cleanup_slots:
+    release(filter->alloc_opts, slots);
+
+    return retval;
+}
+
+/**
+ * Find the slot of a group key, or the empty slot where it belongs.
+ *
+ * \param slots             The group table; each slot holds a group index
+ *                          plus one, or zero if empty.
+ * \param mask              The number of slots minus one.
+ * \param groups            The groups.
+ * \param key               The group key.
+ * \param key_size          The size of the group key.
+ *
+ * \returns the slot.
+ */
+static size_t* vccert_filter_group_slot(
+    size_t* slots, size_t mask, const vccert_filter_group_t* groups,
+    const uint8_t* key, size_t key_size)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    /* FNV-1a over the key size and the key. */
+    hash = (hash ^ key_size) * 1099511628211ULL;
+    for (size_t i = 0; i < key_size; ++i)
+    {
+        hash = (hash ^ key[i]) * 1099511628211ULL;
+    }
+
+    /* the table is never full, so probing always ends. */
+    for (size_t i = (size_t)hash & mask; ; i = (i + 1) & mask)
+    {
+        if (0 == slots[i])
+        {
+            return &slots[i];
+        }
+
+        const vccert_filter_group_t* group = &groups[slots[i] - 1];
+        if (group->key_size == key_size
+         && (0 == key_size || !memcmp(group->key, key, key_size)))
+        {
+            return &slots[i];
+        }
+    }
+}
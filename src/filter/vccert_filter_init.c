@@ -0,0 +1,153 @@
+/**
+ * \file vccert_filter_init.c
+ *
+ * Compile a filter from a list of predicates.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "filter_internal.h"
+
+/* forward decls */
+static void vccert_filter_dispose(void* disposable);
+
+/**
+ * \brief Compile a filter from a list of predicates, all of which must hold.
+ *
+ * This filter is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().
+ *
+ * \param filter            The filter to initialize.
+ * \param alloc_opts        The allocator options to use.
+ * \param predicates        The predicates.
+ * \param predicate_count   The number of predicates, at most \ref
+ *                          VCCERT_FILTER_MAX_PREDICATES.  With none, every
+ *                          certificate is selected.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_FILTER_INIT_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_FILTER_INIT_BAD_PREDICATE if a predicate is
+ *        invalid.
+ *      - \ref VCCERT_ERROR_FILTER_INIT_OUT_OF_MEMORY if the scratch columns
+ *        could not be allocated.
+ */
+int vccert_filter_init(
+    vccert_filter_t* filter, allocator_options_t* alloc_opts,
+    const vccert_filter_predicate_t* predicates, size_t predicate_count)
+{
+    size_t scratch_size = 0;
+
+    MODEL_ASSERT(filter != NULL);
+    MODEL_ASSERT(alloc_opts != NULL);
+    MODEL_ASSERT(predicate_count == 0 || predicates != NULL);
+    MODEL_ASSERT(predicate_count <= VCCERT_FILTER_MAX_PREDICATES);
+
+    /* parameter sanity check */
+    if (NULL == filter || NULL == alloc_opts
+     || (predicate_count > 0 && NULL == predicates)
+     || predicate_count > VCCERT_FILTER_MAX_PREDICATES)
+    {
+        return VCCERT_ERROR_FILTER_INIT_INVALID_ARG;
+    }
+
+    memset(filter, 0, sizeof(vccert_filter_t));
+
+    /* give each predicate a column of the right type. */
+    for (size_t i = 0; i < predicate_count; ++i)
+    {
+        const vccert_filter_predicate_t* predicate = &predicates[i];
+        vccert_column_t* column = &filter->columns[i];
+
+        switch (predicate->op)
+        {
+            case VCCERT_FILTER_OP_EQUAL:
+                if (NULL == predicate->value && 0 != predicate->value_size)
+                {
+                    return VCCERT_ERROR_FILTER_INIT_BAD_PREDICATE;
+                }
+
+                column->type = VCCERT_SCHEMA_TYPE_DATA_BLOB;
+                scratch_size +=
+                    VCCERT_FILTER_CHUNK_ROWS * sizeof(vccert_column_span_t);
+                break;
+
+            case VCCERT_FILTER_OP_RANGE:
+                if (0 == vccert_columns_width(predicate->type)
+                 || (vccert_filter_signed(predicate->type)
+                        ? (int64_t)predicate->min > (int64_t)predicate->max
+                        : predicate->min > predicate->max))
+                {
+                    return VCCERT_ERROR_FILTER_INIT_BAD_PREDICATE;
+                }
+
+                column->type = predicate->type;
+                scratch_size +=
+                    VCCERT_FILTER_CHUNK_ROWS
+                  * vccert_columns_width(predicate->type);
+                break;
+
+            default:
+                return VCCERT_ERROR_FILTER_INIT_BAD_PREDICATE;
+        }
+
+        column->field = predicate->field;
+        filter->predicates[i] = *predicate;
+    }
+
+    /* the group column, the missing bitmaps and the range keys. */
+    scratch_size +=
+        VCCERT_FILTER_CHUNK_ROWS
+      * (sizeof(vccert_column_span_t) + 2 * sizeof(uint64_t));
+
+    filter->scratch = allocate(alloc_opts, scratch_size);
+    if (NULL == filter->scratch)
+    {
+        return VCCERT_ERROR_FILTER_INIT_OUT_OF_MEMORY;
+    }
+
+    /* every part is a multiple of the chunk size, so each stays aligned. */
+    uint8_t* next = (uint8_t*)filter->scratch;
+    filter->missing = (uint64_t*)next;
+    next += VCCERT_FILTER_CHUNK_ROWS * sizeof(uint64_t);
+    filter->keys = (uint64_t*)next;
+    next += VCCERT_FILTER_CHUNK_ROWS * sizeof(uint64_t);
+    filter->columns[predicate_count].type = VCCERT_SCHEMA_TYPE_DATA_BLOB;
+    filter->columns[predicate_count].values = next;
+    next += VCCERT_FILTER_CHUNK_ROWS * sizeof(vccert_column_span_t);
+    for (size_t i = 0; i < predicate_count; ++i)
+    {
+        size_t width = vccert_columns_width(filter->columns[i].type);
+
+        filter->columns[i].values = next;
+        next +=
+            VCCERT_FILTER_CHUNK_ROWS
+          * (0 == width ? sizeof(vccert_column_span_t) : width);
+    }
+
+    filter->hdr.dispose = &vccert_filter_dispose;
+    filter->alloc_opts = alloc_opts;
+    filter->predicate_count = predicate_count;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a filter.
+ *
+ * \param disposable        The filter to dispose.
+ */
+static void vccert_filter_dispose(void* disposable)
+{
+    vccert_filter_t* filter = (vccert_filter_t*)disposable;
+
+    MODEL_ASSERT(filter != NULL);
+
+    release(filter->alloc_opts, filter->scratch);
+
+    memset(filter, 0, sizeof(vccert_filter_t));
+}
@@ -0,0 +1,138 @@
+/**
+ * \file vccert_filter_match_range.c
+ *
+ * Test a column of keys against a range, using a 64-bit compare kernel where
+ * the platform has one.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "filter_internal.h"
+
+#if defined(VCCERT_FILTER_RANGE_SSE42)
+# include <nmmintrin.h>
+#elif defined(VCCERT_FILTER_RANGE_NEON)
+# include <arm_neon.h>
+#endif
+
+/**
+ * Test keys one at a time.
+ */
+static void match_scalar(
+    const uint64_t* keys, size_t begin, size_t count, uint64_t min,
+    uint64_t max, uint64_t* words)
+{
+    for (size_t i = begin; i < count; ++i)
+    {
+        if (keys[i] < min || keys[i] > max)
+        {
+            words[i / 64] &= ~((uint64_t)1 << (i % 64));
+        }
+    }
+}
+
+#if defined(VCCERT_FILTER_RANGE_SSE42)
+
+/**
+ * Test two keys per compare.  SSE4.2 only has a signed 64-bit compare, so
+ * the keys and bounds are moved into signed order by flipping the sign bit.
+ */
+__attribute__((target("sse4.2")))
+static void match_sse42(
+    const uint64_t* keys, size_t count, uint64_t min, uint64_t max,
+    uint64_t* words)
+{
+    const __m128i sign = _mm_set1_epi64x((long long)VCCERT_FILTER_SIGN_BIT);
+    const __m128i low =
+        _mm_set1_epi64x((long long)(min ^ VCCERT_FILTER_SIGN_BIT));
+    const __m128i high =
+        _mm_set1_epi64x((long long)(max ^ VCCERT_FILTER_SIGN_BIT));
+    size_t i = 0;
+
+    for (; i + 64 <= count; i += 64)
+    {
+        uint64_t outside = 0;
+
+        for (size_t j = 0; j < 64; j += 2)
+        {
+            __m128i v =
+                _mm_xor_si128(
+                    _mm_loadu_si128((const __m128i*)(keys + i + j)), sign);
+            __m128i m =
+                _mm_or_si128(_mm_cmpgt_epi64(low, v), _mm_cmpgt_epi64(v, high));
+
+            outside |=
+                (uint64_t)_mm_movemask_pd(_mm_castsi128_pd(m)) << j;
+        }
+
+        words[i / 64] &= ~outside;
+    }
+
+    match_scalar(keys, i, count, min, max, words);
+}
+
+#elif defined(VCCERT_FILTER_RANGE_NEON)
+
+/**
+ * Test two keys per compare.
+ */
+static void match_neon(
+    const uint64_t* keys, size_t count, uint64_t min, uint64_t max,
+    uint64_t* words)
+{
+    const uint64x2_t low = vdupq_n_u64(min);
+    const uint64x2_t high = vdupq_n_u64(max);
+    size_t i = 0;
+
+    for (; i + 64 <= count; i += 64)
+    {
+        uint64_t inside = 0;
+
+        for (size_t j = 0; j < 64; j += 2)
+        {
+            uint64x2_t v = vld1q_u64(keys + i + j);
+            uint64x2_t m = vandq_u64(vcgeq_u64(v, low), vcleq_u64(v, high));
+
+            inside |= (vgetq_lane_u64(m, 0) & 1) << j;
+            inside |= (vgetq_lane_u64(m, 1) & 1) << (j + 1);
+        }
+
+        words[i / 64] &= inside;
+    }
+
+    match_scalar(keys, i, count, min, max, words);
+}
+
+#endif
+
+/**
+ * \brief Clear the selection bits of the rows whose key is out of range.
+ *
+ * \param keys              The key of each row.
+ * \param count             The number of rows.
+ * \param min               The smallest matching key.
+ * \param max               The largest matching key.
+ * \param words             The selection bitmap.
+ */
+void vccert_filter_match_range(
+    const uint64_t* keys, size_t count, uint64_t min, uint64_t max,
+    uint64_t* words)
+{
+    MODEL_ASSERT(keys != NULL);
+    MODEL_ASSERT(words != NULL);
+
+#if defined(VCCERT_FILTER_RANGE_SSE42)
+    if (__builtin_cpu_supports("sse4.2"))
+    {
+        match_sse42(keys, count, min, max, words);
+        return;
+    }
+#elif defined(VCCERT_FILTER_RANGE_NEON)
+    match_neon(keys, count, min, max, words);
+    return;
+#endif
+
+    match_scalar(keys, 0, count, min, max, words);
+}
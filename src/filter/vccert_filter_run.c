@@ -0,0 +1,101 @@
+/**
+ * \file vccert_filter_run.c
+ *
+ * Select the certificates in a batch that match a filter.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "filter_internal.h"
+
+/**
+ * \brief Select the certificates in a batch that match a filter.
+ *
+ * A certificate that cannot be walked is never selected, and is reported as
+ * in vccert_columns_extract(); the rest of the batch is still filtered.
+ *
+ * \param filter            The filter.
+ * \param certs             The certificates.
+ * \param sizes             The size of each certificate.
+ * \param rows              The number of certificates.
+ * \param pool              The thread pool to extract fields with, or NULL.
+ * \param selected          Optional array of (rows + 63) / 64 words to
+ *                          receive a bitmap, with bit (n % 64) of word
+ *                          (n / 64) set if certificate n was selected.
+ * \param matches           Pointer to receive the number of certificates
+ *                          selected.
+ * \param failed            Optional pointer to receive the first certificate
+ *                          that could not be walked, or \ref
+ *                          VCCERT_COLUMNS_NO_ROW.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_FILTER_RUN_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE if a certificate
+ *        could not be walked.
+ */
+int vccert_filter_run(
+    vccert_filter_t* filter, const uint8_t* const* certs,
+    const size_t* sizes, size_t rows, vccert_thread_pool_t* pool,
+    uint64_t* selected, size_t* matches, size_t* failed)
+{
+    uint64_t chunk_words[VCCERT_FILTER_CHUNK_ROWS / 64];
+    int retval = VCCERT_STATUS_SUCCESS;
+
+    MODEL_ASSERT(filter != NULL);
+    MODEL_ASSERT(rows == 0 || certs != NULL);
+    MODEL_ASSERT(rows == 0 || sizes != NULL);
+    MODEL_ASSERT(matches != NULL);
+
+    /* parameter sanity check */
+    if (NULL == filter || NULL == filter->scratch
+     || (rows > 0 && (NULL == certs || NULL == sizes)) || NULL == matches)
+    {
+        return VCCERT_ERROR_FILTER_RUN_INVALID_ARG;
+    }
+
+    *matches = 0;
+    if (NULL != failed)
+    {
+        *failed = VCCERT_COLUMNS_NO_ROW;
+    }
+
+    for (size_t begin = 0; begin < rows; begin += VCCERT_FILTER_CHUNK_ROWS)
+    {
+        size_t count =
+            rows - begin < VCCERT_FILTER_CHUNK_ROWS
+                ? rows - begin
+                : VCCERT_FILTER_CHUNK_ROWS;
+        uint64_t* words =
+            NULL != selected ? selected + begin / 64 : chunk_words;
+        size_t chunk_failed;
+
+        int chunk_retval =
+            vccert_filter_select(
+                filter, certs + begin, sizes + begin, count, pool,
+                filter->predicate_count, words, &chunk_failed);
+        if (VCCERT_STATUS_SUCCESS != chunk_retval
+         && VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE != chunk_retval)
+        {
+            return chunk_retval;
+        }
+
+        /* keep the earliest damaged certificate. */
+        if (VCCERT_STATUS_SUCCESS != chunk_retval
+         && VCCERT_STATUS_SUCCESS == retval)
+        {
+            retval = chunk_retval;
+            if (NULL != failed)
+            {
+                *failed = begin + chunk_failed;
+            }
+        }
+
+        *matches += vccert_filter_popcount(words, (count + 63) / 64);
+    }
+
+    return retval;
+}
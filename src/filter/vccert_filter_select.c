@@ -0,0 +1,206 @@
+/**
+ * \file vccert_filter_select.c
+ *
+ * Extract and test one chunk of certificates.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "filter_internal.h"
+
+/* forward decls */
+static void vccert_filter_match_equal(
+    const vccert_filter_predicate_t* predicate, const vccert_column_t* column,
+    const uint8_t* const* certs, size_t rows, uint64_t* words);
+static uint64_t vccert_filter_key(
+    const vccert_column_t* column, size_t width, bool is_signed, size_t row);
+
+/**
+ * \brief Extract and test one chunk of certificates.
+ *
+ * \param filter            The filter.
+ * \param certs             The certificates in the chunk.
+ * \param sizes             The size of each certificate.
+ * \param rows              The number of certificates, at most \ref
+ *                          VCCERT_FILTER_CHUNK_ROWS.
+ * \param pool              The thread pool to extract fields with, or NULL.
+ * \param column_count      The number of columns to extract, which includes
+ *                          the group column if it is needed.
+ * \param words             The (rows + 63) / 64 words to receive the
+ *                          selection bitmap.
+ * \param failed            Pointer to receive the first certificate that
+ *                          could not be walked.
+ *
+ * \returns a status code indicating success or failure.
+ */
+int vccert_filter_select(
+    vccert_filter_t* filter, const uint8_t* const* certs,
+    const size_t* sizes, size_t rows, vccert_thread_pool_t* pool,
+    size_t column_count, uint64_t* words, size_t* failed)
+{
+    size_t word_count = (rows + 63) / 64;
+
+    MODEL_ASSERT(filter != NULL);
+    MODEL_ASSERT(rows <= VCCERT_FILTER_CHUNK_ROWS);
+    MODEL_ASSERT(words != NULL);
+
+    /* a damaged certificate has every column missing, so never matches. */
+    int retval =
+        vccert_columns_extract(
+            filter->columns, column_count, certs, sizes, rows, pool,
+            filter->missing, failed);
+    if (VCCERT_STATUS_SUCCESS != retval
+     && VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE != retval)
+    {
+        return retval;
+    }
+
+    /* start with every row selected. */
+    memset(words, 0xFF, word_count * sizeof(uint64_t));
+    if (0 != rows % 64)
+    {
+        words[word_count - 1] = ((uint64_t)1 << (rows % 64)) - 1;
+    }
+
+    for (size_t c = 0; c < filter->predicate_count; ++c)
+    {
+        const vccert_filter_predicate_t* predicate = &filter->predicates[c];
+        const vccert_column_t* column = &filter->columns[c];
+
+        /* drop the rows without this field. */
+        for (size_t w = 0; w < word_count; ++w)
+        {
+            uint64_t absent = 0;
+            size_t end = (w + 1) * 64 < rows ? (w + 1) * 64 : rows;
+
+            for (size_t row = w * 64; row < end; ++row)
+            {
+                absent |= ((filter->missing[row] >> c) & 1) << (row % 64);
+            }
+
+            words[w] &= ~absent;
+        }
+
+        if (VCCERT_FILTER_OP_EQUAL == predicate->op)
+        {
+            vccert_filter_match_equal(predicate, column, certs, rows, words);
+            continue;
+        }
+
+        /* compare every row at once, in unsigned order. */
+        size_t width = vccert_columns_width(column->type);
+        bool is_signed = vccert_filter_signed(column->type);
+        const uint64_t* keys = (const uint64_t*)column->values;
+        uint64_t min = predicate->min;
+        uint64_t max = predicate->max;
+        if (is_signed)
+        {
+            min ^= VCCERT_FILTER_SIGN_BIT;
+            max ^= VCCERT_FILTER_SIGN_BIT;
+        }
+
+        if (8 != width || is_signed)
+        {
+            for (size_t row = 0; row < rows; ++row)
+            {
+                filter->keys[row] =
+                    vccert_filter_key(column, width, is_signed, row);
+            }
+
+            keys = filter->keys;
+        }
+
+        vccert_filter_match_range(keys, rows, min, max, words);
+    }
+
+    return retval;
+}
+
+/**
+ * Clear the selection bits of the rows whose field is not the predicate's
+ * value.
+ *
+ * \param predicate         The equality predicate.
+ * \param column            The span column for the predicate's field.
+ * \param certs             The certificates in the chunk.
+ * \param rows              The number of certificates.
+ * \param words             The selection bitmap.
+ */
+static void vccert_filter_match_equal(
+    const vccert_filter_predicate_t* predicate, const vccert_column_t* column,
+    const uint8_t* const* certs, size_t rows, uint64_t* words)
+{
+    const vccert_column_span_t* spans =
+        (const vccert_column_span_t*)column->values;
+
+    for (size_t row = 0; row < rows; ++row)
+    {
+        uint64_t bit = (uint64_t)1 << (row % 64);
+
+        /* only rows still selected need their bytes compared. */
+        if (0 == (words[row / 64] & bit))
+        {
+            continue;
+        }
+
+        if (spans[row].size != predicate->value_size
+         || (0 != predicate->value_size
+          && memcmp(
+                certs[row] + spans[row].offset, predicate->value,
+                predicate->value_size)))
+        {
+            words[row / 64] &= ~bit;
+        }
+    }
+}
+
+/**
+ * Get the key of a row of a fixed-width column, in unsigned order.
+ *
+ * \param column            The column.
+ * \param width             The width of the column's values.
+ * \param is_signed         True if the column's values are signed.
+ * \param row               The row.
+ *
+ * \returns the key.
+ */
+static uint64_t vccert_filter_key(
+    const vccert_column_t* column, size_t width, bool is_signed, size_t row)
+{
+    int64_t value;
+
+    switch (width)
+    {
+        case 1:
+            value =
+                is_signed
+                    ? ((const int8_t*)column->values)[row]
+                    : ((const uint8_t*)column->values)[row];
+            break;
+
+        case 2:
+            value =
+                is_signed
+                    ? ((const int16_t*)column->values)[row]
+                    : ((const uint16_t*)column->values)[row];
+            break;
+
+        case 4:
+            value =
+                is_signed
+                    ? ((const int32_t*)column->values)[row]
+                    : (int64_t)((const uint32_t*)column->values)[row];
+            break;
+
+        default:
+            return
+                ((const uint64_t*)column->values)[row]
+              ^ (is_signed ? VCCERT_FILTER_SIGN_BIT : 0);
+    }
+
+    return
+        (uint64_t)value ^ (is_signed ? VCCERT_FILTER_SIGN_BIT : 0);
+}
@@ -0,0 +1,101 @@
+/**
+ * \file id_index_internal.h
+ *
+ * Internal helpers for the id index.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_PRIVATE_ID_INDEX_INTERNAL_HEADER_GUARD
+#define VCCERT_PRIVATE_ID_INDEX_INTERNAL_HEADER_GUARD
+
+#include <vccert/error_codes.h>
+#include <vccert/id_index.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * The id index magic number.
+ */
+#define VCCERT_ID_INDEX_MAGIC "VCII"
+
+/**
+ * The header field offsets.
+ */
+#define VCCERT_ID_INDEX_OFFSET_CERTIFICATE_SLOTS 8
+#define VCCERT_ID_INDEX_OFFSET_SUCCESSOR_SLOTS 16
+#define VCCERT_ID_INDEX_OFFSET_ARTIFACT_SLOTS 24
+#define VCCERT_ID_INDEX_OFFSET_CERTIFICATE_COUNT 32
+#define VCCERT_ID_INDEX_OFFSET_SUCCESSOR_COUNT 40
+#define VCCERT_ID_INDEX_OFFSET_ARTIFACT_COUNT 48
+#define VCCERT_ID_INDEX_OFFSET_ENTRY_COUNT 56
+
+/**
+ * The slot and entry sizes.  Every slot starts with a 16-byte id, followed by
+ * a 64-bit value that is zero only in an empty slot.
+ */
+#define VCCERT_ID_INDEX_ID_SLOT_SIZE 24
+#define VCCERT_ID_INDEX_ARTIFACT_SLOT_SIZE 40
+#define VCCERT_ID_INDEX_ENTRY_SIZE 16
+
+/**
+ * The artifact slot field offsets.
+ */
+#define VCCERT_ID_INDEX_ARTIFACT_FIRST 16
+#define VCCERT_ID_INDEX_ARTIFACT_LAST 24
+#define VCCERT_ID_INDEX_ARTIFACT_COUNT 32
+
+/**
+ * The number of slots in each table of a new index.
+ */
+#define VCCERT_ID_INDEX_INITIAL_SLOTS 64
+
+/**
+ * Find the slot for an id, or the empty slot where it belongs.
+ *
+ * \param table         The table to search.
+ * \param slot_size     The size of each slot in the table.
+ * \param id            The 128-bit id to find.
+ *
+ * \returns the slot for this id, an empty slot, or NULL if a damaged loaded
+ * table has neither.
+ */
+uint8_t* vccert_id_index_slot(
+    const vccert_id_table_t* table, size_t slot_size, const uint8_t* id);
+
+/**
+ * Read a big endian 64-bit value.
+ */
+static inline uint64_t vccert_id_index_load64(const uint8_t* p)
+{
+    uint64_t val = 0;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        val = (val << 8) | p[i];
+    }
+
+    return val;
+}
+
+/**
+ * Write a big endian 64-bit value.
+ */
+static inline void vccert_id_index_store64(uint8_t* p, uint64_t val)
+{
+    for (int i = 7; i >= 0; --i)
+    {
+        p[i] = (uint8_t)val;
+        val >>= 8;
+    }
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_PRIVATE_ID_INDEX_INTERNAL_HEADER_GUARD
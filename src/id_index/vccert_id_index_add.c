@@ -0,0 +1,282 @@
+/**
+ * \file vccert_id_index_add.c
+ *
+ * Index a certificate in an id index.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/fields.h>
+
+#include "id_index_internal.h"
+#include "../parser/parser_internal.h"
+
+/* forward decls */
+static int vccert_id_index_reserve(
+    vccert_id_index_t* index, vccert_id_table_t* table, size_t slot_size);
+static void vccert_id_index_put(
+    vccert_id_table_t* table, const uint8_t* id, uint64_t position);
+
+/**
+ * \brief Index a certificate appended to a store at the given position.
+ *
+ * The \ref VCCERT_FIELD_TYPE_CERTIFICATE_ID, \ref
+ * VCCERT_FIELD_TYPE_PREVIOUS_CERTIFICATE_ID and \ref
+ * VCCERT_FIELD_TYPE_ARTIFACT_ID of the certificate are indexed when present.
+ * Certificates of an artifact must be added in store order.
+ *
+ * \param index             The index to update.
+ * \param cert              The certificate.
+ * \param size              The size of the certificate.
+ * \param position          The position of the certificate in the store.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_ADD_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_ID_INDEX_ADD_READ_ONLY if the index was loaded.
+ *      - \ref VCCERT_ERROR_ID_INDEX_ADD_BAD_CERTIFICATE if the certificate
+ *        fields could not be parsed.
+ *      - \ref VCCERT_ERROR_ID_INDEX_ADD_DUPLICATE if a certificate with the
+ *        same certificate id was already added.
+ *      - \ref VCCERT_ERROR_ID_INDEX_ADD_OUT_OF_MEMORY if the tables could not
+ *        be grown.
+ */
+int vccert_id_index_add(
+    vccert_id_index_t* index, const uint8_t* cert, size_t size,
+    uint64_t position)
+{
+    int retval;
+    const uint8_t* certificate_id = NULL;
+    const uint8_t* previous_id = NULL;
+    const uint8_t* artifact_id = NULL;
+    uint16_t field_type;
+    size_t field_size;
+    const uint8_t* field;
+
+    MODEL_ASSERT(index != NULL);
+    MODEL_ASSERT(cert != NULL);
+
+    /* parameter sanity check */
+    if (NULL == index || NULL == index->entries || NULL == cert
+     || UINT64_MAX == position)
+    {
+        return VCCERT_ERROR_ID_INDEX_ADD_INVALID_ARG;
+    }
+
+    if (NULL == index->alloc_opts)
+    {
+        return VCCERT_ERROR_ID_INDEX_ADD_READ_ONLY;
+    }
+
+    /* find the ids in one pass over the fields. */
+    size_t offset = 0;
+    while (offset < size)
+    {
+        if (VCCERT_STATUS_SUCCESS !=
+                vccert_parser_field(
+                    cert, size, offset, &field_type, &field_size, &field,
+                    &offset))
+        {
+            return VCCERT_ERROR_ID_INDEX_ADD_BAD_CERTIFICATE;
+        }
+
+        if (16 != field_size)
+        {
+            continue;
+        }
+
+        switch (field_type)
+        {
+            case VCCERT_FIELD_TYPE_CERTIFICATE_ID:
+                certificate_id = field;
+                break;
+
+            case VCCERT_FIELD_TYPE_PREVIOUS_CERTIFICATE_ID:
+                previous_id = field;
+                break;
+
+            case VCCERT_FIELD_TYPE_ARTIFACT_ID:
+                artifact_id = field;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    /* a certificate id names one certificate. */
+    if (NULL != certificate_id
+     && 0 !=
+            vccert_id_index_load64(
+                vccert_id_index_slot(
+                    &index->certificates, VCCERT_ID_INDEX_ID_SLOT_SIZE,
+                    certificate_id) + 16))
+    {
+        return VCCERT_ERROR_ID_INDEX_ADD_DUPLICATE;
+    }
+
+    /* make room everywhere first, so a failure leaves the index unchanged. */
+    retval =
+        vccert_id_index_reserve(
+            index, &index->certificates, VCCERT_ID_INDEX_ID_SLOT_SIZE);
+    if (VCCERT_STATUS_SUCCESS == retval)
+    {
+        retval =
+            vccert_id_index_reserve(
+                index, &index->successors, VCCERT_ID_INDEX_ID_SLOT_SIZE);
+    }
+
+    if (VCCERT_STATUS_SUCCESS == retval)
+    {
+        retval =
+            vccert_id_index_reserve(
+                index, &index->artifacts, VCCERT_ID_INDEX_ARTIFACT_SLOT_SIZE);
+    }
+
+    if (VCCERT_STATUS_SUCCESS == retval
+     && index->entry_count == index->entry_capacity)
+    {
+        uint8_t* entries =
+            (uint8_t*)
+                reallocate(
+                    index->alloc_opts, index->entries,
+                    index->entry_capacity * VCCERT_ID_INDEX_ENTRY_SIZE,
+                    2 * index->entry_capacity * VCCERT_ID_INDEX_ENTRY_SIZE);
+        if (NULL == entries)
+        {
+            retval = VCCERT_ERROR_ID_INDEX_ADD_OUT_OF_MEMORY;
+        }
+        else
+        {
+            index->entries = entries;
+            index->entry_capacity *= 2;
+        }
+    }
+
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (NULL != certificate_id)
+    {
+        vccert_id_index_put(&index->certificates, certificate_id, position);
+    }
+
+    /* on a fork, the first certificate to follow is kept. */
+    if (NULL != previous_id)
+    {
+        vccert_id_index_put(&index->successors, previous_id, position);
+    }
+
+    /* append the certificate to the history of its artifact. */
+    if (NULL != artifact_id)
+    {
+        size_t e = index->entry_count++;
+        uint8_t* entry = index->entries + e * VCCERT_ID_INDEX_ENTRY_SIZE;
+        vccert_id_index_store64(entry, position);
+        vccert_id_index_store64(entry + 8, 0);
+
+        uint8_t* slot =
+            vccert_id_index_slot(
+                &index->artifacts, VCCERT_ID_INDEX_ARTIFACT_SLOT_SIZE,
+                artifact_id);
+        if (0 == vccert_id_index_load64(slot + VCCERT_ID_INDEX_ARTIFACT_FIRST))
+        {
+            memcpy(slot, artifact_id, 16);
+            vccert_id_index_store64(
+                slot + VCCERT_ID_INDEX_ARTIFACT_FIRST, (uint64_t)e + 1);
+            vccert_id_index_store64(slot + VCCERT_ID_INDEX_ARTIFACT_COUNT, 0);
+            ++index->artifacts.count;
+        }
+        else
+        {
+            uint64_t last =
+                vccert_id_index_load64(slot + VCCERT_ID_INDEX_ARTIFACT_LAST);
+            vccert_id_index_store64(
+                index->entries + last * VCCERT_ID_INDEX_ENTRY_SIZE + 8,
+                (uint64_t)e + 1);
+        }
+
+        vccert_id_index_store64(
+            slot + VCCERT_ID_INDEX_ARTIFACT_LAST, (uint64_t)e);
+        vccert_id_index_store64(
+            slot + VCCERT_ID_INDEX_ARTIFACT_COUNT,
+            vccert_id_index_load64(slot + VCCERT_ID_INDEX_ARTIFACT_COUNT) + 1);
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Make room for one more id in a table, doubling it if it would become more
+ * than half full.
+ *
+ * \param index             The index that owns the table.
+ * \param table             The table.
+ * \param slot_size         The size of each slot in the table.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int vccert_id_index_reserve(
+    vccert_id_index_t* index, vccert_id_table_t* table, size_t slot_size)
+{
+    if (2 * (table->count + 1) <= table->mask + 1)
+    {
+        return VCCERT_STATUS_SUCCESS;
+    }
+
+    vccert_id_table_t grown;
+    size_t slots = 2 * (table->mask + 1);
+
+    grown.mask = slots - 1;
+    grown.count = table->count;
+    grown.slots = (uint8_t*)allocate(index->alloc_opts, slots * slot_size);
+    if (NULL == grown.slots)
+    {
+        return VCCERT_ERROR_ID_INDEX_ADD_OUT_OF_MEMORY;
+    }
+
+    memset(grown.slots, 0, slots * slot_size);
+
+    /* move each slot to its place in the larger table. */
+    for (size_t i = 0; i <= table->mask; ++i)
+    {
+        const uint8_t* slot = table->slots + i * slot_size;
+
+        if (0 != vccert_id_index_load64(slot + 16))
+        {
+            memcpy(vccert_id_index_slot(&grown, slot_size, slot), slot,
+                slot_size);
+        }
+    }
+
+    release(index->alloc_opts, table->slots);
+    *table = grown;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Map an id to a position, unless the id is already mapped.
+ *
+ * \param table             The table to update.
+ * \param id                The 128-bit id.
+ * \param position          The position.
+ */
+static void vccert_id_index_put(
+    vccert_id_table_t* table, const uint8_t* id, uint64_t position)
+{
+    uint8_t* slot =
+        vccert_id_index_slot(table, VCCERT_ID_INDEX_ID_SLOT_SIZE, id);
+
+    if (0 == vccert_id_index_load64(slot + 16))
+    {
+        memcpy(slot, id, 16);
+        vccert_id_index_store64(slot + 16, position + 1);
+        ++table->count;
+    }
+}
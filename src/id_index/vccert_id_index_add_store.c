@@ -0,0 +1,57 @@
+/**
+ * \file vccert_id_index_add_store.c
+ *
+ * Index every certificate in a certificate store.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "id_index_internal.h"
+
+/**
+ * \brief Index every certificate in a store.
+ *
+ * \param index             The index to update.
+ * \param store             The store to index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_ADD_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - a status code from vccert_store_at() or vccert_id_index_add().
+ */
+int vccert_id_index_add_store(
+    vccert_id_index_t* index, const vccert_store_t* store)
+{
+    int retval;
+    const uint8_t* cert;
+    size_t size;
+
+    MODEL_ASSERT(index != NULL);
+    MODEL_ASSERT(store != NULL);
+
+    /* parameter sanity check */
+    if (NULL == index || NULL == store)
+    {
+        return VCCERT_ERROR_ID_INDEX_ADD_INVALID_ARG;
+    }
+
+    for (size_t i = 0; i < store->count; ++i)
+    {
+        retval = vccert_store_at(store, i, &cert, &size);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval = vccert_id_index_add(index, cert, size, i);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,86 @@
+/**
+ * \file vccert_id_index_find_artifact.c
+ *
+ * Get the history of an artifact from an id index.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "id_index_internal.h"
+
+/**
+ * \brief Get the positions of the certificates of an artifact, in the order
+ * they were added.
+ *
+ * \param index             The index to search.
+ * \param artifact_id       The 128-bit artifact id to find.
+ * \param positions         Array to receive up to capacity positions, or NULL.
+ * \param capacity          The number of entries in positions.
+ * \param count             Pointer to receive the number of certificates of
+ *                          the artifact, which may exceed capacity.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_FIND_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_ID_INDEX_FIND_NOT_FOUND if the artifact is not
+ *        indexed.
+ *      - \ref VCCERT_ERROR_ID_INDEX_FIND_BAD_ENTRY if a loaded index has a
+ *        damaged history.
+ */
+int vccert_id_index_find_artifact(
+    const vccert_id_index_t* index, const uint8_t* artifact_id,
+    uint64_t* positions, size_t capacity, size_t* count)
+{
+    MODEL_ASSERT(index != NULL);
+    MODEL_ASSERT(artifact_id != NULL);
+    MODEL_ASSERT(capacity == 0 || positions != NULL);
+    MODEL_ASSERT(count != NULL);
+
+    /* parameter sanity check */
+    if (NULL == index || NULL == index->artifacts.slots
+     || NULL == artifact_id || (capacity > 0 && NULL == positions)
+     || NULL == count)
+    {
+        return VCCERT_ERROR_ID_INDEX_FIND_INVALID_ARG;
+    }
+
+    const uint8_t* slot =
+        vccert_id_index_slot(
+            &index->artifacts, VCCERT_ID_INDEX_ARTIFACT_SLOT_SIZE,
+            artifact_id);
+    if (NULL == slot
+     || 0 == vccert_id_index_load64(slot + VCCERT_ID_INDEX_ARTIFACT_FIRST))
+    {
+        return VCCERT_ERROR_ID_INDEX_FIND_NOT_FOUND;
+    }
+
+    uint64_t history =
+        vccert_id_index_load64(slot + VCCERT_ID_INDEX_ARTIFACT_COUNT);
+    if (history > index->entry_count)
+    {
+        return VCCERT_ERROR_ID_INDEX_FIND_BAD_ENTRY;
+    }
+
+    /* follow the history, which a loaded index does not guarantee is sane. */
+    uint64_t next =
+        vccert_id_index_load64(slot + VCCERT_ID_INDEX_ARTIFACT_FIRST);
+    for (size_t i = 0; i < capacity && i < history; ++i)
+    {
+        if (0 == next || next > index->entry_count)
+        {
+            return VCCERT_ERROR_ID_INDEX_FIND_BAD_ENTRY;
+        }
+
+        const uint8_t* entry =
+            index->entries + (next - 1) * VCCERT_ID_INDEX_ENTRY_SIZE;
+        positions[i] = vccert_id_index_load64(entry);
+        next = vccert_id_index_load64(entry + 8);
+    }
+
+    *count = (size_t)history;
+
+    return VCCERT_STATUS_SUCCESS;
+}
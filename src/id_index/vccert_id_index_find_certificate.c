@@ -0,0 +1,53 @@
+/**
+ * \file vccert_id_index_find_certificate.c
+ *
+ * Find a certificate in an id index by its certificate id.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "id_index_internal.h"
+
+/**
+ * \brief Find the position of a certificate by its certificate id.
+ *
+ * \param index             The index to search.
+ * \param certificate_id    The 128-bit certificate id to find.
+ * \param position          Pointer to receive the position.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_FIND_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_ID_INDEX_FIND_NOT_FOUND if the id is not indexed.
+ */
+int vccert_id_index_find_certificate(
+    const vccert_id_index_t* index, const uint8_t* certificate_id,
+    uint64_t* position)
+{
+    MODEL_ASSERT(index != NULL);
+    MODEL_ASSERT(certificate_id != NULL);
+    MODEL_ASSERT(position != NULL);
+
+    /* parameter sanity check */
+    if (NULL == index || NULL == index->certificates.slots
+     || NULL == certificate_id || NULL == position)
+    {
+        return VCCERT_ERROR_ID_INDEX_FIND_INVALID_ARG;
+    }
+
+    const uint8_t* slot =
+        vccert_id_index_slot(
+            &index->certificates, VCCERT_ID_INDEX_ID_SLOT_SIZE,
+            certificate_id);
+    if (NULL == slot || 0 == vccert_id_index_load64(slot + 16))
+    {
+        return VCCERT_ERROR_ID_INDEX_FIND_NOT_FOUND;
+    }
+
+    *position = vccert_id_index_load64(slot + 16) - 1;
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,151 @@
+/**
+ * \file vccert_id_index_init.c
+ *
+ * Initialize an id index.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "id_index_internal.h"
+
+/* forward decls */
+static void vccert_id_index_dispose(void* disposable);
+static int vccert_id_index_table_init(
+    vccert_id_table_t* table, allocator_options_t* alloc_opts,
+    size_t slot_size);
+
+/**
+ * \brief Initialize an empty id index.
+ *
+ * The index is owned by the caller and must be disposed by calling dispose()
+ * when no longer needed.
+ *
+ * \param index             The index to initialize.
+ * \param alloc_opts        The allocator to use for this index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_INIT_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_ID_INDEX_INIT_OUT_OF_MEMORY if the tables could not
+ *        be allocated.
+ */
+int vccert_id_index_init(
+    vccert_id_index_t* index, allocator_options_t* alloc_opts)
+{
+    MODEL_ASSERT(index != NULL);
+    MODEL_ASSERT(alloc_opts != NULL);
+
+    /* parameter sanity check */
+    if (NULL == index || NULL == alloc_opts)
+    {
+        return VCCERT_ERROR_ID_INDEX_INIT_INVALID_ARG;
+    }
+
+    memset(index, 0, sizeof(vccert_id_index_t));
+
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_id_index_table_init(
+                &index->certificates, alloc_opts,
+                VCCERT_ID_INDEX_ID_SLOT_SIZE)
+     || VCCERT_STATUS_SUCCESS !=
+            vccert_id_index_table_init(
+                &index->successors, alloc_opts,
+                VCCERT_ID_INDEX_ID_SLOT_SIZE)
+     || VCCERT_STATUS_SUCCESS !=
+            vccert_id_index_table_init(
+                &index->artifacts, alloc_opts,
+                VCCERT_ID_INDEX_ARTIFACT_SLOT_SIZE))
+    {
+        goto cleanup_tables;
+    }
+
+    index->entries =
+        (uint8_t*)
+            allocate(
+                alloc_opts,
+                VCCERT_ID_INDEX_INITIAL_SLOTS * VCCERT_ID_INDEX_ENTRY_SIZE);
+    if (NULL == index->entries)
+    {
+        goto cleanup_tables;
+    }
+
+    index->hdr.dispose = &vccert_id_index_dispose;
+    index->alloc_opts = alloc_opts;
+    index->entry_capacity = VCCERT_ID_INDEX_INITIAL_SLOTS;
+
+    return VCCERT_STATUS_SUCCESS;
+
+cleanup_tables:
+    if (NULL != index->certificates.slots)
+    {
+        release(alloc_opts, index->certificates.slots);
+    }
+
+    if (NULL != index->successors.slots)
+    {
+        release(alloc_opts, index->successors.slots);
+    }
+
+    if (NULL != index->artifacts.slots)
+    {
+        release(alloc_opts, index->artifacts.slots);
+    }
+
+    memset(index, 0, sizeof(vccert_id_index_t));
+
+    return VCCERT_ERROR_ID_INDEX_INIT_OUT_OF_MEMORY;
+}
+
+/**
+ * Allocate an empty table.
+ *
+ * \param table             The table to initialize.
+ * \param alloc_opts        The allocator to use.
+ * \param slot_size         The size of each slot.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int vccert_id_index_table_init(
+    vccert_id_table_t* table, allocator_options_t* alloc_opts,
+    size_t slot_size)
+{
+    size_t size = VCCERT_ID_INDEX_INITIAL_SLOTS * slot_size;
+
+    table->slots = (uint8_t*)allocate(alloc_opts, size);
+    if (NULL == table->slots)
+    {
+        return VCCERT_ERROR_ID_INDEX_INIT_OUT_OF_MEMORY;
+    }
+
+    memset(table->slots, 0, size);
+    table->mask = VCCERT_ID_INDEX_INITIAL_SLOTS - 1;
+    table->count = 0;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of an id index.  A loaded index does not own its tables.
+ *
+ * \param disposable        The index to dispose.
+ */
+static void vccert_id_index_dispose(void* disposable)
+{
+    vccert_id_index_t* index = (vccert_id_index_t*)disposable;
+
+    MODEL_ASSERT(index != NULL);
+
+    if (NULL != index->alloc_opts)
+    {
+        release(index->alloc_opts, index->certificates.slots);
+        release(index->alloc_opts, index->successors.slots);
+        release(index->alloc_opts, index->artifacts.slots);
+        release(index->alloc_opts, index->entries);
+    }
+
+    memset(index, 0, sizeof(vccert_id_index_t));
+}
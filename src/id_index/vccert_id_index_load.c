@@ -0,0 +1,153 @@
+/**
+ * \file vccert_id_index_load.c
+ *
+ * Load a saved id index.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "id_index_internal.h"
+
+/* forward decls */
+static void vccert_id_index_loaded_dispose(void* disposable);
+static bool vccert_id_index_load_table(
+    vccert_id_table_t* table, const uint8_t* header, size_t slots_offset,
+    size_t count_offset, size_t slot_size, const uint8_t** p, size_t* left);
+
+/**
+ * \brief Load an id index saved by vccert_id_index_write().
+ *
+ * The saved bytes are probed in place, so they must outlive the index, and
+ * the index cannot be added to.  The index must be disposed by calling
+ * dispose() when no longer needed.
+ *
+ * \param index             The index to initialize.
+ * \param data              The saved index, for example a memory mapping.
+ * \param size              The size of the saved index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_LOAD_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_ID_INDEX_LOAD_BAD_HEADER if the header is damaged or
+ *        does not match the size.
+ */
+int vccert_id_index_load(
+    vccert_id_index_t* index, const void* data, size_t size)
+{
+    const uint8_t* header = (const uint8_t*)data;
+
+    MODEL_ASSERT(index != NULL);
+    MODEL_ASSERT(data != NULL);
+
+    /* parameter sanity check */
+    if (NULL == index || NULL == data)
+    {
+        return VCCERT_ERROR_ID_INDEX_LOAD_INVALID_ARG;
+    }
+
+    if (size < VCCERT_ID_INDEX_HEADER_SIZE
+     || memcmp(header, VCCERT_ID_INDEX_MAGIC, strlen(VCCERT_ID_INDEX_MAGIC))
+     || 0 != header[4] || 0 != header[5] || 0 != header[6] || 0 != header[7])
+    {
+        return VCCERT_ERROR_ID_INDEX_LOAD_BAD_HEADER;
+    }
+
+    memset(index, 0, sizeof(vccert_id_index_t));
+
+    /* each table must be a power of two in size, and fit in the data. */
+    const uint8_t* p = header + VCCERT_ID_INDEX_HEADER_SIZE;
+    size_t left = size - VCCERT_ID_INDEX_HEADER_SIZE;
+    if (!vccert_id_index_load_table(
+            &index->certificates, header,
+            VCCERT_ID_INDEX_OFFSET_CERTIFICATE_SLOTS,
+            VCCERT_ID_INDEX_OFFSET_CERTIFICATE_COUNT,
+            VCCERT_ID_INDEX_ID_SLOT_SIZE, &p, &left)
+     || !vccert_id_index_load_table(
+            &index->successors, header,
+            VCCERT_ID_INDEX_OFFSET_SUCCESSOR_SLOTS,
+            VCCERT_ID_INDEX_OFFSET_SUCCESSOR_COUNT,
+            VCCERT_ID_INDEX_ID_SLOT_SIZE, &p, &left)
+     || !vccert_id_index_load_table(
+            &index->artifacts, header,
+            VCCERT_ID_INDEX_OFFSET_ARTIFACT_SLOTS,
+            VCCERT_ID_INDEX_OFFSET_ARTIFACT_COUNT,
+            VCCERT_ID_INDEX_ARTIFACT_SLOT_SIZE, &p, &left))
+    {
+        goto bad_header;
+    }
+
+    /* the history entries must exactly fill the rest. */
+    uint64_t entry_count =
+        vccert_id_index_load64(header + VCCERT_ID_INDEX_OFFSET_ENTRY_COUNT);
+    if (entry_count != left / VCCERT_ID_INDEX_ENTRY_SIZE
+     || 0 != left % VCCERT_ID_INDEX_ENTRY_SIZE)
+    {
+        goto bad_header;
+    }
+
+    /* the loaded tables are only ever read. */
+    index->hdr.dispose = &vccert_id_index_loaded_dispose;
+    index->entries = (uint8_t*)p;
+    index->entry_count = (size_t)entry_count;
+    index->entry_capacity = (size_t)entry_count;
+
+    return VCCERT_STATUS_SUCCESS;
+
+bad_header:
+    memset(index, 0, sizeof(vccert_id_index_t));
+
+    return VCCERT_ERROR_ID_INDEX_LOAD_BAD_HEADER;
+}
+
+/**
+ * Point a table at its saved slots.
+ *
+ * \param table             The table to initialize.
+ * \param header            The saved index header.
+ * \param slots_offset      The header offset of the number of slots.
+ * \param count_offset      The header offset of the number of used slots.
+ * \param slot_size         The size of each slot.
+ * \param p                 The start of the saved slots, advanced past them.
+ * \param left              The bytes left in the saved index, reduced by the
+ *                          size of the slots.
+ *
+ * \returns true if the table fits, and false otherwise.
+ */
+static bool vccert_id_index_load_table(
+    vccert_id_table_t* table, const uint8_t* header, size_t slots_offset,
+    size_t count_offset, size_t slot_size, const uint8_t** p, size_t* left)
+{
+    uint64_t slots = vccert_id_index_load64(header + slots_offset);
+    uint64_t count = vccert_id_index_load64(header + count_offset);
+
+    if (0 == slots || 0 != (slots & (slots - 1)) || count > slots
+     || slots > *left / slot_size)
+    {
+        return false;
+    }
+
+    table->slots = (uint8_t*)*p;
+    table->mask = (size_t)slots - 1;
+    table->count = (size_t)count;
+
+    *p += slots * slot_size;
+    *left -= slots * slot_size;
+
+    return true;
+}
+
+/**
+ * Dispose of a loaded id index.  The saved index is not owned by it.
+ *
+ * \param disposable        The index to dispose.
+ */
+static void vccert_id_index_loaded_dispose(void* disposable)
+{
+    MODEL_ASSERT(disposable != NULL);
+
+    memset(disposable, 0, sizeof(vccert_id_index_t));
+}
@@ -0,0 +1,58 @@
+/**
+ * \file vccert_id_index_slot.c
+ *
+ * Find the slot for an id in an id index table.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "id_index_internal.h"
+
+/**
+ * Find the slot for an id, or the empty slot where it belongs.
+ *
+ * Tables are open addressed with linear probing, and are never more than half
+ * full when built by this library.  A loaded table is not trusted, so the
+ * probe also stops after visiting every slot.
+ *
+ * \param table         The table to search.
+ * \param slot_size     The size of each slot in the table.
+ * \param id            The 128-bit id to find.
+ *
+ * \returns the slot for this id, an empty slot, or NULL if a damaged loaded
+ * table has neither.
+ */
+uint8_t* vccert_id_index_slot(
+    const vccert_id_table_t* table, size_t slot_size, const uint8_t* id)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    MODEL_ASSERT(table != NULL);
+    MODEL_ASSERT(table->slots != NULL);
+    MODEL_ASSERT(id != NULL);
+
+    /* FNV-1a over the id. */
+    for (size_t i = 0; i < 16; ++i)
+    {
+        hash ^= id[i];
+        hash *= 1099511628211ULL;
+    }
+
+    size_t s = (size_t)hash & table->mask;
+    for (size_t probes = 0; probes <= table->mask; ++probes)
+    {
+        uint8_t* slot = table->slots + s * slot_size;
+
+        if (0 == vccert_id_index_load64(slot + 16) || !memcmp(slot, id, 16))
+        {
+            return slot;
+        }
+
+        s = (s + 1) & table->mask;
+    }
+
+    return NULL;
+}
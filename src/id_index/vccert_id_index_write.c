@@ -0,0 +1,106 @@
+/**
+ * \file vccert_id_index_write.c
+ *
+ * Save an id index.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "id_index_internal.h"
+
+/**
+ * \brief Save an id index.
+ *
+ * Call this first with a NULL buffer to get the size of the saved index.
+ *
+ * \param index             The index to save.
+ * \param buffer            The buffer to receive the index, or NULL.
+ * \param size              The size of the buffer.
+ * \param required          Pointer to receive the size of the saved index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_ID_INDEX_WRITE_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_ID_INDEX_WRITE_BUFFER_TOO_SMALL if the buffer is too
+ *        small.
+ */
+int vccert_id_index_write(
+    const vccert_id_index_t* index, uint8_t* buffer, size_t size,
+    size_t* required)
+{
+    MODEL_ASSERT(index != NULL);
+    MODEL_ASSERT(required != NULL);
+
+    /* parameter sanity check */
+    if (NULL == index || NULL == index->entries || NULL == required)
+    {
+        return VCCERT_ERROR_ID_INDEX_WRITE_INVALID_ARG;
+    }
+
+    size_t certificates_size =
+        (index->certificates.mask + 1) * VCCERT_ID_INDEX_ID_SLOT_SIZE;
+    size_t successors_size =
+        (index->successors.mask + 1) * VCCERT_ID_INDEX_ID_SLOT_SIZE;
+    size_t artifacts_size =
+        (index->artifacts.mask + 1) * VCCERT_ID_INDEX_ARTIFACT_SLOT_SIZE;
+    size_t entries_size = index->entry_count * VCCERT_ID_INDEX_ENTRY_SIZE;
+
+    *required =
+        VCCERT_ID_INDEX_HEADER_SIZE + certificates_size + successors_size
+      + artifacts_size + entries_size;
+
+    /* the caller only wants the size. */
+    if (NULL == buffer)
+    {
+        return VCCERT_STATUS_SUCCESS;
+    }
+
+    if (size < *required)
+    {
+        return VCCERT_ERROR_ID_INDEX_WRITE_BUFFER_TOO_SMALL;
+    }
+
+    /* write the header. */
+    memset(buffer, 0, VCCERT_ID_INDEX_HEADER_SIZE);
+    memcpy(buffer, VCCERT_ID_INDEX_MAGIC, strlen(VCCERT_ID_INDEX_MAGIC));
+    vccert_id_index_store64(
+        buffer + VCCERT_ID_INDEX_OFFSET_CERTIFICATE_SLOTS,
+        (uint64_t)index->certificates.mask + 1);
+    vccert_id_index_store64(
+        buffer + VCCERT_ID_INDEX_OFFSET_SUCCESSOR_SLOTS,
+        (uint64_t)index->successors.mask + 1);
+    vccert_id_index_store64(
+        buffer + VCCERT_ID_INDEX_OFFSET_ARTIFACT_SLOTS,
+        (uint64_t)index->artifacts.mask + 1);
+    vccert_id_index_store64(
+        buffer + VCCERT_ID_INDEX_OFFSET_CERTIFICATE_COUNT,
+        (uint64_t)index->certificates.count);
+    vccert_id_index_store64(
+        buffer + VCCERT_ID_INDEX_OFFSET_SUCCESSOR_COUNT,
+        (uint64_t)index->successors.count);
+    vccert_id_index_store64(
+        buffer + VCCERT_ID_INDEX_OFFSET_ARTIFACT_COUNT,
+        (uint64_t)index->artifacts.count);
+    vccert_id_index_store64(
+        buffer + VCCERT_ID_INDEX_OFFSET_ENTRY_COUNT,
+        (uint64_t)index->entry_count);
+
+    /* the tables are already in their saved layout. */
+    uint8_t* p = buffer + VCCERT_ID_INDEX_HEADER_SIZE;
+    memcpy(p, index->certificates.slots, certificates_size);
+    p += certificates_size;
+    memcpy(p, index->successors.slots, successors_size);
+    p += successors_size;
+    memcpy(p, index->artifacts.slots, artifacts_size);
+    p += artifacts_size;
+    if (entries_size > 0)
+    {
+        memcpy(p, index->entries, entries_size);
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,110 @@
+/**
+ * \file keydir_internal.h
+ *
+ * Internal helpers for the key directory format.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_PRIVATE_KEYDIR_INTERNAL_HEADER_GUARD
+#define VCCERT_PRIVATE_KEYDIR_INTERNAL_HEADER_GUARD
+
+#include <vccert/error_codes.h>
+#include <vccert/keydir.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * The key directory format version written and read by this library.
+ */
+#define VCCERT_KEYDIR_VERSION 1
+
+/**
+ * The header field offsets.
+ */
+#define VCCERT_KEYDIR_OFFSET_MAGIC 0
+#define VCCERT_KEYDIR_OFFSET_VERSION 4
+#define VCCERT_KEYDIR_OFFSET_SIGNING_KEY_SIZE 6
+#define VCCERT_KEYDIR_OFFSET_ENCRYPTION_KEY_SIZE 8
+#define VCCERT_KEYDIR_OFFSET_RESERVED 10
+#define VCCERT_KEYDIR_OFFSET_RECORD_SIZE 12
+#define VCCERT_KEYDIR_OFFSET_RECORD_COUNT 16
+#define VCCERT_KEYDIR_OFFSET_RESERVED2 24
+
+/**
+ * The record field offsets.
+ */
+#define VCCERT_KEYDIR_RECORD_ENTITY_ID 0
+#define VCCERT_KEYDIR_RECORD_HEIGHT_FROM 16
+#define VCCERT_KEYDIR_RECORD_HEIGHT_TO 24
+#define VCCERT_KEYDIR_RECORD_KEYS 32
+
+/**
+ * The key directory magic number.
+ */
+#define VCCERT_KEYDIR_MAGIC "VCKD"
+
+/**
+ * Read a big endian 16-bit value.
+ */
+static inline uint16_t vccert_keydir_load16(const uint8_t* p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+/**
+ * Read a big endian 32-bit value.
+ */
+static inline uint32_t vccert_keydir_load32(const uint8_t* p)
+{
+    return
+        ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16)
+      | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+/**
+ * Read a big endian 64-bit value.
+ */
+static inline uint64_t vccert_keydir_load64(const uint8_t* p)
+{
+    return
+        ((uint64_t)vccert_keydir_load32(p) << 32)
+      | (uint64_t)vccert_keydir_load32(p + 4);
+}
+
+/**
+ * Write a big endian 16-bit value.
+ */
+static inline void vccert_keydir_store16(uint8_t* p, uint16_t val)
+{
+    p[0] = (uint8_t)(val >> 8);
+    p[1] = (uint8_t)val;
+}
+
+/**
+ * Write a big endian 32-bit value.
+ */
+static inline void vccert_keydir_store32(uint8_t* p, uint32_t val)
+{
+    vccert_keydir_store16(p, (uint16_t)(val >> 16));
+    vccert_keydir_store16(p + 2, (uint16_t)val);
+}
+
+/**
+ * Write a big endian 64-bit value.
+ */
+static inline void vccert_keydir_store64(uint8_t* p, uint64_t val)
+{
+    vccert_keydir_store32(p, (uint32_t)(val >> 32));
+    vccert_keydir_store32(p + 4, (uint32_t)val);
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_PRIVATE_KEYDIR_INTERNAL_HEADER_GUARD
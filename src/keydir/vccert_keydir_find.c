@@ -0,0 +1,182 @@
+/**
+ * \file vccert_keydir_find.c
+ *
+ * Find the public keys of an entity in a key directory.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "keydir_internal.h"
+
+/* forward decls */
+static size_t vccert_keydir_lower_bound(
+    const vccert_keydir_t* keydir, const uint8_t* entity_id);
+
+/**
+ * \brief Find the public keys of an entity as of a block height.
+ *
+ * The entity is found by interpolation search on its id, then its records are
+ * binary searched by height.
+ *
+ * \param keydir            The key directory to search.
+ * \param entity_id         The 128-bit entity id to find.
+ * \param height            The block height at which the keys are needed.
+ * \param encryption_key    Optional buffer to receive the public encryption
+ *                          key.  Its size must match the stored key.
+ * \param signing_key       Optional buffer to receive the public signing key.
+ *                          Its size must match the stored key.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_KEYDIR_FIND_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_KEYDIR_FIND_NOT_FOUND if the entity had no keys as
+ *        of this height.
+ *      - \ref VCCERT_ERROR_KEYDIR_FIND_KEY_SIZE if an output buffer does not
+ *        match the size of the stored key.
+ */
+int vccert_keydir_find(
+    const vccert_keydir_t* keydir, const uint8_t* entity_id, uint64_t height,
+    vccrypt_buffer_t* encryption_key, vccrypt_buffer_t* signing_key)
+{
+    MODEL_ASSERT(keydir != NULL);
+    MODEL_ASSERT(entity_id != NULL);
+
+    /* parameter sanity check */
+    if (NULL == keydir || NULL == keydir->records || NULL == entity_id)
+    {
+        return VCCERT_ERROR_KEYDIR_FIND_INVALID_ARG;
+    }
+
+    size_t first = vccert_keydir_lower_bound(keydir, entity_id);
+
+    /* find the number of this entity's records at or below this height. */
+    size_t lo = first, hi = keydir->count;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        const uint8_t* record = keydir->records + mid * keydir->record_size;
+
+        if (!memcmp(record + VCCERT_KEYDIR_RECORD_ENTITY_ID, entity_id, 16)
+         && vccert_keydir_load64(record + VCCERT_KEYDIR_RECORD_HEIGHT_FROM)
+                <= height)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    /* the entity is missing, or did not exist yet at this height. */
+    if (first == lo)
+    {
+        return VCCERT_ERROR_KEYDIR_FIND_NOT_FOUND;
+    }
+
+    /* the keys must not have been retired before this height. */
+    const uint8_t* record = keydir->records + (lo - 1) * keydir->record_size;
+    if (height >= vccert_keydir_load64(record + VCCERT_KEYDIR_RECORD_HEIGHT_TO))
+    {
+        return VCCERT_ERROR_KEYDIR_FIND_NOT_FOUND;
+    }
+
+    if ((NULL != encryption_key
+            && encryption_key->size != keydir->encryption_key_size)
+     || (NULL != signing_key
+            && signing_key->size != keydir->signing_key_size))
+    {
+        return VCCERT_ERROR_KEYDIR_FIND_KEY_SIZE;
+    }
+
+    if (NULL != signing_key)
+    {
+        memcpy(
+            signing_key->data, record + VCCERT_KEYDIR_RECORD_KEYS,
+            keydir->signing_key_size);
+    }
+
+    if (NULL != encryption_key)
+    {
+        memcpy(
+            encryption_key->data,
+            record + VCCERT_KEYDIR_RECORD_KEYS + keydir->signing_key_size,
+            keydir->encryption_key_size);
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Find the first record whose entity id is not less than the given id.
+ *
+ * Entity ids are close to uniformly distributed, so the first eight bytes of
+ * an id predict its position well.  Interpolation steps alternate with
+ * bisection steps so that a skewed directory is still searched in
+ * logarithmic time.
+ *
+ * \param keydir            The key directory to search.
+ * \param entity_id         The 128-bit entity id to find.
+ *
+ * \returns the index of the first record not less than this id.
+ */
+static size_t vccert_keydir_lower_bound(
+    const vccert_keydir_t* keydir, const uint8_t* entity_id)
+{
+    uint64_t key = vccert_keydir_load64(entity_id);
+    size_t lo = 0, hi = keydir->count;
+    bool interpolate = true;
+
+    while (lo < hi)
+    {
+        size_t probe = lo + (hi - lo) / 2;
+
+        if (interpolate && hi - lo > 2)
+        {
+            uint64_t lo_key =
+                vccert_keydir_load64(
+                    keydir->records + lo * keydir->record_size);
+            uint64_t hi_key =
+                vccert_keydir_load64(
+                    keydir->records + (hi - 1) * keydir->record_size);
+
+            if (key <= lo_key)
+            {
+                probe = lo;
+            }
+            else if (key >= hi_key)
+            {
+                probe = hi - 1;
+            }
+            else
+            {
+                double fraction =
+                    (double)(key - lo_key) / (double)(hi_key - lo_key);
+
+                probe = lo + (size_t)(fraction * (double)(hi - 1 - lo));
+                if (probe >= hi)
+                {
+                    probe = hi - 1;
+                }
+            }
+        }
+
+        interpolate = !interpolate;
+
+        const uint8_t* record = keydir->records + probe * keydir->record_size;
+        if (memcmp(record + VCCERT_KEYDIR_RECORD_ENTITY_ID, entity_id, 16) < 0)
+        {
+            lo = probe + 1;
+        }
+        else
+        {
+            hi = probe;
+        }
+    }
+
+    return lo;
+}
@@ -0,0 +1,107 @@
+/**
+ * \file vccert_keydir_init.c
+ *
+ * Initialize a view of a key directory.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "keydir_internal.h"
+
+/* forward decls */
+static void vccert_keydir_dispose(void* disposable);
+
+/**
+ * \brief Initialize a view of a key directory.
+ *
+ * Only the header is checked; records are read as they are searched.
+ *
+ * \param keydir            The view to initialize.
+ * \param data              The key directory, for example a memory mapping.
+ * \param size              The size of the key directory.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_KEYDIR_INIT_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_KEYDIR_INIT_BAD_HEADER if the header is not that of
+ *        a key directory this library can read.
+ *      - \ref VCCERT_ERROR_KEYDIR_INIT_TRUNCATED if the records run past the
+ *        end of the data.
+ */
+int vccert_keydir_init(
+    vccert_keydir_t* keydir, const void* data, size_t size)
+{
+    const uint8_t* header = (const uint8_t*)data;
+
+    MODEL_ASSERT(keydir != NULL);
+    MODEL_ASSERT(data != NULL);
+
+    /* parameter sanity check */
+    if (NULL == keydir || NULL == data)
+    {
+        return VCCERT_ERROR_KEYDIR_INIT_INVALID_ARG;
+    }
+
+    if (size < VCCERT_KEYDIR_HEADER_SIZE)
+    {
+        return VCCERT_ERROR_KEYDIR_INIT_TRUNCATED;
+    }
+
+    size_t signing_key_size =
+        vccert_keydir_load16(header + VCCERT_KEYDIR_OFFSET_SIGNING_KEY_SIZE);
+    size_t encryption_key_size =
+        vccert_keydir_load16(
+            header + VCCERT_KEYDIR_OFFSET_ENCRYPTION_KEY_SIZE);
+    size_t record_size =
+        vccert_keydir_load32(header + VCCERT_KEYDIR_OFFSET_RECORD_SIZE);
+    uint64_t count =
+        vccert_keydir_load64(header + VCCERT_KEYDIR_OFFSET_RECORD_COUNT);
+
+    /* the header must be one this library wrote. */
+    if (memcmp(
+            header + VCCERT_KEYDIR_OFFSET_MAGIC, VCCERT_KEYDIR_MAGIC,
+            strlen(VCCERT_KEYDIR_MAGIC))
+     || VCCERT_KEYDIR_VERSION !=
+            vccert_keydir_load16(header + VCCERT_KEYDIR_OFFSET_VERSION)
+     || 0 != vccert_keydir_load16(header + VCCERT_KEYDIR_OFFSET_RESERVED)
+     || 0 != vccert_keydir_load64(header + VCCERT_KEYDIR_OFFSET_RESERVED2)
+     || VCCERT_KEYDIR_RECORD_HEADER_SIZE + signing_key_size
+            + encryption_key_size != record_size)
+    {
+        return VCCERT_ERROR_KEYDIR_INIT_BAD_HEADER;
+    }
+
+    /* the records must fit in the data. */
+    if (count > (size - VCCERT_KEYDIR_HEADER_SIZE) / record_size)
+    {
+        return VCCERT_ERROR_KEYDIR_INIT_TRUNCATED;
+    }
+
+    memset(keydir, 0, sizeof(vccert_keydir_t));
+
+    keydir->hdr.dispose = &vccert_keydir_dispose;
+    keydir->records = header + VCCERT_KEYDIR_HEADER_SIZE;
+    keydir->count = (size_t)count;
+    keydir->record_size = record_size;
+    keydir->signing_key_size = signing_key_size;
+    keydir->encryption_key_size = encryption_key_size;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a key directory view.  The key directory itself is not owned by
+ * the view.
+ *
+ * \param disposable        The view to dispose.
+ */
+static void vccert_keydir_dispose(void* disposable)
+{
+    MODEL_ASSERT(disposable != NULL);
+
+    memset(disposable, 0, sizeof(vccert_keydir_t));
+}
@@ -0,0 +1,264 @@
+/**
+ * \file vccert_keydir_write.c
+ *
+ * Write the keys in a keyring as a key directory.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "keydir_internal.h"
+
+/* forward decls */
+static void vccert_keydir_sort(const vccert_keyring_entry_t** index, size_t n);
+static void vccert_keydir_sift(
+    const vccert_keyring_entry_t** index, size_t root, size_t n);
+
+/**
+ * \brief Write the keys in a keyring as a key directory.
+ *
+ * Call this first with a NULL buffer to get the size of the key directory.
+ *
+ * \param keyring           The keyring to write.
+ * \param buffer            The buffer to receive the key directory, or NULL.
+ * \param size              The size of the buffer.
+ * \param required          Pointer to receive the size of the key directory.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_KEYDIR_WRITE_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_KEYDIR_WRITE_BUFFER_TOO_SMALL if the buffer is too
+ *        small.
+ *      - \ref VCCERT_ERROR_KEYDIR_WRITE_KEY_SIZE_MISMATCH if the keys in the
+ *        keyring do not all have the same size.
+ *      - \ref VCCERT_ERROR_KEYDIR_WRITE_OUT_OF_MEMORY if the sort index could
+ *        not be allocated.
+ */
+int vccert_keydir_write(
+    const vccert_keyring_t* keyring, uint8_t* buffer, size_t size,
+    size_t* required)
+{
+    size_t signing_key_size = 0, encryption_key_size = 0;
+    size_t count = 0;
+
+    MODEL_ASSERT(keyring != NULL);
+    MODEL_ASSERT(keyring->entries != NULL);
+    MODEL_ASSERT(required != NULL);
+
+    /* parameter sanity check */
+    if (NULL == keyring || NULL == keyring->entries || NULL == required)
+    {
+        return VCCERT_ERROR_KEYDIR_WRITE_INVALID_ARG;
+    }
+
+    /* count the records, and check that every key has the same size. */
+    bool first = true;
+    for (size_t i = 0; i <= keyring->mask; ++i)
+    {
+        const vccert_keyring_entry_t* entry = &keyring->entries[i];
+
+        for (size_t v = 0; NULL != entry->versions && v < entry->count; ++v)
+        {
+            const vccert_keyring_version_t* version = &entry->versions[v];
+
+            if (first)
+            {
+                signing_key_size = version->signing_key_size;
+                encryption_key_size = version->encryption_key_size;
+                first = false;
+            }
+            else if (signing_key_size != version->signing_key_size
+                  || encryption_key_size != version->encryption_key_size)
+            {
+                return VCCERT_ERROR_KEYDIR_WRITE_KEY_SIZE_MISMATCH;
+            }
+
+            /* a version replaced at the same height is never used. */
+            if (v + 1 < entry->count
+             && entry->versions[v + 1].height == version->height)
+            {
+                continue;
+            }
+
+            ++count;
+        }
+    }
+
+    /* the key sizes must fit in the header. */
+    if (signing_key_size > UINT16_MAX || encryption_key_size > UINT16_MAX)
+    {
+        return VCCERT_ERROR_KEYDIR_WRITE_KEY_SIZE_MISMATCH;
+    }
+
+    size_t record_size =
+        VCCERT_KEYDIR_RECORD_HEADER_SIZE + signing_key_size
+      + encryption_key_size;
+    *required = VCCERT_KEYDIR_HEADER_SIZE + count * record_size;
+
+    /* the caller only wants the size. */
+    if (NULL == buffer)
+    {
+        return VCCERT_STATUS_SUCCESS;
+    }
+
+    if (size < *required)
+    {
+        return VCCERT_ERROR_KEYDIR_WRITE_BUFFER_TOO_SMALL;
+    }
+
+    /* sort the entries by entity id. */
+    const vccert_keyring_entry_t** index = NULL;
+    if (keyring->count > 0)
+    {
+        index =
+            (const vccert_keyring_entry_t**)
+                allocate(
+                    keyring->alloc_opts,
+                    keyring->count * sizeof(vccert_keyring_entry_t*));
+        if (NULL == index)
+        {
+            return VCCERT_ERROR_KEYDIR_WRITE_OUT_OF_MEMORY;
+        }
+    }
+
+    size_t entries = 0;
+    for (size_t i = 0; i <= keyring->mask; ++i)
+    {
+        if (NULL != keyring->entries[i].versions)
+        {
+            index[entries++] = &keyring->entries[i];
+        }
+    }
+
+    MODEL_ASSERT(entries == keyring->count);
+    vccert_keydir_sort(index, entries);
+
+    /* write the header. */
+    memset(buffer, 0, VCCERT_KEYDIR_HEADER_SIZE);
+    memcpy(
+        buffer + VCCERT_KEYDIR_OFFSET_MAGIC, VCCERT_KEYDIR_MAGIC,
+        strlen(VCCERT_KEYDIR_MAGIC));
+    vccert_keydir_store16(
+        buffer + VCCERT_KEYDIR_OFFSET_VERSION, VCCERT_KEYDIR_VERSION);
+    vccert_keydir_store16(
+        buffer + VCCERT_KEYDIR_OFFSET_SIGNING_KEY_SIZE,
+        (uint16_t)signing_key_size);
+    vccert_keydir_store16(
+        buffer + VCCERT_KEYDIR_OFFSET_ENCRYPTION_KEY_SIZE,
+        (uint16_t)encryption_key_size);
+    vccert_keydir_store32(
+        buffer + VCCERT_KEYDIR_OFFSET_RECORD_SIZE, (uint32_t)record_size);
+    vccert_keydir_store64(
+        buffer + VCCERT_KEYDIR_OFFSET_RECORD_COUNT, (uint64_t)count);
+
+    /* write the records of each entity in height order. */
+    uint8_t* record = buffer + VCCERT_KEYDIR_HEADER_SIZE;
+    for (size_t i = 0; i < entries; ++i)
+    {
+        const vccert_keyring_entry_t* entry = index[i];
+
+        for (size_t v = 0; v < entry->count; ++v)
+        {
+            const vccert_keyring_version_t* version = &entry->versions[v];
+            uint64_t height_to = UINT64_MAX;
+
+            if (v + 1 < entry->count)
+            {
+                height_to = entry->versions[v + 1].height;
+                if (height_to == version->height)
+                {
+                    continue;
+                }
+            }
+
+            memcpy(
+                record + VCCERT_KEYDIR_RECORD_ENTITY_ID, entry->entity_id,
+                sizeof(entry->entity_id));
+            vccert_keydir_store64(
+                record + VCCERT_KEYDIR_RECORD_HEIGHT_FROM, version->height);
+            vccert_keydir_store64(
+                record + VCCERT_KEYDIR_RECORD_HEIGHT_TO, height_to);
+
+            /* the keyring stores the encryption key first. */
+            memcpy(
+                record + VCCERT_KEYDIR_RECORD_KEYS,
+                version->keys + encryption_key_size, signing_key_size);
+            memcpy(
+                record + VCCERT_KEYDIR_RECORD_KEYS + signing_key_size,
+                version->keys, encryption_key_size);
+
+            record += record_size;
+        }
+    }
+
+    MODEL_ASSERT(record == buffer + *required);
+
+    if (NULL != index)
+    {
+        release(keyring->alloc_opts, index);
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Heap sort keyring entries by entity id.
+ *
+ * \param index             The entries to sort.
+ * \param n                 The number of entries.
+ */
+static void vccert_keydir_sort(const vccert_keyring_entry_t** index, size_t n)
+{
+    /* build the heap. */
+    for (size_t i = n / 2; i > 0; --i)
+    {
+        vccert_keydir_sift(index, i - 1, n);
+    }
+
+    /* move the largest entry to the end of the heap until it is empty. */
+    for (size_t end = n; end > 1; --end)
+    {
+        const vccert_keyring_entry_t* tmp = index[0];
+        index[0] = index[end - 1];
+        index[end - 1] = tmp;
+
+        vccert_keydir_sift(index, 0, end - 1);
+    }
+}
+
+/**
+ * Sift an entry down the heap until neither child is larger.
+ *
+ * \param index             The heap.
+ * \param root              The entry to sift.
+ * \param n                 The number of entries in the heap.
+ */
+static void vccert_keydir_sift(
+    const vccert_keyring_entry_t** index, size_t root, size_t n)
+{
+    for (size_t child = 2 * root + 1; child < n; child = 2 * root + 1)
+    {
+        if (child + 1 < n
+         && memcmp(
+                index[child]->entity_id, index[child + 1]->entity_id,
+                sizeof(index[child]->entity_id)) < 0)
+        {
+            ++child;
+        }
+
+        if (memcmp(
+                index[root]->entity_id, index[child]->entity_id,
+                sizeof(index[root]->entity_id)) >= 0)
+        {
+            return;
+        }
+
+        const vccert_keyring_entry_t* tmp = index[root];
+        index[root] = index[child];
+        index[child] = tmp;
+        root = child;
+    }
+}
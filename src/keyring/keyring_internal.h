@@ -0,0 +1,41 @@
+/**
+ * \file keyring_internal.h
+ *
+ * Internal helpers for the keyring.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_PRIVATE_KEYRING_INTERNAL_HEADER_GUARD
+#define VCCERT_PRIVATE_KEYRING_INTERNAL_HEADER_GUARD
+
+#include <vccert/error_codes.h>
+#include <vccert/keyring.h>
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * The number of entries in a new keyring.
+ */
+#define VCCERT_KEYRING_INITIAL_ENTRIES 64
+
+/**
+ * Find the entry for an entity, or the empty entry where it belongs.
+ *
+ * \param keyring       The keyring to search.
+ * \param entity_id     The 128-bit entity id to find.
+ *
+ * \returns the entry for this entity, or an empty entry.
+ */
+vccert_keyring_entry_t* vccert_keyring_entry(
+    const vccert_keyring_t* keyring, const uint8_t* entity_id);
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_PRIVATE_KEYRING_INTERNAL_HEADER_GUARD
@@ -0,0 +1,225 @@
+/**
+ * \file vccert_keyring_add.c
+ *
+ * Add the keys from a public entity certificate to a keyring.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/certificate_types.h>
+#include <vccert/fields.h>
+#include <vpr/parameters.h>
+
+#include "keyring_internal.h"
+
+/* the initial size of an entity's key history. */
+#define KEYRING_INITIAL_VERSIONS 2
+
+/* forward decls */
+static int vccert_keyring_grow(vccert_keyring_t* keyring);
+
+/**
+ * \brief Add the keys from an attested public entity certificate.
+ *
+ * The \ref VCCERT_FIELD_TYPE_PUBLIC_ENCRYPTION_KEY and \ref
+ * VCCERT_FIELD_TYPE_PUBLIC_SIGNING_KEY of the certificate become the keys of
+ * the entity named by its \ref VCCERT_FIELD_TYPE_ARTIFACT_ID from the given
+ * height on.  Certificates for an entity must be added in height order.
+ *
+ * \param keyring           The keyring to update.
+ * \param cert              The parser context of an attested public entity
+ *                          certificate.
+ * \param height            The height from which these keys are used.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_KEYRING_ADD_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_KEYRING_ADD_WRONG_CERTIFICATE_TYPE if the
+ *        certificate is not a public entity certificate.
+ *      - \ref VCCERT_ERROR_KEYRING_ADD_MISSING_FIELD if the certificate lacks
+ *        one of the fields above.
+ *      - \ref VCCERT_ERROR_KEYRING_ADD_HEIGHT_OUT_OF_ORDER if height is lower
+ *        than that of a certificate already added for this entity.
+ *      - \ref VCCERT_ERROR_KEYRING_ADD_OUT_OF_MEMORY if the keyring could not
+ *        be grown.
+ */
+int vccert_keyring_add(
+    vccert_keyring_t* keyring, vccert_parser_context_t* cert,
+    uint64_t height)
+{
+    int retval;
+    const uint8_t* cert_type;
+    const uint8_t* entity_id;
+    const uint8_t* enc_key;
+    const uint8_t* sign_key;
+    size_t cert_type_size, entity_id_size, enc_key_size, sign_key_size;
+
+    MODEL_ASSERT(keyring != NULL);
+    MODEL_ASSERT(keyring->entries != NULL);
+    MODEL_ASSERT(cert != NULL);
+
+    /* parameter sanity check */
+    if (NULL == keyring || NULL == keyring->entries || NULL == cert)
+    {
+        return VCCERT_ERROR_KEYRING_ADD_INVALID_ARG;
+    }
+
+    /* only public entity certificates carry keys for the keyring. */
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_parser_find_short(
+                cert, VCCERT_FIELD_TYPE_CERTIFICATE_TYPE, &cert_type,
+                &cert_type_size)
+     || sizeof(vccert_certificate_type_uuid_public_entity) != cert_type_size
+     || memcmp(
+            vccert_certificate_type_uuid_public_entity, cert_type,
+            cert_type_size))
+    {
+        return VCCERT_ERROR_KEYRING_ADD_WRONG_CERTIFICATE_TYPE;
+    }
+
+    /* get the entity id and its keys. */
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_parser_find_short(
+                cert, VCCERT_FIELD_TYPE_ARTIFACT_ID, &entity_id,
+                &entity_id_size)
+     || sizeof(keyring->entries->entity_id) != entity_id_size
+     || VCCERT_STATUS_SUCCESS !=
+            vccert_parser_find_short(
+                cert, VCCERT_FIELD_TYPE_PUBLIC_ENCRYPTION_KEY, &enc_key,
+                &enc_key_size)
+     || VCCERT_STATUS_SUCCESS !=
+            vccert_parser_find_short(
+                cert, VCCERT_FIELD_TYPE_PUBLIC_SIGNING_KEY, &sign_key,
+                &sign_key_size))
+    {
+        return VCCERT_ERROR_KEYRING_ADD_MISSING_FIELD;
+    }
+
+    /* keep the keyring at most half full. */
+    if (2 * (keyring->count + 1) > keyring->mask + 1)
+    {
+        retval = vccert_keyring_grow(keyring);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    vccert_keyring_entry_t* entry = vccert_keyring_entry(keyring, entity_id);
+
+    /* the history of an entity only moves forward. */
+    if (NULL != entry->versions
+     && height < entry->versions[entry->count - 1].height)
+    {
+        return VCCERT_ERROR_KEYRING_ADD_HEIGHT_OUT_OF_ORDER;
+    }
+
+    /* copy the keys. */
+    uint8_t* keys =
+        (uint8_t*)allocate(keyring->alloc_opts, enc_key_size + sign_key_size);
+    if (NULL == keys)
+    {
+        return VCCERT_ERROR_KEYRING_ADD_OUT_OF_MEMORY;
+    }
+
+    memcpy(keys, enc_key, enc_key_size);
+    memcpy(keys + enc_key_size, sign_key, sign_key_size);
+
+    /* start a history for a new entity. */
+    if (NULL == entry->versions)
+    {
+        entry->versions =
+            (vccert_keyring_version_t*)
+                allocate(
+                    keyring->alloc_opts,
+                    KEYRING_INITIAL_VERSIONS
+                        * sizeof(vccert_keyring_version_t));
+        if (NULL == entry->versions)
+        {
+            retval = VCCERT_ERROR_KEYRING_ADD_OUT_OF_MEMORY;
+            goto release_keys;
+        }
+
+        memcpy(entry->entity_id, entity_id, entity_id_size);
+        entry->count = 0;
+        entry->capacity = KEYRING_INITIAL_VERSIONS;
+        ++keyring->count;
+    }
+    /* grow an existing history. */
+    else if (entry->count == entry->capacity)
+    {
+        vccert_keyring_version_t* versions =
+            (vccert_keyring_version_t*)
+                reallocate(
+                    keyring->alloc_opts, entry->versions,
+                    entry->capacity * sizeof(vccert_keyring_version_t),
+                    2 * entry->capacity * sizeof(vccert_keyring_version_t));
+        if (NULL == versions)
+        {
+            retval = VCCERT_ERROR_KEYRING_ADD_OUT_OF_MEMORY;
+            goto release_keys;
+        }
+
+        entry->versions = versions;
+        entry->capacity *= 2;
+    }
+
+    /* append the new version. */
+    vccert_keyring_version_t* version = &entry->versions[entry->count];
+    version->height = height;
+    version->encryption_key_size = enc_key_size;
+    version->signing_key_size = sign_key_size;
+    version->keys = keys;
+    ++entry->count;
+
+    return VCCERT_STATUS_SUCCESS;
+
+release_keys:
+    release(keyring->alloc_opts, keys);
+
+    return retval;
+}
+
+/**
+ * Double the number of entries in the keyring.
+ *
+ * \param keyring           The keyring to grow.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int vccert_keyring_grow(vccert_keyring_t* keyring)
+{
+    vccert_keyring_t grown;
+    size_t entries = 2 * (keyring->mask + 1);
+
+    grown.mask = entries - 1;
+    grown.entries =
+        (vccert_keyring_entry_t*)
+            allocate(
+                keyring->alloc_opts, entries * sizeof(vccert_keyring_entry_t));
+    if (NULL == grown.entries)
+    {
+        return VCCERT_ERROR_KEYRING_ADD_OUT_OF_MEMORY;
+    }
+
+    memset(grown.entries, 0, entries * sizeof(vccert_keyring_entry_t));
+
+    /* move each history to its place in the larger keyring. */
+    for (size_t i = 0; i <= keyring->mask; ++i)
+    {
+        if (NULL != keyring->entries[i].versions)
+        {
+            *vccert_keyring_entry(&grown, keyring->entries[i].entity_id) =
+                keyring->entries[i];
+        }
+    }
+
+    release(keyring->alloc_opts, keyring->entries);
+    keyring->entries = grown.entries;
+    keyring->mask = grown.mask;
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,49 @@
+/**
+ * \file vccert_keyring_entity_key_resolver.c
+ *
+ * An entity key resolver backed by a keyring.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "keyring_internal.h"
+
+/**
+ * \brief An entity key resolver backed by a keyring.
+ *
+ * To use it, set the parser options' parser_options_entity_key_resolver to
+ * this function and its entity_key_context to a \ref vccert_keyring_t.
+ *
+ * \param options           The \ref vccert_parser_options_t for this parser.
+ * \param parser            The parser context.  Unused.
+ * \param height            The block height at which the keys are needed.
+ * \param entity_id         The 128-bit entity id to find.
+ * \param pubenckey_buffer  A buffer to receive the public encryption key.
+ * \param pubsignkey_buffer A buffer to receive the public signing key.
+ *
+ * \returns true if the entity was found and false if it was not.
+ */
+bool vccert_keyring_entity_key_resolver(
+    void* options, void* UNUSED(parser), uint64_t height,
+    const uint8_t* entity_id, vccrypt_buffer_t* pubenckey_buffer,
+    vccrypt_buffer_t* pubsignkey_buffer)
+{
+    vccert_parser_options_t* opts = (vccert_parser_options_t*)options;
+
+    MODEL_ASSERT(opts != NULL);
+    MODEL_ASSERT(opts->entity_key_context != NULL);
+
+    if (NULL == opts || NULL == opts->entity_key_context)
+    {
+        return false;
+    }
+
+    return
+        VCCERT_STATUS_SUCCESS ==
+            vccert_keyring_find(
+                (const vccert_keyring_t*)opts->entity_key_context, entity_id,
+                height, pubenckey_buffer, pubsignkey_buffer);
+}
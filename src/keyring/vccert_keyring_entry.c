@@ -0,0 +1,51 @@
+/**
+ * \file vccert_keyring_entry.c
+ *
+ * Find the entry for an entity in a keyring.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "keyring_internal.h"
+
+/**
+ * Find the entry for an entity, or the empty entry where it belongs.
+ *
+ * The keyring is open addressed with linear probing, and is never more than
+ * half full, so the probe always ends.
+ *
+ * \param keyring       The keyring to search.
+ * \param entity_id     The 128-bit entity id to find.
+ *
+ * \returns the entry for this entity, or an empty entry.
+ */
+vccert_keyring_entry_t* vccert_keyring_entry(
+    const vccert_keyring_t* keyring, const uint8_t* entity_id)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    MODEL_ASSERT(keyring != NULL);
+    MODEL_ASSERT(keyring->entries != NULL);
+    MODEL_ASSERT(entity_id != NULL);
+
+    /* FNV-1a over the entity id. */
+    for (size_t i = 0; i < sizeof(keyring->entries->entity_id); ++i)
+    {
+        hash ^= entity_id[i];
+        hash *= 1099511628211ULL;
+    }
+
+    size_t e = (size_t)hash & keyring->mask;
+    while (NULL != keyring->entries[e].versions
+        && memcmp(
+            keyring->entries[e].entity_id, entity_id,
+            sizeof(keyring->entries->entity_id)))
+    {
+        e = (e + 1) & keyring->mask;
+    }
+
+    return &keyring->entries[e];
+}
@@ -0,0 +1,102 @@
+/**
+ * \file vccert_keyring_find.c
+ *
+ * Find the public keys of an entity in a keyring.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "keyring_internal.h"
+
+/**
+ * \brief Find the public keys of an entity as of a block height.
+ *
+ * \param keyring           The keyring to search.
+ * \param entity_id         The 128-bit entity id to find.
+ * \param height            The block height at which the keys are needed.
+ * \param encryption_key    Optional buffer to receive the public encryption
+ *                          key.  Its size must match the stored key.
+ * \param signing_key       Optional buffer to receive the public signing key.
+ *                          Its size must match the stored key.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_KEYRING_FIND_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_KEYRING_FIND_NOT_FOUND if the entity had no keys as
+ *        of this height.
+ *      - \ref VCCERT_ERROR_KEYRING_FIND_KEY_SIZE if an output buffer does not
+ *        match the size of the stored key.
+ */
+int vccert_keyring_find(
+    const vccert_keyring_t* keyring, const uint8_t* entity_id,
+    uint64_t height, vccrypt_buffer_t* encryption_key,
+    vccrypt_buffer_t* signing_key)
+{
+    MODEL_ASSERT(keyring != NULL);
+    MODEL_ASSERT(keyring->entries != NULL);
+    MODEL_ASSERT(entity_id != NULL);
+
+    /* parameter sanity check */
+    if (NULL == keyring || NULL == keyring->entries || NULL == entity_id)
+    {
+        return VCCERT_ERROR_KEYRING_FIND_INVALID_ARG;
+    }
+
+    const vccert_keyring_entry_t* entry =
+        vccert_keyring_entry(keyring, entity_id);
+    if (NULL == entry->versions)
+    {
+        return VCCERT_ERROR_KEYRING_FIND_NOT_FOUND;
+    }
+
+    /* find the number of versions at or below this height. */
+    size_t lo = 0, hi = entry->count;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (entry->versions[mid].height <= height)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    /* the entity did not exist yet at this height. */
+    if (0 == lo)
+    {
+        return VCCERT_ERROR_KEYRING_FIND_NOT_FOUND;
+    }
+
+    const vccert_keyring_version_t* version = &entry->versions[lo - 1];
+    if ((NULL != encryption_key
+            && encryption_key->size != version->encryption_key_size)
+     || (NULL != signing_key
+            && signing_key->size != version->signing_key_size))
+    {
+        return VCCERT_ERROR_KEYRING_FIND_KEY_SIZE;
+    }
+
+    if (NULL != encryption_key)
+    {
+        memcpy(
+            encryption_key->data, version->keys,
+            version->encryption_key_size);
+    }
+
+    if (NULL != signing_key)
+    {
+        memcpy(
+            signing_key->data, version->keys + version->encryption_key_size,
+            version->signing_key_size);
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
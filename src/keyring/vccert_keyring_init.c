@@ -0,0 +1,96 @@
+/**
+ * \file vccert_keyring_init.c
+ *
+ * Initialize a keyring.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "keyring_internal.h"
+
+/* forward decls */
+static void vccert_keyring_dispose(void* disposable);
+
+/**
+ * \brief Initialize an empty keyring.
+ *
+ * The keyring is owned by the caller and must be disposed by calling
+ * dispose() when no longer needed.
+ *
+ * \param keyring           The keyring to initialize.
+ * \param alloc_opts        The allocator to use for this keyring.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_KEYRING_INIT_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_KEYRING_INIT_OUT_OF_MEMORY if the keyring could not
+ *        be allocated.
+ */
+int vccert_keyring_init(
+    vccert_keyring_t* keyring, allocator_options_t* alloc_opts)
+{
+    MODEL_ASSERT(keyring != NULL);
+    MODEL_ASSERT(alloc_opts != NULL);
+
+    /* parameter sanity check */
+    if (NULL == keyring || NULL == alloc_opts)
+    {
+        return VCCERT_ERROR_KEYRING_INIT_INVALID_ARG;
+    }
+
+    memset(keyring, 0, sizeof(vccert_keyring_t));
+
+    size_t size =
+        VCCERT_KEYRING_INITIAL_ENTRIES * sizeof(vccert_keyring_entry_t);
+    keyring->entries = (vccert_keyring_entry_t*)allocate(alloc_opts, size);
+    if (NULL == keyring->entries)
+    {
+        return VCCERT_ERROR_KEYRING_INIT_OUT_OF_MEMORY;
+    }
+
+    memset(keyring->entries, 0, size);
+
+    keyring->hdr.dispose = &vccert_keyring_dispose;
+    keyring->alloc_opts = alloc_opts;
+    keyring->mask = VCCERT_KEYRING_INITIAL_ENTRIES - 1;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a keyring.
+ *
+ * \param disposable        The keyring to dispose.
+ */
+static void vccert_keyring_dispose(void* disposable)
+{
+    vccert_keyring_t* keyring = (vccert_keyring_t*)disposable;
+
+    MODEL_ASSERT(keyring != NULL);
+
+    for (size_t i = 0; i <= keyring->mask; ++i)
+    {
+        vccert_keyring_entry_t* entry = &keyring->entries[i];
+
+        if (NULL == entry->versions)
+        {
+            continue;
+        }
+
+        for (size_t v = 0; v < entry->count; ++v)
+        {
+            release(keyring->alloc_opts, entry->versions[v].keys);
+        }
+
+        release(keyring->alloc_opts, entry->versions);
+    }
+
+    release(keyring->alloc_opts, keyring->entries);
+
+    memset(keyring, 0, sizeof(vccert_keyring_t));
+}
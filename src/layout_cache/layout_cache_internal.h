@@ -0,0 +1,70 @@
+/**
+ * \file layout_cache_internal.h
+ *
+ * Internal helpers for the layout cache.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_PRIVATE_LAYOUT_CACHE_INTERNAL_HEADER_GUARD
+#define VCCERT_PRIVATE_LAYOUT_CACHE_INTERNAL_HEADER_GUARD
+
+#include <stdbool.h>
+#include <string.h>
+#include <vccert/error_codes.h>
+#include <vccert/layout_cache.h>
+
+/* Pick a gather kernel for matching layouts, if one is available. */
+#if defined(__GNUC__) && __STDC_HOSTED__ && defined(__x86_64__)
+# define VCCERT_LAYOUT_CACHE_AVX2 1
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * The largest certificate whose layout is cached, so that every offset fits
+ * in a signed 32-bit gather index.
+ */
+#define VCCERT_LAYOUT_CACHE_MAX_SIZE 0x7FFFFFFF
+
+/**
+ * \brief Check a certificate against the header bytes of a layout.
+ *
+ * Every offset must leave room for a header within the certificate.
+ *
+ * \param cert              The certificate.
+ * \param offsets           The header offsets of the layout.
+ * \param headers           The raw header bytes of the layout.
+ * \param count             The number of headers.
+ *
+ * \returns true if every header matches.
+ */
+bool vccert_layout_cache_match(
+    const uint8_t* cert, const uint32_t* offsets, const uint32_t* headers,
+    size_t count);
+
+/**
+ * \brief Read the raw bytes of a field header.
+ *
+ * \param header            The field header.
+ *
+ * \returns the four header bytes, in memory order.
+ */
+static inline uint32_t vccert_layout_cache_header(const uint8_t* header)
+{
+    uint32_t value;
+
+    memcpy(&value, header, sizeof(value));
+
+    return value;
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_PRIVATE_LAYOUT_CACHE_INTERNAL_HEADER_GUARD
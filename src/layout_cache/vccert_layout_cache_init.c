@@ -0,0 +1,108 @@
+/**
+ * \file vccert_layout_cache_init.c
+ *
+ * Initialize a layout cache.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "layout_cache_internal.h"
+
+/* forward decls */
+static void vccert_layout_cache_dispose(void* disposable);
+
+/**
+ * \brief Initialize a layout cache.
+ *
+ * This cache is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().
+ *
+ * \param cache             The cache to initialize.
+ * \param alloc_opts        The allocator options to use.
+ * \param max_layouts       The number of layouts to keep, rounded up to a
+ *                          power of two.
+ * \param max_fields        The largest number of fields in a layout worth
+ *                          keeping.  Certificates with more fields are always
+ *                          walked.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LAYOUT_CACHE_INIT_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_LAYOUT_CACHE_INIT_OUT_OF_MEMORY if the layout table
+ *        could not be allocated.
+ */
+int vccert_layout_cache_init(
+    vccert_layout_cache_t* cache, allocator_options_t* alloc_opts,
+    size_t max_layouts, size_t max_fields)
+{
+    size_t slots = 1;
+
+    MODEL_ASSERT(cache != NULL);
+    MODEL_ASSERT(alloc_opts != NULL);
+    MODEL_ASSERT(max_layouts > 0);
+    MODEL_ASSERT(max_fields > 0);
+
+    /* parameter sanity check */
+    if (NULL == cache || NULL == alloc_opts || 0 == max_layouts
+     || 0 == max_fields || max_layouts > SIZE_MAX / 2
+     || max_fields > SIZE_MAX / (2 * sizeof(uint32_t) * max_layouts))
+    {
+        return VCCERT_ERROR_LAYOUT_CACHE_INIT_INVALID_ARG;
+    }
+
+    while (slots < max_layouts)
+    {
+        slots *= 2;
+    }
+
+    memset(cache, 0, sizeof(vccert_layout_cache_t));
+
+    cache->layouts =
+        (vccert_layout_t*)allocate(alloc_opts, slots * sizeof(vccert_layout_t));
+    if (NULL == cache->layouts)
+    {
+        return VCCERT_ERROR_LAYOUT_CACHE_INIT_OUT_OF_MEMORY;
+    }
+
+    cache->offsets =
+        (uint32_t*)
+            allocate(alloc_opts, slots * max_fields * 2 * sizeof(uint32_t));
+    if (NULL == cache->offsets)
+    {
+        release(alloc_opts, cache->layouts);
+        cache->layouts = NULL;
+
+        return VCCERT_ERROR_LAYOUT_CACHE_INIT_OUT_OF_MEMORY;
+    }
+
+    /* every slot starts empty. */
+    memset(cache->layouts, 0, slots * sizeof(vccert_layout_t));
+    cache->headers = cache->offsets + slots * max_fields;
+
+    cache->hdr.dispose = &vccert_layout_cache_dispose;
+    cache->alloc_opts = alloc_opts;
+    cache->mask = slots - 1;
+    cache->max_fields = max_fields;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a layout cache.
+ *
+ * \param disposable        The cache to dispose.
+ */
+static void vccert_layout_cache_dispose(void* disposable)
+{
+    vccert_layout_cache_t* cache = (vccert_layout_cache_t*)disposable;
+
+    MODEL_ASSERT(cache != NULL);
+
+    release(cache->alloc_opts, cache->offsets);
+    release(cache->alloc_opts, cache->layouts);
+
+    memset(cache, 0, sizeof(vccert_layout_cache_t));
+}
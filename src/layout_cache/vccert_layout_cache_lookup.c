@@ -0,0 +1,160 @@
+/**
+ * \file vccert_layout_cache_lookup.c
+ *
+ * Find the field offsets of a certificate, from a learned layout if possible.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "layout_cache_internal.h"
+#include "../parser/parser_internal.h"
+
+/* forward decls */
+static size_t vccert_layout_cache_slot(
+    const vccert_layout_cache_t* cache, const uint8_t* cert, size_t size);
+
+/**
+ * \brief Find the offset of every field header in a certificate.
+ *
+ * \param cache             The cache.
+ * \param cert              The certificate.
+ * \param size              The size of the certificate.
+ * \param offsets           Array to receive the offset of each field header.
+ * \param capacity          The number of entries in offsets.
+ * \param field_count       Pointer to receive the number of fields, which may
+ *                          exceed capacity, in which case only the first
+ *                          offsets are written.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LAYOUT_CACHE_LOOKUP_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - the error returned by vccert_parser_field() for the first malformed
+ *        field header.
+ */
+int vccert_layout_cache_lookup(
+    vccert_layout_cache_t* cache, const uint8_t* cert, size_t size,
+    size_t* offsets, size_t capacity, size_t* field_count)
+{
+    int retval;
+    vccert_layout_t* layout = NULL;
+    uint32_t* layout_offsets = NULL;
+    uint32_t* layout_headers = NULL;
+
+    MODEL_ASSERT(cache != NULL);
+    MODEL_ASSERT(cert != NULL);
+    MODEL_ASSERT(capacity == 0 || offsets != NULL);
+    MODEL_ASSERT(field_count != NULL);
+
+    /* parameter sanity check */
+    if (NULL == cache || NULL == cache->layouts || NULL == cert
+     || (capacity > 0 && NULL == offsets) || NULL == field_count)
+    {
+        return VCCERT_ERROR_LAYOUT_CACHE_LOOKUP_INVALID_ARG;
+    }
+
+    /* only a certificate with room for a header can have a layout. */
+    if (size > FIELD_TYPE_SIZE + FIELD_SIZE_SIZE
+     && size <= VCCERT_LAYOUT_CACHE_MAX_SIZE)
+    {
+        size_t slot = vccert_layout_cache_slot(cache, cert, size);
+
+        layout = &cache->layouts[slot];
+        layout_offsets = cache->offsets + slot * cache->max_fields;
+        layout_headers = cache->headers + slot * cache->max_fields;
+
+        if (layout->size == size && 0 != layout->field_count
+         && vccert_layout_cache_match(
+                cert, layout_offsets, layout_headers, layout->field_count))
+        {
+            for (size_t i = 0; i < layout->field_count && i < capacity; ++i)
+            {
+                offsets[i] = layout_offsets[i];
+            }
+
+            *field_count = layout->field_count;
+            ++cache->hits;
+
+            return VCCERT_STATUS_SUCCESS;
+        }
+
+        /* the slot is about to be overwritten. */
+        layout->field_count = 0;
+    }
+
+    ++cache->misses;
+
+    /* walk the certificate, learning its layout on the way. */
+    size_t count = 0;
+    size_t offset = 0;
+    do
+    {
+        uint16_t field_type;
+        size_t field_size;
+        const uint8_t* field;
+        size_t header = offset;
+
+        retval =
+            vccert_parser_field(
+                cert, size, offset, &field_type, &field_size, &field,
+                &offset);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            break;
+        }
+
+        if (count < capacity)
+        {
+            offsets[count] = header;
+        }
+
+        if (NULL != layout && count < cache->max_fields)
+        {
+            layout_offsets[count] = (uint32_t)header;
+            layout_headers[count] = vccert_layout_cache_header(cert + header);
+        }
+
+        ++count;
+    } while (offset < size);
+
+    if (VCCERT_STATUS_SUCCESS == retval && NULL != layout
+     && count <= cache->max_fields)
+    {
+        layout->size = size;
+        layout->field_count = count;
+    }
+
+    *field_count = count;
+
+    return retval;
+}
+
+/**
+ * Get the slot for a certificate, from its size and first field header.
+ *
+ * \param cache             The cache.
+ * \param cert              The certificate.
+ * \param size              The size of the certificate.
+ *
+ * \returns the slot.
+ */
+static size_t vccert_layout_cache_slot(
+    const vccert_layout_cache_t* cache, const uint8_t* cert, size_t size)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    /* FNV-1a over the size and the first header. */
+    for (int i = 0; i < 4; ++i)
+    {
+        hash = (hash ^ (uint8_t)(size >> (8 * i))) * 1099511628211ULL;
+    }
+
+    for (int i = 0; i < FIELD_TYPE_SIZE + FIELD_SIZE_SIZE; ++i)
+    {
+        hash = (hash ^ cert[i]) * 1099511628211ULL;
+    }
+
+    return (size_t)(hash ^ (hash >> 32)) & cache->mask;
+}
@@ -0,0 +1,94 @@
+/**
+ * \file vccert_layout_cache_match.c
+ *
+ * Check a certificate against a learned layout, using a gather kernel where
+ * the platform has one.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "layout_cache_internal.h"
+
+#if defined(VCCERT_LAYOUT_CACHE_AVX2)
+# include <immintrin.h>
+#endif
+
+/**
+ * Compare headers one at a time, without stopping early, since a mismatch is
+ * the rare case.
+ */
+static uint32_t match_scalar(
+    const uint8_t* cert, const uint32_t* offsets, const uint32_t* headers,
+    size_t begin, size_t count)
+{
+    uint32_t diff = 0;
+
+    for (size_t i = begin; i < count; ++i)
+    {
+        diff |= vccert_layout_cache_header(cert + offsets[i]) ^ headers[i];
+    }
+
+    return diff;
+}
+
+#if defined(VCCERT_LAYOUT_CACHE_AVX2)
+
+/**
+ * Gather and compare eight headers at a time.
+ */
+__attribute__((target("avx2")))
+static uint32_t match_avx2(
+    const uint8_t* cert, const uint32_t* offsets, const uint32_t* headers,
+    size_t count)
+{
+    __m256i diff = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i index = _mm256_loadu_si256((const __m256i*)(offsets + i));
+        __m256i expected = _mm256_loadu_si256((const __m256i*)(headers + i));
+        __m256i actual =
+            _mm256_i32gather_epi32((const int*)cert, index, 1);
+
+        diff = _mm256_or_si256(diff, _mm256_xor_si256(actual, expected));
+    }
+
+    return
+        (uint32_t)!_mm256_testz_si256(diff, diff)
+      | match_scalar(cert, offsets, headers, i, count);
+}
+
+#endif
+
+/**
+ * \brief Check a certificate against the header bytes of a layout.
+ *
+ * Every offset must leave room for a header within the certificate.
+ *
+ * \param cert              The certificate.
+ * \param offsets           The header offsets of the layout.
+ * \param headers           The raw header bytes of the layout.
+ * \param count             The number of headers.
+ *
+ * \returns true if every header matches.
+ */
+bool vccert_layout_cache_match(
+    const uint8_t* cert, const uint32_t* offsets, const uint32_t* headers,
+    size_t count)
+{
+    MODEL_ASSERT(cert != NULL);
+    MODEL_ASSERT(offsets != NULL);
+    MODEL_ASSERT(headers != NULL);
+
+#if defined(VCCERT_LAYOUT_CACHE_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return 0 == match_avx2(cert, offsets, headers, count);
+    }
+#endif
+
+    return 0 == match_scalar(cert, offsets, headers, 0, count);
+}
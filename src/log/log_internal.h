@@ -0,0 +1,118 @@
+/**
+ * \file log_internal.h
+ *
+ * Internal helpers for the certificate log.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_PRIVATE_LOG_INTERNAL_HEADER_GUARD
+#define VCCERT_PRIVATE_LOG_INTERNAL_HEADER_GUARD
+
+#include <vccert/error_codes.h>
+#include <vccert/log.h>
+
+/* Segment files can only be written on hosted POSIX builds. */
+#if __STDC_HOSTED__ && !defined(__EMSCRIPTEN__) \
+ && (defined(__unix__) || defined(__APPLE__))
+# define VCCERT_LOG_FILES 1
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * The footer and trailer magic numbers.
+ */
+#define VCCERT_LOG_FOOTER_MAGIC "VCLF"
+#define VCCERT_LOG_TRAILER_MAGIC "VCLT"
+
+/**
+ * The size of each footer table entry.
+ */
+#define VCCERT_LOG_OFFSET_ENTRY_SIZE 8
+#define VCCERT_LOG_ID_ENTRY_SIZE 24
+
+/**
+ * The footer and trailer field offsets.
+ */
+#define VCCERT_LOG_FOOTER_OFFSET_COUNT 8
+#define VCCERT_LOG_TRAILER_OFFSET_CHECKSUM 8
+#define VCCERT_LOG_TRAILER_OFFSET_MAGIC 12
+
+/**
+ * The size of the buffer of a new writer.
+ */
+#define VCCERT_LOG_INITIAL_BUFFER 4096
+
+/**
+ * The number of entries in a new writer.
+ */
+#define VCCERT_LOG_INITIAL_ENTRIES 64
+
+/**
+ * Update a CRC-32C with more data.
+ *
+ * \param crc           The CRC of the data so far, or 0.
+ * \param data          The data to add.
+ * \param size          The size of the data.
+ *
+ * \returns the CRC of the data so far.
+ */
+uint32_t vccert_log_crc32c(uint32_t crc, const void* data, size_t size);
+
+/**
+ * Close the file written by a writer from vccert_log_writer_open().
+ *
+ * \param writer        The writer whose file should be closed.
+ */
+void vccert_log_writer_close(vccert_log_writer_t* writer);
+
+/**
+ * Read a big endian 32-bit value.
+ */
+static inline uint32_t vccert_log_load32(const uint8_t* p)
+{
+    return
+        ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16)
+      | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+/**
+ * Read a big endian 64-bit value.
+ */
+static inline uint64_t vccert_log_load64(const uint8_t* p)
+{
+    return
+        ((uint64_t)vccert_log_load32(p) << 32)
+      | (uint64_t)vccert_log_load32(p + 4);
+}
+
+/**
+ * Write a big endian 32-bit value.
+ */
+static inline void vccert_log_store32(uint8_t* p, uint32_t val)
+{
+    p[0] = (uint8_t)(val >> 24);
+    p[1] = (uint8_t)(val >> 16);
+    p[2] = (uint8_t)(val >> 8);
+    p[3] = (uint8_t)val;
+}
+
+/**
+ * Write a big endian 64-bit value.
+ */
+static inline void vccert_log_store64(uint8_t* p, uint64_t val)
+{
+    vccert_log_store32(p, (uint32_t)(val >> 32));
+    vccert_log_store32(p + 4, (uint32_t)val);
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_PRIVATE_LOG_INTERNAL_HEADER_GUARD
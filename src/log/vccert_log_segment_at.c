@@ -0,0 +1,83 @@
+/**
+ * \file vccert_log_segment_at.c
+ *
+ * Get a certificate from a log segment by position.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "log_internal.h"
+
+/**
+ * \brief Get the certificate at the given position in a segment, checking its
+ * frame checksum.
+ *
+ * \param segment           The segment view.
+ * \param index             The position of the certificate, in append order.
+ * \param cert              Pointer to receive the certificate.
+ * \param size              Pointer to receive the certificate size.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_AT_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_AT_OUT_OF_RANGE if the position is past
+ *        the end of the segment.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_AT_BAD_FRAME if the frame does not fit
+ *        in the segment or fails its checksum.
+ */
+int vccert_log_segment_at(
+    const vccert_log_segment_t* segment, size_t index, const uint8_t** cert,
+    size_t* size)
+{
+    MODEL_ASSERT(segment != NULL);
+    MODEL_ASSERT(cert != NULL);
+    MODEL_ASSERT(size != NULL);
+
+    /* parameter sanity check */
+    if (NULL == segment || NULL == segment->data || NULL == cert
+     || NULL == size)
+    {
+        return VCCERT_ERROR_LOG_SEGMENT_AT_INVALID_ARG;
+    }
+
+    if (index >= segment->count)
+    {
+        return VCCERT_ERROR_LOG_SEGMENT_AT_OUT_OF_RANGE;
+    }
+
+    uint64_t offset =
+        vccert_log_load64(
+            segment->offsets + index * VCCERT_LOG_OFFSET_ENTRY_SIZE);
+
+    /* the frame must lie before the footer. */
+    if (segment->size < VCCERT_LOG_FRAME_HEADER_SIZE
+     || offset > segment->size - VCCERT_LOG_FRAME_HEADER_SIZE)
+    {
+        return VCCERT_ERROR_LOG_SEGMENT_AT_BAD_FRAME;
+    }
+
+    const uint8_t* frame = segment->data + offset;
+    size_t cert_size = vccert_log_load32(frame);
+    if (cert_size > segment->size - offset - VCCERT_LOG_FRAME_HEADER_SIZE)
+    {
+        return VCCERT_ERROR_LOG_SEGMENT_AT_BAD_FRAME;
+    }
+
+    /* the checksum covers the size as well as the certificate. */
+    uint32_t crc =
+        vccert_log_crc32c(
+            vccert_log_crc32c(0, frame, 4),
+            frame + VCCERT_LOG_FRAME_HEADER_SIZE, cert_size);
+    if (crc != vccert_log_load32(frame + 4))
+    {
+        return VCCERT_ERROR_LOG_SEGMENT_AT_BAD_FRAME;
+    }
+
+    *cert = frame + VCCERT_LOG_FRAME_HEADER_SIZE;
+    *size = cert_size;
+
+    return VCCERT_STATUS_SUCCESS;
+}
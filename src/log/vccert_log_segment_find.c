@@ -0,0 +1,72 @@
+/**
+ * \file vccert_log_segment_find.c
+ *
+ * Find a certificate in a log segment by its certificate id.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "log_internal.h"
+
+/**
+ * \brief Find the position of a certificate in a segment by its certificate
+ * id.
+ *
+ * \param segment           The segment view.
+ * \param certificate_id    The 128-bit certificate id to find.
+ * \param index             Pointer to receive the position of the first
+ *                          certificate appended with this id.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_FIND_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_FIND_NOT_FOUND if no certificate has
+ *        this id.
+ */
+int vccert_log_segment_find(
+    const vccert_log_segment_t* segment, const uint8_t* certificate_id,
+    size_t* index)
+{
+    MODEL_ASSERT(segment != NULL);
+    MODEL_ASSERT(certificate_id != NULL);
+    MODEL_ASSERT(index != NULL);
+
+    /* parameter sanity check */
+    if (NULL == segment || NULL == segment->ids || NULL == certificate_id
+     || NULL == index)
+    {
+        return VCCERT_ERROR_LOG_SEGMENT_FIND_INVALID_ARG;
+    }
+
+    /* find the first id table entry not less than this id. */
+    size_t lo = 0, hi = segment->count;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (memcmp(
+                segment->ids + mid * VCCERT_LOG_ID_ENTRY_SIZE,
+                certificate_id, 16) < 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    const uint8_t* entry = segment->ids + lo * VCCERT_LOG_ID_ENTRY_SIZE;
+    if (lo == segment->count || memcmp(entry, certificate_id, 16))
+    {
+        return VCCERT_ERROR_LOG_SEGMENT_FIND_NOT_FOUND;
+    }
+
+    *index = (size_t)vccert_log_load64(entry + 16);
+
+    return VCCERT_STATUS_SUCCESS;
+}
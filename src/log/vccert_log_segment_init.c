@@ -0,0 +1,112 @@
+/**
+ * \file vccert_log_segment_init.c
+ *
+ * Initialize a view of a finished log segment.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "log_internal.h"
+
+/* forward decls */
+static void vccert_log_segment_dispose(void* disposable);
+
+/**
+ * \brief Initialize a view of a finished log segment.
+ *
+ * The trailer and footer are checked; frames are checked as they are read.
+ *
+ * \param segment           The view to initialize.
+ * \param data              The segment, for example a memory mapping.
+ * \param size              The size of the segment.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_INIT_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_SEGMENT_INIT_BAD_FOOTER if the segment was not
+ *        finished, or its footer is damaged.
+ */
+int vccert_log_segment_init(
+    vccert_log_segment_t* segment, const void* data, size_t size)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+
+    MODEL_ASSERT(segment != NULL);
+    MODEL_ASSERT(data != NULL);
+
+    /* parameter sanity check */
+    if (NULL == segment || NULL == data)
+    {
+        return VCCERT_ERROR_LOG_SEGMENT_INIT_INVALID_ARG;
+    }
+
+    /* an unfinished segment has no trailer. */
+    if (size < VCCERT_LOG_FOOTER_HEADER_SIZE + VCCERT_LOG_TRAILER_SIZE)
+    {
+        return VCCERT_ERROR_LOG_SEGMENT_INIT_BAD_FOOTER;
+    }
+
+    const uint8_t* trailer = bytes + size - VCCERT_LOG_TRAILER_SIZE;
+    if (memcmp(
+            trailer + VCCERT_LOG_TRAILER_OFFSET_MAGIC,
+            VCCERT_LOG_TRAILER_MAGIC, strlen(VCCERT_LOG_TRAILER_MAGIC)))
+    {
+        return VCCERT_ERROR_LOG_SEGMENT_INIT_BAD_FOOTER;
+    }
+
+    /* the footer runs from its offset up to the trailer. */
+    uint64_t footer_offset = vccert_log_load64(trailer);
+    size_t tables_end = size - VCCERT_LOG_TRAILER_SIZE;
+    if (footer_offset > tables_end - VCCERT_LOG_FOOTER_HEADER_SIZE)
+    {
+        return VCCERT_ERROR_LOG_SEGMENT_INIT_BAD_FOOTER;
+    }
+
+    const uint8_t* footer = bytes + footer_offset;
+    size_t footer_size = tables_end - (size_t)footer_offset;
+    if (memcmp(
+            footer, VCCERT_LOG_FOOTER_MAGIC, strlen(VCCERT_LOG_FOOTER_MAGIC))
+     || vccert_log_load32(trailer + VCCERT_LOG_TRAILER_OFFSET_CHECKSUM)
+            != vccert_log_crc32c(0, footer, footer_size))
+    {
+        return VCCERT_ERROR_LOG_SEGMENT_INIT_BAD_FOOTER;
+    }
+
+    /* the tables must exactly fill the footer. */
+    uint64_t count = vccert_log_load64(footer + VCCERT_LOG_FOOTER_OFFSET_COUNT);
+    size_t entry_size = VCCERT_LOG_OFFSET_ENTRY_SIZE + VCCERT_LOG_ID_ENTRY_SIZE;
+    if (count != (footer_size - VCCERT_LOG_FOOTER_HEADER_SIZE) / entry_size
+     || 0 != (footer_size - VCCERT_LOG_FOOTER_HEADER_SIZE) % entry_size)
+    {
+        return VCCERT_ERROR_LOG_SEGMENT_INIT_BAD_FOOTER;
+    }
+
+    memset(segment, 0, sizeof(vccert_log_segment_t));
+
+    segment->hdr.dispose = &vccert_log_segment_dispose;
+    segment->data = bytes;
+    segment->size = (size_t)footer_offset;
+    segment->count = (size_t)count;
+    segment->offsets = footer + VCCERT_LOG_FOOTER_HEADER_SIZE;
+    segment->ids =
+        segment->offsets + segment->count * VCCERT_LOG_OFFSET_ENTRY_SIZE;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a log segment view.  The segment itself is not owned by the
+ * view.
+ *
+ * \param disposable        The view to dispose.
+ */
+static void vccert_log_segment_dispose(void* disposable)
+{
+    MODEL_ASSERT(disposable != NULL);
+
+    memset(disposable, 0, sizeof(vccert_log_segment_t));
+}
@@ -0,0 +1,178 @@
+/**
+ * \file vccert_log_writer_append.c
+ *
+ * Append a certificate to a log segment.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/fields.h>
+
+#include "log_internal.h"
+#include "../parser/parser_internal.h"
+
+/* forward decls */
+static void vccert_log_certificate_id(
+    const uint8_t* cert, size_t size, uint8_t* certificate_id);
+
+/**
+ * \brief Append a certificate, such as the output of vccert_builder_emit(),
+ * to the segment.
+ *
+ * The certificate is copied into the current group, which is committed if the
+ * policy says so.  Only certificates counted by the writer's committed field
+ * are known to be durable.
+ *
+ * \param writer            The writer.
+ * \param cert              The certificate.
+ * \param size              The size of the certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_APPEND_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_APPEND_OUT_OF_MEMORY if the writer
+ *        buffers could not be grown.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_APPEND_TOO_LARGE if the certificate is
+ *        too large to frame.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_FINISHED if the segment was finished.
+ *      - a status code from vccert_log_writer_commit().
+ */
+int vccert_log_writer_append(
+    vccert_log_writer_t* writer, const uint8_t* cert, size_t size)
+{
+    uint8_t frame_size[4];
+
+    MODEL_ASSERT(writer != NULL);
+    MODEL_ASSERT(writer->buffer != NULL);
+    MODEL_ASSERT(cert != NULL);
+
+    /* parameter sanity check */
+    if (NULL == writer || NULL == writer->buffer || NULL == cert)
+    {
+        return VCCERT_ERROR_LOG_WRITER_APPEND_INVALID_ARG;
+    }
+
+    if (writer->finished)
+    {
+        return VCCERT_ERROR_LOG_WRITER_FINISHED;
+    }
+
+    if (VCCERT_STATUS_SUCCESS != writer->status)
+    {
+        return writer->status;
+    }
+
+    if (size > UINT32_MAX)
+    {
+        return VCCERT_ERROR_LOG_WRITER_APPEND_TOO_LARGE;
+    }
+
+    /* grow the buffer to hold the frame. */
+    size_t needed = writer->buffer_size + VCCERT_LOG_FRAME_HEADER_SIZE + size;
+    if (needed > writer->buffer_capacity)
+    {
+        size_t capacity = 2 * writer->buffer_capacity;
+        while (capacity < needed)
+        {
+            capacity *= 2;
+        }
+
+        uint8_t* buffer =
+            (uint8_t*)
+                reallocate(
+                    writer->alloc_opts, writer->buffer,
+                    writer->buffer_capacity, capacity);
+        if (NULL == buffer)
+        {
+            return VCCERT_ERROR_LOG_WRITER_APPEND_OUT_OF_MEMORY;
+        }
+
+        writer->buffer = buffer;
+        writer->buffer_capacity = capacity;
+    }
+
+    /* grow the entries. */
+    if (writer->count == writer->capacity)
+    {
+        vccert_log_entry_t* entries =
+            (vccert_log_entry_t*)
+                reallocate(
+                    writer->alloc_opts, writer->entries,
+                    writer->capacity * sizeof(vccert_log_entry_t),
+                    2 * writer->capacity * sizeof(vccert_log_entry_t));
+        if (NULL == entries)
+        {
+            return VCCERT_ERROR_LOG_WRITER_APPEND_OUT_OF_MEMORY;
+        }
+
+        writer->entries = entries;
+        writer->capacity *= 2;
+    }
+
+    /* the checksum covers the size as well as the certificate. */
+    vccert_log_store32(frame_size, (uint32_t)size);
+    uint32_t crc =
+        vccert_log_crc32c(
+            vccert_log_crc32c(0, frame_size, sizeof(frame_size)), cert, size);
+
+    uint8_t* frame = writer->buffer + writer->buffer_size;
+    memcpy(frame, frame_size, sizeof(frame_size));
+    vccert_log_store32(frame + sizeof(frame_size), crc);
+    memcpy(frame + VCCERT_LOG_FRAME_HEADER_SIZE, cert, size);
+
+    vccert_log_entry_t* entry = &writer->entries[writer->count];
+    entry->offset = writer->offset;
+    vccert_log_certificate_id(cert, size, entry->certificate_id);
+
+    writer->buffer_size = needed;
+    writer->offset += VCCERT_LOG_FRAME_HEADER_SIZE + size;
+    ++writer->count;
+
+    /* commit the group once it is large enough. */
+    if ((0 != writer->policy.max_batch_bytes
+            && writer->buffer_size >= writer->policy.max_batch_bytes)
+     || (0 != writer->policy.max_batch_certs
+            && writer->count - writer->committed
+                    >= writer->policy.max_batch_certs))
+    {
+        return vccert_log_writer_commit(writer);
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Get the certificate id of a certificate, or zeroes if it has none.
+ *
+ * \param cert              The certificate.
+ * \param size              The size of the certificate.
+ * \param certificate_id    Buffer to receive the 128-bit certificate id.
+ */
+static void vccert_log_certificate_id(
+    const uint8_t* cert, size_t size, uint8_t* certificate_id)
+{
+    uint16_t field_type;
+    size_t field_size;
+    const uint8_t* field;
+
+    memset(certificate_id, 0, 16);
+
+    /* search through all fields for the certificate id. */
+    size_t offset = 0;
+    while (offset < size
+        && VCCERT_STATUS_SUCCESS ==
+            vccert_parser_field(
+                cert, size, offset, &field_type, &field_size, &field,
+                &offset))
+    {
+        if (VCCERT_FIELD_TYPE_CERTIFICATE_ID == field_type
+         && 16 == field_size)
+        {
+            memcpy(certificate_id, field, 16);
+            return;
+        }
+    }
+}
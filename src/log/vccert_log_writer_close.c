@@ -0,0 +1,31 @@
+/**
+ * \file vccert_log_writer_close.c
+ *
+ * Close the file written by a writer from vccert_log_writer_open().
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "log_internal.h"
+
+#ifdef VCCERT_LOG_FILES
+# include <unistd.h>
+#endif  //VCCERT_LOG_FILES
+
+/**
+ * Close the file written by a writer from vccert_log_writer_open().
+ *
+ * \param writer        The writer whose file should be closed.
+ */
+void vccert_log_writer_close(vccert_log_writer_t* writer)
+{
+    MODEL_ASSERT(writer != NULL);
+
+#ifdef VCCERT_LOG_FILES
+    close(writer->fd);
+#endif  //VCCERT_LOG_FILES
+
+    writer->fd = -1;
+}
@@ -0,0 +1,66 @@
+/**
+ * \file vccert_log_writer_commit.c
+ *
+ * Commit the current group of a log writer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "log_internal.h"
+
+/**
+ * \brief Commit the current group with a single write and a single sync.
+ *
+ * \param writer            The writer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_COMMIT_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - a status code from the write or sync callback, which every later call
+ *        on this writer also returns.
+ */
+int vccert_log_writer_commit(vccert_log_writer_t* writer)
+{
+    int retval;
+
+    MODEL_ASSERT(writer != NULL);
+    MODEL_ASSERT(writer->buffer != NULL);
+
+    /* parameter sanity check */
+    if (NULL == writer || NULL == writer->buffer)
+    {
+        return VCCERT_ERROR_LOG_WRITER_COMMIT_INVALID_ARG;
+    }
+
+    /* a failed write leaves the segment in an unknown state. */
+    if (VCCERT_STATUS_SUCCESS != writer->status)
+    {
+        return writer->status;
+    }
+
+    if (0 == writer->buffer_size)
+    {
+        return VCCERT_STATUS_SUCCESS;
+    }
+
+    retval =
+        writer->write(writer->context, writer->buffer, writer->buffer_size);
+    if (VCCERT_STATUS_SUCCESS == retval && NULL != writer->sync)
+    {
+        retval = writer->sync(writer->context);
+    }
+
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        writer->status = retval;
+        return retval;
+    }
+
+    writer->buffer_size = 0;
+    writer->committed = writer->count;
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,226 @@
+/**
+ * \file vccert_log_writer_finish.c
+ *
+ * Finish a log segment with its footer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "log_internal.h"
+
+/* forward decls */
+static void vccert_log_sort(
+    const vccert_log_entry_t* entries, size_t* order, size_t n);
+static void vccert_log_sift(
+    const vccert_log_entry_t* entries, size_t* order, size_t root, size_t n);
+static int vccert_log_compare(
+    const vccert_log_entry_t* entries, size_t a, size_t b);
+
+/**
+ * \brief Finish the segment by committing the footer and trailer.
+ *
+ * \param writer            The writer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_FINISH_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_FINISH_OUT_OF_MEMORY if the footer could
+ *        not be allocated.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_FINISHED if the segment was finished.
+ *      - a status code from vccert_log_writer_commit().
+ */
+int vccert_log_writer_finish(vccert_log_writer_t* writer)
+{
+    MODEL_ASSERT(writer != NULL);
+    MODEL_ASSERT(writer->buffer != NULL);
+
+    /* parameter sanity check */
+    if (NULL == writer || NULL == writer->buffer)
+    {
+        return VCCERT_ERROR_LOG_WRITER_FINISH_INVALID_ARG;
+    }
+
+    if (writer->finished)
+    {
+        return VCCERT_ERROR_LOG_WRITER_FINISHED;
+    }
+
+    if (VCCERT_STATUS_SUCCESS != writer->status)
+    {
+        return writer->status;
+    }
+
+    size_t footer_size =
+        VCCERT_LOG_FOOTER_HEADER_SIZE
+      + writer->count
+            * (VCCERT_LOG_OFFSET_ENTRY_SIZE + VCCERT_LOG_ID_ENTRY_SIZE);
+
+    /* grow the buffer to hold the footer and trailer. */
+    size_t needed = writer->buffer_size + footer_size + VCCERT_LOG_TRAILER_SIZE;
+    if (needed > writer->buffer_capacity)
+    {
+        uint8_t* buffer =
+            (uint8_t*)
+                reallocate(
+                    writer->alloc_opts, writer->buffer,
+                    writer->buffer_capacity, needed);
+        if (NULL == buffer)
+        {
+            return VCCERT_ERROR_LOG_WRITER_FINISH_OUT_OF_MEMORY;
+        }
+
+        writer->buffer = buffer;
+        writer->buffer_capacity = needed;
+    }
+
+    /* order the certificates by id for the id table. */
+    size_t* order = NULL;
+    if (writer->count > 0)
+    {
+        order =
+            (size_t*)
+                allocate(writer->alloc_opts, writer->count * sizeof(size_t));
+        if (NULL == order)
+        {
+            return VCCERT_ERROR_LOG_WRITER_FINISH_OUT_OF_MEMORY;
+        }
+
+        for (size_t i = 0; i < writer->count; ++i)
+        {
+            order[i] = i;
+        }
+
+        vccert_log_sort(writer->entries, order, writer->count);
+    }
+
+    /* write the footer header. */
+    uint8_t* footer = writer->buffer + writer->buffer_size;
+    memset(footer, 0, VCCERT_LOG_FOOTER_HEADER_SIZE);
+    memcpy(
+        footer, VCCERT_LOG_FOOTER_MAGIC, strlen(VCCERT_LOG_FOOTER_MAGIC));
+    vccert_log_store64(
+        footer + VCCERT_LOG_FOOTER_OFFSET_COUNT, (uint64_t)writer->count);
+
+    /* write the offsets in append order. */
+    uint8_t* p = footer + VCCERT_LOG_FOOTER_HEADER_SIZE;
+    for (size_t i = 0; i < writer->count; ++i)
+    {
+        vccert_log_store64(p, writer->entries[i].offset);
+        p += VCCERT_LOG_OFFSET_ENTRY_SIZE;
+    }
+
+    /* write the ids in id order. */
+    for (size_t i = 0; i < writer->count; ++i)
+    {
+        memcpy(p, writer->entries[order[i]].certificate_id, 16);
+        vccert_log_store64(p + 16, (uint64_t)order[i]);
+        p += VCCERT_LOG_ID_ENTRY_SIZE;
+    }
+
+    /* write the trailer. */
+    vccert_log_store64(p, writer->offset);
+    vccert_log_store32(
+        p + VCCERT_LOG_TRAILER_OFFSET_CHECKSUM,
+        vccert_log_crc32c(0, footer, footer_size));
+    memcpy(
+        p + VCCERT_LOG_TRAILER_OFFSET_MAGIC, VCCERT_LOG_TRAILER_MAGIC,
+        strlen(VCCERT_LOG_TRAILER_MAGIC));
+
+    if (NULL != order)
+    {
+        release(writer->alloc_opts, order);
+    }
+
+    writer->buffer_size = needed;
+    writer->offset += footer_size + VCCERT_LOG_TRAILER_SIZE;
+    writer->finished = true;
+
+    return vccert_log_writer_commit(writer);
+}
+
+/**
+ * Heap sort certificate positions by certificate id, then by position.
+ *
+ * \param entries           The entries being ordered.
+ * \param order             The positions to sort.
+ * \param n                 The number of positions.
+ */
+static void vccert_log_sort(
+    const vccert_log_entry_t* entries, size_t* order, size_t n)
+{
+    /* build the heap. */
+    for (size_t i = n / 2; i > 0; --i)
+    {
+        vccert_log_sift(entries, order, i - 1, n);
+    }
+
+    /* move the largest position to the end of the heap until it is empty. */
+    for (size_t end = n; end > 1; --end)
+    {
+        size_t tmp = order[0];
+        order[0] = order[end - 1];
+        order[end - 1] = tmp;
+
+        vccert_log_sift(entries, order, 0, end - 1);
+    }
+}
+
+/**
+ * Sift a position down the heap until neither child is larger.
+ *
+ * \param entries           The entries being ordered.
+ * \param order             The heap.
+ * \param root              The position to sift.
+ * \param n                 The number of positions in the heap.
+ */
+static void vccert_log_sift(
+    const vccert_log_entry_t* entries, size_t* order, size_t root, size_t n)
+{
+    for (size_t child = 2 * root + 1; child < n; child = 2 * root + 1)
+    {
+        if (child + 1 < n
+         && vccert_log_compare(entries, order[child], order[child + 1]) < 0)
+        {
+            ++child;
+        }
+
+        if (vccert_log_compare(entries, order[root], order[child]) >= 0)
+        {
+            return;
+        }
+
+        size_t tmp = order[root];
+        order[root] = order[child];
+        order[child] = tmp;
+        root = child;
+    }
+}
+
+/**
+ * Compare two certificates by id, then by position.
+ *
+ * \param entries           The entries being ordered.
+ * \param a                 The position of the first certificate.
+ * \param b                 The position of the second certificate.
+ *
+ * \returns less than, equal to, or greater than zero as a sorts before, with,
+ * or after b.
+ */
+static int vccert_log_compare(
+    const vccert_log_entry_t* entries, size_t a, size_t b)
+{
+    int cmp =
+        memcmp(
+            entries[a].certificate_id, entries[b].certificate_id,
+            sizeof(entries[a].certificate_id));
+    if (0 != cmp)
+    {
+        return cmp;
+    }
+
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
@@ -0,0 +1,110 @@
+/**
+ * \file vccert_log_writer_init.c
+ *
+ * Initialize a log writer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "log_internal.h"
+
+/* forward decls */
+static void vccert_log_writer_dispose(void* disposable);
+
+/**
+ * \brief Initialize a log writer that writes through callbacks.
+ *
+ * This writer is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().  Disposing of a writer does not commit or
+ * finish its segment.
+ *
+ * \param writer            The writer to initialize.
+ * \param alloc_opts        The allocator options to use.
+ * \param policy            The group commit policy.
+ * \param write             The write callback.
+ * \param sync              The sync callback, or NULL.
+ * \param context           The I/O context passed to the callbacks.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_INIT_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_INIT_OUT_OF_MEMORY if the writer buffers
+ *        could not be allocated.
+ */
+int vccert_log_writer_init(
+    vccert_log_writer_t* writer, allocator_options_t* alloc_opts,
+    const vccert_log_policy_t* policy, vccert_log_write_t write,
+    vccert_log_sync_t sync, void* context)
+{
+    MODEL_ASSERT(writer != NULL);
+    MODEL_ASSERT(alloc_opts != NULL);
+    MODEL_ASSERT(policy != NULL);
+    MODEL_ASSERT(write != NULL);
+
+    /* parameter sanity check */
+    if (NULL == writer || NULL == alloc_opts || NULL == policy
+     || NULL == write)
+    {
+        return VCCERT_ERROR_LOG_WRITER_INIT_INVALID_ARG;
+    }
+
+    memset(writer, 0, sizeof(vccert_log_writer_t));
+
+    writer->buffer =
+        (uint8_t*)allocate(alloc_opts, VCCERT_LOG_INITIAL_BUFFER);
+    if (NULL == writer->buffer)
+    {
+        return VCCERT_ERROR_LOG_WRITER_INIT_OUT_OF_MEMORY;
+    }
+
+    writer->entries =
+        (vccert_log_entry_t*)
+            allocate(
+                alloc_opts,
+                VCCERT_LOG_INITIAL_ENTRIES * sizeof(vccert_log_entry_t));
+    if (NULL == writer->entries)
+    {
+        release(alloc_opts, writer->buffer);
+        writer->buffer = NULL;
+
+        return VCCERT_ERROR_LOG_WRITER_INIT_OUT_OF_MEMORY;
+    }
+
+    writer->hdr.dispose = &vccert_log_writer_dispose;
+    writer->alloc_opts = alloc_opts;
+    writer->policy = *policy;
+    writer->write = write;
+    writer->sync = sync;
+    writer->context = context;
+    writer->fd = -1;
+    writer->buffer_capacity = VCCERT_LOG_INITIAL_BUFFER;
+    writer->capacity = VCCERT_LOG_INITIAL_ENTRIES;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a log writer, closing its file if it opened one.
+ *
+ * \param disposable        The writer to dispose.
+ */
+static void vccert_log_writer_dispose(void* disposable)
+{
+    vccert_log_writer_t* writer = (vccert_log_writer_t*)disposable;
+
+    MODEL_ASSERT(writer != NULL);
+
+    if (writer->fd >= 0)
+    {
+        vccert_log_writer_close(writer);
+    }
+
+    release(writer->alloc_opts, writer->entries);
+    release(writer->alloc_opts, writer->buffer);
+
+    memset(writer, 0, sizeof(vccert_log_writer_t));
+}
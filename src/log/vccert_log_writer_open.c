@@ -0,0 +1,143 @@
+/**
+ * \file vccert_log_writer_open.c
+ *
+ * Initialize a log writer that creates a segment file.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "log_internal.h"
+
+#ifdef VCCERT_LOG_FILES
+# include <errno.h>
+# include <fcntl.h>
+# include <unistd.h>
+
+/* forward decls */
+static int vccert_log_file_write(void* context, const void* data, size_t size);
+static int vccert_log_file_sync(void* context);
+#endif  //VCCERT_LOG_FILES
+
+/**
+ * \brief Initialize a log writer that creates a segment file.
+ *
+ * The file is created, or truncated if it exists, and is closed when the
+ * writer is disposed.  Each commit is a single write followed by an fsync.
+ * This is only available on hosted POSIX builds.
+ *
+ * \param writer            The writer to initialize.
+ * \param alloc_opts        The allocator options to use.
+ * \param policy            The group commit policy.
+ * \param path              The path of the segment file.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_OPEN_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_OPEN_UNSUPPORTED if files cannot be
+ *        written on this platform.
+ *      - \ref VCCERT_ERROR_LOG_WRITER_OPEN_FAILED if the file could not be
+ *        created.
+ *      - a status code from vccert_log_writer_init().
+ */
+int vccert_log_writer_open(
+    vccert_log_writer_t* writer, allocator_options_t* alloc_opts,
+    const vccert_log_policy_t* policy, const char* path)
+{
+    MODEL_ASSERT(writer != NULL);
+    MODEL_ASSERT(alloc_opts != NULL);
+    MODEL_ASSERT(policy != NULL);
+    MODEL_ASSERT(path != NULL);
+
+    /* parameter sanity check */
+    if (NULL == writer || NULL == alloc_opts || NULL == policy
+     || NULL == path)
+    {
+        return VCCERT_ERROR_LOG_WRITER_OPEN_INVALID_ARG;
+    }
+
+#ifdef VCCERT_LOG_FILES
+    int retval;
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        return VCCERT_ERROR_LOG_WRITER_OPEN_FAILED;
+    }
+
+    retval =
+        vccert_log_writer_init(
+            writer, alloc_opts, policy, &vccert_log_file_write,
+            &vccert_log_file_sync, writer);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        close(fd);
+        return retval;
+    }
+
+    /* the writer now owns the file. */
+    writer->fd = fd;
+
+    return VCCERT_STATUS_SUCCESS;
+#else
+    /* there are no files to write on this platform. */
+    return VCCERT_ERROR_LOG_WRITER_OPEN_UNSUPPORTED;
+#endif  //VCCERT_LOG_FILES
+}
+
+#ifdef VCCERT_LOG_FILES
+/**
+ * Write bytes to the end of a segment file, retrying short writes.
+ *
+ * \param context           The writer.
+ * \param data              The bytes to write.
+ * \param size              The number of bytes to write.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int vccert_log_file_write(void* context, const void* data, size_t size)
+{
+    vccert_log_writer_t* writer = (vccert_log_writer_t*)context;
+    const uint8_t* p = (const uint8_t*)data;
+
+    while (size > 0)
+    {
+        ssize_t written = write(writer->fd, p, size);
+        if (written < 0)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+
+            return VCCERT_ERROR_LOG_WRITER_IO;
+        }
+
+        p += written;
+        size -= (size_t)written;
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Sync a segment file to storage.
+ *
+ * \param context           The writer.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int vccert_log_file_sync(void* context)
+{
+    vccert_log_writer_t* writer = (vccert_log_writer_t*)context;
+
+    if (0 != fsync(writer->fd))
+    {
+        return VCCERT_ERROR_LOG_WRITER_IO;
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
+#endif  //VCCERT_LOG_FILES
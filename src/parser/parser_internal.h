@@ -9,8 +9,24 @@
 #ifndef VCCERT_PRIVATE_PARSER_INTERNAL_HEADER_GUARD
 #define VCCERT_PRIVATE_PARSER_INTERNAL_HEADER_GUARD
 
+#include <string.h>
 #include <vccert/parser.h>
 
+/* Big Endian loads use a byte-swap builtin on little-endian GCC targets. */
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) \
+ && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+# define VCCERT_PARSER_LOAD_BSWAP 1
+#endif
+
+/* Pick a byte-shuffle kernel for the array decoders, if one is available. */
+#if defined(__GNUC__) && __STDC_HOSTED__ \
+ && (defined(__x86_64__) || defined(__i386__))
+# define VCCERT_PARSER_DECODE_SSSE3 1
+#elif defined(__ARM_NEON) && defined(__BYTE_ORDER__) \
+ && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+# define VCCERT_PARSER_DECODE_NEON 1
+#endif
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 extern "C" {
@@ -38,6 +54,246 @@ int vccert_parser_field(
     uint16_t* field_type, size_t* field_size, const uint8_t** field,
     size_t* next_offset);
 
+/**
+ * Look up and run the contract for a certificate whose signature has already
+ * been verified by vccert_parser_attest().
+ *
+ * \param context           The attested parser context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_ATTEST_MISSING_TRANSACTION_TYPE if the
+ *        transaction type for this certificate could not be found.
+ *      - \ref VCCERT_ERROR_PARSER_ATTEST_MISSING_ARTIFACT_ID if the artifact
+ *        identifier for this transaction could not be found.
+ *      - \ref VCCERT_ERROR_PARSER_ATTEST_MISSING_CONTRACT if the contract for
+ *        this certificate could not be found.
+ *      - \ref VCCERT_ERROR_PARSER_ATTEST_CONTRACT_VERIFICATION if contract
+ *        verification for this certificate failed.
+ */
+int vccert_parser_attest_contract(vccert_parser_context_t* context);
+
+/**
+ * Find the signer ID of a certificate, along with the field index that
+ * immediately precedes it, if there is one.
+ *
+ * \param context           The parser context.
+ * \param signer            Set to the signer ID value.
+ * \param signer_size       Set to the size of the signer ID value.
+ * \param index             Set to the field index value, or NULL if the field
+ *                          before the signer ID is not a field index.
+ * \param index_size        Set to the size of the field index value.
+ * \param index_fields      Set to the number of fields before the field
+ *                          index, which it must list.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the signer ID
+ *        was not found.
+ */
+int vccert_parser_find_signer(
+    const vccert_parser_context_t* context, const uint8_t** signer,
+    size_t* signer_size, const uint8_t** index, size_t* index_size,
+    size_t* index_fields);
+
+/**
+ * Check that a signed field index is well-formed, and that it lists every
+ * field that precedes it exactly once.
+ *
+ * \param context           The parser context, trimmed to the attested size.
+ * \param index             The field index value.
+ * \param index_size        The size of the field index value.
+ * \param fields            The number of fields before the field index, as
+ *                          counted by vccert_parser_find_signer().
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_ATTEST_BAD_FIELD_INDEX if the index is
+ *        malformed or does not match the certificate.
+ */
+int vccert_parser_field_index_check(
+    const vccert_parser_context_t* context, const uint8_t* index,
+    size_t index_size, size_t fields);
+
+/**
+ * Find the first field with the given type whose header is at or after the
+ * given offset, using the signed field index of an attested certificate.
+ * Fields after the index itself are found by walking the short tail of the
+ * certificate.
+ *
+ * \param context           The attested parser context.
+ * \param field_id          The short-hand field identifier to find.
+ * \param from              The offset of a field header at which to start.
+ * \param value             Set to the field value, or NULL if not found.
+ * \param size              Set to the field size, or 0 if not found.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if no such field
+ *        was found.
+ */
+int vccert_parser_field_index_find(
+    const vccert_parser_context_t* context, uint16_t field_id, size_t from,
+    const uint8_t** value, size_t* size);
+
+/**
+ * Encode a field index record.
+ *
+ * \param record            The record to write.
+ * \param field_id          The field type.
+ * \param offset            The field header offset.
+ */
+static inline void vccert_parser_field_index_record(
+    uint8_t* record, uint16_t field_id, size_t offset)
+{
+    record[0] = (uint8_t)(field_id >> 8);
+    record[1] = (uint8_t)field_id;
+    record[2] = (uint8_t)(offset >> 24);
+    record[3] = (uint8_t)(offset >> 16);
+    record[4] = (uint8_t)(offset >> 8);
+    record[5] = (uint8_t)offset;
+}
+
+/**
+ * Find the first record in a sorted field index that is not less than the
+ * given field type and offset.
+ *
+ * \param index             The field index value.
+ * \param count             The number of records in the index.
+ * \param field_id          The field type to find.
+ * \param offset            The field header offset to find.
+ *
+ * \returns the position of the first such record, or count if there is none.
+ */
+static inline size_t vccert_parser_field_index_lower_bound(
+    const uint8_t* index, size_t count, uint16_t field_id, size_t offset)
+{
+    uint8_t key[VCCERT_FIELD_INDEX_RECORD_SIZE];
+    size_t lo = 0;
+
+    vccert_parser_field_index_record(key, field_id, offset);
+
+    while (count > 0)
+    {
+        size_t half = count / 2;
+
+        if (0 > memcmp(
+                    index + (lo + half) * VCCERT_FIELD_INDEX_RECORD_SIZE, key,
+                    sizeof(key)))
+        {
+            lo += half + 1;
+            count -= half + 1;
+        }
+        else
+        {
+            count = half;
+        }
+    }
+
+    return lo;
+}
+
+/**
+ * Find the first occurrence of a field and check that it has the given size.
+ *
+ * \param context           The parser context.
+ * \param field_id          The short-hand field identifier to find.
+ * \param size              The size the field must have.
+ * \param value             Set to the field value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if the field does not
+ *        have the given size.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the field is
+ *        not found.
+ */
+int vccert_parser_get_fixed(
+    vccert_parser_context_t* context, uint16_t field_id, size_t size,
+    const uint8_t** value);
+
+/**
+ * Decode every occurrence of a 4 or 8 byte Big Endian integer field into a
+ * native array.
+ *
+ * \param context           The parser context.
+ * \param field_id          The short-hand field identifier to find.
+ * \param width             The size of each value, 4 or 8.
+ * \param values            The array to receive the values.
+ * \param capacity          The number of entries in values.
+ * \param count             Set to the number of occurrences.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if an occurrence does
+ *        not have the given width.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_INVALID_FIELD_SIZE if the certificate
+ *        is malformed.
+ */
+int vccert_parser_decode_records(
+    const vccert_parser_context_t* context, uint16_t field_id, size_t width,
+    void* values, size_t capacity, size_t* count);
+
+/**
+ * Load an unsigned 16-bit Big Endian value.
+ *
+ * \param in                The value, which need not be aligned.
+ *
+ * \returns the native value.
+ */
+static inline uint16_t vccert_parser_load_be16(const uint8_t* in)
+{
+#if defined(VCCERT_PARSER_LOAD_BSWAP)
+    uint16_t value;
+    memcpy(&value, in, sizeof(value));
+    return __builtin_bswap16(value);
+#else
+    return (uint16_t)(((uint16_t)in[0] << 8) | in[1]);
+#endif
+}
+
+/**
+ * Load an unsigned 32-bit Big Endian value.
+ *
+ * \param in                The value, which need not be aligned.
+ *
+ * \returns the native value.
+ */
+static inline uint32_t vccert_parser_load_be32(const uint8_t* in)
+{
+#if defined(VCCERT_PARSER_LOAD_BSWAP)
+    uint32_t value;
+    memcpy(&value, in, sizeof(value));
+    return __builtin_bswap32(value);
+#else
+    return ((uint32_t)in[0] << 24) | ((uint32_t)in[1] << 16)
+         | ((uint32_t)in[2] << 8) | in[3];
+#endif
+}
+
+/**
+ * Load an unsigned 64-bit Big Endian value.
+ *
+ * \param in                The value, which need not be aligned.
+ *
+ * \returns the native value.
+ */
+static inline uint64_t vccert_parser_load_be64(const uint8_t* in)
+{
+#if defined(VCCERT_PARSER_LOAD_BSWAP)
+    uint64_t value;
+    memcpy(&value, in, sizeof(value));
+    return __builtin_bswap64(value);
+#else
+    return ((uint64_t)vccert_parser_load_be32(in) << 32)
+         | vccert_parser_load_be32(in + 4);
+#endif
+}
+
 /* make this header C++ friendly. */
 #ifdef __cplusplus
 }
@@ -14,6 +14,8 @@
 #include <vccrypt/compare.h>
 #include <vpr/parameters.h>
 
+#include "parser_internal.h"
+
 /**
  * \brief Perform attestation on a certificate.
  *
@@ -36,6 +38,8 @@
  *        could not be resolved.
  *      - \ref VCCERT_ERROR_PARSER_ATTEST_SIGNATURE_MISMATCH if the computed
  *        signature did not match the signature in the certificate.
+ *      - \ref VCCERT_ERROR_PARSER_ATTEST_BAD_FIELD_INDEX if the signed field
+ *        index is malformed or does not match the certificate.
  *      - \ref VCCERT_ERROR_PARSER_ATTEST_MISSING_TRANSACTION_TYPE if the
  *        transaction type for this certificate could not be found.
  *      - \ref VCCERT_ERROR_PARSER_ATTEST_MISSING_ARTIFACT_ID if the artifact
@@ -65,14 +69,19 @@ int vccert_parser_attest(
      * be equal to the raw size.
      */
     context->size = context->raw_size;
+    context->field_index = NULL;
+    context->field_index_size = 0;
 
-    /* First, we need to get the UUID of the signer. */
+    /* First, we need to get the UUID of the signer, along with the field index
+     * just before it, if there is one. */
     const uint8_t* signer_uuid;
     size_t signer_uuid_size;
+    const uint8_t* field_index;
+    size_t field_index_size, field_index_fields;
     if (VCCERT_STATUS_SUCCESS !=
-            vccert_parser_find_short(
-                context, VCCERT_FIELD_TYPE_SIGNER_ID, &signer_uuid,
-                &signer_uuid_size) ||
+            vccert_parser_find_signer(
+                context, &signer_uuid, &signer_uuid_size, &field_index,
+                &field_index_size, &field_index_fields) ||
         16 != signer_uuid_size)
     {
         return VCCERT_ERROR_PARSER_ATTEST_MISSING_SIGNER_UUID;
@@ -161,62 +170,32 @@ int vccert_parser_attest(
     context->size = (signature - context->cert) -
         FIELD_TYPE_SIZE - FIELD_SIZE_SIZE;
 
-    /* short circuit if contract verification is not required */
-    if (!verifyContract)
+    /* The field index is covered by the signature, so once it is checked,
+     * lookups can use it in place of a walk. */
+    if (NULL != field_index)
     {
-        retval = VCCERT_STATUS_SUCCESS;
-        goto sign_dispose;
+        retval =
+            vccert_parser_field_index_check(
+                context, field_index, field_index_size,
+                field_index_fields);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            goto sign_dispose;
+        }
+
+        context->field_index = field_index;
+        context->field_index_size = field_index_size;
     }
 
-    /* get the transaction type id */
-    const uint8_t* txn_type;
-    size_t txn_type_size;
-    if (VCCERT_STATUS_SUCCESS !=
-            vccert_parser_find_short(
-                context, VCCERT_FIELD_TYPE_TRANSACTION_TYPE, &txn_type,
-                &txn_type_size) ||
-        16 != txn_type_size)
-    {
-        retval = VCCERT_ERROR_PARSER_ATTEST_MISSING_TRANSACTION_TYPE;
-        goto sign_dispose;
-    }
-
-    /* get the artifact id */
-    const uint8_t* artifact_id;
-    size_t artifact_id_size;
-    if (VCCERT_STATUS_SUCCESS !=
-            vccert_parser_find_short(
-                context, VCCERT_FIELD_TYPE_ARTIFACT_ID, &artifact_id,
-                &artifact_id_size) ||
-        16 != artifact_id_size)
-    {
-        retval = VCCERT_ERROR_PARSER_ATTEST_MISSING_ARTIFACT_ID;
-        goto sign_dispose;
-    }
-
-    /* look up the contract function */
-    vccert_contract_closure_t contract;
-    retval =
-        context->options->parser_options_contract_resolver(
-            context->options, context, txn_type, artifact_id, &contract);
-    if (VCCERT_STATUS_SUCCESS != retval)
+    /* short circuit if contract verification is not required */
+    if (!verifyContract)
     {
-        retval = VCCERT_ERROR_PARSER_ATTEST_MISSING_CONTRACT;
+        retval = VCCERT_STATUS_SUCCESS;
         goto sign_dispose;
     }
 
-    /* execute the contract to verify this transaction. */
-    if (!vccert_contract_closure_call(&contract, context))
-    {
-        retval = VCCERT_ERROR_PARSER_ATTEST_CONTRACT_VERIFICATION;
-        goto contract_dispose;
-    }
-
-    /* At this point, the certificate chain has been attested. */
-    retval = VCCERT_STATUS_SUCCESS;
-
-contract_dispose:
-    dispose((disposable_t*)&contract);
+    /* run the contract for this transaction. */
+    retval = vccert_parser_attest_contract(context);
 
 sign_dispose:
     dispose((disposable_t*)&sign);
@@ -0,0 +1,89 @@
+/**
+ * \file vccert_parser_attest_contract.c
+ *
+ * Run the contract for a certificate as the last step of attestation.
+ *
+ * \copyright 2017-2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccert/fields.h>
+#include <vccert/parser.h>
+#include <vpr/parameters.h>
+
+#include "parser_internal.h"
+
+/**
+ * Look up and run the contract for a certificate whose signature has already
+ * been verified by vccert_parser_attest().
+ *
+ * \param context           The attested parser context.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_ATTEST_MISSING_TRANSACTION_TYPE if the
+ *        transaction type for this certificate could not be found.
+ *      - \ref VCCERT_ERROR_PARSER_ATTEST_MISSING_ARTIFACT_ID if the artifact
+ *        identifier for this transaction could not be found.
+ *      - \ref VCCERT_ERROR_PARSER_ATTEST_MISSING_CONTRACT if the contract for
+ *        this certificate could not be found.
+ *      - \ref VCCERT_ERROR_PARSER_ATTEST_CONTRACT_VERIFICATION if contract
+ *        verification for this certificate failed.
+ */
+int vccert_parser_attest_contract(vccert_parser_context_t* context)
+{
+    int retval;
+
+    MODEL_ASSERT(context != NULL);
+    MODEL_ASSERT(context->options != NULL);
+    MODEL_ASSERT(context->options->parser_options_contract_resolver != NULL);
+
+    /* get the transaction type id */
+    const uint8_t* txn_type;
+    size_t txn_type_size;
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_parser_find_short(
+                context, VCCERT_FIELD_TYPE_TRANSACTION_TYPE, &txn_type,
+                &txn_type_size) ||
+        16 != txn_type_size)
+    {
+        return VCCERT_ERROR_PARSER_ATTEST_MISSING_TRANSACTION_TYPE;
+    }
+
+    /* get the artifact id */
+    const uint8_t* artifact_id;
+    size_t artifact_id_size;
+    if (VCCERT_STATUS_SUCCESS !=
+            vccert_parser_find_short(
+                context, VCCERT_FIELD_TYPE_ARTIFACT_ID, &artifact_id,
+                &artifact_id_size) ||
+        16 != artifact_id_size)
+    {
+        return VCCERT_ERROR_PARSER_ATTEST_MISSING_ARTIFACT_ID;
+    }
+
+    /* look up the contract function */
+    vccert_contract_closure_t contract;
+    retval =
+        context->options->parser_options_contract_resolver(
+            context->options, context, txn_type, artifact_id, &contract);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return VCCERT_ERROR_PARSER_ATTEST_MISSING_CONTRACT;
+    }
+
+    /* execute the contract to verify this transaction. */
+    if (!vccert_contract_closure_call(&contract, context))
+    {
+        retval = VCCERT_ERROR_PARSER_ATTEST_CONTRACT_VERIFICATION;
+        goto contract_dispose;
+    }
+
+    /* At this point, the certificate chain has been attested. */
+    retval = VCCERT_STATUS_SUCCESS;
+
+contract_dispose:
+    dispose((disposable_t*)&contract);
+
+    return retval;
+}
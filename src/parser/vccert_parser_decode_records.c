@@ -0,0 +1,293 @@
+/**
+ * \file vccert_parser_decode_records.c
+ *
+ * Decode every occurrence of an integer field, using a byte-shuffle kernel
+ * for runs of consecutive records where the platform has one.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "parser_internal.h"
+
+#if defined(VCCERT_PARSER_DECODE_SSSE3)
+# include <tmmintrin.h>
+#elif defined(VCCERT_PARSER_DECODE_NEON)
+# include <arm_neon.h>
+#endif
+
+#define HEADER_SIZE (FIELD_TYPE_SIZE + FIELD_SIZE_SIZE)
+
+/* forward decls */
+static void decode_run(
+    uint8_t* out, const uint8_t* records, size_t width, size_t count);
+
+/**
+ * Decode 32-bit records one at a time.
+ */
+static void decode_scalar32(
+    uint32_t* out, const uint8_t* records, size_t count)
+{
+    for (size_t i = 0; i < count; ++i, records += HEADER_SIZE + 4)
+    {
+        out[i] = vccert_parser_load_be32(records + HEADER_SIZE);
+    }
+}
+
+/**
+ * Decode 64-bit records one at a time.
+ */
+static void decode_scalar64(
+    uint64_t* out, const uint8_t* records, size_t count)
+{
+    for (size_t i = 0; i < count; ++i, records += HEADER_SIZE + 8)
+    {
+        out[i] = vccert_parser_load_be64(records + HEADER_SIZE);
+    }
+}
+
+#if defined(VCCERT_PARSER_DECODE_SSSE3)
+
+/**
+ * Decode four 32-bit records per iteration, dropping the headers and swapping
+ * the values with one shuffle per pair of records.
+ */
+__attribute__((target("ssse3")))
+static void decode_ssse3_32(
+    uint32_t* out, const uint8_t* records, size_t count)
+{
+    const __m128i swap32 =
+        _mm_setr_epi8(
+            7, 6, 5, 4, 15, 14, 13, 12, -1, -1, -1, -1, -1, -1, -1, -1);
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4, records += 4 * (HEADER_SIZE + 4))
+    {
+        __m128i lo = _mm_loadu_si128((const __m128i*)records);
+        __m128i hi = _mm_loadu_si128((const __m128i*)(records + 16));
+
+        lo = _mm_shuffle_epi8(lo, swap32);
+        hi = _mm_shuffle_epi8(hi, swap32);
+        _mm_storeu_si128((__m128i*)(out + i), _mm_unpacklo_epi64(lo, hi));
+    }
+
+    decode_scalar32(out + i, records, count - i);
+}
+
+/**
+ * Decode two 64-bit records per iteration, swapping both values with one
+ * shuffle.
+ */
+__attribute__((target("ssse3")))
+static void decode_ssse3_64(
+    uint64_t* out, const uint8_t* records, size_t count)
+{
+    const __m128i swap64 =
+        _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    size_t i = 0;
+
+    for (; i + 2 <= count; i += 2, records += 2 * (HEADER_SIZE + 8))
+    {
+        __m128i a = _mm_loadl_epi64((const __m128i*)(records + HEADER_SIZE));
+        __m128i b =
+            _mm_loadl_epi64(
+                (const __m128i*)(records + 2 * HEADER_SIZE + 8));
+
+        _mm_storeu_si128(
+            (__m128i*)(out + i),
+            _mm_shuffle_epi8(_mm_unpacklo_epi64(a, b), swap64));
+    }
+
+    decode_scalar64(out + i, records, count - i);
+}
+
+#elif defined(VCCERT_PARSER_DECODE_NEON)
+
+/**
+ * Decode four 32-bit records per iteration, splitting the headers from the
+ * values with one unzip.
+ */
+static void decode_neon_32(
+    uint32_t* out, const uint8_t* records, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + 4 <= count; i += 4, records += 4 * (HEADER_SIZE + 4))
+    {
+        uint32x4x2_t words =
+            vuzpq_u32(
+                vreinterpretq_u32_u8(vld1q_u8(records)),
+                vreinterpretq_u32_u8(vld1q_u8(records + 16)));
+
+        vst1q_u32(
+            out + i,
+            vreinterpretq_u32_u8(
+                vrev32q_u8(vreinterpretq_u8_u32(words.val[1]))));
+    }
+
+    decode_scalar32(out + i, records, count - i);
+}
+
+/**
+ * Decode two 64-bit records per iteration, reversing both values at once.
+ */
+static void decode_neon_64(
+    uint64_t* out, const uint8_t* records, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + 2 <= count; i += 2, records += 2 * (HEADER_SIZE + 8))
+    {
+        uint8x16_t v =
+            vcombine_u8(
+                vld1_u8(records + HEADER_SIZE),
+                vld1_u8(records + 2 * HEADER_SIZE + 8));
+
+        vst1q_u64(out + i, vreinterpretq_u64_u8(vrev64q_u8(v)));
+    }
+
+    decode_scalar64(out + i, records, count - i);
+}
+
+#endif
+
+/**
+ * Decode every occurrence of a 4 or 8 byte Big Endian integer field into a
+ * native array.
+ *
+ * \param context           The parser context.
+ * \param field_id          The short-hand field identifier to find.
+ * \param width             The size of each value, 4 or 8.
+ * \param values            The array to receive the values.
+ * \param capacity          The number of entries in values.
+ * \param count             Set to the number of occurrences.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if an occurrence does
+ *        not have the given width.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_INVALID_FIELD_SIZE if the certificate
+ *        is malformed.
+ */
+int vccert_parser_decode_records(
+    const vccert_parser_context_t* context, uint16_t field_id, size_t width,
+    void* values, size_t capacity, size_t* count)
+{
+    uint8_t* out = (uint8_t*)values;
+    size_t offset = 0;
+
+    MODEL_ASSERT(context != NULL);
+    MODEL_ASSERT(context->cert != NULL);
+    MODEL_ASSERT(4 == width || 8 == width);
+    MODEL_ASSERT(values != NULL || capacity == 0);
+    MODEL_ASSERT(count != NULL);
+
+    /* parameter sanity check */
+    if (context == NULL || context->cert == NULL
+     || (values == NULL && capacity > 0) || count == NULL)
+    {
+        return VCCERT_ERROR_PARSER_GET_INVALID_ARG;
+    }
+
+    *count = 0;
+
+    while (offset < context->size)
+    {
+        uint16_t found_id;
+        size_t field_size;
+        const uint8_t* field;
+        int retval;
+
+        retval =
+            vccert_parser_field(
+                context->cert, context->size, offset, &found_id, &field_size,
+                &field, &offset);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            /* a trailing partial header is as malformed as an overrun. */
+            return VCCERT_ERROR_PARSER_FIELD_INVALID_FIELD_SIZE;
+        }
+
+        if (found_id != field_id)
+        {
+            continue;
+        }
+
+        if (width != field_size)
+        {
+            return VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE;
+        }
+
+        /* extend the run over records with the very same header. */
+        const uint8_t* records = field - HEADER_SIZE;
+        size_t run = 1;
+        while (offset + HEADER_SIZE + width <= context->size
+            && 0 == memcmp(context->cert + offset, records, HEADER_SIZE))
+        {
+            offset += HEADER_SIZE + width;
+            ++run;
+        }
+
+        /* decode as much of the run as fits. */
+        if (*count < capacity)
+        {
+            size_t room = capacity - *count;
+
+            decode_run(
+                out + *count * width, records, width,
+                run < room ? run : room);
+        }
+
+        *count += run;
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Decode a run of consecutive records with the same header.
+ *
+ * \param out           The output array.
+ * \param records       The first record header.
+ * \param width         The size of each value, 4 or 8.
+ * \param count         The number of records to decode.
+ */
+static void decode_run(
+    uint8_t* out, const uint8_t* records, size_t width, size_t count)
+{
+    if (4 == width)
+    {
+#if defined(VCCERT_PARSER_DECODE_SSSE3)
+        if (__builtin_cpu_supports("ssse3"))
+        {
+            decode_ssse3_32((uint32_t*)out, records, count);
+            return;
+        }
+#elif defined(VCCERT_PARSER_DECODE_NEON)
+        decode_neon_32((uint32_t*)out, records, count);
+        return;
+#endif
+
+        decode_scalar32((uint32_t*)out, records, count);
+    }
+    else
+    {
+#if defined(VCCERT_PARSER_DECODE_SSSE3)
+        if (__builtin_cpu_supports("ssse3"))
+        {
+            decode_ssse3_64((uint64_t*)out, records, count);
+            return;
+        }
+#elif defined(VCCERT_PARSER_DECODE_NEON)
+        decode_neon_64((uint64_t*)out, records, count);
+        return;
+#endif
+
+        decode_scalar64((uint64_t*)out, records, count);
+    }
+}
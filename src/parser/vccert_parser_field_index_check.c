@@ -0,0 +1,135 @@
+/**
+ * \file vccert_parser_field_index_check.c
+ *
+ * Check a signed field index before it is used for lookups.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "parser_internal.h"
+
+/* forward decls */
+static bool field_index_lists(
+    const uint8_t* cert, const uint8_t* index, size_t count, size_t offset);
+
+/**
+ * Check that a signed field index is well-formed, and that it lists every
+ * field that precedes it exactly once.
+ *
+ * The fields before the index form a chain from offset 0, each header leading
+ * to the next, which vccert_parser_find_signer() has already walked and
+ * counted.  If the first field is listed, and every listed field is a real
+ * field whose successor is either the index or also listed, then the records
+ * cover that chain.  Since the records are distinct and there are exactly as
+ * many of them as there are fields, they list nothing else.
+ *
+ * \param context           The parser context, trimmed to the attested size.
+ * \param index             The field index value.
+ * \param index_size        The size of the field index value.
+ * \param fields            The number of fields before the field index, as
+ *                          counted by vccert_parser_find_signer().
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_ATTEST_BAD_FIELD_INDEX if the index is
+ *        malformed or does not match the certificate.
+ */
+int vccert_parser_field_index_check(
+    const vccert_parser_context_t* context, const uint8_t* index,
+    size_t index_size, size_t fields)
+{
+    MODEL_ASSERT(context != NULL);
+    MODEL_ASSERT(context->cert != NULL);
+    MODEL_ASSERT(index != NULL);
+
+    size_t count = index_size / VCCERT_FIELD_INDEX_RECORD_SIZE;
+    size_t index_offset =
+        (size_t)(index - context->cert) - FIELD_TYPE_SIZE - FIELD_SIZE_SIZE;
+
+    /* the index must hold one whole record per field, and 32-bit offsets must
+     * reach it. */
+    if (0 != index_size % VCCERT_FIELD_INDEX_RECORD_SIZE
+     || count != fields || index_offset > UINT32_MAX)
+    {
+        return VCCERT_ERROR_PARSER_ATTEST_BAD_FIELD_INDEX;
+    }
+
+    /* lookups binary search the index, so the records must be strictly
+     * increasing. */
+    for (size_t i = 1; i < count; ++i)
+    {
+        if (0 <= memcmp(
+                    index + (i - 1) * VCCERT_FIELD_INDEX_RECORD_SIZE,
+                    index + i * VCCERT_FIELD_INDEX_RECORD_SIZE,
+                    VCCERT_FIELD_INDEX_RECORD_SIZE))
+        {
+            return VCCERT_ERROR_PARSER_ATTEST_BAD_FIELD_INDEX;
+        }
+    }
+
+    /* an empty index covers an empty chain. */
+    if (0 == count)
+    {
+        return VCCERT_STATUS_SUCCESS;
+    }
+
+    /* the chain starts with the first field. */
+    if (!field_index_lists(context->cert, index, count, 0))
+    {
+        return VCCERT_ERROR_PARSER_ATTEST_BAD_FIELD_INDEX;
+    }
+
+    /* every record must be a real field, followed by the index or by another
+     * listed field. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint8_t* record = index + i * VCCERT_FIELD_INDEX_RECORD_SIZE;
+        size_t offset = vccert_parser_load_be32(record + FIELD_TYPE_SIZE);
+        uint16_t field_id;
+        size_t field_size, next;
+        const uint8_t* field;
+
+        if (offset >= index_offset
+         || VCCERT_STATUS_SUCCESS !=
+                vccert_parser_field(
+                    context->cert, context->size, offset, &field_id,
+                    &field_size, &field, &next)
+         || vccert_parser_load_be16(record) != field_id
+         || next > index_offset
+         || (next < index_offset
+          && !field_index_lists(context->cert, index, count, next)))
+        {
+            return VCCERT_ERROR_PARSER_ATTEST_BAD_FIELD_INDEX;
+        }
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Return true if the field index lists the field header at the given offset.
+ *
+ * \param cert              The certificate.
+ * \param index             The sorted field index value.
+ * \param count             The number of records in the index.
+ * \param offset            The offset of a field header before the index.
+ */
+static bool field_index_lists(
+    const uint8_t* cert, const uint8_t* index, size_t count, size_t offset)
+{
+    uint8_t key[VCCERT_FIELD_INDEX_RECORD_SIZE];
+    uint16_t field_id = vccert_parser_load_be16(cert + offset);
+    size_t pos =
+        vccert_parser_field_index_lower_bound(index, count, field_id, offset);
+
+    vccert_parser_field_index_record(key, field_id, offset);
+
+    return pos < count
+        && 0 == memcmp(
+                    index + pos * VCCERT_FIELD_INDEX_RECORD_SIZE, key,
+                    sizeof(key));
+}
@@ -0,0 +1,97 @@
+/**
+ * \file vccert_parser_field_index_find.c
+ *
+ * Find a field in an attested certificate using its signed field index.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "parser_internal.h"
+
+/**
+ * Find the first field with the given type whose header is at or after the
+ * given offset, using the signed field index of an attested certificate.
+ * Fields after the index itself are found by walking the short tail of the
+ * certificate.
+ *
+ * \param context           The attested parser context.
+ * \param field_id          The short-hand field identifier to find.
+ * \param from              The offset of a field header at which to start.
+ * \param value             Set to the field value, or NULL if not found.
+ * \param size              Set to the field size, or 0 if not found.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if no such field
+ *        was found.
+ */
+int vccert_parser_field_index_find(
+    const vccert_parser_context_t* context, uint16_t field_id, size_t from,
+    const uint8_t** value, size_t* size)
+{
+    MODEL_ASSERT(context != NULL);
+    MODEL_ASSERT(context->cert != NULL);
+    MODEL_ASSERT(context->field_index != NULL);
+    MODEL_ASSERT(value != NULL);
+    MODEL_ASSERT(size != NULL);
+
+    uint16_t found_id = 0;
+    size_t offset =
+        (size_t)(context->field_index - context->cert) - FIELD_TYPE_SIZE
+            - FIELD_SIZE_SIZE;
+
+    /* the index covers every field before its own header. */
+    if (from < offset)
+    {
+        size_t count =
+            context->field_index_size / VCCERT_FIELD_INDEX_RECORD_SIZE;
+        size_t pos =
+            vccert_parser_field_index_lower_bound(
+                context->field_index, count, field_id, from);
+
+        if (pos < count)
+        {
+            const uint8_t* record =
+                context->field_index + pos * VCCERT_FIELD_INDEX_RECORD_SIZE;
+            size_t header =
+                ((size_t)record[2] << 24) | ((size_t)record[3] << 16)
+              | ((size_t)record[4] << 8) | record[5];
+
+            /* the record is signed, but its field is still parsed with
+             * bounds checks. */
+            if (((record[0] << 8) | record[1]) == field_id
+             && VCCERT_STATUS_SUCCESS ==
+                    vccert_parser_field(
+                        context->cert, context->size, header, &found_id,
+                        size, value, &header)
+             && found_id == field_id)
+            {
+                return VCCERT_STATUS_SUCCESS;
+            }
+        }
+    }
+    else
+    {
+        offset = from;
+    }
+
+    /* walk the fields from the index onward. */
+    while (VCCERT_STATUS_SUCCESS ==
+            vccert_parser_field(
+                context->cert, context->size, offset, &found_id, size, value,
+                &offset))
+    {
+        if (found_id == field_id)
+        {
+            return VCCERT_STATUS_SUCCESS;
+        }
+    }
+
+    *size = 0;
+    *value = NULL;
+
+    return VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND;
+}
@@ -58,6 +58,19 @@ int vccert_parser_find_next(
         return VCCERT_ERROR_PARSER_FIND_NEXT_FIELD_NOT_FOUND;
     }
 
+    /* an attested certificate with a signed field index needs no walk. */
+    if (NULL != context->field_index)
+    {
+        if (VCCERT_STATUS_SUCCESS !=
+                vccert_parser_field_index_find(
+                    context, field_id, offset, value, size))
+        {
+            return VCCERT_ERROR_PARSER_FIND_NEXT_FIELD_NOT_FOUND;
+        }
+
+        return VCCERT_STATUS_SUCCESS;
+    }
+
     /* search through all fields for a matching occurrence. */
     do
     {
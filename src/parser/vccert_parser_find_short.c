@@ -19,7 +19,8 @@
  * If the certificate has not been attested, then this performs an UNSAFE SEARCH
  * of the RAW CERTIFICATE.  Run vccert_parser_attest() first if you want trusted
  * information.  Additional matching fields can be found by calling
- * vccert_parser_find_next().
+ * vccert_parser_find_next().  If an attested certificate carries a signed
+ * field index, then the index is used in place of a search.
  *
  * \param context           The parser context structure for this certificate.
  * \param field_id          The short-hand field identifier to find.
@@ -54,6 +55,13 @@ int vccert_parser_find_short(
     size_t offset = 0;
     int retval = 0;
 
+    /* an attested certificate with a signed field index needs no walk. */
+    if (NULL != context->field_index)
+    {
+        return
+            vccert_parser_field_index_find(context, field_id, 0, value, size);
+    }
+
     /* search through all fields for a matching occurrence. */
     do
     {
@@ -0,0 +1,87 @@
+/**
+ * \file vccert_parser_find_signer.c
+ *
+ * Find the signer ID of a certificate and the field index before it.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vccert/fields.h>
+#include <vpr/parameters.h>
+
+#include "parser_internal.h"
+
+/**
+ * Find the signer ID of a certificate, along with the field index that
+ * immediately precedes it, if there is one.
+ *
+ * \param context           The parser context.
+ * \param signer            Set to the signer ID value.
+ * \param signer_size       Set to the size of the signer ID value.
+ * \param index             Set to the field index value, or NULL if the field
+ *                          before the signer ID is not a field index.
+ * \param index_size        Set to the size of the field index value.
+ * \param index_fields      Set to the number of fields before the field
+ *                          index, which it must list.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the signer ID
+ *        was not found.
+ */
+int vccert_parser_find_signer(
+    const vccert_parser_context_t* context, const uint8_t** signer,
+    size_t* signer_size, const uint8_t** index, size_t* index_size,
+    size_t* index_fields)
+{
+    MODEL_ASSERT(context != NULL);
+    MODEL_ASSERT(context->cert != NULL);
+    MODEL_ASSERT(signer != NULL);
+    MODEL_ASSERT(signer_size != NULL);
+    MODEL_ASSERT(index != NULL);
+    MODEL_ASSERT(index_size != NULL);
+    MODEL_ASSERT(index_fields != NULL);
+
+    uint16_t found_id = 0;
+    uint16_t previous_id = 0;
+    const uint8_t* previous = NULL;
+    size_t previous_size = 0;
+    size_t offset = 0;
+    size_t fields = 0;
+
+    *index = NULL;
+    *index_size = 0;
+    *index_fields = 0;
+
+    /* walk the fields, remembering the one before the current field and
+     * counting the fields that a field index there would have to list. */
+    while (VCCERT_STATUS_SUCCESS ==
+            vccert_parser_field(
+                context->cert, context->size, offset, &found_id,
+                signer_size, signer, &offset))
+    {
+        if (VCCERT_FIELD_TYPE_SIGNER_ID == found_id)
+        {
+            if (NULL != previous
+             && VCCERT_FIELD_TYPE_FIELD_INDEX == previous_id)
+            {
+                *index = previous;
+                *index_size = previous_size;
+                *index_fields = fields - 1;
+            }
+
+            return VCCERT_STATUS_SUCCESS;
+        }
+
+        previous_id = found_id;
+        previous = *signer;
+        previous_size = *signer_size;
+        ++fields;
+    }
+
+    *signer = NULL;
+    *signer_size = 0;
+
+    return VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND;
+}
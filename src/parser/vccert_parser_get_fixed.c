@@ -0,0 +1,60 @@
+/**
+ * \file vccert_parser_get_fixed.c
+ *
+ * Find a field that must have a given size.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "parser_internal.h"
+
+/**
+ * Find the first occurrence of a field and check that it has the given size.
+ *
+ * \param context           The parser context.
+ * \param field_id          The short-hand field identifier to find.
+ * \param size              The size the field must have.
+ * \param value             Set to the field value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if the field does not
+ *        have the given size.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the field is
+ *        not found.
+ */
+int vccert_parser_get_fixed(
+    vccert_parser_context_t* context, uint16_t field_id, size_t size,
+    const uint8_t** value)
+{
+    size_t field_size;
+    int retval;
+
+    MODEL_ASSERT(context != NULL);
+    MODEL_ASSERT(context->cert != NULL);
+    MODEL_ASSERT(value != NULL);
+
+    /* parameter sanity check */
+    if (context == NULL || context->cert == NULL || value == NULL)
+    {
+        return VCCERT_ERROR_PARSER_GET_INVALID_ARG;
+    }
+
+    retval = vccert_parser_find_short(context, field_id, value, &field_size);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (size != field_size)
+    {
+        return VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE;
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,56 @@
+/**
+ * \file vccert_parser_get_int32.c
+ *
+ * Find a field and decode it as a signed 32-bit integer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "parser_internal.h"
+
+/**
+ * \brief Find the first occurrence of a field and decode it as
+ * a signed 32-bit Big Endian integer.
+ *
+ * This searches the certificate as vccert_parser_find_short() does.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param value             A pointer to receive the decoded value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if the field is not
+ *        4 bytes long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND if the field is
+ *        not found.
+ */
+int vccert_parser_get_int32(
+    vccert_parser_context_t* context, uint16_t field_id, int32_t* value)
+{
+    const uint8_t* field;
+    int retval;
+
+    MODEL_ASSERT(value != NULL);
+
+    /* parameter sanity check */
+    if (value == NULL)
+    {
+        return VCCERT_ERROR_PARSER_GET_INVALID_ARG;
+    }
+
+    retval = vccert_parser_get_fixed(context, field_id, 4, &field);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    *value = (int32_t)vccert_parser_load_be32(field);
+
+    return VCCERT_STATUS_SUCCESS;
+}
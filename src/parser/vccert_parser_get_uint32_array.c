@@ -0,0 +1,49 @@
+/**
+ * \file vccert_parser_get_uint32_array.c
+ *
+ * Decode every occurrence of a field as an unsigned 32-bit integer.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "parser_internal.h"
+
+/**
+ * \brief Decode every occurrence of a field as an unsigned 32-bit Big Endian
+ * integer.
+ *
+ * The certificate is walked once, within its attested bounds if it has been
+ * attested.  Runs of consecutive occurrences, as written by
+ * vccert_builder_add_short_uint32_array(), are decoded with a byte-shuffle
+ * kernel where the platform has one.
+ *
+ * \param context           The parser context structure for this certificate.
+ * \param field_id          The short-hand field identifier to find.
+ * \param values            The array to receive the decoded values.  This may
+ *                          be NULL if capacity is 0.
+ * \param capacity          The number of entries in values.
+ * \param count             Set to the number of occurrences.  This may exceed
+ *                          capacity, in which case only the first capacity
+ *                          values are written.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success, including when the field does
+ *        not occur.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_ARG if an invalid argument is
+ *        provided.
+ *      - \ref VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE if an occurrence is
+ *        not 4 bytes long.
+ *      - \ref VCCERT_ERROR_PARSER_FIELD_INVALID_FIELD_SIZE if the certificate
+ *        is malformed.
+ */
+int vccert_parser_get_uint32_array(
+    vccert_parser_context_t* context, uint16_t field_id, uint32_t* values,
+    size_t capacity, size_t* count)
+{
+    return
+        vccert_parser_decode_records(
+            context, field_id, sizeof(uint32_t), values, capacity, count);
+}
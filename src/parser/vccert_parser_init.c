@@ -64,6 +64,8 @@ int vccert_parser_init(
     context->parent_buffer.data = NULL;
     context->parent_buffer.size = 0;
     context->parent = NULL;
+    context->field_index = NULL;
+    context->field_index_size = 0;
 
     /* success */
     return VCCERT_STATUS_SUCCESS;
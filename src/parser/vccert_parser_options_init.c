@@ -68,6 +68,8 @@ int vccert_parser_options_init(
     options->parser_options_contract_resolver = contract_resolver;
     options->parser_options_entity_key_resolver = key_resolver;
     options->context = context;
+    options->artifact_state_context = NULL;
+    options->entity_key_context = NULL;
 
     /* success */
     return VCCERT_STATUS_SUCCESS;
@@ -0,0 +1,93 @@
+/**
+ * \file vccert_parser_tuple_init.c
+ *
+ * Initialize a lightweight parser view over a tuple-valued field.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vccert/parser.h>
+#include <vpr/parameters.h>
+
+/* forward decls */
+static void vccert_parser_tuple_dispose(void* context);
+
+/**
+ * \brief Initialize a lightweight parser view over a tuple-valued field of a
+ * parent certificate.
+ *
+ * Tuple-valued fields, such as \ref VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE
+ * or \ref VCCERT_FIELD_TYPE_GRANT_TUPLE, hold a nested stream of fields.  The
+ * resulting view borrows the parent's options, allocates nothing, and can be
+ * used with vccert_parser_field_first(), vccert_parser_field_next(),
+ * vccert_parser_find_short(), and vccert_parser_find_next().  The value must
+ * lie within the parent's attested bounds, or within its raw bounds if the
+ * parent has not been attested.
+ *
+ * The view owns no resources; disposing it is allowed but not required.  It
+ * must not outlive the parent certificate.  A tuple view cannot be attested
+ * on its own; to attest a wrapped certificate, use vccert_parser_init().
+ *
+ * \param parent            The parser context of the enclosing certificate.
+ * \param tuple             The parser context to initialize as a view.
+ * \param value             The tuple field value, found in the parent.
+ * \param size              The size of the tuple field value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_PARSER_TUPLE_INIT_INVALID_ARG if an invalid
+ *        argument was passed to vccert_parser_tuple_init().
+ *      - \ref VCCERT_ERROR_PARSER_TUPLE_INIT_OUT_OF_BOUNDS if the value does
+ *        not lie within the parent certificate.
+ */
+int vccert_parser_tuple_init(
+    const vccert_parser_context_t* parent, vccert_parser_context_t* tuple,
+    const uint8_t* value, size_t size)
+{
+    MODEL_ASSERT(parent != NULL);
+    MODEL_ASSERT(parent->cert != NULL);
+    MODEL_ASSERT(tuple != NULL);
+    MODEL_ASSERT(value != NULL);
+    MODEL_ASSERT(size > 0);
+
+    if (parent == NULL || parent->cert == NULL || tuple == NULL
+     || value == NULL || size == 0)
+    {
+        return VCCERT_ERROR_PARSER_TUPLE_INIT_INVALID_ARG;
+    }
+
+    /* the tuple must lie entirely within the parent's (attested) bounds. */
+    if (value < parent->cert || size > parent->size
+     || (size_t)(value - parent->cert) > parent->size - size)
+    {
+        return VCCERT_ERROR_PARSER_TUPLE_INIT_OUT_OF_BOUNDS;
+    }
+
+    /* the view borrows everything from the parent, so there is no parent */
+    /* chain or parent buffer to clean up later. */
+    tuple->hdr.dispose = &vccert_parser_tuple_dispose;
+    tuple->options = parent->options;
+    tuple->cert = value;
+    tuple->raw_size = size;
+    tuple->size = size;
+    tuple->parent_buffer.data = NULL;
+    tuple->parent_buffer.size = 0;
+    tuple->parent = NULL;
+    tuple->field_index = NULL;
+    tuple->field_index_size = 0;
+
+    /* success */
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a tuple view.  The view owns nothing, so it is simply cleared.
+ *
+ * \param context       The tuple view to clear.
+ */
+static void vccert_parser_tuple_dispose(void* context)
+{
+    memset(context, 0, sizeof(vccert_parser_context_t));
+}
@@ -0,0 +1,157 @@
+/**
+ * \file vccert_parser_validate_batch.c
+ *
+ * Check the field headers of a batch of certificates, several at a time.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "parser_internal.h"
+
+/**
+ * The walk state of one lane.
+ */
+typedef struct batch_lane
+{
+    vccert_parser_batch_entry_t* entry;
+    size_t offset;
+    size_t count;
+} batch_lane_t;
+
+/* forward decls */
+static bool batch_lane_step(batch_lane_t* lane);
+
+/**
+ * \brief Check the field headers of a batch of certificates.
+ *
+ * Every field header must lie within its certificate, and every field value
+ * must end within it.  A certificate is walked one header at a time, and each
+ * step depends on the size read in the last one, so a single walk is bound
+ * by memory latency.  This walks \ref VCCERT_PARSER_BATCH_LANES certificates
+ * in lockstep instead, taking one step in each per round, so that their
+ * header reads overlap.  A lane moves on to the next certificate in the batch
+ * as soon as its current one is done.
+ *
+ * Signatures are not checked; this only establishes that each certificate
+ * can be walked.
+ *
+ * \param entries           The certificates to check.
+ * \param count             The number of certificates.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS if every certificate is well formed.
+ *      - \ref VCCERT_ERROR_PARSER_VALIDATE_BATCH_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_PARSER_VALIDATE_BATCH_MALFORMED if at least one
+ *        certificate is malformed; its entry holds the reason.
+ */
+int vccert_parser_validate_batch(
+    vccert_parser_batch_entry_t* entries, size_t count)
+{
+    batch_lane_t lanes[VCCERT_PARSER_BATCH_LANES];
+    size_t next = 0;
+    size_t active = 0;
+    bool malformed = false;
+
+    MODEL_ASSERT(count == 0 || entries != NULL);
+
+    /* parameter sanity check */
+    if (count > 0 && NULL == entries)
+    {
+        return VCCERT_ERROR_PARSER_VALIDATE_BATCH_INVALID_ARG;
+    }
+
+    /* start a certificate in each lane. */
+    for (size_t l = 0; l < VCCERT_PARSER_BATCH_LANES; ++l)
+    {
+        lanes[l].entry = next < count ? &entries[next++] : NULL;
+        lanes[l].offset = 0;
+        lanes[l].count = 0;
+        active += NULL != lanes[l].entry ? 1 : 0;
+    }
+
+    /* take one step in every lane per round, so the reads overlap. */
+    while (active > 0)
+    {
+        for (size_t l = 0; l < VCCERT_PARSER_BATCH_LANES; ++l)
+        {
+            batch_lane_t* lane = &lanes[l];
+            if (NULL == lane->entry || batch_lane_step(lane))
+            {
+                continue;
+            }
+
+            /* this certificate is done; refill the lane. */
+            lane->entry->field_count = lane->count;
+            malformed =
+                malformed || VCCERT_STATUS_SUCCESS != lane->entry->status;
+
+            lane->entry = next < count ? &entries[next++] : NULL;
+            lane->offset = 0;
+            lane->count = 0;
+            active -= NULL == lane->entry ? 1 : 0;
+        }
+    }
+
+    return
+        malformed
+            ? VCCERT_ERROR_PARSER_VALIDATE_BATCH_MALFORMED
+            : VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Check the next field header of a lane's certificate.  This accepts and
+ * rejects exactly the headers that vccert_parser_field() does.
+ *
+ * \param lane              The lane.
+ *
+ * \returns true if the lane's certificate has more fields to check, and
+ * false once it is done, with the entry's status set.
+ */
+static bool batch_lane_step(batch_lane_t* lane)
+{
+    vccert_parser_batch_entry_t* entry = lane->entry;
+    const size_t header_size = FIELD_TYPE_SIZE + FIELD_SIZE_SIZE;
+
+    if (lane->offset >= entry->size && NULL != entry->cert && 0 < entry->size)
+    {
+        entry->status = VCCERT_STATUS_SUCCESS;
+        return false;
+    }
+
+    if (NULL == entry->cert || lane->offset + header_size >= entry->size)
+    {
+        entry->status = VCCERT_ERROR_PARSER_FIELD_INVALID_ARG;
+        return false;
+    }
+
+    const uint8_t* header = entry->cert + lane->offset;
+    size_t field_size = ((size_t)header[2] << 8) | header[3];
+    size_t next_offset = lane->offset + header_size + field_size;
+    if (next_offset > entry->size)
+    {
+        entry->status = VCCERT_ERROR_PARSER_FIELD_INVALID_FIELD_SIZE;
+        return false;
+    }
+
+    if (lane->count < entry->offset_capacity && NULL != entry->offsets)
+    {
+        entry->offsets[lane->count] = lane->offset;
+    }
+
+    ++lane->count;
+    lane->offset = next_offset;
+
+#if defined(__GNUC__)
+    /* start the read of the next header before the next round needs it. */
+    if (next_offset < entry->size)
+    {
+        __builtin_prefetch(entry->cert + next_offset);
+    }
+#endif
+
+    return true;
+}
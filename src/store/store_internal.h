@@ -0,0 +1,88 @@
+/**
+ * \file store_internal.h
+ *
+ * Internal helpers for the certificate store.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_PRIVATE_STORE_INTERNAL_HEADER_GUARD
+#define VCCERT_PRIVATE_STORE_INTERNAL_HEADER_GUARD
+
+#include <vccert/error_codes.h>
+#include <vccert/store.h>
+
+/* Store files can only be mapped on hosted POSIX builds. */
+#if __STDC_HOSTED__ && !defined(__EMSCRIPTEN__) \
+ && (defined(__unix__) || defined(__APPLE__))
+# define VCCERT_STORE_MMAP 1
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * The offset index magic number.
+ */
+#define VCCERT_STORE_INDEX_MAGIC "VCSI"
+
+/**
+ * The offset index header field offsets.
+ */
+#define VCCERT_STORE_INDEX_OFFSET_MAGIC 0
+#define VCCERT_STORE_INDEX_OFFSET_RESERVED 4
+#define VCCERT_STORE_INDEX_OFFSET_COUNT 8
+#define VCCERT_STORE_INDEX_OFFSET_STORE_SIZE 16
+
+/**
+ * The size of each offset in the offset index.
+ */
+#define VCCERT_STORE_INDEX_ENTRY_SIZE 8
+
+/**
+ * Unmap the files mapped by vccert_store_open().
+ *
+ * \param store         The store whose files should be unmapped.
+ */
+void vccert_store_unmap(vccert_store_t* store);
+
+/**
+ * Read a big endian 32-bit value.
+ */
+static inline uint32_t vccert_store_load32(const uint8_t* p)
+{
+    return
+        ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16)
+      | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+/**
+ * Read a big endian 64-bit value.
+ */
+static inline uint64_t vccert_store_load64(const uint8_t* p)
+{
+    return
+        ((uint64_t)vccert_store_load32(p) << 32)
+      | (uint64_t)vccert_store_load32(p + 4);
+}
+
+/**
+ * Write a big endian 64-bit value.
+ */
+static inline void vccert_store_store64(uint8_t* p, uint64_t val)
+{
+    for (int i = 7; i >= 0; --i)
+    {
+        p[i] = (uint8_t)val;
+        val >>= 8;
+    }
+}
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_PRIVATE_STORE_INTERNAL_HEADER_GUARD
@@ -0,0 +1,70 @@
+/**
+ * \file vccert_store_at.c
+ *
+ * Get a certificate from a certificate store by position.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "store_internal.h"
+
+/**
+ * \brief Get the certificate at the given position in the store.
+ *
+ * \param store             The store view.
+ * \param index             The position of the certificate.
+ * \param cert              Pointer to receive the certificate.
+ * \param size              Pointer to receive the certificate size.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_STORE_AT_INVALID_ARG if one of the arguments to this
+ *        method is invalid.
+ *      - \ref VCCERT_ERROR_STORE_AT_OUT_OF_RANGE if the position is past the
+ *        end of the store.
+ *      - \ref VCCERT_ERROR_STORE_AT_BAD_FRAME if a loaded index points to a
+ *        frame that does not fit in the store.
+ */
+int vccert_store_at(
+    const vccert_store_t* store, size_t index, const uint8_t** cert,
+    size_t* size)
+{
+    MODEL_ASSERT(store != NULL);
+    MODEL_ASSERT(cert != NULL);
+    MODEL_ASSERT(size != NULL);
+
+    /* parameter sanity check */
+    if (NULL == store || NULL == store->data || NULL == cert || NULL == size)
+    {
+        return VCCERT_ERROR_STORE_AT_INVALID_ARG;
+    }
+
+    if (index >= store->count)
+    {
+        return VCCERT_ERROR_STORE_AT_OUT_OF_RANGE;
+    }
+
+    uint64_t offset =
+        vccert_store_load64(
+            store->offsets + index * VCCERT_STORE_INDEX_ENTRY_SIZE);
+
+    /* a loaded index is trusted no further than the bounds of the store. */
+    if (store->size < VCCERT_STORE_FRAME_HEADER_SIZE
+     || offset > store->size - VCCERT_STORE_FRAME_HEADER_SIZE)
+    {
+        return VCCERT_ERROR_STORE_AT_BAD_FRAME;
+    }
+
+    size_t cert_size = vccert_store_load32(store->data + offset);
+    if (cert_size > store->size - offset - VCCERT_STORE_FRAME_HEADER_SIZE)
+    {
+        return VCCERT_ERROR_STORE_AT_BAD_FRAME;
+    }
+
+    *cert = store->data + offset + VCCERT_STORE_FRAME_HEADER_SIZE;
+    *size = cert_size;
+
+    return VCCERT_STATUS_SUCCESS;
+}
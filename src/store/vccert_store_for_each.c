@@ -0,0 +1,179 @@
+/**
+ * \file vccert_store_for_each.c
+ *
+ * Visit every certificate in a certificate store, in parallel.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "store_internal.h"
+
+/* the number of partitions per worker, so that uneven partitions balance. */
+#define STORE_PARTITIONS_PER_WORKER 4
+
+/**
+ * The outcome of visiting a single partition.
+ */
+typedef struct store_partition_result
+{
+    int status;
+    size_t failed;
+} store_partition_result_t;
+
+/**
+ * The state shared by every worker.
+ */
+typedef struct store_for_each
+{
+    const vccert_store_t* store;
+    vccert_store_visitor_t visitor;
+    void* context;
+    size_t partitions;
+    store_partition_result_t* results;
+} store_for_each_t;
+
+/* forward decls */
+static void store_visit_partition(void* context, size_t index, size_t worker);
+
+/**
+ * \brief Visit every certificate in the store, in parallel.
+ *
+ * The store is split into contiguous partitions, several per worker, and each
+ * partition is visited in order by one worker.  A partition stops at its first
+ * failing visit.  The visitor is called from worker threads and must be safe
+ * to call concurrently.
+ *
+ * \param store             The store view.
+ * \param pool              The thread pool to use, or NULL to visit every
+ *                          certificate on the calling thread.
+ * \param visitor           The visitor to call.
+ * \param context           The user context passed to the visitor.
+ * \param failed            Optional pointer to receive the position of the
+ *                          first certificate that failed, or \ref
+ *                          VCCERT_STORE_NO_CERT.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS if every visit succeeded.
+ *      - \ref VCCERT_ERROR_STORE_FOR_EACH_INVALID_ARG if one of the arguments
+ *        to this method is invalid.
+ *      - \ref VCCERT_ERROR_STORE_FOR_EACH_OUT_OF_MEMORY if the partition table
+ *        could not be allocated.
+ *      - the status of the first failing certificate.
+ */
+int vccert_store_for_each(
+    const vccert_store_t* store, vccert_thread_pool_t* pool,
+    vccert_store_visitor_t visitor, void* context, size_t* failed)
+{
+    int retval;
+    store_for_each_t table;
+
+    MODEL_ASSERT(store != NULL);
+    MODEL_ASSERT(visitor != NULL);
+
+    /* parameter sanity check */
+    if (NULL == store || NULL == store->data || NULL == visitor)
+    {
+        return VCCERT_ERROR_STORE_FOR_EACH_INVALID_ARG;
+    }
+
+    if (NULL != failed)
+    {
+        *failed = VCCERT_STORE_NO_CERT;
+    }
+
+    if (0 == store->count)
+    {
+        return VCCERT_STATUS_SUCCESS;
+    }
+
+    table.store = store;
+    table.visitor = visitor;
+    table.context = context;
+    table.partitions =
+        NULL == pool ? 1 : pool->worker_count * STORE_PARTITIONS_PER_WORKER;
+    if (table.partitions > store->count)
+    {
+        table.partitions = store->count;
+    }
+
+    table.results =
+        (store_partition_result_t*)
+            allocate(
+                store->alloc_opts,
+                table.partitions * sizeof(store_partition_result_t));
+    if (NULL == table.results)
+    {
+        return VCCERT_ERROR_STORE_FOR_EACH_OUT_OF_MEMORY;
+    }
+
+    memset(
+        table.results, 0, table.partitions * sizeof(store_partition_result_t));
+
+    retval =
+        vccert_thread_pool_run(
+            pool, &store_visit_partition, &table, table.partitions);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        goto cleanup_results;
+    }
+
+    /* partitions are in store order, so the first failure is the earliest. */
+    for (size_t i = 0; i < table.partitions; ++i)
+    {
+        if (VCCERT_STATUS_SUCCESS != table.results[i].status)
+        {
+            retval = table.results[i].status;
+            if (NULL != failed)
+            {
+                *failed = table.results[i].failed;
+            }
+
+            break;
+        }
+    }
+
+cleanup_results:
+    release(store->alloc_opts, table.results);
+
+    return retval;
+}
+
+/**
+ * Visit the certificates in one partition, in order, stopping at the first
+ * failure.
+ *
+ * \param context           The shared state.
+ * \param index             The partition to visit.
+ * \param worker            The worker visiting this partition.
+ */
+static void store_visit_partition(void* context, size_t index, size_t worker)
+{
+    store_for_each_t* table = (store_for_each_t*)context;
+    store_partition_result_t* result = &table->results[index];
+    size_t begin, end;
+
+    vccert_store_partition(
+        table->store, index, table->partitions, &begin, &end);
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        const uint8_t* cert;
+        size_t size;
+
+        int retval = vccert_store_at(table->store, i, &cert, &size);
+        if (VCCERT_STATUS_SUCCESS == retval)
+        {
+            retval = table->visitor(table->context, i, cert, size, worker);
+        }
+
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            result->status = retval;
+            result->failed = i;
+            return;
+        }
+    }
+}
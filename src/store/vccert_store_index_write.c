@@ -0,0 +1,76 @@
+/**
+ * \file vccert_store_index_write.c
+ *
+ * Write the offset index of a certificate store.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "store_internal.h"
+
+/**
+ * \brief Write the offset index of a store.
+ *
+ * Call this first with a NULL buffer to get the size of the index.
+ *
+ * \param store             The store view.
+ * \param buffer            The buffer to receive the index, or NULL.
+ * \param size              The size of the buffer.
+ * \param required          Pointer to receive the size of the index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_STORE_INDEX_WRITE_INVALID_ARG if one of the
+ *        arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_STORE_INDEX_WRITE_BUFFER_TOO_SMALL if the buffer is
+ *        too small.
+ */
+int vccert_store_index_write(
+    const vccert_store_t* store, uint8_t* buffer, size_t size,
+    size_t* required)
+{
+    MODEL_ASSERT(store != NULL);
+    MODEL_ASSERT(required != NULL);
+
+    /* parameter sanity check */
+    if (NULL == store || NULL == store->data || NULL == required)
+    {
+        return VCCERT_ERROR_STORE_INDEX_WRITE_INVALID_ARG;
+    }
+
+    size_t offsets_size = store->count * VCCERT_STORE_INDEX_ENTRY_SIZE;
+    *required = VCCERT_STORE_INDEX_HEADER_SIZE + offsets_size;
+
+    /* the caller only wants the size. */
+    if (NULL == buffer)
+    {
+        return VCCERT_STATUS_SUCCESS;
+    }
+
+    if (size < *required)
+    {
+        return VCCERT_ERROR_STORE_INDEX_WRITE_BUFFER_TOO_SMALL;
+    }
+
+    memset(buffer, 0, VCCERT_STORE_INDEX_HEADER_SIZE);
+    memcpy(
+        buffer + VCCERT_STORE_INDEX_OFFSET_MAGIC, VCCERT_STORE_INDEX_MAGIC,
+        strlen(VCCERT_STORE_INDEX_MAGIC));
+    vccert_store_store64(
+        buffer + VCCERT_STORE_INDEX_OFFSET_COUNT, (uint64_t)store->count);
+    vccert_store_store64(
+        buffer + VCCERT_STORE_INDEX_OFFSET_STORE_SIZE, (uint64_t)store->size);
+
+    /* the offsets are already in index order and byte order. */
+    if (offsets_size > 0)
+    {
+        memcpy(
+            buffer + VCCERT_STORE_INDEX_HEADER_SIZE, store->offsets,
+            offsets_size);
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,232 @@
+/**
+ * \file vccert_store_init.c
+ *
+ * Initialize a view of a certificate store.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "store_internal.h"
+
+/* the number of frames for which a built index first has room. */
+#define STORE_INITIAL_CAPACITY 64
+
+/* forward decls */
+static void vccert_store_dispose(void* disposable);
+static int vccert_store_load_index(
+    vccert_store_t* store, const uint8_t* index, size_t index_size);
+static int vccert_store_build_index(vccert_store_t* store);
+
+/**
+ * \brief Initialize a view of a certificate store held in memory.
+ *
+ * If an index is given, it is checked against the store and used as is;
+ * frames are then only checked as they are read.  Otherwise, an offset index
+ * is built by walking every frame.  Neither the store nor the index is copied,
+ * so both must outlive the view.  This view is owned by the caller and must be
+ * disposed of when no longer needed by calling dispose().
+ *
+ * \param store             The store view to initialize.
+ * \param alloc_opts        The allocator options to use for a built index.
+ * \param data              The store file, for example a memory mapping.
+ * \param size              The size of the store file.
+ * \param index             An offset index for this store, or NULL.
+ * \param index_size        The size of the offset index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_STORE_INIT_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_STORE_INIT_OUT_OF_MEMORY if the offset index could
+ *        not be allocated.
+ *      - \ref VCCERT_ERROR_STORE_INIT_TRUNCATED if a frame runs past the end of
+ *        the store.
+ *      - \ref VCCERT_ERROR_STORE_INIT_BAD_INDEX if the index does not belong to
+ *        this store.
+ */
+int vccert_store_init(
+    vccert_store_t* store, allocator_options_t* alloc_opts, const void* data,
+    size_t size, const void* index, size_t index_size)
+{
+    int retval;
+
+    MODEL_ASSERT(store != NULL);
+    MODEL_ASSERT(alloc_opts != NULL);
+    MODEL_ASSERT(data != NULL);
+
+    /* parameter sanity check */
+    if (NULL == store || NULL == alloc_opts || NULL == data)
+    {
+        return VCCERT_ERROR_STORE_INIT_INVALID_ARG;
+    }
+
+    memset(store, 0, sizeof(vccert_store_t));
+    store->alloc_opts = alloc_opts;
+    store->data = (const uint8_t*)data;
+    store->size = size;
+
+    if (NULL != index)
+    {
+        retval =
+            vccert_store_load_index(store, (const uint8_t*)index, index_size);
+    }
+    else
+    {
+        retval = vccert_store_build_index(store);
+    }
+
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        memset(store, 0, sizeof(vccert_store_t));
+        return retval;
+    }
+
+    store->hdr.dispose = &vccert_store_dispose;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Use an offset index written for this store.
+ *
+ * \param store             The store view.
+ * \param index             The offset index.
+ * \param index_size        The size of the offset index.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int vccert_store_load_index(
+    vccert_store_t* store, const uint8_t* index, size_t index_size)
+{
+    if (index_size < VCCERT_STORE_INDEX_HEADER_SIZE
+     || memcmp(
+            index + VCCERT_STORE_INDEX_OFFSET_MAGIC, VCCERT_STORE_INDEX_MAGIC,
+            strlen(VCCERT_STORE_INDEX_MAGIC))
+     || 0 != vccert_store_load32(index + VCCERT_STORE_INDEX_OFFSET_RESERVED)
+     || store->size !=
+            vccert_store_load64(index + VCCERT_STORE_INDEX_OFFSET_STORE_SIZE))
+    {
+        return VCCERT_ERROR_STORE_INIT_BAD_INDEX;
+    }
+
+    /* the offsets must exactly fill the rest of the index. */
+    uint64_t count =
+        vccert_store_load64(index + VCCERT_STORE_INDEX_OFFSET_COUNT);
+    if (count
+            != (index_size - VCCERT_STORE_INDEX_HEADER_SIZE)
+                    / VCCERT_STORE_INDEX_ENTRY_SIZE
+     || 0 !=
+            (index_size - VCCERT_STORE_INDEX_HEADER_SIZE)
+                    % VCCERT_STORE_INDEX_ENTRY_SIZE)
+    {
+        return VCCERT_ERROR_STORE_INIT_BAD_INDEX;
+    }
+
+    store->count = (size_t)count;
+    store->offsets = index + VCCERT_STORE_INDEX_HEADER_SIZE;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Build an offset index by walking every frame in the store.
+ *
+ * \param store             The store view.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int vccert_store_build_index(vccert_store_t* store)
+{
+    size_t offset = 0;
+
+    while (offset < store->size)
+    {
+        /* the frame header and certificate must both fit. */
+        if (store->size - offset < VCCERT_STORE_FRAME_HEADER_SIZE)
+        {
+            goto truncated;
+        }
+
+        size_t cert_size = vccert_store_load32(store->data + offset);
+        if (cert_size
+                > store->size - offset - VCCERT_STORE_FRAME_HEADER_SIZE)
+        {
+            goto truncated;
+        }
+
+        /* grow the offset table. */
+        size_t needed = (store->count + 1) * VCCERT_STORE_INDEX_ENTRY_SIZE;
+        if (needed > store->capacity)
+        {
+            size_t capacity =
+                0 == store->capacity
+                    ? STORE_INITIAL_CAPACITY * VCCERT_STORE_INDEX_ENTRY_SIZE
+                    : 2 * store->capacity;
+
+            uint8_t* offsets =
+                NULL == store->built_offsets
+                    ? (uint8_t*)allocate(store->alloc_opts, capacity)
+                    : (uint8_t*)reallocate(
+                            store->alloc_opts, store->built_offsets,
+                            store->capacity, capacity);
+            if (NULL == offsets)
+            {
+                if (NULL != store->built_offsets)
+                {
+                    release(store->alloc_opts, store->built_offsets);
+                }
+
+                return VCCERT_ERROR_STORE_INIT_OUT_OF_MEMORY;
+            }
+
+            store->built_offsets = offsets;
+            store->capacity = capacity;
+        }
+
+        vccert_store_store64(
+            store->built_offsets + store->count * VCCERT_STORE_INDEX_ENTRY_SIZE,
+            (uint64_t)offset);
+        ++store->count;
+
+        offset += VCCERT_STORE_FRAME_HEADER_SIZE + cert_size;
+    }
+
+    store->offsets = store->built_offsets;
+
+    return VCCERT_STATUS_SUCCESS;
+
+truncated:
+    if (NULL != store->built_offsets)
+    {
+        release(store->alloc_opts, store->built_offsets);
+    }
+
+    return VCCERT_ERROR_STORE_INIT_TRUNCATED;
+}
+
+/**
+ * Dispose of a certificate store view.
+ *
+ * \param disposable        The store view to dispose.
+ */
+static void vccert_store_dispose(void* disposable)
+{
+    vccert_store_t* store = (vccert_store_t*)disposable;
+
+    MODEL_ASSERT(store != NULL);
+
+    if (NULL != store->built_offsets)
+    {
+        release(store->alloc_opts, store->built_offsets);
+    }
+
+    if (store->mapped_data || store->mapped_index)
+    {
+        vccert_store_unmap(store);
+    }
+
+    memset(store, 0, sizeof(vccert_store_t));
+}
@@ -0,0 +1,171 @@
+/**
+ * \file vccert_store_open.c
+ *
+ * Open a certificate store file by mapping it into memory.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+
+#include "store_internal.h"
+
+#ifdef VCCERT_STORE_MMAP
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+
+/* forward decls */
+static int vccert_store_map(
+    const char* path, const uint8_t** data, size_t* size, bool* mapped);
+#endif  //VCCERT_STORE_MMAP
+
+/**
+ * \brief Open a certificate store file by mapping it into memory.
+ *
+ * The store file, and the index file if one is given, are mapped read-only
+ * and stay mapped until the store is disposed.  This is only available on
+ * hosted POSIX builds.
+ *
+ * \param store             The store view to initialize.
+ * \param alloc_opts        The allocator options to use for a built index.
+ * \param path              The path of the store file.
+ * \param index_path        The path of an offset index file, or NULL to build
+ *                          the index.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_STORE_OPEN_INVALID_ARG if one of the arguments to
+ *        this method is invalid.
+ *      - \ref VCCERT_ERROR_STORE_OPEN_UNSUPPORTED if files cannot be mapped on
+ *        this platform.
+ *      - \ref VCCERT_ERROR_STORE_OPEN_FAILED if a file could not be opened or
+ *        mapped.
+ *      - a status code from vccert_store_init().
+ */
+int vccert_store_open(
+    vccert_store_t* store, allocator_options_t* alloc_opts, const char* path,
+    const char* index_path)
+{
+    MODEL_ASSERT(store != NULL);
+    MODEL_ASSERT(alloc_opts != NULL);
+    MODEL_ASSERT(path != NULL);
+
+    /* parameter sanity check */
+    if (NULL == store || NULL == alloc_opts || NULL == path)
+    {
+        return VCCERT_ERROR_STORE_OPEN_INVALID_ARG;
+    }
+
+#ifdef VCCERT_STORE_MMAP
+    int retval;
+    const uint8_t* data;
+    const uint8_t* index = NULL;
+    size_t size, index_size = 0;
+    bool mapped_data, mapped_index = false;
+
+    retval = vccert_store_map(path, &data, &size, &mapped_data);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (NULL != index_path)
+    {
+        retval =
+            vccert_store_map(index_path, &index, &index_size, &mapped_index);
+        if (VCCERT_STATUS_SUCCESS != retval)
+        {
+            goto unmap_data;
+        }
+    }
+
+    retval =
+        vccert_store_init(store, alloc_opts, data, size, index, index_size);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        goto unmap_index;
+    }
+
+    /* the store now owns the mappings. */
+    store->mapped_data = mapped_data;
+    store->mapped_index = mapped_index;
+
+    return VCCERT_STATUS_SUCCESS;
+
+unmap_index:
+    if (mapped_index)
+    {
+        munmap((void*)index, index_size);
+    }
+
+unmap_data:
+    if (mapped_data)
+    {
+        munmap((void*)data, size);
+    }
+
+    return retval;
+#else
+    /* there are no files to map on this platform. */
+    (void)index_path;
+
+    return VCCERT_ERROR_STORE_OPEN_UNSUPPORTED;
+#endif  //VCCERT_STORE_MMAP
+}
+
+#ifdef VCCERT_STORE_MMAP
+/**
+ * Map a file read-only.  An empty file cannot be mapped, so it is returned as
+ * an empty, unmapped buffer.
+ *
+ * \param path              The path of the file.
+ * \param data              Pointer to receive the file contents.
+ * \param size              Pointer to receive the file size.
+ * \param mapped            Pointer to receive whether the file was mapped.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static int vccert_store_map(
+    const char* path, const uint8_t** data, size_t* size, bool* mapped)
+{
+    int retval = VCCERT_ERROR_STORE_OPEN_FAILED;
+    struct stat st;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return VCCERT_ERROR_STORE_OPEN_FAILED;
+    }
+
+    if (0 != fstat(fd, &st) || st.st_size < 0
+     || (uint64_t)st.st_size > (uint64_t)SIZE_MAX)
+    {
+        goto close_fd;
+    }
+
+    *size = (size_t)st.st_size;
+    *mapped = *size > 0;
+    *data = (const uint8_t*)"";
+
+    if (*mapped)
+    {
+        void* map = mmap(NULL, *size, PROT_READ, MAP_SHARED, fd, 0);
+        if (MAP_FAILED == map)
+        {
+            goto close_fd;
+        }
+
+        *data = (const uint8_t*)map;
+    }
+
+    retval = VCCERT_STATUS_SUCCESS;
+
+close_fd:
+    close(fd);
+
+    return retval;
+}
+#endif  //VCCERT_STORE_MMAP
@@ -0,0 +1,48 @@
+/**
+ * \file vccert_store_parser_init.c
+ *
+ * Initialize a parser for a certificate in a certificate store.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "store_internal.h"
+
+/**
+ * \brief Initialize a parser context for the certificate at the given
+ * position in the store.
+ *
+ * The certificate bytes are not copied.  This parser context is owned by the
+ * caller and must be disposed of when no longer needed by calling dispose().
+ *
+ * \param store             The store view.
+ * \param options           The parser options to use.
+ * \param parser            The parser context to initialize.
+ * \param index             The position of the certificate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - a status code from vccert_store_at() or vccert_parser_init().
+ */
+int vccert_store_parser_init(
+    const vccert_store_t* store, vccert_parser_options_t* options,
+    vccert_parser_context_t* parser, size_t index)
+{
+    int retval;
+    const uint8_t* cert;
+    size_t size;
+
+    MODEL_ASSERT(store != NULL);
+    MODEL_ASSERT(options != NULL);
+    MODEL_ASSERT(parser != NULL);
+
+    retval = vccert_store_at(store, index, &cert, &size);
+    if (VCCERT_STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return vccert_parser_init(options, parser, cert, size);
+}
@@ -0,0 +1,38 @@
+/**
+ * \file vccert_store_partition.c
+ *
+ * Split a certificate store into contiguous partitions.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "store_internal.h"
+
+/**
+ * \brief Get the range of positions in one of several equal partitions of a
+ * store, for callers that spread the store over their own threads.
+ *
+ * \param store             The store view.
+ * \param partition         The partition, from 0 up to partitions.
+ * \param partitions        The number of partitions.
+ * \param begin             Pointer to receive the first position.
+ * \param end               Pointer to receive one past the last position.
+ */
+void vccert_store_partition(
+    const vccert_store_t* store, size_t partition, size_t partitions,
+    size_t* begin, size_t* end)
+{
+    MODEL_ASSERT(store != NULL);
+    MODEL_ASSERT(partition < partitions);
+    MODEL_ASSERT(begin != NULL);
+    MODEL_ASSERT(end != NULL);
+
+    /* the first count % partitions partitions take one extra position. */
+    size_t share = store->count / partitions;
+    size_t extra = store->count % partitions;
+
+    *begin = partition * share + (partition < extra ? partition : extra);
+    *end = *begin + share + (partition < extra ? 1 : 0);
+}
@@ -0,0 +1,46 @@
+/**
+ * \file vccert_store_unmap.c
+ *
+ * Unmap the files mapped by vccert_store_open().
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+
+#include "store_internal.h"
+
+#ifdef VCCERT_STORE_MMAP
+# include <sys/mman.h>
+#endif  //VCCERT_STORE_MMAP
+
+/**
+ * Unmap the files mapped by vccert_store_open().
+ *
+ * \param store         The store whose files should be unmapped.
+ */
+void vccert_store_unmap(vccert_store_t* store)
+{
+    MODEL_ASSERT(store != NULL);
+
+#ifdef VCCERT_STORE_MMAP
+    if (store->mapped_data)
+    {
+        munmap((void*)store->data, store->size);
+        store->mapped_data = false;
+    }
+
+    /* a mapped index starts with its header. */
+    if (store->mapped_index)
+    {
+        munmap(
+            (void*)(store->offsets - VCCERT_STORE_INDEX_HEADER_SIZE),
+            VCCERT_STORE_INDEX_HEADER_SIZE
+                + store->count * VCCERT_STORE_INDEX_ENTRY_SIZE);
+        store->mapped_index = false;
+    }
+#else
+    /* nothing is ever mapped on this platform. */
+    (void)store;
+#endif  //VCCERT_STORE_MMAP
+}
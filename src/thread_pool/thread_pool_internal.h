@@ -0,0 +1,155 @@
+/**
+ * \file thread_pool_internal.h
+ *
+ * Internal state and helpers for the thread pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#ifndef VCCERT_PRIVATE_THREAD_POOL_INTERNAL_HEADER_GUARD
+#define VCCERT_PRIVATE_THREAD_POOL_INTERNAL_HEADER_GUARD
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <vccert/error_codes.h>
+#include <vccert/thread_pool.h>
+#include <vpr/allocator.h>
+#include <vpr/disposable.h>
+
+/* Worker threads are only available on hosted POSIX builds. */
+#if __STDC_HOSTED__ && !defined(__EMSCRIPTEN__) \
+ && (defined(__unix__) || defined(__APPLE__))
+# define VCCERT_THREAD_POOL_PTHREADS 1
+# include <pthread.h>
+#endif
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+extern "C" {
+#endif  //__cplusplus
+
+/**
+ * A single slot in a bounded queue.
+ */
+typedef struct vccert_queue_cell
+{
+    size_t sequence;
+    size_t value;
+} vccert_queue_cell_t;
+
+/**
+ * A bounded, lock-free, multi-producer / multi-consumer queue of size_t
+ * values, used to connect the stages of a pipeline.  Each cell carries a
+ * sequence number that tells producers and consumers whether it is free or
+ * full for the current lap, so neither side ever takes a lock.
+ */
+typedef struct vccert_queue
+{
+    disposable_t hdr;
+    allocator_options_t* alloc_opts;
+    vccert_queue_cell_t* cells;
+    size_t mask;
+    size_t enqueue_pos;
+    size_t dequeue_pos;
+} vccert_queue_t;
+
+/**
+ * Initialize a bounded queue holding at least the given number of values.
+ *
+ * \param queue         The queue to initialize.
+ * \param alloc_opts    The allocator options to use.
+ * \param capacity      The minimum capacity; rounded up to a power of two.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_THREAD_POOL_QUEUE_INIT_OUT_OF_MEMORY if the queue
+ *        could not be allocated.
+ */
+int vccert_queue_init(
+    vccert_queue_t* queue, allocator_options_t* alloc_opts, size_t capacity);
+
+/**
+ * Push a value onto a bounded queue.
+ *
+ * \param queue         The queue.
+ * \param value         The value to push.
+ *
+ * \returns true if the value was pushed, or false if the queue is full.
+ */
+bool vccert_queue_push(vccert_queue_t* queue, size_t value);
+
+/**
+ * Pop a value from a bounded queue.
+ *
+ * \param queue         The queue.
+ * \param value         Pointer to receive the value.
+ *
+ * \returns true if a value was popped, or false if the queue is empty.
+ */
+bool vccert_queue_pop(vccert_queue_t* queue, size_t* value);
+
+/**
+ * Give up the processor while waiting for another worker to make progress.
+ */
+void vccert_thread_pool_yield(void);
+
+#ifdef VCCERT_THREAD_POOL_PTHREADS
+
+struct vccert_thread_pool_shared;
+
+/**
+ * A single worker thread and its id.
+ */
+typedef struct vccert_thread_pool_worker
+{
+    pthread_t thread;
+    struct vccert_thread_pool_shared* shared;
+    size_t id;
+} vccert_thread_pool_worker_t;
+
+/**
+ * State shared between the caller of vccert_thread_pool_run() and the worker
+ * threads.  Everything except next is guarded by lock.
+ */
+typedef struct vccert_thread_pool_shared
+{
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    vccert_thread_pool_worker_t* workers;
+    size_t thread_count;
+    bool shutdown;
+    uint64_t generation;
+    size_t active;
+    vccert_thread_pool_task_t task;
+    void* context;
+    size_t count;
+    size_t next;
+} vccert_thread_pool_shared_t;
+
+/**
+ * Claim and run items from the current run until none remain.
+ *
+ * \param shared        The shared pool state.
+ * \param worker        The id of the calling worker.
+ */
+void vccert_thread_pool_drain(
+    vccert_thread_pool_shared_t* shared, size_t worker);
+
+/**
+ * Entry point for each worker thread.
+ *
+ * \param worker        The vccert_thread_pool_worker_t for this thread.
+ *
+ * \returns NULL.
+ */
+void* vccert_thread_pool_worker(void* worker);
+
+#endif  //VCCERT_THREAD_POOL_PTHREADS
+
+/* make this header C++ friendly. */
+#ifdef __cplusplus
+}
+#endif  //__cplusplus
+
+#endif  //VCCERT_PRIVATE_THREAD_POOL_INTERNAL_HEADER_GUARD
@@ -0,0 +1,77 @@
+/**
+ * \file vccert_queue_init.c
+ *
+ * Initialize a bounded lock-free queue.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "thread_pool_internal.h"
+
+/* forward decls */
+static void vccert_queue_dispose(void* queue);
+
+/**
+ * Initialize a bounded queue holding at least the given number of values.
+ *
+ * \param queue         The queue to initialize.
+ * \param alloc_opts    The allocator options to use.
+ * \param capacity      The minimum capacity; rounded up to a power of two.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_THREAD_POOL_QUEUE_INIT_OUT_OF_MEMORY if the queue
+ *        could not be allocated.
+ */
+int vccert_queue_init(
+    vccert_queue_t* queue, allocator_options_t* alloc_opts, size_t capacity)
+{
+    size_t size = 2;
+
+    MODEL_ASSERT(queue != NULL);
+    MODEL_ASSERT(alloc_opts != NULL);
+
+    while (size < capacity)
+    {
+        size *= 2;
+    }
+
+    memset(queue, 0, sizeof(vccert_queue_t));
+
+    queue->cells = (vccert_queue_cell_t*)
+        allocate(alloc_opts, size * sizeof(vccert_queue_cell_t));
+    if (NULL == queue->cells)
+    {
+        return VCCERT_ERROR_THREAD_POOL_QUEUE_INIT_OUT_OF_MEMORY;
+    }
+
+    /* each cell starts out free for the first lap. */
+    for (size_t i = 0; i < size; ++i)
+    {
+        queue->cells[i].sequence = i;
+    }
+
+    queue->hdr.dispose = &vccert_queue_dispose;
+    queue->alloc_opts = alloc_opts;
+    queue->mask = size - 1;
+
+    return VCCERT_STATUS_SUCCESS;
+}
+
+/**
+ * Dispose of a bounded queue.
+ *
+ * \param queue         The queue to dispose.
+ */
+static void vccert_queue_dispose(void* queue)
+{
+    vccert_queue_t* q = (vccert_queue_t*)queue;
+
+    release(q->alloc_opts, q->cells);
+
+    memset(q, 0, sizeof(vccert_queue_t));
+}
@@ -0,0 +1,63 @@
+/**
+ * \file vccert_queue_pop.c
+ *
+ * Pop a value from a bounded lock-free queue.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "thread_pool_internal.h"
+
+/**
+ * Pop a value from a bounded queue.
+ *
+ * \param queue         The queue.
+ * \param value         Pointer to receive the value.
+ *
+ * \returns true if a value was popped, or false if the queue is empty.
+ */
+bool vccert_queue_pop(vccert_queue_t* queue, size_t* value)
+{
+    vccert_queue_cell_t* cell;
+    size_t pos = __atomic_load_n(&queue->dequeue_pos, __ATOMIC_RELAXED);
+
+    MODEL_ASSERT(queue != NULL);
+    MODEL_ASSERT(value != NULL);
+
+    for (;;)
+    {
+        cell = &queue->cells[pos & queue->mask];
+
+        size_t seq = __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (0 == diff)
+        {
+            /* the cell is full for this lap; try to claim it. */
+            if (__atomic_compare_exchange_n(
+                    &queue->dequeue_pos, &pos, pos + 1, true,
+                    __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            /* nothing has been pushed into this cell yet. */
+            return false;
+        }
+        else
+        {
+            pos = __atomic_load_n(&queue->dequeue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    *value = cell->value;
+    __atomic_store_n(
+        &cell->sequence, pos + queue->mask + 1, __ATOMIC_RELEASE);
+
+    return true;
+}
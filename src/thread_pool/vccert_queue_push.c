@@ -0,0 +1,61 @@
+/**
+ * \file vccert_queue_push.c
+ *
+ * Push a value onto a bounded lock-free queue.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "thread_pool_internal.h"
+
+/**
+ * Push a value onto a bounded queue.
+ *
+ * \param queue         The queue.
+ * \param value         The value to push.
+ *
+ * \returns true if the value was pushed, or false if the queue is full.
+ */
+bool vccert_queue_push(vccert_queue_t* queue, size_t value)
+{
+    vccert_queue_cell_t* cell;
+    size_t pos = __atomic_load_n(&queue->enqueue_pos, __ATOMIC_RELAXED);
+
+    MODEL_ASSERT(queue != NULL);
+
+    for (;;)
+    {
+        cell = &queue->cells[pos & queue->mask];
+
+        size_t seq = __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (0 == diff)
+        {
+            /* the cell is free for this lap; try to claim it. */
+            if (__atomic_compare_exchange_n(
+                    &queue->enqueue_pos, &pos, pos + 1, true,
+                    __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            /* the cell still holds a value from the previous lap. */
+            return false;
+        }
+        else
+        {
+            pos = __atomic_load_n(&queue->enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    cell->value = value;
+    __atomic_store_n(&cell->sequence, pos + 1, __ATOMIC_RELEASE);
+
+    return true;
+}
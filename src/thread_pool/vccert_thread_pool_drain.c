@@ -0,0 +1,38 @@
+/**
+ * \file vccert_thread_pool_drain.c
+ *
+ * Claim and run work items from the current thread pool run.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "thread_pool_internal.h"
+
+#ifdef VCCERT_THREAD_POOL_PTHREADS
+
+/**
+ * Claim and run items from the current run until none remain.
+ *
+ * The task, context, and count are published under the pool lock before any
+ * worker is woken, so only the item counter needs to be atomic here.
+ *
+ * \param shared        The shared pool state.
+ * \param worker        The id of the calling worker.
+ */
+void vccert_thread_pool_drain(
+    vccert_thread_pool_shared_t* shared, size_t worker)
+{
+    for (;;)
+    {
+        size_t index =
+            __atomic_fetch_add(&shared->next, 1, __ATOMIC_RELAXED);
+        if (index >= shared->count)
+        {
+            return;
+        }
+
+        shared->task(shared->context, index, worker);
+    }
+}
+
+#endif  //VCCERT_THREAD_POOL_PTHREADS
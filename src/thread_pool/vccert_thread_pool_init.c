@@ -0,0 +1,176 @@
+/**
+ * \file vccert_thread_pool_init.c
+ *
+ * Initialize a thread pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <string.h>
+#include <vpr/parameters.h>
+
+#include "thread_pool_internal.h"
+
+/* forward decls */
+static void vccert_thread_pool_dispose(void* pool);
+
+/**
+ * \brief Initialize a thread pool with the given number of workers.
+ *
+ * The calling thread counts as a worker, so worker_count - 1 threads are
+ * started.  On platforms without thread support, the worker count is always
+ * 1.  This pool is owned by the caller and must be disposed of when no longer
+ * needed by calling dispose().
+ *
+ * \param pool              The thread pool to initialize.
+ * \param alloc_opts        The allocator options to use.
+ * \param worker_count      The number of workers; must be at least 1.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_THREAD_POOL_INIT_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ *      - \ref VCCERT_ERROR_THREAD_POOL_INIT_OUT_OF_MEMORY if the pool could
+ *             not be allocated.
+ *      - \ref VCCERT_ERROR_THREAD_POOL_INIT_THREAD_CREATE if a worker thread
+ *             could not be started.
+ */
+int vccert_thread_pool_init(
+    vccert_thread_pool_t* pool, allocator_options_t* alloc_opts,
+    size_t worker_count)
+{
+    MODEL_ASSERT(pool != NULL);
+    MODEL_ASSERT(alloc_opts != NULL);
+    MODEL_ASSERT(worker_count > 0);
+
+    /* parameter sanity check */
+    if (pool == NULL || alloc_opts == NULL || worker_count == 0)
+    {
+        return VCCERT_ERROR_THREAD_POOL_INIT_INVALID_ARG;
+    }
+
+    memset(pool, 0, sizeof(vccert_thread_pool_t));
+    pool->hdr.dispose = &vccert_thread_pool_dispose;
+    pool->alloc_opts = alloc_opts;
+    pool->worker_count = 1;
+
+#ifdef VCCERT_THREAD_POOL_PTHREADS
+    int retval;
+    size_t i;
+
+    /* the calling thread is worker 0. */
+    if (worker_count == 1)
+    {
+        return VCCERT_STATUS_SUCCESS;
+    }
+
+    vccert_thread_pool_shared_t* shared = (vccert_thread_pool_shared_t*)
+        allocate(alloc_opts, sizeof(vccert_thread_pool_shared_t));
+    if (NULL == shared)
+    {
+        retval = VCCERT_ERROR_THREAD_POOL_INIT_OUT_OF_MEMORY;
+        goto fail;
+    }
+
+    memset(shared, 0, sizeof(vccert_thread_pool_shared_t));
+    shared->thread_count = worker_count - 1;
+
+    shared->workers = (vccert_thread_pool_worker_t*)
+        allocate(alloc_opts,
+            shared->thread_count * sizeof(vccert_thread_pool_worker_t));
+    if (NULL == shared->workers)
+    {
+        retval = VCCERT_ERROR_THREAD_POOL_INIT_OUT_OF_MEMORY;
+        goto release_shared;
+    }
+
+    pthread_mutex_init(&shared->lock, NULL);
+    pthread_cond_init(&shared->start, NULL);
+    pthread_cond_init(&shared->done, NULL);
+
+    for (i = 0; i < shared->thread_count; ++i)
+    {
+        shared->workers[i].shared = shared;
+        shared->workers[i].id = i + 1;
+
+        if (0 != pthread_create(
+                    &shared->workers[i].thread, NULL,
+                    &vccert_thread_pool_worker, &shared->workers[i]))
+        {
+            retval = VCCERT_ERROR_THREAD_POOL_INIT_THREAD_CREATE;
+            goto stop_workers;
+        }
+    }
+
+    pool->impl = shared;
+    pool->worker_count = worker_count;
+
+    /* success */
+    return VCCERT_STATUS_SUCCESS;
+
+stop_workers:
+    pthread_mutex_lock(&shared->lock);
+    shared->shutdown = true;
+    pthread_cond_broadcast(&shared->start);
+    pthread_mutex_unlock(&shared->lock);
+
+    while (i > 0)
+    {
+        --i;
+        pthread_join(shared->workers[i].thread, NULL);
+    }
+
+    pthread_cond_destroy(&shared->done);
+    pthread_cond_destroy(&shared->start);
+    pthread_mutex_destroy(&shared->lock);
+    release(alloc_opts, shared->workers);
+
+release_shared:
+    release(alloc_opts, shared);
+
+fail:
+    memset(pool, 0, sizeof(vccert_thread_pool_t));
+
+    return retval;
+#else
+    /* no threads on this platform; every run happens on the caller. */
+    return VCCERT_STATUS_SUCCESS;
+#endif  //VCCERT_THREAD_POOL_PTHREADS
+}
+
+/**
+ * Dispose of a thread pool, stopping and joining its worker threads.
+ *
+ * \param pool          The thread pool to dispose.
+ */
+static void vccert_thread_pool_dispose(void* pool)
+{
+    vccert_thread_pool_t* p = (vccert_thread_pool_t*)pool;
+
+#ifdef VCCERT_THREAD_POOL_PTHREADS
+    vccert_thread_pool_shared_t* shared =
+        (vccert_thread_pool_shared_t*)p->impl;
+
+    if (NULL != shared)
+    {
+        pthread_mutex_lock(&shared->lock);
+        shared->shutdown = true;
+        pthread_cond_broadcast(&shared->start);
+        pthread_mutex_unlock(&shared->lock);
+
+        for (size_t i = 0; i < shared->thread_count; ++i)
+        {
+            pthread_join(shared->workers[i].thread, NULL);
+        }
+
+        pthread_cond_destroy(&shared->done);
+        pthread_cond_destroy(&shared->start);
+        pthread_mutex_destroy(&shared->lock);
+        release(p->alloc_opts, shared->workers);
+        release(p->alloc_opts, shared);
+    }
+#endif  //VCCERT_THREAD_POOL_PTHREADS
+
+    memset(p, 0, sizeof(vccert_thread_pool_t));
+}
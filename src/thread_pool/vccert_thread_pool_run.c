@@ -0,0 +1,84 @@
+/**
+ * \file vccert_thread_pool_run.c
+ *
+ * Run a task across a thread pool.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include <cbmc/model_assert.h>
+#include <vpr/parameters.h>
+
+#include "thread_pool_internal.h"
+
+/**
+ * \brief Run a task for every index in [0, count) and wait for all of them to
+ * complete.
+ *
+ * Items are handed out dynamically, so the order in which indices run is
+ * unspecified.  The calling thread participates as worker 0.  A pool must
+ * only be run by one thread at a time.  If pool is NULL, every item is run on
+ * the calling thread.
+ *
+ * \param pool              The thread pool to use, or NULL.
+ * \param task              The task to run.
+ * \param context           The user context passed to each task.
+ * \param count             The number of items to process.
+ *
+ * \returns a status code indicating success or failure.
+ *      - \ref VCCERT_STATUS_SUCCESS on success.
+ *      - \ref VCCERT_ERROR_THREAD_POOL_RUN_INVALID_ARG if one of the
+ *             arguments to this method is invalid.
+ */
+int vccert_thread_pool_run(
+    vccert_thread_pool_t* pool, vccert_thread_pool_task_t task,
+    void* context, size_t count)
+{
+    MODEL_ASSERT(task != NULL);
+
+    /* parameter sanity check */
+    if (task == NULL)
+    {
+        return VCCERT_ERROR_THREAD_POOL_RUN_INVALID_ARG;
+    }
+
+#ifdef VCCERT_THREAD_POOL_PTHREADS
+    vccert_thread_pool_shared_t* shared =
+        (NULL == pool) ? NULL : (vccert_thread_pool_shared_t*)pool->impl;
+
+    /* only wake the workers if there is more than one item to share. */
+    if (NULL != shared && count > 1)
+    {
+        pthread_mutex_lock(&shared->lock);
+        shared->task = task;
+        shared->context = context;
+        shared->count = count;
+        shared->next = 0;
+        shared->active = shared->thread_count;
+        ++shared->generation;
+        pthread_cond_broadcast(&shared->start);
+        pthread_mutex_unlock(&shared->lock);
+
+        vccert_thread_pool_drain(shared, 0);
+
+        pthread_mutex_lock(&shared->lock);
+        while (shared->active > 0)
+        {
+            pthread_cond_wait(&shared->done, &shared->lock);
+        }
+        pthread_mutex_unlock(&shared->lock);
+
+        return VCCERT_STATUS_SUCCESS;
+    }
+#else
+    (void)pool;
+#endif  //VCCERT_THREAD_POOL_PTHREADS
+
+    /* run everything on the calling thread. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        task(context, i, 0);
+    }
+
+    return VCCERT_STATUS_SUCCESS;
+}
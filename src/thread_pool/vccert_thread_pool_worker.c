@@ -0,0 +1,59 @@
+/**
+ * \file vccert_thread_pool_worker.c
+ *
+ * The main loop of a thread pool worker thread.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "thread_pool_internal.h"
+
+#ifdef VCCERT_THREAD_POOL_PTHREADS
+
+/**
+ * Entry point for each worker thread.
+ *
+ * The worker sleeps until a new run generation is published, drains the run,
+ * and then reports completion, until the pool is shut down.
+ *
+ * \param worker        The vccert_thread_pool_worker_t for this thread.
+ *
+ * \returns NULL.
+ */
+void* vccert_thread_pool_worker(void* worker)
+{
+    vccert_thread_pool_worker_t* w = (vccert_thread_pool_worker_t*)worker;
+    vccert_thread_pool_shared_t* shared = w->shared;
+
+    /* generations start at 0, so a late starting thread still joins the
+     * first run. */
+    uint64_t seen = 0;
+
+    pthread_mutex_lock(&shared->lock);
+
+    while (!shared->shutdown)
+    {
+        if (seen == shared->generation)
+        {
+            pthread_cond_wait(&shared->start, &shared->lock);
+            continue;
+        }
+
+        seen = shared->generation;
+
+        pthread_mutex_unlock(&shared->lock);
+        vccert_thread_pool_drain(shared, w->id);
+        pthread_mutex_lock(&shared->lock);
+
+        if (0 == --shared->active)
+        {
+            pthread_cond_signal(&shared->done);
+        }
+    }
+
+    pthread_mutex_unlock(&shared->lock);
+
+    return NULL;
+}
+
+#endif  //VCCERT_THREAD_POOL_PTHREADS
@@ -0,0 +1,23 @@
+/**
+ * \file vccert_thread_pool_yield.c
+ *
+ * Yield the processor while waiting on another worker.
+ *
+ * \copyright 2026 Velo Payments, Inc.  All rights reserved.
+ */
+
+#include "thread_pool_internal.h"
+
+#ifdef VCCERT_THREAD_POOL_PTHREADS
+# include <sched.h>
+#endif
+
+/**
+ * Give up the processor while waiting for another worker to make progress.
+ */
+void vccert_thread_pool_yield(void)
+{
+#ifdef VCCERT_THREAD_POOL_PTHREADS
+    sched_yield();
+#endif
+}
@@ -0,0 +1,313 @@
+/**
+ * \file test_vccert_artifact_state_table.cpp
+ *
+ * Test the artifact state table.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccert/artifact_state.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+class vccert_artifact_state_table_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        options_init_result =
+            vccert_parser_options_simple_init(
+                &options, &alloc_opts, &crypto_suite);
+
+        table_init_result =
+            vccert_artifact_state_table_init(&table, &alloc_opts);
+    }
+
+    void tearDown()
+    {
+        if (table_init_result == 0)
+        {
+            dispose((disposable_t*)&table);
+        }
+
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Apply a certificate moving an artifact to a new state.
+     */
+    int apply(
+        uint16_t artifact, uint8_t txn, uint16_t state, uint64_t height)
+    {
+        int retval;
+        vccert_builder_context_t builder;
+        vccert_parser_context_t parser;
+        uint8_t artifact_id[16], txn_id[16];
+        size_t size;
+
+        make_id(artifact_id, artifact);
+        make_id(txn_id, txn);
+
+        retval = vccert_builder_init(&builder_opts, &builder, 128);
+        if (0 != retval)
+            return retval;
+
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_CERTIFICATE_ID, txn_id);
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_ARTIFACT_ID, artifact_id);
+        vccert_builder_add_short_uint16(
+            &builder, VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE, state);
+
+        const uint8_t* cert = vccert_builder_emit(&builder, &size);
+        retval = vccert_parser_init(&options, &parser, cert, size);
+        if (0 == retval)
+        {
+            retval = vccert_artifact_state_table_apply(&table, &parser, height);
+            dispose((disposable_t*)&parser);
+        }
+
+        dispose((disposable_t*)&builder);
+
+        return retval;
+    }
+
+    static void make_id(uint8_t* id, uint16_t value)
+    {
+        memset(id, 0, 16);
+        id[14] = (uint8_t)(value >> 8);
+        id[15] = (uint8_t)value;
+    }
+
+    int suite_init_result, builder_opts_init_result, options_init_result;
+    int table_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t options;
+    vccert_artifact_state_table_t table;
+};
+
+TEST_SUITE(vccert_artifact_state_table_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_artifact_state_table_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that snapshots see the state as of their height.
+ */
+BEGIN_TEST_F(snapshot_history)
+    vccert_artifact_state_snapshot_t snapshot;
+    uint8_t artifact_id[16], txn_id[16], expected_txn[16];
+    int32_t state;
+
+    TEST_ASSERT(0 == fixture.table_init_result);
+    TEST_ASSERT(0 == fixture.apply(1, 10, 1, 5));
+    TEST_ASSERT(0 == fixture.apply(1, 11, 2, 7));
+    TEST_ASSERT(0 == fixture.apply(1, 12, 3, 7));
+    TEST_ASSERT(0 == fixture.apply(2, 13, 9, 8));
+
+    fixture.make_id(artifact_id, 1);
+
+    /* before the artifact was created. */
+    vccert_artifact_state_table_snapshot(&snapshot, &fixture.table, 4);
+    TEST_EXPECT(
+        VCCERT_ERROR_ARTIFACT_STATE_SNAPSHOT_FIND_NOT_FOUND
+            == vccert_artifact_state_snapshot_find(
+                    &snapshot, artifact_id, &state, txn_id));
+
+    vccert_artifact_state_table_snapshot(&snapshot, &fixture.table, 6);
+    TEST_ASSERT(
+        0
+            == vccert_artifact_state_snapshot_find(
+                    &snapshot, artifact_id, &state, txn_id));
+    TEST_EXPECT(1 == state);
+    fixture.make_id(expected_txn, 10);
+    TEST_EXPECT(0 == memcmp(expected_txn, txn_id, 16));
+
+    /* the last certificate at a height wins. */
+    vccert_artifact_state_table_snapshot(&snapshot, &fixture.table, 7);
+    TEST_ASSERT(
+        0
+            == vccert_artifact_state_snapshot_find(
+                    &snapshot, artifact_id, &state, txn_id));
+    TEST_EXPECT(3 == state);
+    fixture.make_id(expected_txn, 12);
+    TEST_EXPECT(0 == memcmp(expected_txn, txn_id, 16));
+
+    /* an older snapshot is unchanged by later updates. */
+    vccert_artifact_state_snapshot_t old;
+    vccert_artifact_state_table_snapshot(&old, &fixture.table, 6);
+    TEST_ASSERT(0 == fixture.apply(1, 14, 4, 9));
+    TEST_ASSERT(
+        0 == vccert_artifact_state_snapshot_find(
+                &old, artifact_id, &state, nullptr));
+    TEST_EXPECT(1 == state);
+
+    /* an unknown artifact. */
+    fixture.make_id(artifact_id, 3);
+    TEST_EXPECT(
+        VCCERT_ERROR_ARTIFACT_STATE_SNAPSHOT_FIND_NOT_FOUND
+            == vccert_artifact_state_snapshot_find(
+                    &snapshot, artifact_id, &state, txn_id));
+END_TEST_F()
+
+/**
+ * Test that the table grows to hold many artifacts and long histories.
+ */
+BEGIN_TEST_F(grow)
+    vccert_artifact_state_snapshot_t snapshot;
+    uint8_t artifact_id[16];
+    int32_t state;
+
+    TEST_ASSERT(0 == fixture.table_init_result);
+
+    for (uint16_t height = 1; height <= 10; ++height)
+    {
+        for (uint16_t artifact = 0; artifact < 300; ++artifact)
+        {
+            TEST_ASSERT(
+                0
+                    == fixture.apply(
+                            artifact, 0, artifact + height, height));
+        }
+    }
+
+    TEST_EXPECT(300U == fixture.table.count);
+
+    for (uint16_t height = 1; height <= 10; ++height)
+    {
+        vccert_artifact_state_table_snapshot(
+            &snapshot, &fixture.table, height);
+        for (uint16_t artifact = 0; artifact < 300; ++artifact)
+        {
+            fixture.make_id(artifact_id, artifact);
+            TEST_ASSERT(
+                0
+                    == vccert_artifact_state_snapshot_find(
+                            &snapshot, artifact_id, &state, nullptr));
+            TEST_EXPECT(artifact + height == state);
+        }
+    }
+END_TEST_F()
+
+/**
+ * Test that the table rejects certificates applied out of order or without
+ * the required fields.
+ */
+BEGIN_TEST_F(apply_errors)
+    vccert_parser_context_t parser;
+    vccert_builder_context_t builder;
+    size_t size;
+
+    TEST_ASSERT(0 == fixture.table_init_result);
+    TEST_ASSERT(0 == fixture.apply(1, 10, 1, 5));
+    TEST_EXPECT(
+        VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_HEIGHT_OUT_OF_ORDER
+            == fixture.apply(1, 11, 2, 4));
+
+    TEST_ASSERT(
+        0 == vccert_builder_init(&fixture.builder_opts, &builder, 128));
+    vccert_builder_add_short_uint16(
+        &builder, VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE, 2);
+    const uint8_t* cert = vccert_builder_emit(&builder, &size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+    TEST_EXPECT(
+        VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_MISSING_FIELD
+            == vccert_artifact_state_table_apply(&fixture.table, &parser, 6));
+    TEST_EXPECT(
+        VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_INVALID_ARG
+            == vccert_artifact_state_table_apply(nullptr, &parser, 6));
+    TEST_EXPECT(
+        VCCERT_ERROR_ARTIFACT_STATE_TABLE_APPLY_INVALID_ARG
+            == vccert_artifact_state_table_apply(&fixture.table, nullptr, 6));
+
+    dispose((disposable_t*)&parser);
+    dispose((disposable_t*)&builder);
+END_TEST_F()
+
+/**
+ * Test the ready-made artifact state resolver.
+ */
+BEGIN_TEST_F(resolver)
+    vccert_artifact_state_snapshot_t snapshot;
+    vccrypt_buffer_t txn_id;
+    uint8_t artifact_id[16], expected_txn[16];
+
+    TEST_ASSERT(0 == fixture.table_init_result);
+    TEST_ASSERT(0 == fixture.apply(1, 10, 6, 5));
+    TEST_ASSERT(0 == vccrypt_buffer_init(&txn_id, &fixture.alloc_opts, 16));
+
+    vccert_artifact_state_table_snapshot(&snapshot, &fixture.table, 5);
+    fixture.options.parser_options_artifact_state_resolver =
+        &vccert_artifact_state_resolver;
+    fixture.options.artifact_state_context = &snapshot;
+
+    fixture.make_id(artifact_id, 1);
+    TEST_EXPECT(
+        6
+            == fixture.options.parser_options_artifact_state_resolver(
+                    &fixture.options, nullptr, artifact_id, &txn_id));
+    fixture.make_id(expected_txn, 10);
+    TEST_EXPECT(0 == memcmp(expected_txn, txn_id.data, 16));
+
+    fixture.make_id(artifact_id, 2);
+    TEST_EXPECT(
+        -1
+            == fixture.options.parser_options_artifact_state_resolver(
+                    &fixture.options, nullptr, artifact_id, nullptr));
+
+    dispose((disposable_t*)&txn_id);
+END_TEST_F()
+
+/**
+ * Test that vccert_artifact_state_table_init rejects invalid arguments.
+ */
+BEGIN_TEST_F(init_invalid_args)
+    vccert_artifact_state_table_t other;
+
+    TEST_EXPECT(
+        VCCERT_ERROR_ARTIFACT_STATE_TABLE_INIT_INVALID_ARG
+            == vccert_artifact_state_table_init(nullptr, &fixture.alloc_opts));
+    TEST_EXPECT(
+        VCCERT_ERROR_ARTIFACT_STATE_TABLE_INIT_INVALID_ARG
+            == vccert_artifact_state_table_init(&other, nullptr));
+END_TEST_F()
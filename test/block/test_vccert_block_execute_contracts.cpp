@@ -0,0 +1,440 @@
+/**
+ * \file test_vccert_block_execute_contracts.cpp
+ *
+ * Test partitioned contract execution.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <map>
+#include <minunit/minunit.h>
+#include <mutex>
+#include <string.h>
+#include <vccert/block.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t EXECUTE_TXN_COUNT = 64;
+const size_t EXECUTE_ARTIFACT_COUNT = 7;
+const size_t EXECUTE_WORKERS = 4;
+const uint64_t EXECUTE_HEIGHT = 77;
+
+static const uint8_t* PRIVATE_KEY =
+    (const uint8_t*)"\x65\x93\x21\xd0\x35\xa9\xf8\xcf"
+                    "\x35\x37\xd1\xd1\x82\xfd\xee\xf8"
+                    "\x92\x8e\x0c\xfe\xb4\x56\x4b\x2d"
+                    "\xb5\x11\x60\x6d\xc6\xf6\x13\xbd"
+                    "\x47\x83\xe9\xf6\x78\xd1\x49\xac"
+                    "\xd2\x09\x66\xb0\xab\x88\xf7\xd0"
+                    "\x5d\x6d\x4f\x54\x0f\x1f\x23\x82"
+                    "\x86\x00\x3a\xda\x0c\x27\xcc\x35";
+
+static const uint8_t* SIGNER_ID =
+    (const uint8_t*)"\x71\x1f\x22\x65\xb6\x50\x46\x12"
+                    "\xa7\x3a\xad\x82\x7f\xb2\x71\x18";
+
+static const uint8_t* TXN_TYPE =
+    (const uint8_t*)"\x17\xe1\xfc\x1f\x5d\xd9\x44\xa9"
+                    "\xb4\x9d\x1b\x6c\x1e\xb6\xd0\x11";
+
+//forward declarations for certificate delegate methods
+static bool dummy_txn_resolver(
+    void*, void*, const uint8_t*, const uint8_t*,
+    vccrypt_buffer_t*, bool*);
+static int32_t dummy_artifact_state_resolver(
+    void*, void*, const uint8_t*, vccrypt_buffer_t*);
+static bool signer_key_resolver(
+    void*, void*, uint64_t, const uint8_t*, vccrypt_buffer_t*,
+    vccrypt_buffer_t*);
+static int sequence_contract_resolver(
+    void*, void*, const uint8_t*, const uint8_t*,
+    vccert_contract_closure_t* closure);
+
+class vccert_block_execute_contracts_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        options_init_result =
+            vccert_parser_options_init(
+                &options, &alloc_opts, &crypto_suite, &dummy_txn_resolver,
+                &dummy_artifact_state_resolver, &sequence_contract_resolver,
+                &signer_key_resolver, this);
+
+        key_init_result =
+            vccrypt_suite_buffer_init_for_signature_private_key(
+                &crypto_suite, &private_key);
+        if (0 == key_init_result)
+        {
+            memcpy(private_key.data, PRIVATE_KEY, private_key.size);
+        }
+
+        pool_init_result =
+            vccert_thread_pool_init(&pool, &alloc_opts, EXECUTE_WORKERS);
+    }
+
+    void tearDown()
+    {
+        if (pool_init_result == 0)
+        {
+            dispose((disposable_t*)&pool);
+        }
+
+        if (key_init_result == 0)
+        {
+            dispose((disposable_t*)&private_key);
+        }
+
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Build signed transactions spread over several artifacts.  Each holds
+     * its expected sequence number within its artifact; the transactions in
+     * skip get a sequence number that is one too high.
+     */
+    int build_txns(const std::vector<size_t>& skip)
+    {
+        int retval;
+        vccert_builder_context_t txn;
+        uint64_t sequence[EXECUTE_ARTIFACT_COUNT] = { 0 };
+
+        retval = vccert_builder_init(&builder_opts, &txn, 256);
+        if (0 != retval)
+            return retval;
+
+        for (size_t i = 0; 0 == retval && i < EXECUTE_TXN_COUNT; ++i)
+        {
+            size_t txn_size;
+            uint8_t artifact_id[16];
+            size_t artifact = (3 * i + i / 5) % EXECUTE_ARTIFACT_COUNT;
+            uint64_t seq = sequence[artifact]++;
+
+            for (size_t s : skip)
+            {
+                if (s == i)
+                    ++seq;
+            }
+
+            memset(artifact_id, 0, sizeof(artifact_id));
+            artifact_id[15] = (uint8_t)artifact;
+
+            vccert_builder_reset(&txn);
+            vccert_builder_add_short_uint32(
+                &txn, VCCERT_FIELD_TYPE_CERTIFICATE_VERSION, 0x00010000UL);
+            vccert_builder_add_short_UUID(
+                &txn, VCCERT_FIELD_TYPE_TRANSACTION_TYPE, TXN_TYPE);
+            vccert_builder_add_short_UUID(
+                &txn, VCCERT_FIELD_TYPE_ARTIFACT_ID, artifact_id);
+            vccert_builder_add_short_uint64(
+                &txn, VCCERT_FIELD_TYPE_VELO_RESERVED_0086, seq);
+            retval = vccert_builder_sign(&txn, SIGNER_ID, &private_key);
+            if (0 != retval)
+                break;
+
+            const uint8_t* cert = vccert_builder_emit(&txn, &txn_size);
+            certs.push_back(std::vector<uint8_t>(cert, cert + txn_size));
+        }
+
+        dispose((disposable_t*)&txn);
+
+        return retval;
+    }
+
+    /**
+     * Create a parser for every transaction.
+     */
+    int init_parsers()
+    {
+        parsers.resize(certs.size());
+        for (size_t i = 0; i < certs.size(); ++i)
+        {
+            int retval =
+                vccert_parser_init(
+                    &options, &parsers[i], certs[i].data(), certs[i].size());
+            if (0 != retval)
+                return retval;
+        }
+
+        return 0;
+    }
+
+    void dispose_parsers()
+    {
+        for (auto& parser : parsers)
+        {
+            dispose((disposable_t*)&parser);
+        }
+    }
+
+    void reset_state()
+    {
+        state.clear();
+        history.clear();
+    }
+
+    int suite_init_result, builder_opts_init_result, options_init_result;
+    int key_init_result, pool_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t options;
+    vccrypt_buffer_t private_key;
+    vccert_thread_pool_t pool;
+    std::vector<std::vector<uint8_t>> certs;
+    std::vector<vccert_parser_context_t> parsers;
+
+    /* per-artifact state touched by the contract. */
+    std::mutex state_lock;
+    std::map<uint8_t, uint64_t> state;
+    std::map<uint8_t, std::vector<uint64_t>> history;
+};
+
+TEST_SUITE(vccert_block_execute_contracts_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_block_execute_contracts_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that partitioned execution gives the same statuses and the same
+ * per-artifact history as attesting each transaction in block order.
+ */
+BEGIN_TEST_F(matches_sequential)
+    std::vector<int> expected(EXECUTE_TXN_COUNT), statuses(EXECUTE_TXN_COUNT);
+    size_t expected_failed = VCCERT_BLOCK_NO_TXN;
+    size_t failed_txn;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(0 == fixture.build_txns({ 9, 20, 21, 47 }));
+    TEST_ASSERT(0 == fixture.init_parsers());
+
+    /* sequential reference run. */
+    for (size_t i = 0; i < EXECUTE_TXN_COUNT; ++i)
+    {
+        expected[i] =
+            vccert_parser_attest(&fixture.parsers[i], EXECUTE_HEIGHT, true);
+        if (0 != expected[i] && VCCERT_BLOCK_NO_TXN == expected_failed)
+        {
+            expected_failed = i;
+        }
+    }
+
+    auto expected_state = fixture.state;
+    auto expected_history = fixture.history;
+    TEST_ASSERT(9U == expected_failed);
+
+    for (int pass = 0; pass < 10; ++pass)
+    {
+        fixture.reset_state();
+        for (size_t i = 0; i < EXECUTE_TXN_COUNT; ++i)
+        {
+            TEST_ASSERT(
+                0
+                    == vccert_parser_attest(
+                            &fixture.parsers[i], EXECUTE_HEIGHT, false));
+        }
+
+        vccert_thread_pool_t* pool = (0 == pass) ? nullptr : &fixture.pool;
+        TEST_EXPECT(
+            VCCERT_ERROR_PARSER_ATTEST_CONTRACT_VERIFICATION
+                == vccert_block_execute_contracts(
+                        fixture.parsers.data(), EXECUTE_TXN_COUNT, pool,
+                        statuses.data(), &failed_txn));
+        TEST_EXPECT(expected_failed == failed_txn);
+        TEST_EXPECT(expected == statuses);
+        TEST_EXPECT(expected_state == fixture.state);
+        TEST_EXPECT(expected_history == fixture.history);
+    }
+
+    fixture.dispose_parsers();
+END_TEST_F()
+
+/**
+ * Test that a run with no failures succeeds.
+ */
+BEGIN_TEST_F(happy_path)
+    std::vector<int> statuses(EXECUTE_TXN_COUNT);
+    size_t failed_txn;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(0 == fixture.build_txns({}));
+    TEST_ASSERT(0 == fixture.init_parsers());
+
+    for (size_t i = 0; i < EXECUTE_TXN_COUNT; ++i)
+    {
+        TEST_ASSERT(
+            0
+                == vccert_parser_attest(
+                        &fixture.parsers[i], EXECUTE_HEIGHT, false));
+    }
+
+    TEST_EXPECT(
+        0
+            == vccert_block_execute_contracts(
+                    fixture.parsers.data(), EXECUTE_TXN_COUNT, &fixture.pool,
+                    statuses.data(), &failed_txn));
+    TEST_EXPECT(VCCERT_BLOCK_NO_TXN == failed_txn);
+    TEST_EXPECT(EXECUTE_ARTIFACT_COUNT == fixture.state.size());
+
+    fixture.dispose_parsers();
+END_TEST_F()
+
+/**
+ * Test that vccert_block_execute_contracts rejects invalid arguments.
+ */
+BEGIN_TEST_F(invalid_args)
+    vccert_parser_context_t parser;
+    int status;
+    size_t failed_txn;
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_EXECUTE_CONTRACTS_INVALID_ARG
+            == vccert_block_execute_contracts(
+                    nullptr, 1, nullptr, &status, &failed_txn));
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_EXECUTE_CONTRACTS_INVALID_ARG
+            == vccert_block_execute_contracts(
+                    &parser, 1, nullptr, nullptr, &failed_txn));
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_EXECUTE_CONTRACTS_INVALID_ARG
+            == vccert_block_execute_contracts(
+                    &parser, 1, nullptr, &status, nullptr));
+    TEST_EXPECT(
+        0
+            == vccert_block_execute_contracts(
+                    nullptr, 0, nullptr, nullptr, &failed_txn));
+    TEST_EXPECT(VCCERT_BLOCK_NO_TXN == failed_txn);
+END_TEST_F()
+
+/**
+ * Dummy transaction resolver.
+ */
+static bool dummy_txn_resolver(
+    void*, void*, const uint8_t*, const uint8_t*,
+    vccrypt_buffer_t*, bool*)
+{
+    return false;
+}
+
+/**
+ * Dummy artifact state resolver.
+ */
+static int32_t dummy_artifact_state_resolver(
+    void*, void*, const uint8_t*, vccrypt_buffer_t*)
+{
+    return -1;
+}
+
+/**
+ * Return the public half of the test signing key.
+ */
+static bool signer_key_resolver(
+    void*, void*, uint64_t, const uint8_t*,
+    vccrypt_buffer_t* enc_buffer, vccrypt_buffer_t* sign_buffer)
+{
+    memset(enc_buffer->data, 0, enc_buffer->size);
+    memcpy(sign_buffer->data, PRIVATE_KEY + 32, 32);
+
+    return true;
+}
+
+/**
+ * Accept a transaction only if it carries the next sequence number for its
+ * artifact, so that the outcome depends on per-artifact ordering.
+ */
+static bool sequence_contract(
+    vccert_parser_context_t* parser, void* context)
+{
+    vccert_block_execute_contracts_test* fixture =
+        (vccert_block_execute_contracts_test*)context;
+    const uint8_t* artifact_id;
+    const uint8_t* value;
+    size_t size;
+    uint64_t seq = 0;
+
+    if (0 != vccert_parser_find_short(
+                parser, VCCERT_FIELD_TYPE_ARTIFACT_ID, &artifact_id, &size)
+     || 16 != size
+     || 0 != vccert_parser_find_short(
+                parser, VCCERT_FIELD_TYPE_VELO_RESERVED_0086, &value, &size)
+     || sizeof(seq) != size)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        seq = (seq << 8) | value[i];
+    }
+
+    std::lock_guard<std::mutex> guard(fixture->state_lock);
+    uint64_t& next = fixture->state[artifact_id[15]];
+    fixture->history[artifact_id[15]].push_back(seq);
+    if (seq != next)
+    {
+        return false;
+    }
+
+    ++next;
+
+    return true;
+}
+
+/**
+ * Dummy disposer.
+ */
+static void dummy_dispose(void*)
+{
+}
+
+/**
+ * Contract resolver for the sequence contract.
+ */
+static int sequence_contract_resolver(
+    void* options, void*, const uint8_t*, const uint8_t*,
+    vccert_contract_closure_t* closure)
+{
+    closure->hdr.dispose = &dummy_dispose;
+    closure->contract_fn = &sequence_contract;
+    closure->context = ((vccert_parser_options_t*)options)->context;
+
+    return VCCERT_STATUS_SUCCESS;
+}
@@ -0,0 +1,470 @@
+/**
+ * \file test_vccert_block_execute_speculative.cpp
+ *
+ * Test speculative contract execution.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <atomic>
+#include <map>
+#include <minunit/minunit.h>
+#include <mutex>
+#include <string.h>
+#include <vccert/block.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t SPEC_TXN_COUNT = 60;
+const size_t SPEC_ARTIFACT_COUNT = 5;
+const size_t SPEC_WORKERS = 4;
+const uint64_t SPEC_HEIGHT = 77;
+
+static const uint8_t* PRIVATE_KEY =
+    (const uint8_t*)"\x65\x93\x21\xd0\x35\xa9\xf8\xcf"
+                    "\x35\x37\xd1\xd1\x82\xfd\xee\xf8"
+                    "\x92\x8e\x0c\xfe\xb4\x56\x4b\x2d"
+                    "\xb5\x11\x60\x6d\xc6\xf6\x13\xbd"
+                    "\x47\x83\xe9\xf6\x78\xd1\x49\xac"
+                    "\xd2\x09\x66\xb0\xab\x88\xf7\xd0"
+                    "\x5d\x6d\x4f\x54\x0f\x1f\x23\x82"
+                    "\x86\x00\x3a\xda\x0c\x27\xcc\x35";
+
+static const uint8_t* SIGNER_ID =
+    (const uint8_t*)"\x71\x1f\x22\x65\xb6\x50\x46\x12"
+                    "\xa7\x3a\xad\x82\x7f\xb2\x71\x18";
+
+static const uint8_t* TXN_TYPE =
+    (const uint8_t*)"\x17\xe1\xfc\x1f\x5d\xd9\x44\xa9"
+                    "\xb4\x9d\x1b\x6c\x1e\xb6\xd0\x11";
+
+//forward declarations for certificate delegate methods
+static bool dummy_txn_resolver(
+    void*, void*, const uint8_t*, const uint8_t*,
+    vccrypt_buffer_t*, bool*);
+static int32_t committed_state_resolver(
+    void*, void*, const uint8_t*, vccrypt_buffer_t*);
+static bool signer_key_resolver(
+    void*, void*, uint64_t, const uint8_t*, vccrypt_buffer_t*,
+    vccrypt_buffer_t*);
+static int transition_contract_resolver(
+    void*, void*, const uint8_t*, const uint8_t*,
+    vccert_contract_closure_t* closure);
+
+/**
+ * How a generated transaction relates to the state of its artifact.
+ */
+enum spec_txn_kind
+{
+    /* moves the artifact from its current state to the next. */
+    SPEC_TXN_GOOD,
+    /* names the wrong previous state, and is not built upon. */
+    SPEC_TXN_BAD,
+    /* names the wrong previous state, but later transactions build on it. */
+    SPEC_TXN_BAD_CASCADE,
+};
+
+class vccert_block_execute_speculative_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        options_init_result =
+            vccert_parser_options_init(
+                &options, &alloc_opts, &crypto_suite, &dummy_txn_resolver,
+                &committed_state_resolver, &transition_contract_resolver,
+                &signer_key_resolver, this);
+
+        key_init_result =
+            vccrypt_suite_buffer_init_for_signature_private_key(
+                &crypto_suite, &private_key);
+        if (0 == key_init_result)
+        {
+            memcpy(private_key.data, PRIVATE_KEY, private_key.size);
+        }
+
+        pool_init_result =
+            vccert_thread_pool_init(&pool, &alloc_opts, SPEC_WORKERS);
+
+        executions = 0;
+    }
+
+    void tearDown()
+    {
+        for (auto& parser : parsers)
+        {
+            dispose((disposable_t*)&parser);
+        }
+
+        if (pool_init_result == 0)
+        {
+            dispose((disposable_t*)&pool);
+        }
+
+        if (key_init_result == 0)
+        {
+            dispose((disposable_t*)&private_key);
+        }
+
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Build and attest signed transactions that move artifacts through a
+     * chain of states.  kind_of(i) picks how transaction i is built.
+     */
+    template <typename F>
+    int build_txns(F kind_of)
+    {
+        int retval;
+        vccert_builder_context_t txn;
+        uint16_t state[SPEC_ARTIFACT_COUNT] = { 0 };
+
+        retval = vccert_builder_init(&builder_opts, &txn, 256);
+        if (0 != retval)
+            return retval;
+
+        for (size_t i = 0; 0 == retval && i < SPEC_TXN_COUNT; ++i)
+        {
+            size_t txn_size;
+            uint8_t artifact_id[16], txn_id[16];
+            size_t artifact = (i * 3 + i / 4) % SPEC_ARTIFACT_COUNT;
+            uint16_t prev = state[artifact];
+
+            switch (kind_of(i))
+            {
+                case SPEC_TXN_GOOD:
+                    ++state[artifact];
+                    break;
+
+                case SPEC_TXN_BAD:
+                    prev += 7;
+                    break;
+
+                case SPEC_TXN_BAD_CASCADE:
+                    prev += 7;
+                    state[artifact] = prev + 1;
+                    break;
+            }
+
+            memset(artifact_id, 0, sizeof(artifact_id));
+            artifact_id[15] = (uint8_t)artifact;
+            memset(txn_id, 0xAA, sizeof(txn_id));
+            txn_id[15] = (uint8_t)i;
+
+            vccert_builder_reset(&txn);
+            vccert_builder_add_short_uint32(
+                &txn, VCCERT_FIELD_TYPE_CERTIFICATE_VERSION, 0x00010000UL);
+            vccert_builder_add_short_UUID(
+                &txn, VCCERT_FIELD_TYPE_CERTIFICATE_ID, txn_id);
+            vccert_builder_add_short_UUID(
+                &txn, VCCERT_FIELD_TYPE_TRANSACTION_TYPE, TXN_TYPE);
+            vccert_builder_add_short_UUID(
+                &txn, VCCERT_FIELD_TYPE_ARTIFACT_ID, artifact_id);
+            vccert_builder_add_short_uint16(
+                &txn, VCCERT_FIELD_TYPE_PREVIOUS_ARTIFACT_STATE, prev);
+            vccert_builder_add_short_uint16(
+                &txn, VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE, prev + 1);
+            retval = vccert_builder_sign(&txn, SIGNER_ID, &private_key);
+            if (0 != retval)
+                break;
+
+            const uint8_t* cert = vccert_builder_emit(&txn, &txn_size);
+            certs.push_back(std::vector<uint8_t>(cert, cert + txn_size));
+        }
+
+        dispose((disposable_t*)&txn);
+
+        parsers.resize(certs.size());
+        for (size_t i = 0; 0 == retval && i < certs.size(); ++i)
+        {
+            retval =
+                vccert_parser_init(
+                    &options, &parsers[i], certs[i].data(), certs[i].size());
+            if (0 == retval)
+            {
+                retval = vccert_parser_attest(&parsers[i], SPEC_HEIGHT, false);
+            }
+        }
+
+        return retval;
+    }
+
+    /**
+     * Run each contract in block order, applying the new state of each
+     * passing transaction before the next runs.
+     */
+    size_t run_sequential(std::vector<int>& statuses)
+    {
+        size_t failed = VCCERT_BLOCK_NO_TXN;
+
+        committed.clear();
+        for (size_t i = 0; i < parsers.size(); ++i)
+        {
+            const uint8_t* artifact_id;
+            const uint8_t* value;
+            size_t size;
+
+            statuses[i] = vccert_parser_attest(&parsers[i], SPEC_HEIGHT, true);
+            if (0 != statuses[i])
+            {
+                if (VCCERT_BLOCK_NO_TXN == failed)
+                    failed = i;
+                continue;
+            }
+
+            vccert_parser_find_short(
+                &parsers[i], VCCERT_FIELD_TYPE_ARTIFACT_ID, &artifact_id,
+                &size);
+            vccert_parser_find_short(
+                &parsers[i], VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE, &value,
+                &size);
+            committed[artifact_id[15]] = (value[0] << 8) | value[1];
+        }
+
+        committed.clear();
+
+        return failed;
+    }
+
+    int suite_init_result, builder_opts_init_result, options_init_result;
+    int key_init_result, pool_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t options;
+    vccrypt_buffer_t private_key;
+    vccert_thread_pool_t pool;
+    std::vector<std::vector<uint8_t>> certs;
+    std::vector<vccert_parser_context_t> parsers;
+
+    /* artifact state before the block; every artifact starts at 0. */
+    std::mutex committed_lock;
+    std::map<uint8_t, int32_t> committed;
+    std::atomic<size_t> executions;
+};
+
+TEST_SUITE(vccert_block_execute_speculative_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_block_execute_speculative_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that a block of chained transactions with no failures runs each
+ * contract exactly once.
+ */
+BEGIN_TEST_F(no_conflicts)
+    std::vector<int> statuses(SPEC_TXN_COUNT);
+    size_t failed_txn;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(0 == fixture.build_txns([](size_t) { return SPEC_TXN_GOOD; }));
+
+    TEST_EXPECT(
+        0
+            == vccert_block_execute_speculative(
+                    fixture.parsers.data(), SPEC_TXN_COUNT, &fixture.pool,
+                    statuses.data(), &failed_txn));
+    TEST_EXPECT(VCCERT_BLOCK_NO_TXN == failed_txn);
+    TEST_EXPECT(SPEC_TXN_COUNT == fixture.executions);
+END_TEST_F()
+
+/**
+ * Test that speculative execution gives the same statuses as sequential
+ * execution when failures invalidate later reads.
+ */
+BEGIN_TEST_F(matches_sequential)
+    std::vector<int> expected(SPEC_TXN_COUNT), statuses(SPEC_TXN_COUNT);
+    size_t failed_txn;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(
+        0
+            == fixture.build_txns(
+                    [](size_t i) {
+                        if (i == 6 || i == 31)
+                            return SPEC_TXN_BAD;
+                        if (i == 12 || i == 40)
+                            return SPEC_TXN_BAD_CASCADE;
+                        return SPEC_TXN_GOOD;
+                    }));
+
+    size_t expected_failed = fixture.run_sequential(expected);
+    TEST_ASSERT(6U == expected_failed);
+
+    for (int pass = 0; pass < 10; ++pass)
+    {
+        vccert_thread_pool_t* pool = (0 == pass) ? nullptr : &fixture.pool;
+
+        fixture.executions = 0;
+        TEST_EXPECT(
+            VCCERT_ERROR_PARSER_ATTEST_CONTRACT_VERIFICATION
+                == vccert_block_execute_speculative(
+                        fixture.parsers.data(), SPEC_TXN_COUNT, pool,
+                        statuses.data(), &failed_txn));
+        TEST_EXPECT(expected_failed == failed_txn);
+        TEST_EXPECT(expected == statuses);
+
+        /* only the transactions that read a stale state run again. */
+        TEST_EXPECT(fixture.executions > SPEC_TXN_COUNT);
+        TEST_EXPECT(fixture.executions < 2 * SPEC_TXN_COUNT);
+    }
+END_TEST_F()
+
+/**
+ * Test that vccert_block_execute_speculative rejects invalid arguments.
+ */
+BEGIN_TEST_F(invalid_args)
+    vccert_parser_context_t parser;
+    int status;
+    size_t failed_txn;
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_EXECUTE_SPECULATIVE_INVALID_ARG
+            == vccert_block_execute_speculative(
+                    nullptr, 1, nullptr, &status, &failed_txn));
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_EXECUTE_SPECULATIVE_INVALID_ARG
+            == vccert_block_execute_speculative(
+                    &parser, 1, nullptr, nullptr, &failed_txn));
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_EXECUTE_SPECULATIVE_INVALID_ARG
+            == vccert_block_execute_speculative(
+                    &parser, 1, nullptr, &status, nullptr));
+    TEST_EXPECT(
+        0
+            == vccert_block_execute_speculative(
+                    nullptr, 0, nullptr, nullptr, &failed_txn));
+    TEST_EXPECT(VCCERT_BLOCK_NO_TXN == failed_txn);
+END_TEST_F()
+
+/**
+ * Dummy transaction resolver.
+ */
+static bool dummy_txn_resolver(
+    void*, void*, const uint8_t*, const uint8_t*,
+    vccrypt_buffer_t*, bool*)
+{
+    return false;
+}
+
+/**
+ * Resolve the committed state of an artifact.
+ */
+static int32_t committed_state_resolver(
+    void* options, void*, const uint8_t* artifact_id, vccrypt_buffer_t*)
+{
+    vccert_block_execute_speculative_test* fixture =
+        (vccert_block_execute_speculative_test*)
+            ((vccert_parser_options_t*)options)->context;
+
+    std::lock_guard<std::mutex> guard(fixture->committed_lock);
+    auto found = fixture->committed.find(artifact_id[15]);
+
+    return (fixture->committed.end() == found) ? 0 : found->second;
+}
+
+/**
+ * Return the public half of the test signing key.
+ */
+static bool signer_key_resolver(
+    void*, void*, uint64_t, const uint8_t*,
+    vccrypt_buffer_t* enc_buffer, vccrypt_buffer_t* sign_buffer)
+{
+    memset(enc_buffer->data, 0, enc_buffer->size);
+    memcpy(sign_buffer->data, PRIVATE_KEY + 32, 32);
+
+    return true;
+}
+
+/**
+ * Accept a transaction only if its previous state matches the current state
+ * of its artifact.
+ */
+static bool transition_contract(
+    vccert_parser_context_t* parser, void* context)
+{
+    vccert_block_execute_speculative_test* fixture =
+        (vccert_block_execute_speculative_test*)context;
+    const uint8_t* artifact_id;
+    const uint8_t* value;
+    size_t size;
+
+    ++fixture->executions;
+
+    if (0 != vccert_parser_find_short(
+                parser, VCCERT_FIELD_TYPE_ARTIFACT_ID, &artifact_id, &size)
+     || 16 != size
+     || 0 != vccert_parser_find_short(
+                parser, VCCERT_FIELD_TYPE_PREVIOUS_ARTIFACT_STATE, &value,
+                &size)
+     || 2 != size)
+    {
+        return false;
+    }
+
+    int32_t state =
+        parser->options->parser_options_artifact_state_resolver(
+            parser->options, parser, artifact_id, nullptr);
+
+    return state == ((value[0] << 8) | value[1]);
+}
+
+/**
+ * Dummy disposer.
+ */
+static void dummy_dispose(void*)
+{
+}
+
+/**
+ * Contract resolver for the transition contract.
+ */
+static int transition_contract_resolver(
+    void* options, void*, const uint8_t*, const uint8_t*,
+    vccert_contract_closure_t* closure)
+{
+    closure->hdr.dispose = &dummy_dispose;
+    closure->contract_fn = &transition_contract;
+    closure->context = ((vccert_parser_options_t*)options)->context;
+
+    return VCCERT_STATUS_SUCCESS;
+}
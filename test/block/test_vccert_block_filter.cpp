@@ -0,0 +1,240 @@
+/**
+ * \file test_vccert_block_filter.cpp
+ *
+ * Test the vccert block filter.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccert/block.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t FILTER_TXN_COUNT = 500;
+const size_t FILTER_PROBE_COUNT = 10000;
+const size_t FILTER_CERT_SIZE = 65536;
+
+class vccert_block_filter_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        options_init_result =
+            vccert_parser_options_simple_init(
+                &options, &alloc_opts, &crypto_suite);
+
+        block_init_result =
+            vccert_builder_init(&builder_opts, &block, FILTER_CERT_SIZE);
+    }
+
+    void tearDown()
+    {
+        if (block_init_result == 0)
+        {
+            dispose((disposable_t*)&block);
+        }
+
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Make a 128-bit id from a tag and a number.
+     */
+    static void make_id(uint8_t* id, uint8_t tag, size_t number)
+    {
+        memset(id, tag, 16);
+        for (int i = 0; i < 8; ++i)
+        {
+            id[15 - i] = (uint8_t)(number >> (8 * i));
+        }
+    }
+
+    /**
+     * Build a block holding the given number of wrapped transactions, each
+     * with its own certificate id and artifact id, then write its filter.
+     */
+    int build_filter(size_t count)
+    {
+        vccert_parser_context_t parser;
+        vccert_block_view_t view;
+        vccert_builder_context_t txn;
+        uint8_t id[16];
+        size_t size, required;
+        int retval;
+
+        retval = vccert_builder_init(&builder_opts, &txn, 64);
+        if (0 != retval)
+            return retval;
+
+        retval =
+            vccert_builder_add_short_uint64(
+                &block, VCCERT_FIELD_TYPE_BLOCK_HEIGHT, 77);
+
+        for (size_t i = 0; 0 == retval && i < count; ++i)
+        {
+            size_t txn_size;
+
+            vccert_builder_reset(&txn);
+            make_id(id, 0xCE, i);
+            vccert_builder_add_short_UUID(
+                &txn, VCCERT_FIELD_TYPE_CERTIFICATE_ID, id);
+            make_id(id, 0xAA, i);
+            vccert_builder_add_short_UUID(
+                &txn, VCCERT_FIELD_TYPE_ARTIFACT_ID, id);
+            const uint8_t* txn_cert = vccert_builder_emit(&txn, &txn_size);
+
+            retval =
+                vccert_builder_add_short_buffer(
+                    &block, VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE,
+                    txn_cert, txn_size);
+        }
+
+        dispose((disposable_t*)&txn);
+        if (0 != retval)
+            return retval;
+
+        const uint8_t* cert = vccert_builder_emit(&block, &size);
+        retval = vccert_parser_init(&options, &parser, cert, size);
+        if (0 != retval)
+            return retval;
+
+        retval = vccert_block_view_init(&view, &alloc_opts, &parser);
+        if (0 == retval)
+        {
+            retval = vccert_block_filter_write(&view, nullptr, 0, &required);
+            if (0 == retval)
+            {
+                filter.resize(required);
+                retval =
+                    vccert_block_filter_write(
+                        &view, filter.data(), filter.size(), &required);
+            }
+
+            dispose((disposable_t*)&view);
+        }
+
+        dispose((disposable_t*)&parser);
+
+        return retval;
+    }
+
+    int suite_init_result, builder_opts_init_result, options_init_result;
+    int block_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t options;
+    vccert_builder_context_t block;
+    std::vector<uint8_t> filter;
+};
+
+TEST_SUITE(vccert_block_filter_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_block_filter_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that every id in the block is found, and that almost every other id
+ * is ruled out.
+ */
+BEGIN_TEST_F(may_contain)
+    uint8_t id[16];
+    size_t false_positives = 0;
+
+    TEST_ASSERT(0 == fixture.block_init_result);
+    TEST_ASSERT(0 == fixture.build_filter(FILTER_TXN_COUNT));
+    TEST_EXPECT(
+        VCCERT_BLOCK_FILTER_HEADER_SIZE + FILTER_TXN_COUNT * 2 * 10 / 8 + 8
+            >= fixture.filter.size());
+
+    for (size_t i = 0; i < FILTER_TXN_COUNT; ++i)
+    {
+        fixture.make_id(id, 0xAA, i);
+        TEST_EXPECT(
+            vccert_block_may_contain_artifact(
+                fixture.filter.data(), fixture.filter.size(), id));
+
+        fixture.make_id(id, 0xCE, i);
+        TEST_EXPECT(
+            vccert_block_may_contain_certificate(
+                fixture.filter.data(), fixture.filter.size(), id));
+    }
+
+    for (size_t i = FILTER_TXN_COUNT;
+         i < FILTER_TXN_COUNT + FILTER_PROBE_COUNT; ++i)
+    {
+        fixture.make_id(id, 0xAA, i);
+        if (vccert_block_may_contain_artifact(
+                fixture.filter.data(), fixture.filter.size(), id))
+        {
+            ++false_positives;
+        }
+    }
+
+    /* about one percent is expected. */
+    TEST_EXPECT(false_positives < FILTER_PROBE_COUNT / 50);
+END_TEST_F()
+
+/**
+ * Test that an empty block rules everything out, and that a damaged filter
+ * rules nothing out.
+ */
+BEGIN_TEST_F(empty_and_damaged)
+    uint8_t id[16];
+
+    TEST_ASSERT(0 == fixture.block_init_result);
+    TEST_ASSERT(0 == fixture.build_filter(0));
+
+    fixture.make_id(id, 0xAA, 1);
+    TEST_EXPECT(
+        !vccert_block_may_contain_artifact(
+            fixture.filter.data(), fixture.filter.size(), id));
+
+    TEST_EXPECT(
+        vccert_block_may_contain_artifact(
+            fixture.filter.data(), fixture.filter.size() - 1, id));
+    TEST_EXPECT(vccert_block_may_contain_artifact(nullptr, 0, id));
+
+    fixture.filter[0] ^= 1;
+    TEST_EXPECT(
+        vccert_block_may_contain_artifact(
+            fixture.filter.data(), fixture.filter.size(), id));
+END_TEST_F()
@@ -0,0 +1,577 @@
+/**
+ * \file test_vccert_block_validate.cpp
+ *
+ * Test the vccert block validation pipeline.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccert/block.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t VALIDATE_TXN_COUNT = 40;
+const size_t VALIDATE_CERT_SIZE = 16384;
+const size_t VALIDATE_WORKERS = 4;
+const uint64_t VALIDATE_HEIGHT = 77;
+
+static const uint8_t* PRIVATE_KEY =
+    (const uint8_t*)"\x65\x93\x21\xd0\x35\xa9\xf8\xcf"
+                    "\x35\x37\xd1\xd1\x82\xfd\xee\xf8"
+                    "\x92\x8e\x0c\xfe\xb4\x56\x4b\x2d"
+                    "\xb5\x11\x60\x6d\xc6\xf6\x13\xbd"
+                    "\x47\x83\xe9\xf6\x78\xd1\x49\xac"
+                    "\xd2\x09\x66\xb0\xab\x88\xf7\xd0"
+                    "\x5d\x6d\x4f\x54\x0f\x1f\x23\x82"
+                    "\x86\x00\x3a\xda\x0c\x27\xcc\x35";
+
+static const uint8_t* SIGNER_ID =
+    (const uint8_t*)"\x71\x1f\x22\x65\xb6\x50\x46\x12"
+                    "\xa7\x3a\xad\x82\x7f\xb2\x71\x18";
+
+static const uint8_t* TXN_TYPE =
+    (const uint8_t*)"\x17\xe1\xfc\x1f\x5d\xd9\x44\xa9"
+                    "\xb4\x9d\x1b\x6c\x1e\xb6\xd0\x11";
+
+//forward declarations for certificate delegate methods
+static bool dummy_txn_resolver(
+    void*, void*, const uint8_t*, const uint8_t*,
+    vccrypt_buffer_t*, bool*);
+static int32_t dummy_artifact_state_resolver(
+    void*, void*, const uint8_t*, vccrypt_buffer_t*);
+static bool signer_key_resolver(
+    void*, void*, uint64_t, const uint8_t*, vccrypt_buffer_t*,
+    vccrypt_buffer_t*);
+static int recording_contract_resolver(
+    void*, void*, const uint8_t*, const uint8_t*,
+    vccert_contract_closure_t* closure);
+
+class vccert_block_validate_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        options_init_result =
+            vccert_parser_options_init(
+                &options, &alloc_opts, &crypto_suite, &dummy_txn_resolver,
+                &dummy_artifact_state_resolver, &recording_contract_resolver,
+                &signer_key_resolver, this);
+
+        block_init_result =
+            vccert_builder_init(&builder_opts, &block, VALIDATE_CERT_SIZE);
+
+        key_init_result =
+            vccrypt_suite_buffer_init_for_signature_private_key(
+                &crypto_suite, &private_key);
+        if (0 == key_init_result)
+        {
+            memcpy(private_key.data, PRIVATE_KEY, private_key.size);
+        }
+
+        pool_init_result =
+            vccert_thread_pool_init(&pool, &alloc_opts, VALIDATE_WORKERS);
+
+        fail_contract_at = VALIDATE_TXN_COUNT;
+    }
+
+    void tearDown()
+    {
+        if (pool_init_result == 0)
+        {
+            dispose((disposable_t*)&pool);
+        }
+
+        if (key_init_result == 0)
+        {
+            dispose((disposable_t*)&private_key);
+        }
+
+        if (block_init_result == 0)
+        {
+            dispose((disposable_t*)&block);
+        }
+
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Build a signed block holding the given number of signed transactions.
+     * Each transaction holds its index as a uint64 field.  The transaction at
+     * tamper_index is modified after it is signed.
+     */
+    int build_block(size_t count, size_t tamper_index)
+    {
+        int retval;
+        vccert_builder_context_t txn;
+
+        retval = vccert_builder_init(&builder_opts, &txn, 256);
+        if (0 != retval)
+            return retval;
+
+        retval =
+            vccert_builder_add_short_uint64(
+                &block, VCCERT_FIELD_TYPE_BLOCK_HEIGHT, VALIDATE_HEIGHT);
+
+        for (size_t i = 0; 0 == retval && i < count; ++i)
+        {
+            size_t txn_size;
+            uint8_t artifact_id[16];
+
+            memset(artifact_id, 0, sizeof(artifact_id));
+            artifact_id[15] = (uint8_t)i;
+
+            vccert_builder_reset(&txn);
+            vccert_builder_add_short_uint32(
+                &txn, VCCERT_FIELD_TYPE_CERTIFICATE_VERSION, 0x00010000UL);
+            vccert_builder_add_short_UUID(
+                &txn, VCCERT_FIELD_TYPE_TRANSACTION_TYPE, TXN_TYPE);
+            vccert_builder_add_short_UUID(
+                &txn, VCCERT_FIELD_TYPE_ARTIFACT_ID, artifact_id);
+            vccert_builder_add_short_uint64(
+                &txn, VCCERT_FIELD_TYPE_VELO_RESERVED_0086, i);
+            retval = vccert_builder_sign(&txn, SIGNER_ID, &private_key);
+            if (0 != retval)
+                break;
+
+            const uint8_t* txn_cert = vccert_builder_emit(&txn, &txn_size);
+            std::vector<uint8_t> copy(txn_cert, txn_cert + txn_size);
+            if (i == tamper_index)
+            {
+                copy[7] ^= 0x01;
+            }
+
+            retval =
+                vccert_builder_add_short_buffer(
+                    &block, VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE,
+                    copy.data(), copy.size());
+        }
+
+        if (0 == retval)
+        {
+            retval = vccert_builder_sign(&block, SIGNER_ID, &private_key);
+        }
+
+        dispose((disposable_t*)&txn);
+
+        return retval;
+    }
+
+    int suite_init_result, builder_opts_init_result, options_init_result;
+    int block_init_result, key_init_result, pool_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t options;
+    vccert_builder_context_t block;
+    vccrypt_buffer_t private_key;
+    vccert_thread_pool_t pool;
+    std::vector<uint64_t> contracts_run;
+    uint64_t fail_contract_at;
+};
+
+TEST_SUITE(vccert_block_validate_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_block_validate_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that a valid block passes, both on a pool and on the calling thread.
+ */
+BEGIN_TEST_F(happy_path)
+    vccert_parser_context_t parser;
+    size_t size, failed_txn;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(
+        0 == fixture.build_block(VALIDATE_TXN_COUNT, VALIDATE_TXN_COUNT));
+
+    const uint8_t* cert = vccert_builder_emit(&fixture.block, &size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+
+    TEST_EXPECT(
+        0
+            == vccert_block_validate(
+                    &parser, VALIDATE_HEIGHT, true, &fixture.pool,
+                    &failed_txn));
+    TEST_EXPECT(VCCERT_BLOCK_NO_TXN == failed_txn);
+    TEST_EXPECT(VALIDATE_TXN_COUNT == fixture.contracts_run.size());
+
+    TEST_EXPECT(
+        0
+            == vccert_block_validate(
+                    &parser, VALIDATE_HEIGHT, false, nullptr, &failed_txn));
+    TEST_EXPECT(VCCERT_BLOCK_NO_TXN == failed_txn);
+    TEST_EXPECT(VALIDATE_TXN_COUNT == fixture.contracts_run.size());
+
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that contracts run exactly once each, in block order.
+ */
+BEGIN_TEST_F(contract_order)
+    vccert_parser_context_t parser;
+    size_t size, failed_txn;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(
+        0 == fixture.build_block(VALIDATE_TXN_COUNT, VALIDATE_TXN_COUNT));
+
+    const uint8_t* cert = vccert_builder_emit(&fixture.block, &size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+
+    for (int pass = 0; pass < 10; ++pass)
+    {
+        fixture.contracts_run.clear();
+        TEST_ASSERT(
+            0
+                == vccert_block_validate(
+                        &parser, VALIDATE_HEIGHT, true, &fixture.pool,
+                        &failed_txn));
+        TEST_ASSERT(VALIDATE_TXN_COUNT == fixture.contracts_run.size());
+        for (size_t i = 0; i < VALIDATE_TXN_COUNT; ++i)
+        {
+            TEST_EXPECT(i == fixture.contracts_run[i]);
+        }
+    }
+
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that no contract runs after the first failing contract.
+ */
+BEGIN_TEST_F(contract_failure)
+    vccert_parser_context_t parser;
+    size_t size, failed_txn;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(
+        0 == fixture.build_block(VALIDATE_TXN_COUNT, VALIDATE_TXN_COUNT));
+
+    const uint8_t* cert = vccert_builder_emit(&fixture.block, &size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+
+    fixture.fail_contract_at = 5;
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_ATTEST_CONTRACT_VERIFICATION
+            == vccert_block_validate(
+                    &parser, VALIDATE_HEIGHT, true, &fixture.pool,
+                    &failed_txn));
+    TEST_EXPECT(5U == failed_txn);
+    TEST_EXPECT(6U == fixture.contracts_run.size());
+
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that a transaction with a bad signature is reported by index, and that
+ * no contract runs from that transaction on.
+ */
+BEGIN_TEST_F(bad_txn_signature)
+    vccert_parser_context_t parser;
+    size_t size, failed_txn;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(0 == fixture.build_block(VALIDATE_TXN_COUNT, 17));
+
+    const uint8_t* cert = vccert_builder_emit(&fixture.block, &size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_ATTEST_SIGNATURE_MISMATCH
+            == vccert_block_validate(
+                    &parser, VALIDATE_HEIGHT, true, &fixture.pool,
+                    &failed_txn));
+    TEST_EXPECT(17U == failed_txn);
+    TEST_EXPECT(17U == fixture.contracts_run.size());
+
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that a block with a bad signature fails without blaming a transaction.
+ */
+BEGIN_TEST_F(bad_block_signature)
+    vccert_parser_context_t parser;
+    size_t size, failed_txn;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(
+        0 == fixture.build_block(VALIDATE_TXN_COUNT, VALIDATE_TXN_COUNT));
+
+    const uint8_t* cert = vccert_builder_emit(&fixture.block, &size);
+    std::vector<uint8_t> copy(cert, cert + size);
+    copy[7] ^= 0x01;
+    TEST_ASSERT(
+        0
+            == vccert_parser_init(
+                    &fixture.options, &parser, copy.data(), copy.size()));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_ATTEST_SIGNATURE_MISMATCH
+            == vccert_block_validate(
+                    &parser, VALIDATE_HEIGHT, true, &fixture.pool,
+                    &failed_txn));
+    TEST_EXPECT(VCCERT_BLOCK_NO_TXN == failed_txn);
+
+    /* with a single worker, the block signature is checked first, so no
+     * contract runs at all. */
+    vccert_thread_pool_t single;
+    TEST_ASSERT(0 == vccert_thread_pool_init(&single, &fixture.alloc_opts, 1));
+    fixture.contracts_run.clear();
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_ATTEST_SIGNATURE_MISMATCH
+            == vccert_block_validate(
+                    &parser, VALIDATE_HEIGHT, true, &single, &failed_txn));
+    TEST_EXPECT(fixture.contracts_run.empty());
+    dispose((disposable_t*)&single);
+
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that a transaction appended after the block signature is rejected.
+ */
+BEGIN_TEST_F(unsigned_txn)
+    vccert_parser_context_t parser;
+    size_t size, failed_txn;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(0 == fixture.build_block(3, 3));
+
+    /* append a copy of the first transaction after the signature. */
+    const uint8_t* cert = vccert_builder_emit(&fixture.block, &size);
+    std::vector<uint8_t> copy(cert, cert + size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+    const uint8_t* txn;
+    size_t txn_size;
+    TEST_ASSERT(
+        0
+            == vccert_parser_find_short(
+                    &parser, VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE, &txn,
+                    &txn_size));
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_buffer(
+                    &fixture.block,
+                    VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE,
+                    copy.data() + (txn - cert), txn_size));
+    dispose((disposable_t*)&parser);
+
+    cert = vccert_builder_emit(&fixture.block, &size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_VALIDATE_UNSIGNED_TXN
+            == vccert_block_validate(
+                    &parser, VALIDATE_HEIGHT, true, &fixture.pool,
+                    &failed_txn));
+    TEST_EXPECT(3U == failed_txn);
+
+    /* with a single worker, the unsigned transaction's contract never runs. */
+    vccert_thread_pool_t single;
+    TEST_ASSERT(0 == vccert_thread_pool_init(&single, &fixture.alloc_opts, 1));
+    fixture.contracts_run.clear();
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_VALIDATE_UNSIGNED_TXN
+            == vccert_block_validate(
+                    &parser, VALIDATE_HEIGHT, true, &single, &failed_txn));
+    TEST_EXPECT(3U == fixture.contracts_run.size());
+    dispose((disposable_t*)&single);
+
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that an earlier failing transaction is reported ahead of a later one
+ * that lies outside the signed part of the block.
+ */
+BEGIN_TEST_F(bad_txn_before_unsigned_txn)
+    vccert_parser_context_t parser;
+    size_t size, failed_txn;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    TEST_ASSERT(0 == fixture.build_block(3, 0));
+
+    /* append a copy of the first transaction after the signature. */
+    const uint8_t* cert = vccert_builder_emit(&fixture.block, &size);
+    std::vector<uint8_t> copy(cert, cert + size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+    const uint8_t* txn;
+    size_t txn_size;
+    TEST_ASSERT(
+        0
+            == vccert_parser_find_short(
+                    &parser, VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE, &txn,
+                    &txn_size));
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_buffer(
+                    &fixture.block,
+                    VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE,
+                    copy.data() + (txn - cert), txn_size));
+    dispose((disposable_t*)&parser);
+
+    cert = vccert_builder_emit(&fixture.block, &size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_ATTEST_SIGNATURE_MISMATCH
+            == vccert_block_validate(
+                    &parser, VALIDATE_HEIGHT, true, &fixture.pool,
+                    &failed_txn));
+    TEST_EXPECT(0U == failed_txn);
+
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that vccert_block_validate rejects invalid arguments.
+ */
+BEGIN_TEST_F(invalid_args)
+    vccert_parser_context_t parser;
+    size_t failed_txn;
+
+    memset(&parser, 0, sizeof(parser));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_VALIDATE_INVALID_ARG
+            == vccert_block_validate(
+                    nullptr, VALIDATE_HEIGHT, true, nullptr, &failed_txn));
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_VALIDATE_INVALID_ARG
+            == vccert_block_validate(
+                    &parser, VALIDATE_HEIGHT, true, nullptr, &failed_txn));
+    parser.options = &fixture.options;
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_VALIDATE_INVALID_ARG
+            == vccert_block_validate(
+                    &parser, VALIDATE_HEIGHT, true, nullptr, nullptr));
+END_TEST_F()
+
+/**
+ * Dummy transaction resolver.
+ */
+static bool dummy_txn_resolver(
+    void*, void*, const uint8_t*, const uint8_t*,
+    vccrypt_buffer_t*, bool*)
+{
+    return false;
+}
+
+/**
+ * Dummy artifact state resolver.
+ */
+static int32_t dummy_artifact_state_resolver(
+    void*, void*, const uint8_t*, vccrypt_buffer_t*)
+{
+    return -1;
+}
+
+/**
+ * Return the public half of the test signing key.
+ */
+static bool signer_key_resolver(
+    void*, void*, uint64_t, const uint8_t*,
+    vccrypt_buffer_t* enc_buffer, vccrypt_buffer_t* sign_buffer)
+{
+    memset(enc_buffer->data, 0, enc_buffer->size);
+    memcpy(sign_buffer->data, PRIVATE_KEY + 32, 32);
+
+    return true;
+}
+
+/**
+ * Record the index of each transaction whose contract runs.
+ */
+static bool recording_contract(
+    vccert_parser_context_t* parser, void* context)
+{
+    vccert_block_validate_test* fixture = (vccert_block_validate_test*)context;
+    const uint8_t* value;
+    size_t size;
+    uint64_t index = 0;
+
+    if (0 != vccert_parser_find_short(
+                parser, VCCERT_FIELD_TYPE_VELO_RESERVED_0086, &value, &size)
+     || sizeof(index) != size)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        index = (index << 8) | value[i];
+    }
+
+    fixture->contracts_run.push_back(index);
+
+    return index != fixture->fail_contract_at;
+}
+
+/**
+ * Dummy disposer.
+ */
+static void dummy_dispose(void*)
+{
+}
+
+/**
+ * Contract resolver for the recording contract.
+ */
+static int recording_contract_resolver(
+    void* options, void*, const uint8_t*, const uint8_t*,
+    vccert_contract_closure_t* closure)
+{
+    closure->hdr.dispose = &dummy_dispose;
+    closure->contract_fn = &recording_contract;
+    closure->context = ((vccert_parser_options_t*)options)->context;
+
+    return VCCERT_STATUS_SUCCESS;
+}
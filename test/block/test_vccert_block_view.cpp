@@ -0,0 +1,256 @@
+/**
+ * \file test_vccert_block_view.cpp
+ *
+ * Test the vccert block view.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccert/block.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t BLOCK_TXN_COUNT = 40;
+const size_t BLOCK_CERT_SIZE = 8192;
+
+class vccert_block_view_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        options_init_result =
+            vccert_parser_options_simple_init(
+                &options, &alloc_opts, &crypto_suite);
+
+        block_init_result =
+            vccert_builder_init(&builder_opts, &block, BLOCK_CERT_SIZE);
+    }
+
+    void tearDown()
+    {
+        if (block_init_result == 0)
+        {
+            dispose((disposable_t*)&block);
+        }
+
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Build a block holding the given number of wrapped transactions, each of
+     * which holds its index as a uint64 field.
+     */
+    int build_block(size_t count)
+    {
+        int retval;
+        vccert_builder_context_t txn;
+
+        retval = vccert_builder_init(&builder_opts, &txn, 64);
+        if (0 != retval)
+            return retval;
+
+        retval =
+            vccert_builder_add_short_uint64(
+                &block, VCCERT_FIELD_TYPE_BLOCK_HEIGHT, 77);
+
+        for (size_t i = 0; 0 == retval && i < count; ++i)
+        {
+            size_t txn_size;
+
+            vccert_builder_reset(&txn);
+            vccert_builder_add_short_uint32(
+                &txn, VCCERT_FIELD_TYPE_CERTIFICATE_VERSION, 0x00010000UL);
+            vccert_builder_add_short_uint64(
+                &txn, VCCERT_FIELD_TYPE_VELO_RESERVED_0086, i);
+            const uint8_t* txn_cert = vccert_builder_emit(&txn, &txn_size);
+
+            retval =
+                vccert_builder_add_short_buffer(
+                    &block, VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE,
+                    txn_cert, txn_size);
+        }
+
+        dispose((disposable_t*)&txn);
+
+        return retval;
+    }
+
+    int suite_init_result, builder_opts_init_result, options_init_result;
+    int block_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t options;
+    vccert_builder_context_t block;
+};
+
+TEST_SUITE(vccert_block_view_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_block_view_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that the offset table matches a find_short / find_next walk.
+ */
+BEGIN_TEST_F(matches_find_next)
+    vccert_parser_context_t parser;
+    vccert_block_view_t view;
+    const uint8_t* value;
+    const uint8_t* txn;
+    size_t size, txn_size;
+
+    TEST_ASSERT(0 == fixture.block_init_result);
+    TEST_ASSERT(0 == fixture.build_block(BLOCK_TXN_COUNT));
+
+    const uint8_t* cert = vccert_builder_emit(&fixture.block, &size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+    TEST_ASSERT(
+        0 == vccert_block_view_init(&view, &fixture.alloc_opts, &parser));
+    TEST_ASSERT(BLOCK_TXN_COUNT == vccert_block_txn_count(&view));
+
+    TEST_ASSERT(
+        0
+            == vccert_parser_find_short(
+                    &parser, VCCERT_FIELD_TYPE_WRAPPED_TRANSACTION_TUPLE,
+                    &value, &size));
+    for (size_t i = 0; i < BLOCK_TXN_COUNT; ++i)
+    {
+        TEST_ASSERT(0 == vccert_block_txn_at(&view, i, &txn, &txn_size));
+        TEST_EXPECT(value == txn);
+        TEST_EXPECT(size == txn_size);
+
+        if (i + 1 < BLOCK_TXN_COUNT)
+        {
+            TEST_ASSERT(0 == vccert_parser_find_next(&parser, &value, &size));
+        }
+    }
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_TXN_OUT_OF_RANGE
+            == vccert_block_txn_at(&view, BLOCK_TXN_COUNT, &txn, &txn_size));
+
+    dispose((disposable_t*)&view);
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that a parser can be created directly for any transaction.
+ */
+BEGIN_TEST_F(txn_parser)
+    vccert_parser_context_t parser, txn;
+    vccert_block_view_t view;
+    const uint8_t* value;
+    size_t size;
+
+    TEST_ASSERT(0 == fixture.block_init_result);
+    TEST_ASSERT(0 == fixture.build_block(BLOCK_TXN_COUNT));
+
+    const uint8_t* cert = vccert_builder_emit(&fixture.block, &size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+    TEST_ASSERT(
+        0 == vccert_block_view_init(&view, &fixture.alloc_opts, &parser));
+
+    /* visit the transactions out of order. */
+    for (size_t n = 0; n < BLOCK_TXN_COUNT; ++n)
+    {
+        size_t i = (n * 7) % BLOCK_TXN_COUNT;
+
+        TEST_ASSERT(0 == vccert_block_txn_parser_init(&view, i, &txn));
+        TEST_EXPECT(&fixture.options == txn.options);
+        TEST_ASSERT(
+            0
+                == vccert_parser_find_short(
+                        &txn, VCCERT_FIELD_TYPE_VELO_RESERVED_0086, &value,
+                        &size));
+        TEST_ASSERT(8U == size);
+        TEST_EXPECT(i == value[7]);
+
+        dispose((disposable_t*)&txn);
+    }
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_TXN_OUT_OF_RANGE
+            == vccert_block_txn_parser_init(&view, BLOCK_TXN_COUNT, &txn));
+
+    dispose((disposable_t*)&view);
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that a block without transactions has an empty view.
+ */
+BEGIN_TEST_F(empty_block)
+    vccert_parser_context_t parser;
+    vccert_block_view_t view;
+    size_t size;
+
+    TEST_ASSERT(0 == fixture.block_init_result);
+    TEST_ASSERT(0 == fixture.build_block(0));
+
+    const uint8_t* cert = vccert_builder_emit(&fixture.block, &size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+    TEST_ASSERT(
+        0 == vccert_block_view_init(&view, &fixture.alloc_opts, &parser));
+    TEST_EXPECT(0U == vccert_block_txn_count(&view));
+
+    dispose((disposable_t*)&view);
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that a truncated block is rejected.
+ */
+BEGIN_TEST_F(truncated_block)
+    vccert_parser_context_t parser;
+    vccert_block_view_t view;
+    size_t size;
+
+    TEST_ASSERT(0 == fixture.block_init_result);
+    TEST_ASSERT(0 == fixture.build_block(3));
+
+    const uint8_t* cert = vccert_builder_emit(&fixture.block, &size);
+    TEST_ASSERT(
+        0 == vccert_parser_init(&fixture.options, &parser, cert, size - 1));
+    TEST_EXPECT(
+        VCCERT_ERROR_BLOCK_VIEW_INIT_INVALID_FIELD_SIZE
+            == vccert_block_view_init(&view, &fixture.alloc_opts, &parser));
+
+    dispose((disposable_t*)&parser);
+END_TEST_F()
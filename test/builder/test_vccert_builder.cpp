@@ -593,6 +593,41 @@ BEGIN_TEST_F(vccert_builder_emit)
     TEST_EXPECT(fixture.builder.offset == size);
 END_TEST_F()
 
+/**
+ * Test that resetting a builder rewinds it and clears the written data.
+ */
+BEGIN_TEST_F(vccert_builder_reset)
+    const uint16_t FIELD = 0x1068;
+    const uint8_t VALUE[] = {
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+        0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+    };
+    const uint8_t ZERO[sizeof(VALUE) + FIELD_TYPE_SIZE + FIELD_SIZE_SIZE] = {
+        0 };
+
+    //add a UUID value
+    TEST_ASSERT(
+        0 == vccert_builder_add_short_UUID(&fixture.builder, FIELD, VALUE));
+    TEST_ASSERT(0UL != fixture.builder.offset);
+    void* data = fixture.builder.buffer.data;
+
+    //reset the builder
+    TEST_ASSERT(0 == vccert_builder_reset(&fixture.builder));
+
+    //the buffer is retained, but the offset is rewound and the data cleared
+    TEST_EXPECT(data == fixture.builder.buffer.data);
+    TEST_EXPECT(CERT_MAX_SIZE == fixture.builder.buffer.size);
+    TEST_EXPECT(0UL == fixture.builder.offset);
+    TEST_EXPECT(0 == memcmp(data, ZERO, sizeof(ZERO)));
+
+    //the builder can be used again
+    TEST_ASSERT(
+        0 == vccert_builder_add_short_UUID(&fixture.builder, FIELD, VALUE));
+    TEST_EXPECT(
+        FIELD_TYPE_SIZE + FIELD_SIZE_SIZE + sizeof(VALUE)
+            == fixture.builder.offset);
+END_TEST_F()
+
 static const uint8_t* PRIVATE_KEY =
     (const uint8_t*)"\x65\x93\x21\xd0\x35\xa9\xf8\xcf"
                     "\x35\x37\xd1\xd1\x82\xfd\xee\xf8"
@@ -0,0 +1,231 @@
+/**
+ * \file test_vccert_builder_add_short_array.cpp
+ *
+ * Test the vccert builder numeric array methods.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t ARRAY_CERT_SIZE = 4096;
+const size_t ARRAY_MAX_COUNT = 37;
+
+class vccert_builder_add_short_array_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        expected_init_result =
+            vccert_builder_init(&builder_opts, &expected, ARRAY_CERT_SIZE);
+
+        actual_init_result =
+            vccert_builder_init(&builder_opts, &actual, ARRAY_CERT_SIZE);
+
+        /* fill the inputs with distinct bytes so any misplaced byte shows. */
+        for (size_t i = 0; i < ARRAY_MAX_COUNT; ++i)
+        {
+            fields[i] = (uint16_t)(0x0100 * (i + 1) + 0x20 + i);
+            u64[i] = 0x0102030405060708ULL * (i + 1) + 0x8000000000000000ULL;
+            i64[i] = -(int64_t)(0x0807060504030201LL + i);
+            u32[i] = 0x01020304UL * (uint32_t)(i + 1) + 0x80000000UL;
+        }
+    }
+
+    void tearDown()
+    {
+        if (actual_init_result == 0)
+        {
+            dispose((disposable_t*)&actual);
+        }
+
+        if (expected_init_result == 0)
+        {
+            dispose((disposable_t*)&expected);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Return true if both builders hold identical certificates.
+     */
+    bool same_certificate()
+    {
+        size_t expected_size = 0, actual_size = 0;
+        const uint8_t* e = vccert_builder_emit(&expected, &expected_size);
+        const uint8_t* a = vccert_builder_emit(&actual, &actual_size);
+
+        return
+            expected_size == actual_size
+         && 0 == memcmp(e, a, actual_size);
+    }
+
+    int suite_init_result, builder_opts_init_result;
+    int expected_init_result, actual_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_builder_context_t expected, actual;
+    uint16_t fields[ARRAY_MAX_COUNT];
+    uint64_t u64[ARRAY_MAX_COUNT];
+    int64_t i64[ARRAY_MAX_COUNT];
+    uint32_t u32[ARRAY_MAX_COUNT];
+};
+
+TEST_SUITE(vccert_builder_add_short_array_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_builder_add_short_array_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that the uint32 array encoder matches the per-field encoder for every
+ * count, covering both the vector body and the scalar tail.
+ */
+BEGIN_TEST_F(uint32_array_matches_per_field)
+    TEST_ASSERT(0 == fixture.expected_init_result);
+    TEST_ASSERT(0 == fixture.actual_init_result);
+
+    for (size_t count = 0; count <= ARRAY_MAX_COUNT; ++count)
+    {
+        vccert_builder_reset(&fixture.expected);
+        vccert_builder_reset(&fixture.actual);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            TEST_ASSERT(
+                0
+                    == vccert_builder_add_short_uint32(
+                            &fixture.expected, fixture.fields[i],
+                            fixture.u32[i]));
+        }
+
+        TEST_ASSERT(
+            0
+                == vccert_builder_add_short_uint32_array(
+                        &fixture.actual, fixture.fields, fixture.u32,
+                        count));
+        TEST_EXPECT(fixture.same_certificate());
+    }
+END_TEST_F()
+
+/**
+ * Test that the uint64 array encoder matches the per-field encoder.
+ */
+BEGIN_TEST_F(uint64_array_matches_per_field)
+    TEST_ASSERT(0 == fixture.expected_init_result);
+    TEST_ASSERT(0 == fixture.actual_init_result);
+
+    for (size_t count = 0; count <= ARRAY_MAX_COUNT; ++count)
+    {
+        vccert_builder_reset(&fixture.expected);
+        vccert_builder_reset(&fixture.actual);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            TEST_ASSERT(
+                0
+                    == vccert_builder_add_short_uint64(
+                            &fixture.expected, fixture.fields[i],
+                            fixture.u64[i]));
+        }
+
+        TEST_ASSERT(
+            0
+                == vccert_builder_add_short_uint64_array(
+                        &fixture.actual, fixture.fields, fixture.u64,
+                        count));
+        TEST_EXPECT(fixture.same_certificate());
+    }
+END_TEST_F()
+
+/**
+ * Test that the int64 array encoder matches the per-field encoder.
+ */
+BEGIN_TEST_F(int64_array_matches_per_field)
+    TEST_ASSERT(0 == fixture.expected_init_result);
+    TEST_ASSERT(0 == fixture.actual_init_result);
+
+    for (size_t count = 0; count <= ARRAY_MAX_COUNT; ++count)
+    {
+        vccert_builder_reset(&fixture.expected);
+        vccert_builder_reset(&fixture.actual);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            TEST_ASSERT(
+                0
+                    == vccert_builder_add_short_int64(
+                            &fixture.expected, fixture.fields[i],
+                            fixture.i64[i]));
+        }
+
+        TEST_ASSERT(
+            0
+                == vccert_builder_add_short_int64_array(
+                        &fixture.actual, fixture.fields, fixture.i64,
+                        count));
+        TEST_EXPECT(fixture.same_certificate());
+    }
+END_TEST_F()
+
+/**
+ * Test that an array which does not fit is rejected without writing anything.
+ */
+BEGIN_TEST_F(array_too_big)
+    vccert_builder_context_t small;
+
+    TEST_ASSERT(0 == vccert_builder_init(&fixture.builder_opts, &small, 20));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_ADD_INVALID_ARG
+            == vccert_builder_add_short_uint64_array(
+                    &small, fixture.fields, fixture.u64, 2));
+    TEST_EXPECT(0U == small.offset);
+
+    TEST_EXPECT(
+        0
+            == vccert_builder_add_short_uint32_array(
+                    &small, fixture.fields, fixture.u32, 2));
+    TEST_EXPECT(16U == small.offset);
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_ADD_INVALID_ARG
+            == vccert_builder_add_short_uint32_array(
+                    &small, nullptr, fixture.u32, 1));
+
+    dispose((disposable_t*)&small);
+END_TEST_F()
@@ -0,0 +1,257 @@
+/**
+ * \file test_vccert_builder_pool.cpp
+ *
+ * Test the vccert builder pool methods.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t POOL_CAPACITY = 4;
+const size_t POOL_CERT_SIZE = 1024;
+
+class vccert_builder_pool_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        pool_init_result =
+            vccert_builder_pool_init(
+                &builder_opts, &pool, POOL_CAPACITY, POOL_CERT_SIZE);
+    }
+
+    void tearDown()
+    {
+        if (pool_init_result == 0)
+        {
+            dispose((disposable_t*)&pool);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    int suite_init_result, builder_opts_init_result, pool_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_builder_pool_t pool;
+};
+
+TEST_SUITE(vccert_builder_pool_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_builder_pool_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that invalid arguments to vccert_builder_pool_init are rejected.
+ */
+BEGIN_TEST_F(init_parameter_sanity)
+    vccert_builder_pool_t pool;
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_POOL_INIT_INVALID_ARG
+            == vccert_builder_pool_init(
+                    nullptr, &pool, POOL_CAPACITY, POOL_CERT_SIZE));
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_POOL_INIT_INVALID_ARG
+            == vccert_builder_pool_init(
+                    &fixture.builder_opts, nullptr, POOL_CAPACITY,
+                    POOL_CERT_SIZE));
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_POOL_INIT_INVALID_ARG
+            == vccert_builder_pool_init(
+                    &fixture.builder_opts, &pool, 0, POOL_CERT_SIZE));
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_POOL_INIT_INVALID_ARG
+            == vccert_builder_pool_init(
+                    &fixture.builder_opts, &pool, POOL_CAPACITY, 0));
+END_TEST_F()
+
+/**
+ * Happy path test for vccert_builder_pool_init.
+ */
+BEGIN_TEST_F(init)
+    TEST_ASSERT(0 == fixture.pool_init_result);
+
+    TEST_EXPECT(&fixture.builder_opts == fixture.pool.options);
+    TEST_EXPECT(POOL_CAPACITY == fixture.pool.capacity);
+    TEST_EXPECT(POOL_CAPACITY == fixture.pool.available);
+END_TEST_F()
+
+/**
+ * Test that every context can be acquired, and that the pool reports when it
+ * is exhausted.
+ */
+BEGIN_TEST_F(acquire_exhausted)
+    vccert_builder_context_t* builders[POOL_CAPACITY];
+    vccert_builder_context_t* extra = nullptr;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+
+    for (size_t i = 0; i < POOL_CAPACITY; ++i)
+    {
+        TEST_ASSERT(
+            0 == vccert_builder_pool_acquire(&fixture.pool, &builders[i]));
+        TEST_EXPECT(nullptr != builders[i]);
+        TEST_EXPECT(0UL == builders[i]->offset);
+        TEST_EXPECT(POOL_CERT_SIZE == builders[i]->buffer.size);
+
+        for (size_t j = 0; j < i; ++j)
+        {
+            TEST_EXPECT(builders[j] != builders[i]);
+        }
+    }
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_POOL_EXHAUSTED
+            == vccert_builder_pool_acquire(&fixture.pool, &extra));
+
+    for (size_t i = 0; i < POOL_CAPACITY; ++i)
+    {
+        TEST_ASSERT(
+            0 == vccert_builder_pool_release(&fixture.pool, builders[i]));
+    }
+
+    TEST_EXPECT(POOL_CAPACITY == fixture.pool.available);
+END_TEST_F()
+
+/**
+ * Test that a released context is reset and handed out again without
+ * reallocating its buffer.
+ */
+BEGIN_TEST_F(release_reuses_buffer)
+    vccert_builder_context_t* builder = nullptr;
+    vccert_builder_context_t* builder2 = nullptr;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == vccert_builder_pool_acquire(&fixture.pool, &builder));
+
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_uint64(
+                    builder, VCCERT_FIELD_TYPE_BLOCK_HEIGHT, 12345));
+    void* data = builder->buffer.data;
+
+    TEST_ASSERT(0 == vccert_builder_pool_release(&fixture.pool, builder));
+    TEST_ASSERT(0 == vccert_builder_pool_acquire(&fixture.pool, &builder2));
+
+    TEST_EXPECT(builder == builder2);
+    TEST_EXPECT(data == builder2->buffer.data);
+    TEST_EXPECT(0UL == builder2->offset);
+
+    TEST_ASSERT(0 == vccert_builder_pool_release(&fixture.pool, builder2));
+END_TEST_F()
+
+/**
+ * Test that a context that is not owned by the pool cannot be released to it.
+ */
+BEGIN_TEST_F(release_foreign_context)
+    vccert_builder_context_t foreign;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(
+        0 == vccert_builder_init(&fixture.builder_opts, &foreign, 64));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_POOL_INVALID_ARG
+            == vccert_builder_pool_release(&fixture.pool, &foreign));
+    TEST_EXPECT(POOL_CAPACITY == fixture.pool.available);
+
+    dispose((disposable_t*)&foreign);
+END_TEST_F()
+
+/**
+ * Test that a context cannot be released twice, so that two callers are never
+ * handed the same context.
+ */
+BEGIN_TEST_F(release_twice)
+    vccert_builder_context_t* first = nullptr;
+    vccert_builder_context_t* second = nullptr;
+    vccert_builder_context_t* again = nullptr;
+    vccert_builder_context_t* other = nullptr;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == vccert_builder_pool_acquire(&fixture.pool, &first));
+    TEST_ASSERT(0 == vccert_builder_pool_acquire(&fixture.pool, &second));
+
+    TEST_ASSERT(0 == vccert_builder_pool_release(&fixture.pool, first));
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_POOL_INVALID_ARG
+            == vccert_builder_pool_release(&fixture.pool, first));
+    TEST_EXPECT(POOL_CAPACITY - 1 == fixture.pool.available);
+
+    /* a context that was never acquired cannot be released either. */
+    for (size_t i = 0; i < POOL_CAPACITY; ++i)
+    {
+        vccert_builder_context_t* slot = &fixture.pool.contexts[i];
+
+        if (slot != second)
+        {
+            TEST_EXPECT(
+                VCCERT_ERROR_BUILDER_POOL_INVALID_ARG
+                    == vccert_builder_pool_release(&fixture.pool, slot));
+        }
+    }
+
+    TEST_ASSERT(0 == vccert_builder_pool_acquire(&fixture.pool, &again));
+    TEST_ASSERT(0 == vccert_builder_pool_acquire(&fixture.pool, &other));
+    TEST_EXPECT(again != other);
+    TEST_EXPECT(second != again && second != other);
+
+    TEST_ASSERT(0 == vccert_builder_pool_release(&fixture.pool, again));
+    TEST_ASSERT(0 == vccert_builder_pool_release(&fixture.pool, other));
+    TEST_ASSERT(0 == vccert_builder_pool_release(&fixture.pool, second));
+    TEST_EXPECT(POOL_CAPACITY == fixture.pool.available);
+END_TEST_F()
+
+/**
+ * Test that a pointer into the middle of a pooled context is not a slot.
+ */
+BEGIN_TEST_F(release_misaligned)
+    vccert_builder_context_t* builder = nullptr;
+
+    TEST_ASSERT(0 == fixture.pool_init_result);
+    TEST_ASSERT(0 == vccert_builder_pool_acquire(&fixture.pool, &builder));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_POOL_INVALID_ARG
+            == vccert_builder_pool_release(
+                    &fixture.pool,
+                    (vccert_builder_context_t*)((uint8_t*)builder + 8)));
+
+    TEST_ASSERT(0 == vccert_builder_pool_release(&fixture.pool, builder));
+END_TEST_F()
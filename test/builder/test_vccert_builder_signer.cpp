@@ -0,0 +1,327 @@
+/**
+ * \file test_vccert_builder_signer.cpp
+ *
+ * Test the vccert prepared signer methods.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t SIGNER_CERT_SIZE = 4096;
+
+static const uint8_t* SIGNER_PRIVATE_KEY =
+    (const uint8_t*)"\x65\x93\x21\xd0\x35\xa9\xf8\xcf"
+                    "\x35\x37\xd1\xd1\x82\xfd\xee\xf8"
+                    "\x92\x8e\x0c\xfe\xb4\x56\x4b\x2d"
+                    "\xb5\x11\x60\x6d\xc6\xf6\x13\xbd"
+                    "\x47\x83\xe9\xf6\x78\xd1\x49\xac"
+                    "\xd2\x09\x66\xb0\xab\x88\xf7\xd0"
+                    "\x5d\x6d\x4f\x54\x0f\x1f\x23\x82"
+                    "\x86\x00\x3a\xda\x0c\x27\xcc\x35";
+
+static const uint8_t* PREPARED_SIGNER_ID =
+    (const uint8_t*)"\x71\x1f\x22\x65\xb6\x50\x46\x12"
+                    "\xa7\x3a\xad\x82\x7f\xb2\x71\x18";
+
+static const uint8_t* SIGNER_CERT_ID =
+    (const uint8_t*)"\x1d\x6e\x32\xfa\x1f\x23\x49\xf4"
+                    "\xa5\xaa\x57\x05\x48\x93\xc5\xf6";
+
+class vccert_builder_signer_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        private_key_buffer_result =
+            vccrypt_suite_buffer_init_for_signature_private_key(
+                &crypto_suite, &private_key_buffer);
+        if (0 == private_key_buffer_result)
+        {
+            vccrypt_buffer_read_data(
+                &private_key_buffer, SIGNER_PRIVATE_KEY, 64);
+        }
+
+        signer_init_result =
+            vccert_builder_signer_init(
+                &builder_opts, &signer, PREPARED_SIGNER_ID,
+                &private_key_buffer);
+    }
+
+    void tearDown()
+    {
+        if (signer_init_result == 0)
+        {
+            dispose((disposable_t*)&signer);
+        }
+
+        if (private_key_buffer_result == 0)
+        {
+            dispose((disposable_t*)&private_key_buffer);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Build a small unsigned certificate with the given version.
+     */
+    int build_unsigned(vccert_builder_context_t* builder, uint32_t version)
+    {
+        int retval =
+            vccert_builder_add_short_uint32(
+                builder, VCCERT_FIELD_TYPE_CERTIFICATE_VERSION, version);
+        if (0 != retval)
+            return retval;
+
+        return
+            vccert_builder_add_short_UUID(
+                builder, VCCERT_FIELD_TYPE_CERTIFICATE_ID, SIGNER_CERT_ID);
+    }
+
+    int suite_init_result, builder_opts_init_result;
+    int private_key_buffer_result, signer_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccrypt_buffer_t private_key_buffer;
+    vccert_builder_signer_t signer;
+};
+
+TEST_SUITE(vccert_builder_signer_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_builder_signer_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Happy path test for vccert_builder_signer_init.
+ */
+BEGIN_TEST_F(init)
+    TEST_ASSERT(0 == fixture.signer_init_result);
+
+    TEST_EXPECT(
+        0 == memcmp(fixture.signer.signer_id, PREPARED_SIGNER_ID, 16));
+    TEST_EXPECT(
+        fixture.private_key_buffer.size == fixture.signer.private_key.size);
+    TEST_EXPECT(
+        0
+            == memcmp(
+                    fixture.signer.private_key.data, SIGNER_PRIVATE_KEY,
+                    fixture.signer.private_key.size));
+END_TEST_F()
+
+/**
+ * Test that vccert_builder_signer_init rejects invalid arguments.
+ */
+BEGIN_TEST_F(init_invalid_args)
+    vccert_builder_signer_t other;
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_SIGNER_INIT_INVALID_ARG
+            == vccert_builder_signer_init(
+                    nullptr, &other, PREPARED_SIGNER_ID,
+                    &fixture.private_key_buffer));
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_SIGNER_INIT_INVALID_ARG
+            == vccert_builder_signer_init(
+                    &fixture.builder_opts, nullptr, PREPARED_SIGNER_ID,
+                    &fixture.private_key_buffer));
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_SIGNER_INIT_INVALID_ARG
+            == vccert_builder_signer_init(
+                    &fixture.builder_opts, &other, nullptr,
+                    &fixture.private_key_buffer));
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_SIGNER_INIT_INVALID_ARG
+            == vccert_builder_signer_init(
+                    &fixture.builder_opts, &other, PREPARED_SIGNER_ID,
+                    nullptr));
+END_TEST_F()
+
+/**
+ * Test that a prepared signer produces the same certificates as
+ * vccert_builder_sign, and that it can be reused.
+ */
+BEGIN_TEST_F(prepared_matches_sign)
+    vccert_builder_context_t expected, actual;
+
+    TEST_ASSERT(0 == fixture.signer_init_result);
+    TEST_ASSERT(
+        0
+            == vccert_builder_init(
+                    &fixture.builder_opts, &expected, SIGNER_CERT_SIZE));
+    TEST_ASSERT(
+        0
+            == vccert_builder_init(
+                    &fixture.builder_opts, &actual, SIGNER_CERT_SIZE));
+
+    for (uint32_t version = 1; version <= 3; ++version)
+    {
+        size_t expected_size = 0, actual_size = 0;
+
+        vccert_builder_reset(&expected);
+        vccert_builder_reset(&actual);
+
+        TEST_ASSERT(0 == fixture.build_unsigned(&expected, version));
+        TEST_ASSERT(0 == fixture.build_unsigned(&actual, version));
+
+        TEST_ASSERT(
+            0
+                == vccert_builder_sign(
+                        &expected, PREPARED_SIGNER_ID,
+                        &fixture.private_key_buffer));
+        TEST_ASSERT(
+            0 == vccert_builder_sign_prepared(&actual, &fixture.signer));
+
+        const uint8_t* expected_cert =
+            vccert_builder_emit(&expected, &expected_size);
+        const uint8_t* actual_cert =
+            vccert_builder_emit(&actual, &actual_size);
+
+        TEST_ASSERT(expected_size == actual_size);
+        TEST_EXPECT(0 == memcmp(expected_cert, actual_cert, actual_size));
+    }
+
+    dispose((disposable_t*)&actual);
+    dispose((disposable_t*)&expected);
+END_TEST_F()
+
+/**
+ * Test that vccert_builder_sign_prepared refuses to overrun the builder.
+ */
+BEGIN_TEST_F(sign_prepared_too_small)
+    vccert_builder_context_t builder;
+
+    TEST_ASSERT(0 == fixture.signer_init_result);
+    TEST_ASSERT(0 == vccert_builder_init(&fixture.builder_opts, &builder, 64));
+    TEST_ASSERT(0 == fixture.build_unsigned(&builder, 1));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_SIGN_INVALID_FIELD_SIZE
+            == vccert_builder_sign_prepared(&builder, &fixture.signer));
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_SIGN_PREPARED_INVALID_ARG
+            == vccert_builder_sign_prepared(&builder, nullptr));
+
+    dispose((disposable_t*)&builder);
+END_TEST_F()
+
+/**
+ * Test that signing a batch across a thread pool produces the same
+ * certificates as signing each one with vccert_builder_sign_prepared.
+ */
+BEGIN_TEST_F(sign_batch_matches_prepared)
+    const size_t BATCH_SIZE = 32;
+    vccert_thread_pool_t pool;
+    vccert_builder_context_t expected[BATCH_SIZE], actual[BATCH_SIZE];
+    vccert_builder_context_t* batch[BATCH_SIZE];
+    int status[BATCH_SIZE];
+
+    TEST_ASSERT(0 == fixture.signer_init_result);
+    TEST_ASSERT(0 == vccert_thread_pool_init(&pool, &fixture.alloc_opts, 4));
+
+    for (size_t i = 0; i < BATCH_SIZE; ++i)
+    {
+        TEST_ASSERT(
+            0
+                == vccert_builder_init(
+                        &fixture.builder_opts, &expected[i],
+                        SIGNER_CERT_SIZE));
+        TEST_ASSERT(
+            0
+                == vccert_builder_init(
+                        &fixture.builder_opts, &actual[i], SIGNER_CERT_SIZE));
+        TEST_ASSERT(0 == fixture.build_unsigned(&expected[i], i));
+        TEST_ASSERT(0 == fixture.build_unsigned(&actual[i], i));
+        TEST_ASSERT(
+            0 == vccert_builder_sign_prepared(&expected[i], &fixture.signer));
+
+        batch[i] = &actual[i];
+        status[i] = -1;
+    }
+
+    TEST_EXPECT(
+        0
+            == vccert_builder_sign_batch(
+                    batch, BATCH_SIZE, &fixture.signer, &pool, status));
+
+    for (size_t i = 0; i < BATCH_SIZE; ++i)
+    {
+        size_t expected_size = 0, actual_size = 0;
+        const uint8_t* expected_cert =
+            vccert_builder_emit(&expected[i], &expected_size);
+        const uint8_t* actual_cert =
+            vccert_builder_emit(&actual[i], &actual_size);
+
+        TEST_EXPECT(0 == status[i]);
+        TEST_ASSERT(expected_size == actual_size);
+        TEST_EXPECT(0 == memcmp(expected_cert, actual_cert, actual_size));
+
+        dispose((disposable_t*)&actual[i]);
+        dispose((disposable_t*)&expected[i]);
+    }
+
+    dispose((disposable_t*)&pool);
+END_TEST_F()
+
+/**
+ * Test that one failing context in a batch is reported without stopping the
+ * rest of the batch.
+ */
+BEGIN_TEST_F(sign_batch_per_context_status)
+    vccert_builder_context_t good, small;
+    vccert_builder_context_t* batch[2] = { &good, &small };
+    int status[2] = { -1, -1 };
+
+    TEST_ASSERT(0 == fixture.signer_init_result);
+    TEST_ASSERT(
+        0
+            == vccert_builder_init(
+                    &fixture.builder_opts, &good, SIGNER_CERT_SIZE));
+    TEST_ASSERT(0 == vccert_builder_init(&fixture.builder_opts, &small, 64));
+    TEST_ASSERT(0 == fixture.build_unsigned(&good, 1));
+    TEST_ASSERT(0 == fixture.build_unsigned(&small, 1));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_SIGN_BATCH_FAILED
+            == vccert_builder_sign_batch(
+                    batch, 2, &fixture.signer, nullptr, status));
+    TEST_EXPECT(0 == status[0]);
+    TEST_EXPECT(VCCERT_ERROR_BUILDER_SIGN_INVALID_FIELD_SIZE == status[1]);
+
+    dispose((disposable_t*)&small);
+    dispose((disposable_t*)&good);
+END_TEST_F()
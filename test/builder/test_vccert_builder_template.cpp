@@ -0,0 +1,335 @@
+/**
+ * \file test_vccert_builder_template.cpp
+ *
+ * Test the vccert builder template methods.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <cstring>
+#include <minunit/minunit.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t TEMPLATE_CERT_SIZE = 4096;
+
+static const uint8_t* TEMPLATE_PRIVATE_KEY =
+    (const uint8_t*)"\x65\x93\x21\xd0\x35\xa9\xf8\xcf"
+                    "\x35\x37\xd1\xd1\x82\xfd\xee\xf8"
+                    "\x92\x8e\x0c\xfe\xb4\x56\x4b\x2d"
+                    "\xb5\x11\x60\x6d\xc6\xf6\x13\xbd"
+                    "\x47\x83\xe9\xf6\x78\xd1\x49\xac"
+                    "\xd2\x09\x66\xb0\xab\x88\xf7\xd0"
+                    "\x5d\x6d\x4f\x54\x0f\x1f\x23\x82"
+                    "\x86\x00\x3a\xda\x0c\x27\xcc\x35";
+
+static const uint8_t* TEMPLATE_SIGNER_ID =
+    (const uint8_t*)"\x71\x1f\x22\x65\xb6\x50\x46\x12"
+                    "\xa7\x3a\xad\x82\x7f\xb2\x71\x18";
+
+static const uint8_t* CERT_TYPE =
+    (const uint8_t*)"\x52\xa7\xf0\xfb\x8a\x6b\x4d\x03"
+                    "\x86\xa5\x7f\x61\x2f\xcf\x7e\xff";
+
+static const uint8_t* TXN_TYPE =
+    (const uint8_t*)"\x17\xe1\xfc\x1f\x5d\xd9\x44\xa9"
+                    "\xb4\x9d\x1b\x6c\x1e\xb6\xd0\x11";
+
+static const uint8_t* CERT_ID =
+    (const uint8_t*)"\x1d\x6e\x32\xfa\x1f\x23\x49\xf4"
+                    "\xa5\xaa\x57\x05\x48\x93\xc5\xf6";
+
+static const uint8_t* ARTIFACT_ID =
+    (const uint8_t*)"\x3e\xe2\x99\x7b\x2d\x4f\x48\x2e"
+                    "\x86\x58\x88\x86\x06\xd1\x35\x03";
+
+class vccert_builder_template_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        template_init_result =
+            vccert_builder_template_init(
+                &builder_opts, &tmpl, TEMPLATE_CERT_SIZE);
+
+        builder_init_result =
+            vccert_builder_init(&builder_opts, &builder, TEMPLATE_CERT_SIZE);
+
+        private_key_buffer_result =
+            vccrypt_suite_buffer_init_for_signature_private_key(
+                &crypto_suite, &private_key_buffer);
+        if (0 == private_key_buffer_result)
+        {
+            vccrypt_buffer_read_data(
+                &private_key_buffer, TEMPLATE_PRIVATE_KEY, 64);
+        }
+    }
+
+    void tearDown()
+    {
+        if (private_key_buffer_result == 0)
+        {
+            dispose((disposable_t*)&private_key_buffer);
+        }
+
+        if (builder_init_result == 0)
+        {
+            dispose((disposable_t*)&builder);
+        }
+
+        if (template_init_result == 0)
+        {
+            dispose((disposable_t*)&tmpl);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    int suite_init_result, builder_opts_init_result, template_init_result;
+    int builder_init_result, private_key_buffer_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_builder_template_t tmpl;
+    vccert_builder_context_t builder;
+    vccrypt_buffer_t private_key_buffer;
+};
+
+TEST_SUITE(vccert_builder_template_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_builder_template_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Happy path test for vccert_builder_template_init.
+ */
+BEGIN_TEST_F(init)
+    TEST_ASSERT(0 == fixture.template_init_result);
+
+    TEST_EXPECT(0UL == fixture.tmpl.slot_count);
+    TEST_EXPECT(0UL == fixture.tmpl.builder.offset);
+    TEST_EXPECT(TEMPLATE_CERT_SIZE == fixture.tmpl.builder.buffer.size);
+END_TEST_F()
+
+/**
+ * Test that a certificate built from a patched template is identical to one
+ * built field by field.
+ */
+BEGIN_TEST_F(patched_template_matches_builder)
+    size_t id_slot, artifact_slot, date_slot, state_slot;
+
+    TEST_ASSERT(0 == fixture.template_init_result);
+    TEST_ASSERT(0 == fixture.builder_init_result);
+    TEST_ASSERT(0 == fixture.private_key_buffer_result);
+
+    /* build the template prefix. */
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_uint32(
+                    &fixture.tmpl.builder,
+                    VCCERT_FIELD_TYPE_CERTIFICATE_VERSION, 0x00010000UL));
+    TEST_ASSERT(
+        0
+            == vccert_builder_template_add_slot(
+                    &fixture.tmpl, VCCERT_FIELD_TYPE_CERTIFICATE_VALID_FROM,
+                    sizeof(uint64_t), &date_slot));
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_uint16(
+                    &fixture.tmpl.builder,
+                    VCCERT_FIELD_TYPE_CERTIFICATE_CRYPTO_SUITE, 0x0001));
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_UUID(
+                    &fixture.tmpl.builder, VCCERT_FIELD_TYPE_CERTIFICATE_TYPE,
+                    CERT_TYPE));
+    TEST_ASSERT(
+        0
+            == vccert_builder_template_add_slot(
+                    &fixture.tmpl, VCCERT_FIELD_TYPE_CERTIFICATE_ID, 16,
+                    &id_slot));
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_UUID(
+                    &fixture.tmpl.builder, VCCERT_FIELD_TYPE_TRANSACTION_TYPE,
+                    TXN_TYPE));
+    TEST_ASSERT(
+        0
+            == vccert_builder_template_add_slot(
+                    &fixture.tmpl, VCCERT_FIELD_TYPE_ARTIFACT_ID, 16,
+                    &artifact_slot));
+    TEST_ASSERT(
+        0
+            == vccert_builder_template_add_slot(
+                    &fixture.tmpl, VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE,
+                    sizeof(uint16_t), &state_slot));
+    TEST_EXPECT(4UL == fixture.tmpl.slot_count);
+
+    /* apply and patch the template. */
+    TEST_ASSERT(
+        0 == vccert_builder_template_apply(&fixture.tmpl, &fixture.builder));
+    TEST_ASSERT(
+        0
+            == vccert_builder_template_patch_uint64(
+                    &fixture.tmpl, &fixture.builder, date_slot, 1515987826));
+    TEST_ASSERT(
+        0
+            == vccert_builder_template_patch_UUID(
+                    &fixture.tmpl, &fixture.builder, id_slot, CERT_ID));
+    TEST_ASSERT(
+        0
+            == vccert_builder_template_patch_UUID(
+                    &fixture.tmpl, &fixture.builder, artifact_slot,
+                    ARTIFACT_ID));
+    TEST_ASSERT(
+        0
+            == vccert_builder_template_patch_uint16(
+                    &fixture.tmpl, &fixture.builder, state_slot, 0x0003));
+    TEST_ASSERT(
+        0
+            == vccert_builder_sign(
+                    &fixture.builder, TEMPLATE_SIGNER_ID,
+                    &fixture.private_key_buffer));
+
+    /* build the same certificate field by field. */
+    vccert_builder_context_t direct;
+    TEST_ASSERT(
+        0
+            == vccert_builder_init(
+                    &fixture.builder_opts, &direct, TEMPLATE_CERT_SIZE));
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_uint32(
+                    &direct, VCCERT_FIELD_TYPE_CERTIFICATE_VERSION,
+                    0x00010000UL));
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_uint64(
+                    &direct, VCCERT_FIELD_TYPE_CERTIFICATE_VALID_FROM,
+                    1515987826));
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_uint16(
+                    &direct, VCCERT_FIELD_TYPE_CERTIFICATE_CRYPTO_SUITE,
+                    0x0001));
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_UUID(
+                    &direct, VCCERT_FIELD_TYPE_CERTIFICATE_TYPE, CERT_TYPE));
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_UUID(
+                    &direct, VCCERT_FIELD_TYPE_CERTIFICATE_ID, CERT_ID));
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_UUID(
+                    &direct, VCCERT_FIELD_TYPE_TRANSACTION_TYPE, TXN_TYPE));
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_UUID(
+                    &direct, VCCERT_FIELD_TYPE_ARTIFACT_ID, ARTIFACT_ID));
+    TEST_ASSERT(
+        0
+            == vccert_builder_add_short_uint16(
+                    &direct, VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE, 0x0003));
+    TEST_ASSERT(
+        0
+            == vccert_builder_sign(
+                    &direct, TEMPLATE_SIGNER_ID, &fixture.private_key_buffer));
+
+    size_t templated_size, direct_size;
+    const uint8_t* templated =
+        vccert_builder_emit(&fixture.builder, &templated_size);
+    const uint8_t* expected = vccert_builder_emit(&direct, &direct_size);
+
+    TEST_EXPECT(direct_size == templated_size);
+    TEST_EXPECT(0 == memcmp(expected, templated, direct_size));
+
+    dispose((disposable_t*)&direct);
+END_TEST_F()
+
+/**
+ * Test that a slot can only be patched with a value of the same size.
+ */
+BEGIN_TEST_F(patch_size_mismatch)
+    size_t slot;
+
+    TEST_ASSERT(0 == fixture.template_init_result);
+    TEST_ASSERT(0 == fixture.builder_init_result);
+
+    TEST_ASSERT(
+        0
+            == vccert_builder_template_add_slot(
+                    &fixture.tmpl, VCCERT_FIELD_TYPE_BLOCK_HEIGHT,
+                    sizeof(uint64_t), &slot));
+    TEST_ASSERT(
+        0 == vccert_builder_template_apply(&fixture.tmpl, &fixture.builder));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_TEMPLATE_SLOT_SIZE_MISMATCH
+            == vccert_builder_template_patch_uint32(
+                    &fixture.tmpl, &fixture.builder, slot, 7));
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_TEMPLATE_INVALID_ARG
+            == vccert_builder_template_patch_uint64(
+                    &fixture.tmpl, &fixture.builder, slot + 1, 7));
+    TEST_EXPECT(
+        0
+            == vccert_builder_template_patch_uint64(
+                    &fixture.tmpl, &fixture.builder, slot, 7));
+END_TEST_F()
+
+/**
+ * Test that a template holds at most VCCERT_BUILDER_TEMPLATE_MAX_SLOTS slots.
+ */
+BEGIN_TEST_F(too_many_slots)
+    size_t slot;
+
+    TEST_ASSERT(0 == fixture.template_init_result);
+
+    for (size_t i = 0; i < VCCERT_BUILDER_TEMPLATE_MAX_SLOTS; ++i)
+    {
+        TEST_ASSERT(
+            0
+                == vccert_builder_template_add_slot(
+                        &fixture.tmpl, VCCERT_FIELD_TYPE_BLOCK_HEIGHT,
+                        sizeof(uint64_t), &slot));
+        TEST_EXPECT(i == slot);
+    }
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_TEMPLATE_TOO_MANY_SLOTS
+            == vccert_builder_template_add_slot(
+                    &fixture.tmpl, VCCERT_FIELD_TYPE_BLOCK_HEIGHT,
+                    sizeof(uint64_t), &slot));
+END_TEST_F()
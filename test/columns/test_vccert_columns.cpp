@@ -0,0 +1,282 @@
+/**
+ * \file test_vccert_columns.cpp
+ *
+ * Test column extraction.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccert/builder.h>
+#include <vccert/columns.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t COLUMNS_ROW_COUNT = 2000;
+const size_t COLUMNS_WORKERS = 4;
+
+class vccert_columns_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        heights.resize(COLUMNS_ROW_COUNT);
+        versions.resize(COLUMNS_ROW_COUNT);
+        flags.resize(COLUMNS_ROW_COUNT);
+        artifacts.resize(COLUMNS_ROW_COUNT);
+        missing.resize(COLUMNS_ROW_COUNT);
+
+        columns[0] = {
+            VCCERT_FIELD_TYPE_CERTIFICATE_VALID_FROM,
+            VCCERT_SCHEMA_TYPE_UINT64, heights.data() };
+        columns[1] = {
+            VCCERT_FIELD_TYPE_CERTIFICATE_VERSION, VCCERT_SCHEMA_TYPE_UINT32,
+            versions.data() };
+        columns[2] = {
+            VCCERT_FIELD_TYPE_VELO_RESERVED_0086, VCCERT_SCHEMA_TYPE_INT8,
+            flags.data() };
+        columns[3] = {
+            VCCERT_FIELD_TYPE_ARTIFACT_ID, VCCERT_SCHEMA_TYPE_DATA_BLOB,
+            artifacts.data() };
+    }
+
+    void tearDown()
+    {
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Append a framed certificate for the given row.  Every third row has no
+     * version, and every fifth row has a flag of the wrong size.
+     */
+    int append(size_t row)
+    {
+        vccert_builder_context_t builder;
+        uint8_t id[16];
+        size_t size;
+
+        int retval = vccert_builder_init(&builder_opts, &builder, 256);
+        if (0 != retval)
+            return retval;
+
+        memset(id, (uint8_t)row, sizeof(id));
+        if (0 != row % 3)
+        {
+            vccert_builder_add_short_uint32(
+                &builder, VCCERT_FIELD_TYPE_CERTIFICATE_VERSION,
+                (uint32_t)row);
+        }
+
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_ARTIFACT_ID, id);
+        if (0 == row % 5)
+        {
+            vccert_builder_add_short_int16(
+                &builder, VCCERT_FIELD_TYPE_VELO_RESERVED_0086, -1);
+        }
+        else
+        {
+            vccert_builder_add_short_int8(
+                &builder, VCCERT_FIELD_TYPE_VELO_RESERVED_0086,
+                (int8_t)-row);
+        }
+
+        vccert_builder_add_short_uint64(
+            &builder, VCCERT_FIELD_TYPE_CERTIFICATE_VALID_FROM,
+            row * 0x100000001ULL);
+
+        const uint8_t* cert = vccert_builder_emit(&builder, &size);
+        for (int shift = 24; shift >= 0; shift -= 8)
+        {
+            data.push_back((uint8_t)(size >> shift));
+        }
+
+        offsets.push_back(data.size());
+        sizes.push_back(size);
+        data.insert(data.end(), cert, cert + size);
+        dispose((disposable_t*)&builder);
+
+        return 0;
+    }
+
+    /**
+     * Fill the batch with certificates.
+     */
+    int fill()
+    {
+        for (size_t i = 0; i < COLUMNS_ROW_COUNT; ++i)
+        {
+            int retval = append(i);
+            if (0 != retval)
+                return retval;
+        }
+
+        for (size_t i = 0; i < COLUMNS_ROW_COUNT; ++i)
+        {
+            certs.push_back(data.data() + offsets[i]);
+        }
+
+        return 0;
+    }
+
+    /**
+     * Check the extracted columns against the way the batch was filled.
+     */
+    bool check_columns()
+    {
+        for (size_t i = 0; i < COLUMNS_ROW_COUNT; ++i)
+        {
+            uint64_t expected_missing =
+                (0 == i % 3 ? 2 : 0) | (0 == i % 5 ? 4 : 0);
+
+            if (expected_missing != missing[i]
+             || i * 0x100000001ULL != heights[i]
+             || (0 == i % 3 ? 0 : i) != versions[i]
+             || (0 == i % 5 ? 0 : (int8_t)-i) != flags[i]
+             || 16 != artifacts[i].size
+             || artifacts[i].offset >= sizes[i]
+             || (uint8_t)i != certs[i][artifacts[i].offset + 15])
+                return false;
+        }
+
+        return true;
+    }
+
+    int suite_init_result, builder_opts_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    std::vector<uint8_t> data;
+    std::vector<size_t> offsets, sizes;
+    std::vector<const uint8_t*> certs;
+    std::vector<uint64_t> heights;
+    std::vector<uint32_t> versions;
+    std::vector<int8_t> flags;
+    std::vector<vccert_column_span_t> artifacts;
+    std::vector<uint64_t> missing;
+    vccert_column_t columns[4];
+};
+
+TEST_SUITE(vccert_columns_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_columns_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that columns are extracted from a batch on one thread and across a
+ * thread pool.
+ */
+BEGIN_TEST_F(extract)
+    vccert_thread_pool_t pool;
+    size_t failed;
+
+    TEST_ASSERT(0 == fixture.fill());
+
+    TEST_ASSERT(
+        0
+            == vccert_columns_extract(
+                    fixture.columns, 4, fixture.certs.data(),
+                    fixture.sizes.data(), COLUMNS_ROW_COUNT, nullptr,
+                    fixture.missing.data(), &failed));
+    TEST_EXPECT(VCCERT_COLUMNS_NO_ROW == failed);
+    TEST_EXPECT(fixture.check_columns());
+
+    TEST_ASSERT(
+        0
+            == vccert_thread_pool_init(
+                    &pool, &fixture.alloc_opts, COLUMNS_WORKERS));
+    memset(fixture.missing.data(), 0, COLUMNS_ROW_COUNT * sizeof(uint64_t));
+    TEST_EXPECT(
+        0
+            == vccert_columns_extract(
+                    fixture.columns, 4, fixture.certs.data(),
+                    fixture.sizes.data(), COLUMNS_ROW_COUNT, &pool,
+                    fixture.missing.data(), &failed));
+    TEST_EXPECT(fixture.check_columns());
+    dispose((disposable_t*)&pool);
+
+    /* a column without values. */
+    fixture.columns[2].values = nullptr;
+    TEST_EXPECT(
+        VCCERT_ERROR_COLUMNS_EXTRACT_INVALID_ARG
+            == vccert_columns_extract(
+                    fixture.columns, 4, fixture.certs.data(),
+                    fixture.sizes.data(), COLUMNS_ROW_COUNT, nullptr,
+                    fixture.missing.data(), &failed));
+END_TEST_F()
+
+/**
+ * Test that columns are extracted from a store, and that a damaged
+ * certificate is reported without stopping the other rows.
+ */
+BEGIN_TEST_F(extract_store)
+    vccert_store_t store;
+    vccert_thread_pool_t pool;
+    size_t failed;
+
+    TEST_ASSERT(0 == fixture.fill());
+    TEST_ASSERT(
+        0
+            == vccert_store_init(
+                    &store, &fixture.alloc_opts, fixture.data.data(),
+                    fixture.data.size(), nullptr, 0));
+    TEST_ASSERT(
+        0
+            == vccert_thread_pool_init(
+                    &pool, &fixture.alloc_opts, COLUMNS_WORKERS));
+
+    TEST_ASSERT(
+        0
+            == vccert_columns_extract_store(
+                    fixture.columns, 4, &store, &pool,
+                    fixture.missing.data(), &failed));
+    TEST_EXPECT(fixture.check_columns());
+
+    /* make the size of the first field of two rows run past the end. */
+    fixture.data[fixture.offsets[700] + 2] = 0xFF;
+    fixture.data[fixture.offsets[1500] + 2] = 0xFF;
+    TEST_EXPECT(
+        VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE
+            == vccert_columns_extract_store(
+                    fixture.columns, 4, &store, &pool,
+                    fixture.missing.data(), &failed));
+    TEST_EXPECT(700 == failed);
+    TEST_EXPECT(0x0F == fixture.missing[700]);
+    TEST_EXPECT(0 == fixture.heights[700]);
+    TEST_EXPECT(0x0F == fixture.missing[1500]);
+    TEST_EXPECT(701 * 0x100000001ULL == fixture.heights[701]);
+
+    dispose((disposable_t*)&pool);
+    dispose((disposable_t*)&store);
+END_TEST_F()
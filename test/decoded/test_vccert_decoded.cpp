@@ -0,0 +1,214 @@
+/**
+ * \file test_vccert_decoded.cpp
+ *
+ * Test the decoded certificate.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccert/builder.h>
+#include <vccert/decoded.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t DECODED_CERT_SIZE = 4096;
+const size_t DECODED_EXTRA_COUNT = 20;
+
+static const uint8_t DECODED_ARTIFACT_ID[16] = {
+    0x21, 0x32, 0x43, 0x54, 0x65, 0x76, 0x87, 0x98,
+    0xa9, 0xba, 0xcb, 0xdc, 0xed, 0xfe, 0x0f, 0x10 };
+
+static const uint8_t DECODED_CERT_ID[16] = {
+    0x71, 0x62, 0x53, 0x44, 0x35, 0x26, 0x17, 0x08,
+    0xf9, 0xea, 0xdb, 0xcc, 0xbd, 0xae, 0x9f, 0x80 };
+
+class vccert_decoded_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        options_init_result =
+            vccert_parser_options_simple_init(
+                &options, &alloc_opts, &crypto_suite);
+
+        builder_init_result =
+            vccert_builder_init(&builder_opts, &builder, DECODED_CERT_SIZE);
+    }
+
+    void tearDown()
+    {
+        if (builder_init_result == 0)
+        {
+            dispose((disposable_t*)&builder);
+        }
+
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    int suite_init_result, builder_opts_init_result, options_init_result;
+    int builder_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t options;
+    vccert_builder_context_t builder;
+};
+
+TEST_SUITE(vccert_decoded_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_decoded_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that known fields are decoded into their slots, and that everything
+ * else lands in the overflow table in certificate order.
+ */
+BEGIN_TEST_F(decode)
+    vccert_parser_context_t parser;
+    vccert_decoded_t decoded;
+    size_t size;
+
+    TEST_ASSERT(0 == fixture.builder_init_result);
+
+    vccert_builder_add_short_uint32(
+        &fixture.builder, VCCERT_FIELD_TYPE_CERTIFICATE_VERSION, 0x00010000UL);
+    vccert_builder_add_short_uint64(
+        &fixture.builder, VCCERT_FIELD_TYPE_CERTIFICATE_VALID_FROM,
+        0x0102030405060708ULL);
+    vccert_builder_add_short_uint16(
+        &fixture.builder, VCCERT_FIELD_TYPE_CERTIFICATE_CRYPTO_SUITE, 0x0001);
+    vccert_builder_add_short_UUID(
+        &fixture.builder, VCCERT_FIELD_TYPE_CERTIFICATE_ID, DECODED_CERT_ID);
+    vccert_builder_add_short_UUID(
+        &fixture.builder, VCCERT_FIELD_TYPE_ARTIFACT_ID, DECODED_ARTIFACT_ID);
+    vccert_builder_add_short_uint16(
+        &fixture.builder, VCCERT_FIELD_TYPE_NEW_ARTIFACT_STATE, 0xA001);
+    vccert_builder_add_short_uint64(
+        &fixture.builder, VCCERT_FIELD_TYPE_BLOCK_HEIGHT, 1234567);
+
+    /* a repeated known field, and unknown fields, go to the overflow. */
+    vccert_builder_add_short_UUID(
+        &fixture.builder, VCCERT_FIELD_TYPE_CERTIFICATE_ID,
+        DECODED_ARTIFACT_ID);
+    for (size_t i = 0; i < DECODED_EXTRA_COUNT; ++i)
+    {
+        vccert_builder_add_short_uint32(
+            &fixture.builder, (uint16_t)(0x0400 + i), (uint32_t)i);
+    }
+
+    const uint8_t* cert = vccert_builder_emit(&fixture.builder, &size);
+    TEST_ASSERT(
+        0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+
+    TEST_ASSERT(
+        0 == vccert_decoded_init(&decoded, &fixture.alloc_opts, &parser));
+
+    TEST_EXPECT(
+        (VCCERT_DECODED_HAS_CERTIFICATE_VERSION | VCCERT_DECODED_HAS_VALID_FROM
+       | VCCERT_DECODED_HAS_CRYPTO_SUITE | VCCERT_DECODED_HAS_CERTIFICATE_ID
+       | VCCERT_DECODED_HAS_ARTIFACT_ID | VCCERT_DECODED_HAS_NEW_ARTIFACT_STATE
+       | VCCERT_DECODED_HAS_BLOCK_HEIGHT)
+            == decoded.present);
+    TEST_EXPECT(0x00010000UL == decoded.certificate_version);
+    TEST_EXPECT(0x0102030405060708ULL == decoded.valid_from);
+    TEST_EXPECT(0 == decoded.valid_to);
+    TEST_EXPECT(0x0001 == decoded.crypto_suite);
+    TEST_EXPECT(0 == memcmp(DECODED_CERT_ID, decoded.certificate_id, 16));
+    TEST_EXPECT(0 == memcmp(DECODED_ARTIFACT_ID, decoded.artifact_id, 16));
+    TEST_EXPECT(0xA001 == decoded.new_artifact_state);
+    TEST_EXPECT(1234567 == decoded.block_height);
+
+    TEST_ASSERT(DECODED_EXTRA_COUNT + 1 == decoded.overflow_count);
+    TEST_EXPECT(
+        VCCERT_FIELD_TYPE_CERTIFICATE_ID == decoded.overflow[0].field);
+    TEST_EXPECT(16 == decoded.overflow[0].size);
+    TEST_EXPECT(
+        0 == memcmp(DECODED_ARTIFACT_ID, decoded.overflow[0].value, 16));
+    for (size_t i = 0; i < DECODED_EXTRA_COUNT; ++i)
+    {
+        TEST_EXPECT(0x0400 + i == decoded.overflow[i + 1].field);
+        TEST_EXPECT(4 == decoded.overflow[i + 1].size);
+        TEST_EXPECT(i == decoded.overflow[i + 1].value[3]);
+    }
+
+    dispose((disposable_t*)&decoded);
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that a known field with the wrong size, or a malformed certificate, is
+ * rejected.
+ */
+BEGIN_TEST_F(bad_field)
+    vccert_parser_context_t parser;
+    vccert_decoded_t decoded;
+
+    /* a block height that is only four bytes. */
+    static const uint8_t SHORT_HEIGHT[] = {
+        0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00,
+        0x00, 0x83, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01 };
+
+    TEST_ASSERT(
+        0
+            == vccert_parser_init(
+                    &fixture.options, &parser, SHORT_HEIGHT,
+                    sizeof(SHORT_HEIGHT)));
+    TEST_EXPECT(
+        VCCERT_ERROR_DECODED_INIT_INVALID_FIELD_SIZE
+            == vccert_decoded_init(&decoded, &fixture.alloc_opts, &parser));
+    dispose((disposable_t*)&parser);
+
+    /* a field that runs past the end of the certificate. */
+    TEST_ASSERT(
+        0
+            == vccert_parser_init(
+                    &fixture.options, &parser, SHORT_HEIGHT,
+                    sizeof(SHORT_HEIGHT) - 1));
+    TEST_EXPECT(
+        VCCERT_ERROR_DECODED_INIT_INVALID_FIELD_SIZE
+            == vccert_decoded_init(&decoded, &fixture.alloc_opts, &parser));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_DECODED_INIT_INVALID_ARG
+            == vccert_decoded_init(&decoded, &fixture.alloc_opts, NULL));
+    TEST_EXPECT(
+        VCCERT_ERROR_DECODED_INIT_INVALID_ARG
+            == vccert_decoded_init(NULL, &fixture.alloc_opts, &parser));
+    dispose((disposable_t*)&parser);
+END_TEST_F()
@@ -0,0 +1,295 @@
+/**
+ * \file test_vccert_filter.cpp
+ *
+ * Test the filter engine.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccert/filter.h>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t FILTER_ROW_COUNT = 10000;
+const size_t FILTER_WORKERS = 4;
+
+const uint8_t FILTER_TYPES[3][16] = {
+    { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10 },
+    { 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+      0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20 },
+    { 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+      0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30 },
+};
+
+class vccert_filter_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+    }
+
+    void tearDown()
+    {
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Build the batch.  Row n has type n % 3, a block height of n unless n is
+     * a multiple of 7, and a valid-from date of n - 5000.
+     */
+    int fill()
+    {
+        vccert_builder_context_t builder;
+        size_t size;
+
+        int retval = vccert_builder_init(&builder_opts, &builder, 128);
+        if (0 != retval)
+            return retval;
+
+        for (size_t row = 0; row < FILTER_ROW_COUNT; ++row)
+        {
+            vccert_builder_reset(&builder);
+            vccert_builder_add_short_UUID(
+                &builder, VCCERT_FIELD_TYPE_CERTIFICATE_TYPE,
+                FILTER_TYPES[row % 3]);
+            vccert_builder_add_short_int64(
+                &builder, VCCERT_FIELD_TYPE_CERTIFICATE_VALID_FROM,
+                (int64_t)row - 5000);
+            if (0 != row % 7)
+            {
+                vccert_builder_add_short_uint64(
+                    &builder, VCCERT_FIELD_TYPE_BLOCK_HEIGHT, row);
+            }
+
+            const uint8_t* cert = vccert_builder_emit(&builder, &size);
+            offsets.push_back(data.size());
+            sizes.push_back(size);
+            data.insert(data.end(), cert, cert + size);
+        }
+
+        dispose((disposable_t*)&builder);
+
+        for (size_t row = 0; row < FILTER_ROW_COUNT; ++row)
+        {
+            certs.push_back(data.data() + offsets[row]);
+        }
+
+        return 0;
+    }
+
+    int suite_init_result, builder_opts_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    std::vector<uint8_t> data;
+    std::vector<size_t> offsets, sizes;
+    std::vector<const uint8_t*> certs;
+};
+
+TEST_SUITE(vccert_filter_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_filter_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that a filter selects the same rows as a scalar loop, on one thread
+ * and across a thread pool.
+ */
+BEGIN_TEST_F(select)
+    vccert_filter_t filter;
+    vccert_thread_pool_t pool;
+    vccert_filter_predicate_t predicates[3];
+    std::vector<uint64_t> selected((FILTER_ROW_COUNT + 63) / 64);
+    size_t matches, failed, expected = 0;
+    bool same = true;
+
+    TEST_ASSERT(0 == fixture.fill());
+
+    memset(predicates, 0, sizeof(predicates));
+    predicates[0].field = VCCERT_FIELD_TYPE_CERTIFICATE_TYPE;
+    predicates[0].op = VCCERT_FILTER_OP_EQUAL;
+    predicates[0].value = FILTER_TYPES[1];
+    predicates[0].value_size = 16;
+    predicates[1].field = VCCERT_FIELD_TYPE_BLOCK_HEIGHT;
+    predicates[1].op = VCCERT_FILTER_OP_RANGE;
+    predicates[1].type = VCCERT_SCHEMA_TYPE_UINT64;
+    predicates[1].min = 100;
+    predicates[1].max = 9000;
+    predicates[2].field = VCCERT_FIELD_TYPE_CERTIFICATE_VALID_FROM;
+    predicates[2].op = VCCERT_FILTER_OP_RANGE;
+    predicates[2].type = VCCERT_SCHEMA_TYPE_C_STYLE_DATE;
+    predicates[2].min = (uint64_t)(int64_t)-4000;
+    predicates[2].max = 3000;
+
+    TEST_ASSERT(
+        0 == vccert_filter_init(&filter, &fixture.alloc_opts, predicates, 3));
+    TEST_ASSERT(
+        0
+            == vccert_thread_pool_init(
+                    &pool, &fixture.alloc_opts, FILTER_WORKERS));
+
+    TEST_ASSERT(
+        0
+            == vccert_filter_run(
+                    &filter, fixture.certs.data(), fixture.sizes.data(),
+                    FILTER_ROW_COUNT, &pool, selected.data(), &matches,
+                    &failed));
+    TEST_EXPECT(VCCERT_COLUMNS_NO_ROW == failed);
+
+    for (size_t row = 0; row < FILTER_ROW_COUNT; ++row)
+    {
+        bool match =
+            1 == row % 3 && 0 != row % 7 && row >= 100 && row <= 9000
+         && row >= 1000 && row <= 8000;
+        bool got = 0 != (selected[row / 64] & ((uint64_t)1 << (row % 64)));
+
+        expected += match ? 1 : 0;
+        same = same && match == got;
+    }
+
+    TEST_EXPECT(same);
+    TEST_EXPECT(expected == matches);
+
+    /* the same count without a pool or a bitmap. */
+    TEST_EXPECT(
+        0
+            == vccert_filter_run(
+                    &filter, fixture.certs.data(), fixture.sizes.data(),
+                    FILTER_ROW_COUNT, nullptr, nullptr, &matches, nullptr));
+    TEST_EXPECT(expected == matches);
+
+    dispose((disposable_t*)&pool);
+    dispose((disposable_t*)&filter);
+END_TEST_F()
+
+/**
+ * Test that selected rows are counted by group, and that a damaged
+ * certificate is skipped and reported.
+ */
+BEGIN_TEST_F(count_by)
+    vccert_filter_t filter;
+    vccert_filter_predicate_t predicate;
+    vccert_filter_group_t groups[4];
+    size_t group_count, failed;
+
+    TEST_ASSERT(0 == fixture.fill());
+
+    memset(&predicate, 0, sizeof(predicate));
+    predicate.field = VCCERT_FIELD_TYPE_CERTIFICATE_VALID_FROM;
+    predicate.op = VCCERT_FILTER_OP_RANGE;
+    predicate.type = VCCERT_SCHEMA_TYPE_INT64;
+    predicate.min = (uint64_t)(int64_t)-5000;
+    predicate.max = (uint64_t)(int64_t)-4001;
+
+    TEST_ASSERT(
+        0
+            == vccert_filter_init(
+                    &filter, &fixture.alloc_opts, &predicate, 1));
+
+    /* rows 0 to 999, grouped by type. */
+    TEST_ASSERT(
+        0
+            == vccert_filter_count_by(
+                    &filter, fixture.certs.data(), fixture.sizes.data(),
+                    FILTER_ROW_COUNT, nullptr,
+                    VCCERT_FIELD_TYPE_CERTIFICATE_TYPE, groups, 4,
+                    &group_count, &failed));
+    TEST_ASSERT(3 == group_count);
+    for (size_t i = 0; i < 3; ++i)
+    {
+        TEST_EXPECT(16 == groups[i].key_size);
+        TEST_EXPECT(0 == memcmp(FILTER_TYPES[i], groups[i].key, 16));
+        TEST_EXPECT((0 == i ? 334U : 333U) == groups[i].count);
+    }
+
+    /* rows 0 to 999, grouped by height, which is missing from 143 rows. */
+    TEST_EXPECT(
+        VCCERT_ERROR_FILTER_COUNT_BY_TOO_MANY_GROUPS
+            == vccert_filter_count_by(
+                    &filter, fixture.certs.data(), fixture.sizes.data(),
+                    FILTER_ROW_COUNT, nullptr,
+                    VCCERT_FIELD_TYPE_BLOCK_HEIGHT, groups, 4, &group_count,
+                    &failed));
+    TEST_EXPECT(0 == groups[0].key_size);
+    TEST_EXPECT(1 == groups[0].count);
+
+    /* make the first field of row 4 run past the end. */
+    fixture.data[fixture.offsets[4] + 2] = 0xFF;
+    TEST_EXPECT(
+        VCCERT_ERROR_COLUMNS_EXTRACT_BAD_CERTIFICATE
+            == vccert_filter_count_by(
+                    &filter, fixture.certs.data(), fixture.sizes.data(),
+                    FILTER_ROW_COUNT, nullptr,
+                    VCCERT_FIELD_TYPE_CERTIFICATE_TYPE, groups, 4,
+                    &group_count, &failed));
+    TEST_EXPECT(4 == failed);
+    TEST_EXPECT(3 == group_count);
+    TEST_EXPECT(332U == groups[1].count);
+
+    dispose((disposable_t*)&filter);
+END_TEST_F()
+
+/**
+ * Test that bad predicates are rejected.
+ */
+BEGIN_TEST_F(bad_predicate)
+    vccert_filter_t filter;
+    vccert_filter_predicate_t predicate;
+
+    memset(&predicate, 0, sizeof(predicate));
+    predicate.field = VCCERT_FIELD_TYPE_BLOCK_HEIGHT;
+    predicate.op = VCCERT_FILTER_OP_RANGE;
+    predicate.type = VCCERT_SCHEMA_TYPE_DATA_BLOB;
+    TEST_EXPECT(
+        VCCERT_ERROR_FILTER_INIT_BAD_PREDICATE
+            == vccert_filter_init(
+                    &filter, &fixture.alloc_opts, &predicate, 1));
+
+    predicate.type = VCCERT_SCHEMA_TYPE_INT32;
+    predicate.min = 1;
+    predicate.max = (uint64_t)(int64_t)-1;
+    TEST_EXPECT(
+        VCCERT_ERROR_FILTER_INIT_BAD_PREDICATE
+            == vccert_filter_init(
+                    &filter, &fixture.alloc_opts, &predicate, 1));
+
+    predicate.op = VCCERT_FILTER_OP_EQUAL;
+    predicate.value_size = 16;
+    TEST_EXPECT(
+        VCCERT_ERROR_FILTER_INIT_BAD_PREDICATE
+            == vccert_filter_init(
+                    &filter, &fixture.alloc_opts, &predicate, 1));
+END_TEST_F()
@@ -0,0 +1,329 @@
+/**
+ * \file test_vccert_id_index.cpp
+ *
+ * Test the id index.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccert/id_index.h>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t ID_INDEX_CERT_COUNT = 1000;
+const size_t ID_INDEX_ARTIFACT_COUNT = 150;
+
+class vccert_id_index_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+    }
+
+    void tearDown()
+    {
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Make a 128-bit id from a tag and a number.
+     */
+    static void make_id(uint8_t* id, uint8_t tag, size_t number)
+    {
+        memset(id, tag, 16);
+        for (int i = 0; i < 8; ++i)
+        {
+            id[15 - i] = (uint8_t)(number >> (8 * i));
+        }
+    }
+
+    /**
+     * Append a framed certificate for the given sequence number.  Each
+     * certificate belongs to one artifact and follows the previous
+     * certificate of that artifact.
+     */
+    int append(size_t sequence)
+    {
+        vccert_builder_context_t builder;
+        uint8_t id[16];
+        size_t size;
+
+        int retval = vccert_builder_init(&builder_opts, &builder, 256);
+        if (0 != retval)
+            return retval;
+
+        make_id(id, 0xCE, sequence);
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_CERTIFICATE_ID, id);
+
+        make_id(id, 0xAA, sequence % ID_INDEX_ARTIFACT_COUNT);
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_ARTIFACT_ID, id);
+
+        if (sequence >= ID_INDEX_ARTIFACT_COUNT)
+        {
+            make_id(id, 0xCE, sequence - ID_INDEX_ARTIFACT_COUNT);
+            vccert_builder_add_short_UUID(
+                &builder, VCCERT_FIELD_TYPE_PREVIOUS_CERTIFICATE_ID, id);
+        }
+
+        const uint8_t* cert = vccert_builder_emit(&builder, &size);
+        for (int shift = 24; shift >= 0; shift -= 8)
+        {
+            data.push_back((uint8_t)(size >> shift));
+        }
+
+        data.insert(data.end(), cert, cert + size);
+        dispose((disposable_t*)&builder);
+
+        return 0;
+    }
+
+    /**
+     * Fill the store with certificates.
+     */
+    int fill()
+    {
+        for (size_t i = 0; i < ID_INDEX_CERT_COUNT; ++i)
+        {
+            int retval = append(i);
+            if (0 != retval)
+                return retval;
+        }
+
+        return 0;
+    }
+
+    /**
+     * Check every lookup against the way the store was filled.
+     */
+    bool check_index(const vccert_id_index_t* index)
+    {
+        uint8_t id[16];
+        uint64_t position;
+        uint64_t positions[16];
+        size_t count;
+
+        for (size_t i = 0; i < ID_INDEX_CERT_COUNT; ++i)
+        {
+            make_id(id, 0xCE, i);
+            if (0 != vccert_id_index_find_certificate(index, id, &position)
+             || i != position)
+                return false;
+
+            int retval = vccert_id_index_find_successor(index, id, &position);
+            if (i + ID_INDEX_ARTIFACT_COUNT < ID_INDEX_CERT_COUNT
+                    ? 0 != retval || i + ID_INDEX_ARTIFACT_COUNT != position
+                    : VCCERT_ERROR_ID_INDEX_FIND_NOT_FOUND != retval)
+                return false;
+        }
+
+        for (size_t a = 0; a < ID_INDEX_ARTIFACT_COUNT; ++a)
+        {
+            make_id(id, 0xAA, a);
+            if (0
+                    != vccert_id_index_find_artifact(
+                            index, id, positions, 16, &count)
+             || ID_INDEX_CERT_COUNT / ID_INDEX_ARTIFACT_COUNT
+                    + (a < ID_INDEX_CERT_COUNT % ID_INDEX_ARTIFACT_COUNT)
+                        != count)
+                return false;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (a + i * ID_INDEX_ARTIFACT_COUNT != positions[i])
+                    return false;
+            }
+        }
+
+        make_id(id, 0xAA, ID_INDEX_ARTIFACT_COUNT);
+        if (VCCERT_ERROR_ID_INDEX_FIND_NOT_FOUND
+                != vccert_id_index_find_artifact(
+                        index, id, positions, 16, &count))
+            return false;
+
+        make_id(id, 0xCE, ID_INDEX_CERT_COUNT);
+        return
+            VCCERT_ERROR_ID_INDEX_FIND_NOT_FOUND
+                == vccert_id_index_find_certificate(index, id, &position);
+    }
+
+    int suite_init_result, builder_opts_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    std::vector<uint8_t> data;
+};
+
+TEST_SUITE(vccert_id_index_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_id_index_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that every id in a store can be looked up, and that an id is only
+ * indexed once.
+ */
+BEGIN_TEST_F(add_store)
+    vccert_store_t store;
+    vccert_id_index_t index;
+    const uint8_t* cert;
+    size_t size;
+
+    TEST_ASSERT(0 == fixture.fill());
+    TEST_ASSERT(
+        0
+            == vccert_store_init(
+                    &store, &fixture.alloc_opts, fixture.data.data(),
+                    fixture.data.size(), nullptr, 0));
+    TEST_ASSERT(0 == vccert_id_index_init(&index, &fixture.alloc_opts));
+
+    TEST_ASSERT(0 == vccert_id_index_add_store(&index, &store));
+    TEST_EXPECT(fixture.check_index(&index));
+
+    TEST_ASSERT(0 == vccert_store_at(&store, 3, &cert, &size));
+    TEST_EXPECT(
+        VCCERT_ERROR_ID_INDEX_ADD_DUPLICATE
+            == vccert_id_index_add(&index, cert, size, 3));
+    TEST_EXPECT(fixture.check_index(&index));
+
+    dispose((disposable_t*)&index);
+    dispose((disposable_t*)&store);
+END_TEST_F()
+
+/**
+ * Test that a written index answers the same in place, and that a damaged
+ * index is caught.
+ */
+BEGIN_TEST_F(load)
+    vccert_store_t store;
+    vccert_id_index_t built, loaded;
+    const uint8_t* cert;
+    size_t required, size;
+
+    TEST_ASSERT(0 == fixture.fill());
+    TEST_ASSERT(
+        0
+            == vccert_store_init(
+                    &store, &fixture.alloc_opts, fixture.data.data(),
+                    fixture.data.size(), nullptr, 0));
+    TEST_ASSERT(0 == vccert_id_index_init(&built, &fixture.alloc_opts));
+    TEST_ASSERT(0 == vccert_id_index_add_store(&built, &store));
+
+    TEST_ASSERT(0 == vccert_id_index_write(&built, nullptr, 0, &required));
+    std::vector<uint8_t> saved(required);
+    TEST_EXPECT(
+        VCCERT_ERROR_ID_INDEX_WRITE_BUFFER_TOO_SMALL
+            == vccert_id_index_write(
+                    &built, saved.data(), required - 1, &required));
+    TEST_ASSERT(
+        0
+            == vccert_id_index_write(
+                    &built, saved.data(), saved.size(), &required));
+    dispose((disposable_t*)&built);
+
+    TEST_ASSERT(0 == vccert_id_index_load(&loaded, saved.data(), required));
+    TEST_EXPECT(fixture.check_index(&loaded));
+
+    /* a loaded index is read only. */
+    TEST_ASSERT(0 == vccert_store_at(&store, 0, &cert, &size));
+    TEST_EXPECT(
+        VCCERT_ERROR_ID_INDEX_ADD_READ_ONLY
+            == vccert_id_index_add(&loaded, cert, size, 0));
+    dispose((disposable_t*)&loaded);
+
+    /* a truncated index. */
+    TEST_EXPECT(
+        VCCERT_ERROR_ID_INDEX_LOAD_BAD_HEADER
+            == vccert_id_index_load(&loaded, saved.data(), required - 1));
+
+    /* a table that is not a power of two in size. */
+    saved[VCCERT_ID_INDEX_HEADER_SIZE - 1 - 8 * 4] ^= 1;
+    TEST_EXPECT(
+        VCCERT_ERROR_ID_INDEX_LOAD_BAD_HEADER
+            == vccert_id_index_load(&loaded, saved.data(), required));
+    saved[VCCERT_ID_INDEX_HEADER_SIZE - 1 - 8 * 4] ^= 1;
+
+    /* a history link past the end of the entries. */
+    uint64_t positions[4];
+    uint8_t id[16];
+    fixture.make_id(id, 0xAA, 0);
+    memset(&saved[required - 16 * ID_INDEX_CERT_COUNT + 8], 0xFF, 8);
+    TEST_ASSERT(0 == vccert_id_index_load(&loaded, saved.data(), required));
+    TEST_EXPECT(
+        VCCERT_ERROR_ID_INDEX_FIND_BAD_ENTRY
+            == vccert_id_index_find_artifact(
+                    &loaded, id, positions, 4, &size));
+    dispose((disposable_t*)&loaded);
+
+    dispose((disposable_t*)&store);
+END_TEST_F()
+
+/**
+ * Test that a damaged certificate is rejected, and that a certificate without
+ * a certificate id is still indexed by artifact.
+ */
+BEGIN_TEST_F(partial_ids)
+    vccert_builder_context_t builder;
+    vccert_id_index_t index;
+    uint8_t id[16];
+    uint64_t position;
+    size_t count, size;
+
+    TEST_ASSERT(
+        0 == vccert_builder_init(&fixture.builder_opts, &builder, 64));
+    fixture.make_id(id, 0xAA, 1);
+    vccert_builder_add_short_UUID(
+        &builder, VCCERT_FIELD_TYPE_ARTIFACT_ID, id);
+    const uint8_t* cert = vccert_builder_emit(&builder, &size);
+
+    TEST_ASSERT(0 == vccert_id_index_init(&index, &fixture.alloc_opts));
+    TEST_EXPECT(
+        VCCERT_ERROR_ID_INDEX_ADD_BAD_CERTIFICATE
+            == vccert_id_index_add(&index, cert, size - 1, 0));
+    TEST_EXPECT(
+        VCCERT_ERROR_ID_INDEX_FIND_NOT_FOUND
+            == vccert_id_index_find_artifact(
+                    &index, id, nullptr, 0, &count));
+
+    TEST_ASSERT(0 == vccert_id_index_add(&index, cert, size, 7));
+    TEST_EXPECT(
+        0 == vccert_id_index_find_artifact(&index, id, &position, 1, &count));
+    TEST_EXPECT(1 == count);
+    TEST_EXPECT(7 == position);
+
+    dispose((disposable_t*)&index);
+    dispose((disposable_t*)&builder);
+END_TEST_F()
@@ -0,0 +1,386 @@
+/**
+ * \file test_vccert_keydir.cpp
+ *
+ * Test the entity key directory.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vector>
+#include <vccert/builder.h>
+#include <vccert/certificate_types.h>
+#include <vccert/fields.h>
+#include <vccert/keydir.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+static const uint8_t* PRIVATE_KEY =
+    (const uint8_t*)"\x65\x93\x21\xd0\x35\xa9\xf8\xcf"
+                    "\x35\x37\xd1\xd1\x82\xfd\xee\xf8"
+                    "\x92\x8e\x0c\xfe\xb4\x56\x4b\x2d"
+                    "\xb5\x11\x60\x6d\xc6\xf6\x13\xbd"
+                    "\x47\x83\xe9\xf6\x78\xd1\x49\xac"
+                    "\xd2\x09\x66\xb0\xab\x88\xf7\xd0"
+                    "\x5d\x6d\x4f\x54\x0f\x1f\x23\x82"
+                    "\x86\x00\x3a\xda\x0c\x27\xcc\x35";
+
+static const uint8_t* SIGNER_ID =
+    (const uint8_t*)"\x71\x1f\x22\x65\xb6\x50\x46\x12"
+                    "\xa7\x3a\xad\x82\x7f\xb2\x71\x18";
+
+class vccert_keydir_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        options_init_result =
+            vccert_parser_options_simple_init(
+                &options, &alloc_opts, &crypto_suite);
+
+        keyring_init_result = vccert_keyring_init(&keyring, &alloc_opts);
+    }
+
+    void tearDown()
+    {
+        if (keyring_init_result == 0)
+        {
+            dispose((disposable_t*)&keyring);
+        }
+
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Add a public entity certificate for an entity whose keys are filled
+     * with the given byte, or with the given signing key.
+     */
+    int add(
+        const uint8_t* entity_id, uint8_t fill, uint64_t height,
+        const uint8_t* cert_type = vccert_certificate_type_uuid_public_entity,
+        const uint8_t* signing_key = nullptr)
+    {
+        int retval;
+        vccert_builder_context_t builder;
+        vccert_parser_context_t parser;
+        uint8_t enc_key[32], sign_key[32];
+        size_t size;
+
+        memset(enc_key, fill, sizeof(enc_key));
+        memset(sign_key, fill ^ 0xFF, sizeof(sign_key));
+        if (nullptr != signing_key)
+        {
+            memcpy(sign_key, signing_key, sizeof(sign_key));
+        }
+
+        retval = vccert_builder_init(&builder_opts, &builder, 256);
+        if (0 != retval)
+            return retval;
+
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_CERTIFICATE_TYPE, cert_type);
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_ARTIFACT_ID, entity_id);
+        vccert_builder_add_short_buffer(
+            &builder, VCCERT_FIELD_TYPE_PUBLIC_ENCRYPTION_KEY, enc_key,
+            sizeof(enc_key));
+        vccert_builder_add_short_buffer(
+            &builder, VCCERT_FIELD_TYPE_PUBLIC_SIGNING_KEY, sign_key,
+            sizeof(sign_key));
+
+        const uint8_t* cert = vccert_builder_emit(&builder, &size);
+        retval = vccert_parser_init(&options, &parser, cert, size);
+        if (0 == retval)
+        {
+            retval = vccert_keyring_add(&keyring, &parser, height);
+            dispose((disposable_t*)&parser);
+        }
+
+        dispose((disposable_t*)&builder);
+
+        return retval;
+    }
+
+    /**
+     * Make an entity id whose bytes are spread out like those of a random
+     * UUID.
+     */
+    static void make_id(uint8_t* id, uint16_t value)
+    {
+        uint64_t x = (value + 1) * 0x9E3779B97F4A7C15ULL;
+
+        for (int i = 0; i < 16; ++i)
+        {
+            id[i] = (uint8_t)(x >> (8 * (i % 8)));
+            x ^= x >> 29;
+        }
+    }
+
+    /**
+     * Write the keyring to the directory buffer and view it.
+     */
+    int write()
+    {
+        int retval;
+        size_t required;
+
+        retval = vccert_keydir_write(&keyring, nullptr, 0, &required);
+        if (0 != retval)
+            return retval;
+
+        directory.resize(required);
+        retval =
+            vccert_keydir_write(
+                &keyring, directory.data(), directory.size(), &required);
+        if (0 != retval)
+            return retval;
+
+        return vccert_keydir_init(&keydir, directory.data(), required);
+    }
+
+    int suite_init_result, builder_opts_init_result, options_init_result;
+    int keyring_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t options;
+    vccert_keyring_t keyring;
+    std::vector<uint8_t> directory;
+    vccert_keydir_t keydir;
+};
+
+TEST_SUITE(vccert_keydir_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_keydir_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that the key directory answers every lookup as the keyring does.
+ */
+BEGIN_TEST_F(matches_keyring)
+    vccrypt_buffer_t enc, sign, dir_enc, dir_sign;
+    uint8_t entity_id[16];
+
+    TEST_ASSERT(0 == fixture.keyring_init_result);
+    TEST_ASSERT(0 == vccrypt_buffer_init(&enc, &fixture.alloc_opts, 32));
+    TEST_ASSERT(0 == vccrypt_buffer_init(&sign, &fixture.alloc_opts, 32));
+    TEST_ASSERT(0 == vccrypt_buffer_init(&dir_enc, &fixture.alloc_opts, 32));
+    TEST_ASSERT(0 == vccrypt_buffer_init(&dir_sign, &fixture.alloc_opts, 32));
+
+    /* some entities rotate their keys, and one replaces them in place. */
+    for (uint16_t i = 0; i < 500; ++i)
+    {
+        fixture.make_id(entity_id, i);
+        TEST_ASSERT(0 == fixture.add(entity_id, (uint8_t)i, i % 50));
+
+        for (uint16_t r = 1; r <= i % 4; ++r)
+        {
+            TEST_ASSERT(
+                0 == fixture.add(entity_id, (uint8_t)(i + r), i % 50 + 10 * r));
+        }
+
+        if (0 == i % 7)
+        {
+            TEST_ASSERT(
+                0 == fixture.add(entity_id, 0xEE, i % 50 + 10 * (i % 4)));
+        }
+    }
+
+    TEST_ASSERT(0 == fixture.write());
+    TEST_EXPECT(500U <= fixture.keydir.count);
+
+    for (uint16_t i = 0; i < 520; ++i)
+    {
+        fixture.make_id(entity_id, i);
+
+        for (uint64_t height = 0; height < 100; height += 3)
+        {
+            int expected =
+                vccert_keyring_find(
+                    &fixture.keyring, entity_id, height, &enc, &sign);
+            int actual =
+                vccert_keydir_find(
+                    &fixture.keydir, entity_id, height, &dir_enc, &dir_sign);
+
+            TEST_ASSERT((0 == expected) == (0 == actual));
+            if (0 == expected)
+            {
+                TEST_EXPECT(0 == memcmp(enc.data, dir_enc.data, 32));
+                TEST_EXPECT(0 == memcmp(sign.data, dir_sign.data, 32));
+            }
+        }
+    }
+
+    dispose((disposable_t*)&fixture.keydir);
+    dispose((disposable_t*)&enc);
+    dispose((disposable_t*)&sign);
+    dispose((disposable_t*)&dir_enc);
+    dispose((disposable_t*)&dir_sign);
+END_TEST_F()
+
+/**
+ * Test that a damaged key directory is rejected.
+ */
+BEGIN_TEST_F(bad_directory)
+    vccrypt_buffer_t small;
+    uint8_t entity_id[16];
+    size_t required;
+
+    TEST_ASSERT(0 == fixture.keyring_init_result);
+    fixture.make_id(entity_id, 1);
+    TEST_ASSERT(0 == fixture.add(entity_id, 0x11, 10));
+    TEST_ASSERT(0 == fixture.write());
+
+    std::vector<uint8_t> bytes = fixture.directory;
+    vccert_keydir_t keydir;
+
+    /* the size query and a short buffer. */
+    TEST_EXPECT(
+        0 == vccert_keydir_write(&fixture.keyring, nullptr, 0, &required));
+    TEST_EXPECT(VCCERT_KEYDIR_HEADER_SIZE + 32U + 64U == required);
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYDIR_WRITE_BUFFER_TOO_SMALL
+            == vccert_keydir_write(
+                    &fixture.keyring, bytes.data(), required - 1, &required));
+
+    /* a truncated directory. */
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYDIR_INIT_TRUNCATED
+            == vccert_keydir_init(&keydir, bytes.data(), bytes.size() - 1));
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYDIR_INIT_TRUNCATED
+            == vccert_keydir_init(&keydir, bytes.data(), 8));
+
+    /* a bad magic number. */
+    bytes[0] ^= 0xFF;
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYDIR_INIT_BAD_HEADER
+            == vccert_keydir_init(&keydir, bytes.data(), bytes.size()));
+    bytes[0] ^= 0xFF;
+
+    /* a record size that does not match the key sizes. */
+    bytes[15] ^= 0x01;
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYDIR_INIT_BAD_HEADER
+            == vccert_keydir_init(&keydir, bytes.data(), bytes.size()));
+    bytes[15] ^= 0x01;
+
+    /* a buffer that does not match the stored key. */
+    TEST_ASSERT(0 == vccrypt_buffer_init(&small, &fixture.alloc_opts, 16));
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYDIR_FIND_KEY_SIZE
+            == vccert_keydir_find(
+                    &fixture.keydir, entity_id, 10, &small, nullptr));
+    dispose((disposable_t*)&small);
+
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYDIR_FIND_INVALID_ARG
+            == vccert_keydir_find(
+                    nullptr, entity_id, 10, nullptr, nullptr));
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYDIR_INIT_INVALID_ARG
+            == vccert_keydir_init(nullptr, bytes.data(), bytes.size()));
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYDIR_WRITE_INVALID_ARG
+            == vccert_keydir_write(nullptr, nullptr, 0, &required));
+
+    dispose((disposable_t*)&fixture.keydir);
+END_TEST_F()
+
+/**
+ * Test that an empty keyring makes an empty key directory.
+ */
+BEGIN_TEST_F(empty)
+    uint8_t entity_id[16];
+
+    TEST_ASSERT(0 == fixture.keyring_init_result);
+    TEST_ASSERT(0 == fixture.write());
+    TEST_EXPECT(VCCERT_KEYDIR_HEADER_SIZE == fixture.directory.size());
+    TEST_EXPECT(0U == fixture.keydir.count);
+
+    fixture.make_id(entity_id, 1);
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYDIR_FIND_NOT_FOUND
+            == vccert_keydir_find(
+                    &fixture.keydir, entity_id, 10, nullptr, nullptr));
+
+    dispose((disposable_t*)&fixture.keydir);
+END_TEST_F()
+
+/**
+ * Test that the key directory resolver can attest a certificate.
+ */
+BEGIN_TEST_F(resolver)
+    vccert_builder_context_t builder;
+    vccert_parser_context_t parser;
+    vccrypt_buffer_t private_key;
+    size_t size;
+
+    TEST_ASSERT(0 == fixture.keyring_init_result);
+    TEST_ASSERT(0 == fixture.add(SIGNER_ID, 0x11, 10,
+            vccert_certificate_type_uuid_public_entity, PRIVATE_KEY + 32));
+    TEST_ASSERT(0 == fixture.write());
+
+    fixture.options.parser_options_entity_key_resolver =
+        &vccert_keydir_entity_key_resolver;
+    fixture.options.entity_key_context = &fixture.keydir;
+
+    TEST_ASSERT(
+        0
+            == vccrypt_suite_buffer_init_for_signature_private_key(
+                    &fixture.crypto_suite, &private_key));
+    memcpy(private_key.data, PRIVATE_KEY, private_key.size);
+
+    TEST_ASSERT(
+        0 == vccert_builder_init(&fixture.builder_opts, &builder, 256));
+    vccert_builder_add_short_uint32(
+        &builder, VCCERT_FIELD_TYPE_CERTIFICATE_VERSION, 0x00010000UL);
+    TEST_ASSERT(0 == vccert_builder_sign(&builder, SIGNER_ID, &private_key));
+
+    const uint8_t* cert = vccert_builder_emit(&builder, &size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+
+    TEST_EXPECT(0 == vccert_parser_attest(&parser, 10, false));
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_ATTEST_MISSING_SIGNING_CERT
+            == vccert_parser_attest(&parser, 9, false));
+
+    dispose((disposable_t*)&parser);
+    dispose((disposable_t*)&builder);
+    dispose((disposable_t*)&private_key);
+    dispose((disposable_t*)&fixture.keydir);
+END_TEST_F()
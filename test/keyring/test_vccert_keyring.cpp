@@ -0,0 +1,317 @@
+/**
+ * \file test_vccert_keyring.cpp
+ *
+ * Test the entity keyring.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccert/builder.h>
+#include <vccert/certificate_types.h>
+#include <vccert/fields.h>
+#include <vccert/keyring.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+static const uint8_t* PRIVATE_KEY =
+    (const uint8_t*)"\x65\x93\x21\xd0\x35\xa9\xf8\xcf"
+                    "\x35\x37\xd1\xd1\x82\xfd\xee\xf8"
+                    "\x92\x8e\x0c\xfe\xb4\x56\x4b\x2d"
+                    "\xb5\x11\x60\x6d\xc6\xf6\x13\xbd"
+                    "\x47\x83\xe9\xf6\x78\xd1\x49\xac"
+                    "\xd2\x09\x66\xb0\xab\x88\xf7\xd0"
+                    "\x5d\x6d\x4f\x54\x0f\x1f\x23\x82"
+                    "\x86\x00\x3a\xda\x0c\x27\xcc\x35";
+
+static const uint8_t* SIGNER_ID =
+    (const uint8_t*)"\x71\x1f\x22\x65\xb6\x50\x46\x12"
+                    "\xa7\x3a\xad\x82\x7f\xb2\x71\x18";
+
+class vccert_keyring_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        options_init_result =
+            vccert_parser_options_simple_init(
+                &options, &alloc_opts, &crypto_suite);
+
+        keyring_init_result = vccert_keyring_init(&keyring, &alloc_opts);
+    }
+
+    void tearDown()
+    {
+        if (keyring_init_result == 0)
+        {
+            dispose((disposable_t*)&keyring);
+        }
+
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Add a public entity certificate for an entity whose keys are filled
+     * with the given byte, or with the given signing key.
+     */
+    int add(
+        const uint8_t* entity_id, uint8_t fill, uint64_t height,
+        const uint8_t* cert_type = vccert_certificate_type_uuid_public_entity,
+        const uint8_t* signing_key = nullptr)
+    {
+        int retval;
+        vccert_builder_context_t builder;
+        vccert_parser_context_t parser;
+        uint8_t enc_key[32], sign_key[32];
+        size_t size;
+
+        memset(enc_key, fill, sizeof(enc_key));
+        memset(sign_key, fill ^ 0xFF, sizeof(sign_key));
+        if (nullptr != signing_key)
+        {
+            memcpy(sign_key, signing_key, sizeof(sign_key));
+        }
+
+        retval = vccert_builder_init(&builder_opts, &builder, 256);
+        if (0 != retval)
+            return retval;
+
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_CERTIFICATE_TYPE, cert_type);
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_ARTIFACT_ID, entity_id);
+        vccert_builder_add_short_buffer(
+            &builder, VCCERT_FIELD_TYPE_PUBLIC_ENCRYPTION_KEY, enc_key,
+            sizeof(enc_key));
+        vccert_builder_add_short_buffer(
+            &builder, VCCERT_FIELD_TYPE_PUBLIC_SIGNING_KEY, sign_key,
+            sizeof(sign_key));
+
+        const uint8_t* cert = vccert_builder_emit(&builder, &size);
+        retval = vccert_parser_init(&options, &parser, cert, size);
+        if (0 == retval)
+        {
+            retval = vccert_keyring_add(&keyring, &parser, height);
+            dispose((disposable_t*)&parser);
+        }
+
+        dispose((disposable_t*)&builder);
+
+        return retval;
+    }
+
+    static void make_id(uint8_t* id, uint16_t value)
+    {
+        memset(id, 0, 16);
+        id[14] = (uint8_t)(value >> 8);
+        id[15] = (uint8_t)value;
+    }
+
+    int suite_init_result, builder_opts_init_result, options_init_result;
+    int keyring_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t options;
+    vccert_keyring_t keyring;
+};
+
+TEST_SUITE(vccert_keyring_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_keyring_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that lookups follow key rotation by height.
+ */
+BEGIN_TEST_F(rotation)
+    vccrypt_buffer_t enc, sign;
+    uint8_t entity_id[16], expected[32];
+
+    TEST_ASSERT(0 == fixture.keyring_init_result);
+    TEST_ASSERT(0 == vccrypt_buffer_init(&enc, &fixture.alloc_opts, 32));
+    TEST_ASSERT(0 == vccrypt_buffer_init(&sign, &fixture.alloc_opts, 32));
+
+    fixture.make_id(entity_id, 1);
+    TEST_ASSERT(0 == fixture.add(entity_id, 0x11, 10));
+    TEST_ASSERT(0 == fixture.add(entity_id, 0x22, 20));
+    TEST_ASSERT(0 == fixture.add(entity_id, 0x33, 30));
+
+    /* before the entity existed. */
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYRING_FIND_NOT_FOUND
+            == vccert_keyring_find(&fixture.keyring, entity_id, 9, &enc,
+                    &sign));
+
+    const uint64_t heights[] = { 10, 19, 20, 29, 30, 1000 };
+    const uint8_t fills[] = { 0x11, 0x11, 0x22, 0x22, 0x33, 0x33 };
+    for (size_t i = 0; i < sizeof(heights) / sizeof(heights[0]); ++i)
+    {
+        TEST_ASSERT(
+            0
+                == vccert_keyring_find(
+                        &fixture.keyring, entity_id, heights[i], &enc,
+                        &sign));
+        memset(expected, fills[i], sizeof(expected));
+        TEST_EXPECT(0 == memcmp(expected, enc.data, 32));
+        memset(expected, fills[i] ^ 0xFF, sizeof(expected));
+        TEST_EXPECT(0 == memcmp(expected, sign.data, 32));
+    }
+
+    /* an unknown entity. */
+    fixture.make_id(entity_id, 2);
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYRING_FIND_NOT_FOUND
+            == vccert_keyring_find(&fixture.keyring, entity_id, 30, &enc,
+                    &sign));
+
+    dispose((disposable_t*)&enc);
+    dispose((disposable_t*)&sign);
+END_TEST_F()
+
+/**
+ * Test that the keyring grows to hold many entities.
+ */
+BEGIN_TEST_F(grow)
+    vccrypt_buffer_t enc;
+    uint8_t entity_id[16];
+
+    TEST_ASSERT(0 == fixture.keyring_init_result);
+    TEST_ASSERT(0 == vccrypt_buffer_init(&enc, &fixture.alloc_opts, 32));
+
+    for (uint16_t i = 0; i < 300; ++i)
+    {
+        fixture.make_id(entity_id, i);
+        TEST_ASSERT(0 == fixture.add(entity_id, (uint8_t)i, i));
+    }
+
+    TEST_EXPECT(300U == fixture.keyring.count);
+
+    for (uint16_t i = 0; i < 300; ++i)
+    {
+        fixture.make_id(entity_id, i);
+        TEST_ASSERT(
+            0
+                == vccert_keyring_find(
+                        &fixture.keyring, entity_id, 300, &enc, nullptr));
+        TEST_EXPECT((uint8_t)i == ((uint8_t*)enc.data)[0]);
+    }
+
+    dispose((disposable_t*)&enc);
+END_TEST_F()
+
+/**
+ * Test that the keyring rejects bad certificates and mismatched buffers.
+ */
+BEGIN_TEST_F(errors)
+    vccrypt_buffer_t small;
+    uint8_t entity_id[16];
+
+    TEST_ASSERT(0 == fixture.keyring_init_result);
+    fixture.make_id(entity_id, 1);
+
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYRING_ADD_WRONG_CERTIFICATE_TYPE
+            == fixture.add(
+                    entity_id, 0x11, 10,
+                    vccert_certificate_type_uuid_private_entity));
+
+    TEST_ASSERT(0 == fixture.add(entity_id, 0x11, 10));
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYRING_ADD_HEIGHT_OUT_OF_ORDER
+            == fixture.add(entity_id, 0x22, 9));
+
+    TEST_ASSERT(0 == vccrypt_buffer_init(&small, &fixture.alloc_opts, 16));
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYRING_FIND_KEY_SIZE
+            == vccert_keyring_find(
+                    &fixture.keyring, entity_id, 10, &small, nullptr));
+    dispose((disposable_t*)&small);
+
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYRING_FIND_INVALID_ARG
+            == vccert_keyring_find(
+                    nullptr, entity_id, 10, nullptr, nullptr));
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYRING_ADD_INVALID_ARG
+            == vccert_keyring_add(&fixture.keyring, nullptr, 10));
+    TEST_EXPECT(
+        VCCERT_ERROR_KEYRING_INIT_INVALID_ARG
+            == vccert_keyring_init(nullptr, &fixture.alloc_opts));
+END_TEST_F()
+
+/**
+ * Test that the keyring resolver can attest a certificate.
+ */
+BEGIN_TEST_F(resolver)
+    vccert_builder_context_t builder;
+    vccert_parser_context_t parser;
+    vccrypt_buffer_t private_key;
+    size_t size;
+
+    TEST_ASSERT(0 == fixture.keyring_init_result);
+    TEST_ASSERT(0 == fixture.add(SIGNER_ID, 0x11, 10,
+            vccert_certificate_type_uuid_public_entity, PRIVATE_KEY + 32));
+
+    fixture.options.parser_options_entity_key_resolver =
+        &vccert_keyring_entity_key_resolver;
+    fixture.options.entity_key_context = &fixture.keyring;
+
+    TEST_ASSERT(
+        0
+            == vccrypt_suite_buffer_init_for_signature_private_key(
+                    &fixture.crypto_suite, &private_key));
+    memcpy(private_key.data, PRIVATE_KEY, private_key.size);
+
+    TEST_ASSERT(
+        0 == vccert_builder_init(&fixture.builder_opts, &builder, 256));
+    vccert_builder_add_short_uint32(
+        &builder, VCCERT_FIELD_TYPE_CERTIFICATE_VERSION, 0x00010000UL);
+    TEST_ASSERT(0 == vccert_builder_sign(&builder, SIGNER_ID, &private_key));
+
+    const uint8_t* cert = vccert_builder_emit(&builder, &size);
+    TEST_ASSERT(0 == vccert_parser_init(&fixture.options, &parser, cert, size));
+
+    TEST_EXPECT(0 == vccert_parser_attest(&parser, 10, false));
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_ATTEST_MISSING_SIGNING_CERT
+            == vccert_parser_attest(&parser, 9, false));
+
+    dispose((disposable_t*)&parser);
+    dispose((disposable_t*)&builder);
+    dispose((disposable_t*)&private_key);
+END_TEST_F()
@@ -0,0 +1,200 @@
+/**
+ * \file test_vccert_layout_cache.cpp
+ *
+ * Test the layout cache.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccert/layout_cache.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include "../../src/parser/parser_internal.h"
+
+const size_t LAYOUT_CERT_COUNT = 1000;
+
+class vccert_layout_cache_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+    }
+
+    void tearDown()
+    {
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Build a certificate with fields of the given sizes, filled from a seed.
+     */
+    static std::vector<uint8_t> make_cert(
+        const std::vector<size_t>& sizes, uint8_t seed)
+    {
+        std::vector<uint8_t> cert;
+
+        for (size_t i = 0; i < sizes.size(); ++i)
+        {
+            cert.push_back(0x00);
+            cert.push_back((uint8_t)(i + 1));
+            cert.push_back((uint8_t)(sizes[i] >> 8));
+            cert.push_back((uint8_t)sizes[i]);
+            cert.insert(cert.end(), sizes[i], (uint8_t)(seed + i));
+        }
+
+        return cert;
+    }
+
+    /**
+     * Check a lookup against a walk of the certificate.
+     */
+    bool check_lookup(
+        vccert_layout_cache_t* cache, const std::vector<uint8_t>& cert)
+    {
+        size_t offsets[64];
+        size_t field_count;
+        size_t offset = 0;
+        size_t count = 0;
+
+        if (0
+                != vccert_layout_cache_lookup(
+                        cache, cert.data(), cert.size(), offsets, 64,
+                        &field_count))
+            return false;
+
+        while (offset < cert.size())
+        {
+            uint16_t field_type;
+            size_t field_size;
+            const uint8_t* field;
+
+            if (count >= field_count || offsets[count] != offset)
+                return false;
+
+            if (0
+                    != vccert_parser_field(
+                            cert.data(), cert.size(), offset, &field_type,
+                            &field_size, &field, &offset))
+                return false;
+
+            ++count;
+        }
+
+        return count == field_count;
+    }
+
+    allocator_options_t alloc_opts;
+};
+
+TEST_SUITE(vccert_layout_cache_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_layout_cache_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that certificates of one shape are walked once, and then answered
+ * from the learned layout.
+ */
+BEGIN_TEST_F(same_shape)
+    vccert_layout_cache_t cache;
+    std::vector<size_t> sizes;
+
+    /* enough fields for several gathers and a scalar tail. */
+    for (size_t i = 0; i < 21; ++i)
+    {
+        sizes.push_back(i % 3 == 0 ? 16 : 8);
+    }
+
+    TEST_ASSERT(
+        0 == vccert_layout_cache_init(&cache, &fixture.alloc_opts, 16, 32));
+
+    for (size_t i = 0; i < LAYOUT_CERT_COUNT; ++i)
+    {
+        TEST_EXPECT(
+            fixture.check_lookup(
+                &cache, fixture.make_cert(sizes, (uint8_t)i)));
+    }
+
+    TEST_EXPECT(1 == cache.misses);
+    TEST_EXPECT(LAYOUT_CERT_COUNT - 1 == cache.hits);
+
+    dispose((disposable_t*)&cache);
+END_TEST_F()
+
+/**
+ * Test that a certificate with the same size and first header as a learned
+ * layout, but a different shape, is walked.
+ */
+BEGIN_TEST_F(lookalike)
+    vccert_layout_cache_t cache;
+    size_t offsets[8];
+    size_t field_count;
+
+    std::vector<uint8_t> learned = fixture.make_cert({ 8, 4, 4, 4 }, 1);
+    std::vector<uint8_t> other = fixture.make_cert({ 8, 2, 6, 4 }, 1);
+    TEST_ASSERT(learned.size() == other.size());
+
+    TEST_ASSERT(
+        0 == vccert_layout_cache_init(&cache, &fixture.alloc_opts, 4, 8));
+
+    TEST_EXPECT(fixture.check_lookup(&cache, learned));
+    TEST_EXPECT(fixture.check_lookup(&cache, other));
+    TEST_EXPECT(fixture.check_lookup(&cache, learned));
+    TEST_EXPECT(0 == cache.hits);
+    TEST_EXPECT(3 == cache.misses);
+    TEST_EXPECT(fixture.check_lookup(&cache, learned));
+    TEST_EXPECT(1 == cache.hits);
+
+    /* a damaged size in a learned shape is caught by the walk. */
+    learned[8 + 4 + 3] = 0xFF;
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_FIELD_INVALID_FIELD_SIZE
+            == vccert_layout_cache_lookup(
+                    &cache, learned.data(), learned.size(), offsets, 8,
+                    &field_count));
+    TEST_EXPECT(1 == field_count);
+    TEST_EXPECT(1 == cache.hits);
+
+    dispose((disposable_t*)&cache);
+END_TEST_F()
+
+/**
+ * Test that a certificate with more fields than the cache keeps is always
+ * walked, and that its offsets are clipped to the caller's capacity.
+ */
+BEGIN_TEST_F(too_many_fields)
+    vccert_layout_cache_t cache;
+    size_t offsets[2];
+    size_t field_count;
+
+    std::vector<uint8_t> cert = fixture.make_cert({ 1, 2, 3, 4, 5 }, 7);
+
+    TEST_ASSERT(
+        0 == vccert_layout_cache_init(&cache, &fixture.alloc_opts, 4, 4));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        TEST_ASSERT(
+            0
+                == vccert_layout_cache_lookup(
+                        &cache, cert.data(), cert.size(), offsets, 2,
+                        &field_count));
+        TEST_EXPECT(5 == field_count);
+        TEST_EXPECT(0 == offsets[0]);
+        TEST_EXPECT(5 == offsets[1]);
+    }
+
+    TEST_EXPECT(0 == cache.hits);
+    TEST_EXPECT(3 == cache.misses);
+
+    dispose((disposable_t*)&cache);
+END_TEST_F()
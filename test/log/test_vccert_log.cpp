@@ -0,0 +1,388 @@
+/**
+ * \file test_vccert_log.cpp
+ *
+ * Test the certificate log writer and segment reader.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <fstream>
+#include <iterator>
+#include <minunit/minunit.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccert/log.h>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t LOG_CERT_COUNT = 25;
+
+class vccert_log_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        writes = syncs = 0;
+        fail_writes = false;
+    }
+
+    void tearDown()
+    {
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Make the id of the certificate with the given sequence number.
+     */
+    static void make_id(uint8_t* id, size_t sequence)
+    {
+        memset(id, 0xA5, 16);
+        id[0] = (uint8_t)(sequence * 37);
+        id[15] = (uint8_t)sequence;
+    }
+
+    /**
+     * Build the certificate with the given sequence number.
+     */
+    int build(size_t sequence, std::vector<uint8_t>& cert)
+    {
+        vccert_builder_context_t builder;
+        uint8_t id[16], padding[64];
+        size_t size;
+
+        int retval = vccert_builder_init(&builder_opts, &builder, 256);
+        if (0 != retval)
+            return retval;
+
+        make_id(id, sequence);
+        memset(padding, (uint8_t)sequence, sizeof(padding));
+        vccert_builder_add_short_uint32(
+            &builder, VCCERT_FIELD_TYPE_CERTIFICATE_VERSION, 0x00010000UL);
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_CERTIFICATE_ID, id);
+        vccert_builder_add_short_buffer(
+            &builder, VCCERT_FIELD_TYPE_SIGNATURE, padding,
+            sequence % sizeof(padding));
+
+        const uint8_t* data = vccert_builder_emit(&builder, &size);
+        cert.assign(data, data + size);
+        dispose((disposable_t*)&builder);
+
+        return 0;
+    }
+
+    /**
+     * Append every certificate to the writer.
+     */
+    int append_all(vccert_log_writer_t* writer)
+    {
+        std::vector<uint8_t> cert;
+
+        for (size_t i = 0; i < LOG_CERT_COUNT; ++i)
+        {
+            int retval = build(i, cert);
+            if (0 == retval)
+                retval = vccert_log_writer_append(
+                            writer, cert.data(), cert.size());
+            if (0 != retval)
+                return retval;
+        }
+
+        return 0;
+    }
+
+    /**
+     * Check that every certificate can be read back, and found by id.
+     */
+    bool check_segment(const vccert_log_segment_t* segment)
+    {
+        std::vector<uint8_t> expected;
+        const uint8_t* cert;
+        uint8_t id[16];
+        size_t size, index;
+
+        if (LOG_CERT_COUNT != segment->count)
+            return false;
+
+        for (size_t i = 0; i < LOG_CERT_COUNT; ++i)
+        {
+            make_id(id, i);
+            if (0 != build(i, expected)
+             || 0 != vccert_log_segment_at(segment, i, &cert, &size)
+             || expected.size() != size
+             || 0 != memcmp(expected.data(), cert, size)
+             || 0 != vccert_log_segment_find(segment, id, &index)
+             || i != index)
+                return false;
+        }
+
+        memset(id, 0, sizeof(id));
+        return
+            VCCERT_ERROR_LOG_SEGMENT_FIND_NOT_FOUND
+                == vccert_log_segment_find(segment, id, &index);
+    }
+
+    static int memory_write(void* context, const void* data, size_t size)
+    {
+        vccert_log_test* test = (vccert_log_test*)context;
+        const uint8_t* bytes = (const uint8_t*)data;
+
+        if (test->fail_writes)
+            return -1;
+
+        ++test->writes;
+        test->segment.insert(test->segment.end(), bytes, bytes + size);
+
+        return 0;
+    }
+
+    static int memory_sync(void* context)
+    {
+        ++((vccert_log_test*)context)->syncs;
+
+        return 0;
+    }
+
+    int suite_init_result, builder_opts_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    std::vector<uint8_t> segment;
+    int writes, syncs;
+    bool fail_writes;
+};
+
+TEST_SUITE(vccert_log_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_log_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that certificates are committed in groups, and that a finished segment
+ * can be read back by position and by id.
+ */
+BEGIN_TEST_F(group_commit)
+    vccert_log_writer_t writer;
+    vccert_log_segment_t segment;
+    vccert_log_policy_t policy = { 0, 10 };
+
+    TEST_ASSERT(
+        0
+            == vccert_log_writer_init(
+                    &writer, &fixture.alloc_opts, &policy,
+                    &vccert_log_test::memory_write,
+                    &vccert_log_test::memory_sync, &fixture));
+    TEST_ASSERT(0 == fixture.append_all(&writer));
+
+    /* two full groups were committed, each with one write and one sync. */
+    TEST_EXPECT(2 == fixture.writes);
+    TEST_EXPECT(2 == fixture.syncs);
+    TEST_EXPECT(20U == writer.committed);
+
+    TEST_ASSERT(0 == vccert_log_writer_commit(&writer));
+    TEST_EXPECT(3 == fixture.writes);
+    TEST_EXPECT(LOG_CERT_COUNT == writer.committed);
+
+    /* the segment is not readable until it is finished. */
+    TEST_EXPECT(
+        VCCERT_ERROR_LOG_SEGMENT_INIT_BAD_FOOTER
+            == vccert_log_segment_init(
+                    &segment, fixture.segment.data(), fixture.segment.size()));
+
+    TEST_ASSERT(0 == vccert_log_writer_finish(&writer));
+    TEST_EXPECT(4 == fixture.writes);
+    TEST_EXPECT(4 == fixture.syncs);
+    TEST_EXPECT(writer.offset == fixture.segment.size());
+    TEST_EXPECT(
+        VCCERT_ERROR_LOG_WRITER_FINISHED
+            == vccert_log_writer_append(
+                    &writer, fixture.segment.data(), 8));
+    TEST_EXPECT(
+        VCCERT_ERROR_LOG_WRITER_FINISHED == vccert_log_writer_finish(&writer));
+    dispose((disposable_t*)&writer);
+
+    TEST_ASSERT(
+        0
+            == vccert_log_segment_init(
+                    &segment, fixture.segment.data(), fixture.segment.size()));
+    TEST_EXPECT(fixture.check_segment(&segment));
+    dispose((disposable_t*)&segment);
+END_TEST_F()
+
+/**
+ * Test that a byte limit commits groups, and that a writer without limits
+ * only writes when asked.
+ */
+BEGIN_TEST_F(batch_bytes)
+    vccert_log_writer_t writer;
+    vccert_log_segment_t segment;
+    vccert_log_policy_t policy = { 512, 0 };
+
+    TEST_ASSERT(
+        0
+            == vccert_log_writer_init(
+                    &writer, &fixture.alloc_opts, &policy,
+                    &vccert_log_test::memory_write, nullptr, &fixture));
+    TEST_ASSERT(0 == fixture.append_all(&writer));
+    TEST_EXPECT(fixture.writes > 1);
+    TEST_EXPECT(0 == fixture.syncs);
+    TEST_EXPECT(writer.buffer_size < 512U);
+    TEST_ASSERT(0 == vccert_log_writer_finish(&writer));
+    dispose((disposable_t*)&writer);
+
+    TEST_ASSERT(
+        0
+            == vccert_log_segment_init(
+                    &segment, fixture.segment.data(), fixture.segment.size()));
+    TEST_EXPECT(fixture.check_segment(&segment));
+    dispose((disposable_t*)&segment);
+
+    /* no limits: the whole segment is one write. */
+    vccert_log_policy_t unlimited = { 0, 0 };
+    fixture.segment.clear();
+    fixture.writes = 0;
+    TEST_ASSERT(
+        0
+            == vccert_log_writer_init(
+                    &writer, &fixture.alloc_opts, &unlimited,
+                    &vccert_log_test::memory_write,
+                    &vccert_log_test::memory_sync, &fixture));
+    TEST_ASSERT(0 == fixture.append_all(&writer));
+    TEST_EXPECT(0 == fixture.writes);
+    TEST_ASSERT(0 == vccert_log_writer_finish(&writer));
+    TEST_EXPECT(1 == fixture.writes);
+    dispose((disposable_t*)&writer);
+END_TEST_F()
+
+/**
+ * Test that damage to a frame or footer is caught, and that a failed write
+ * sticks.
+ */
+BEGIN_TEST_F(damage)
+    vccert_log_writer_t writer;
+    vccert_log_segment_t segment;
+    vccert_log_policy_t policy = { 0, 0 };
+    const uint8_t* cert;
+    size_t size;
+
+    TEST_ASSERT(
+        0
+            == vccert_log_writer_init(
+                    &writer, &fixture.alloc_opts, &policy,
+                    &vccert_log_test::memory_write, nullptr, &fixture));
+    TEST_ASSERT(0 == fixture.append_all(&writer));
+    TEST_ASSERT(0 == vccert_log_writer_finish(&writer));
+    dispose((disposable_t*)&writer);
+
+    /* a damaged certificate fails its frame checksum. */
+    std::vector<uint8_t> bytes = fixture.segment;
+    bytes[VCCERT_LOG_FRAME_HEADER_SIZE + 2] ^= 0x01;
+    TEST_ASSERT(0 == vccert_log_segment_init(&segment, bytes.data(),
+                        bytes.size()));
+    TEST_EXPECT(
+        VCCERT_ERROR_LOG_SEGMENT_AT_BAD_FRAME
+            == vccert_log_segment_at(&segment, 0, &cert, &size));
+    TEST_EXPECT(0 == vccert_log_segment_at(&segment, 1, &cert, &size));
+    TEST_EXPECT(
+        VCCERT_ERROR_LOG_SEGMENT_AT_OUT_OF_RANGE
+            == vccert_log_segment_at(&segment, LOG_CERT_COUNT, &cert, &size));
+    dispose((disposable_t*)&segment);
+
+    /* a damaged footer fails the footer checksum. */
+    bytes = fixture.segment;
+    bytes[bytes.size() - VCCERT_LOG_TRAILER_SIZE - 3] ^= 0x01;
+    TEST_EXPECT(
+        VCCERT_ERROR_LOG_SEGMENT_INIT_BAD_FOOTER
+            == vccert_log_segment_init(&segment, bytes.data(), bytes.size()));
+
+    /* a write failure is returned by every later call. */
+    fixture.fail_writes = true;
+    TEST_ASSERT(
+        0
+            == vccert_log_writer_init(
+                    &writer, &fixture.alloc_opts, &policy,
+                    &vccert_log_test::memory_write, nullptr, &fixture));
+    TEST_ASSERT(0 == fixture.append_all(&writer));
+    TEST_EXPECT(-1 == vccert_log_writer_commit(&writer));
+    fixture.fail_writes = false;
+    TEST_EXPECT(-1 == vccert_log_writer_commit(&writer));
+    TEST_EXPECT(-1 == vccert_log_writer_finish(&writer));
+    TEST_EXPECT(0U == writer.committed);
+    dispose((disposable_t*)&writer);
+
+    TEST_EXPECT(
+        VCCERT_ERROR_LOG_WRITER_INIT_INVALID_ARG
+            == vccert_log_writer_init(
+                    &writer, &fixture.alloc_opts, &policy, nullptr, nullptr,
+                    nullptr));
+END_TEST_F()
+
+/**
+ * Test that a segment file can be written and read back.
+ */
+BEGIN_TEST_F(open)
+    vccert_log_writer_t writer;
+    vccert_log_segment_t segment;
+    vccert_log_policy_t policy = { 0, 8 };
+    char path[] = "/tmp/vccert_log_XXXXXX";
+
+    int fd = mkstemp(path);
+    TEST_ASSERT(fd >= 0);
+    close(fd);
+
+    TEST_ASSERT(
+        0
+            == vccert_log_writer_open(
+                    &writer, &fixture.alloc_opts, &policy, path));
+    TEST_ASSERT(0 == fixture.append_all(&writer));
+    TEST_ASSERT(0 == vccert_log_writer_finish(&writer));
+    dispose((disposable_t*)&writer);
+
+    std::ifstream in(path, std::ios::binary);
+    std::vector<uint8_t> bytes(
+        (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    unlink(path);
+
+    TEST_ASSERT(
+        0 == vccert_log_segment_init(&segment, bytes.data(), bytes.size()));
+    TEST_EXPECT(fixture.check_segment(&segment));
+    dispose((disposable_t*)&segment);
+
+    TEST_EXPECT(
+        VCCERT_ERROR_LOG_WRITER_OPEN_FAILED
+            == vccert_log_writer_open(
+                    &writer, &fixture.alloc_opts, &policy,
+                    "/nonexistent/segment"));
+END_TEST_F()
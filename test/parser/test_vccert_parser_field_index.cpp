@@ -0,0 +1,504 @@
+/**
+ * \file test_vccert_parser_field_index.cpp
+ *
+ * Test the signed field index.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+#include "../../src/parser/parser_internal.h"
+
+const size_t INDEX_CERT_SIZE = 32768;
+const size_t INDEX_FIELD_COUNT = 40;
+
+static const uint8_t INDEX_SIGNER_ID[16] = {
+    0x1b, 0x2c, 0x3d, 0x4e, 0x5f, 0x60, 0x71, 0x82,
+    0x93, 0xa4, 0xb5, 0xc6, 0xd7, 0xe8, 0xf9, 0x0a };
+
+static const uint8_t* INDEX_PRIVATE_KEY =
+    (const uint8_t*)"\x65\x93\x21\xd0\x35\xa9\xf8\xcf"
+                    "\x35\x37\xd1\xd1\x82\xfd\xee\xf8"
+                    "\x92\x8e\x0c\xfe\xb4\x56\x4b\x2d"
+                    "\xb5\x11\x60\x6d\xc6\xf6\x13\xbd"
+                    "\x47\x83\xe9\xf6\x78\xd1\x49\xac"
+                    "\xd2\x09\x66\xb0\xab\x88\xf7\xd0"
+                    "\x5d\x6d\x4f\x54\x0f\x1f\x23\x82"
+                    "\x86\x00\x3a\xda\x0c\x27\xcc\x35";
+
+/* the public half of INDEX_PRIVATE_KEY. */
+static const uint8_t* INDEX_SIGNING_KEY = INDEX_PRIVATE_KEY + 32;
+
+static bool index_txn_resolver(
+    void*, void*, const uint8_t*, const uint8_t*, vccrypt_buffer_t*, bool*)
+{
+    return false;
+}
+
+static int32_t index_artifact_state_resolver(
+    void*, void*, const uint8_t*, vccrypt_buffer_t*)
+{
+    return -1;
+}
+
+static int index_contract_resolver(
+    void*, void*, const uint8_t*, const uint8_t*, vccert_contract_closure_t*)
+{
+    return 1;
+}
+
+static bool index_entity_key_resolver(
+    void*, void*, uint64_t, const uint8_t*, vccrypt_buffer_t* enc_buffer,
+    vccrypt_buffer_t* sign_buffer)
+{
+    memset(enc_buffer->data, 0, enc_buffer->size);
+    memcpy(sign_buffer->data, INDEX_SIGNING_KEY, 32);
+
+    return true;
+}
+
+class vccert_parser_field_index_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        options_init_result =
+            vccert_parser_options_init(
+                &options, &alloc_opts, &crypto_suite, &index_txn_resolver,
+                &index_artifact_state_resolver, &index_contract_resolver,
+                &index_entity_key_resolver, NULL);
+
+        builder_init_result =
+            vccert_builder_init(&builder_opts, &builder, INDEX_CERT_SIZE);
+
+        key_init_result =
+            vccrypt_suite_buffer_init_for_signature_private_key(
+                &crypto_suite, &private_key);
+        if (key_init_result == 0)
+        {
+            vccrypt_buffer_read_data(&private_key, INDEX_PRIVATE_KEY, 64);
+        }
+    }
+
+    void tearDown()
+    {
+        if (key_init_result == 0)
+        {
+            dispose((disposable_t*)&private_key);
+        }
+
+        if (builder_init_result == 0)
+        {
+            dispose((disposable_t*)&builder);
+        }
+
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Build a signed certificate with repeated field types in no particular
+     * order, followed by a field index.  If swap is set, the first two index
+     * records are swapped before signing.
+     */
+    std::vector<uint8_t> build_cert(bool swap = false)
+    {
+        for (size_t i = 0; i < INDEX_FIELD_COUNT; ++i)
+        {
+            vccert_builder_add_short_uint32(
+                &builder, (uint16_t)(0x0100 + (i * 7) % 5), (uint32_t)i);
+        }
+
+        size_t index_offset = builder.offset;
+        if (0 != vccert_builder_add_field_index(&builder))
+            return std::vector<uint8_t>();
+
+        if (swap)
+        {
+            uint8_t* records =
+                (uint8_t*)builder.buffer.data + index_offset + 4;
+            uint8_t tmp[VCCERT_FIELD_INDEX_RECORD_SIZE];
+
+            memcpy(tmp, records, sizeof(tmp));
+            memcpy(records, records + sizeof(tmp), sizeof(tmp));
+            memcpy(records + sizeof(tmp), tmp, sizeof(tmp));
+        }
+
+        return sign();
+    }
+
+    /**
+     * Build a signed certificate holding two artifact IDs, with the given
+     * records as its field index.  The first artifact ID hides a field header
+     * for another artifact ID at offset 4, which ends where the first does.
+     */
+    std::vector<uint8_t> build_forged(
+        const std::vector<uint8_t>& records)
+    {
+        static const uint8_t FIRST[16] = {
+            0x00, 0x41, 0x00, 0x0c, 0xcc, 0xcc, 0xcc, 0xcc,
+            0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc };
+        uint8_t second[16];
+
+        memset(second, 0xbb, sizeof(second));
+
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_ARTIFACT_ID, FIRST);
+        vccert_builder_add_short_UUID(
+            &builder, VCCERT_FIELD_TYPE_ARTIFACT_ID, second);
+        vccert_builder_add_short_buffer(
+            &builder, VCCERT_FIELD_TYPE_FIELD_INDEX, records.data(),
+            records.size());
+
+        return sign();
+    }
+
+    /**
+     * Start over with an empty builder.
+     */
+    void reset_builder()
+    {
+        if (builder_init_result == 0)
+        {
+            dispose((disposable_t*)&builder);
+        }
+
+        builder_init_result =
+            vccert_builder_init(&builder_opts, &builder, INDEX_CERT_SIZE);
+    }
+
+    /**
+     * Sign the certificate and return a copy of it.
+     */
+    std::vector<uint8_t> sign()
+    {
+        size_t size;
+
+        if (0 != vccert_builder_sign(&builder, INDEX_SIGNER_ID, &private_key))
+            return std::vector<uint8_t>();
+
+        const uint8_t* cert = vccert_builder_emit(&builder, &size);
+
+        return std::vector<uint8_t>(cert, cert + size);
+    }
+
+    /**
+     * Check that every occurrence of a field is found in the same order with
+     * and without the field index.
+     */
+    bool same_fields(
+        vccert_parser_context_t* indexed, vccert_parser_context_t* plain,
+        uint16_t field_id)
+    {
+        const uint8_t* indexed_value;
+        const uint8_t* plain_value;
+        size_t indexed_size, plain_size;
+
+        int indexed_result =
+            vccert_parser_find_short(
+                indexed, field_id, &indexed_value, &indexed_size);
+        int plain_result =
+            vccert_parser_find_short(
+                plain, field_id, &plain_value, &plain_size);
+
+        for (;;)
+        {
+            if (indexed_result != plain_result)
+                return false;
+
+            if (0 != indexed_result)
+                return true;
+
+            if (indexed_value - indexed->cert != plain_value - plain->cert
+             || indexed_size != plain_size)
+                return false;
+
+            indexed_result =
+                vccert_parser_find_next(
+                    indexed, &indexed_value, &indexed_size);
+            plain_result =
+                vccert_parser_find_next(plain, &plain_value, &plain_size);
+        }
+    }
+
+    int suite_init_result, builder_opts_init_result, options_init_result;
+    int builder_init_result, key_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t options;
+    vccert_builder_context_t builder;
+    vccrypt_buffer_t private_key;
+};
+
+TEST_SUITE(vccert_parser_field_index_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_parser_field_index_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Make a field index record.
+ */
+static void add_record(
+    std::vector<uint8_t>& records, uint16_t field_id, size_t offset)
+{
+    uint8_t record[VCCERT_FIELD_INDEX_RECORD_SIZE];
+
+    vccert_parser_field_index_record(record, field_id, offset);
+    records.insert(records.end(), record, record + sizeof(record));
+}
+
+/**
+ * Test that the builder writes one sorted record per field just before the
+ * signer ID.
+ */
+BEGIN_TEST_F(builder_layout)
+    vccert_parser_context_t parser;
+    const uint8_t* signer;
+    const uint8_t* index;
+    size_t signer_size, index_size, index_fields;
+
+    TEST_ASSERT(0 == fixture.builder_init_result);
+    std::vector<uint8_t> cert = fixture.build_cert();
+    TEST_ASSERT(!cert.empty());
+
+    TEST_ASSERT(
+        0
+            == vccert_parser_init(
+                    &fixture.options, &parser, cert.data(), cert.size()));
+    TEST_ASSERT(
+        0
+            == vccert_parser_find_signer(
+                    &parser, &signer, &signer_size, &index, &index_size,
+                    &index_fields));
+    TEST_ASSERT(NULL != index);
+    TEST_EXPECT(INDEX_FIELD_COUNT == index_fields);
+    TEST_EXPECT(0 == memcmp(signer, INDEX_SIGNER_ID, 16));
+    TEST_EXPECT(
+        INDEX_FIELD_COUNT * VCCERT_FIELD_INDEX_RECORD_SIZE == index_size);
+    TEST_EXPECT(index + index_size + 4 == signer);
+
+    for (size_t i = 0; i < INDEX_FIELD_COUNT; ++i)
+    {
+        const uint8_t* record = index + i * VCCERT_FIELD_INDEX_RECORD_SIZE;
+        size_t offset =
+            ((size_t)record[2] << 24) | ((size_t)record[3] << 16)
+          | ((size_t)record[4] << 8) | record[5];
+
+        TEST_EXPECT(0 == memcmp(record, cert.data() + offset, 2));
+        if (i > 0)
+        {
+            TEST_EXPECT(
+                0 > memcmp(
+                        record - VCCERT_FIELD_INDEX_RECORD_SIZE, record,
+                        VCCERT_FIELD_INDEX_RECORD_SIZE));
+        }
+    }
+
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that attestation attaches a signed index, and that lookups through it
+ * find the same fields as a walk.
+ */
+BEGIN_TEST_F(lookups)
+    vccert_parser_context_t indexed, plain;
+    const uint16_t fields[] = {
+        0x0100, 0x0101, 0x0102, 0x0103, 0x0104, 0x0999,
+        VCCERT_FIELD_TYPE_FIELD_INDEX, VCCERT_FIELD_TYPE_SIGNER_ID };
+
+    TEST_ASSERT(0 == fixture.builder_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+    std::vector<uint8_t> cert = fixture.build_cert();
+    TEST_ASSERT(!cert.empty());
+
+    TEST_ASSERT(
+        0
+            == vccert_parser_init(
+                    &fixture.options, &indexed, cert.data(), cert.size()));
+    TEST_ASSERT(
+        0
+            == vccert_parser_init(
+                    &fixture.options, &plain, cert.data(), cert.size()));
+    TEST_ASSERT(0 == vccert_parser_attest(&indexed, 77, false));
+    TEST_ASSERT(NULL != indexed.field_index);
+    TEST_EXPECT(
+        INDEX_FIELD_COUNT * VCCERT_FIELD_INDEX_RECORD_SIZE
+            == indexed.field_index_size);
+    plain.size = indexed.size;
+
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); ++i)
+    {
+        TEST_EXPECT(fixture.same_fields(&indexed, &plain, fields[i]));
+    }
+
+    /* attesting again keeps the index. */
+    TEST_ASSERT(0 == vccert_parser_attest(&indexed, 77, false));
+    TEST_EXPECT(NULL != indexed.field_index);
+
+    dispose((disposable_t*)&plain);
+    dispose((disposable_t*)&indexed);
+END_TEST_F()
+
+/**
+ * Test that a signed but malformed index fails attestation.
+ */
+BEGIN_TEST_F(bad_index)
+    vccert_parser_context_t parser;
+
+    TEST_ASSERT(0 == fixture.builder_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+
+    /* swap the first two records, so that the index is out of order. */
+    std::vector<uint8_t> cert = fixture.build_cert(true);
+    TEST_ASSERT(!cert.empty());
+    TEST_ASSERT(
+        0
+            == vccert_parser_init(
+                    &fixture.options, &parser, cert.data(), cert.size()));
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_ATTEST_BAD_FIELD_INDEX
+            == vccert_parser_attest(&parser, 77, false));
+    TEST_EXPECT(NULL == parser.field_index);
+    dispose((disposable_t*)&parser);
+
+    /* an index that does not hold whole records. */
+    fixture.reset_builder();
+    std::vector<uint8_t> partial(VCCERT_FIELD_INDEX_RECORD_SIZE - 1, 0);
+    cert = fixture.build_forged(partial);
+    TEST_ASSERT(!cert.empty());
+    TEST_ASSERT(
+        0
+            == vccert_parser_init(
+                    &fixture.options, &parser, cert.data(), cert.size()));
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_ATTEST_BAD_FIELD_INDEX
+            == vccert_parser_attest(&parser, 77, false));
+    TEST_EXPECT(NULL == parser.field_index);
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that a signed, sorted index which does not list exactly the fields
+ * before it fails attestation, so that indexed lookups can never disagree with
+ * a walk.
+ */
+BEGIN_TEST_F(forged_index)
+    vccert_parser_context_t parser;
+    const uint16_t id = VCCERT_FIELD_TYPE_ARTIFACT_ID;
+    std::vector<std::vector<uint8_t>> forgeries(3);
+
+    TEST_ASSERT(0 == fixture.builder_init_result);
+    TEST_ASSERT(0 == fixture.key_init_result);
+
+    /* the first artifact ID is left out. */
+    add_record(forgeries[0], id, 20);
+
+    /* the hidden header is listed alongside the real fields. */
+    add_record(forgeries[1], id, 0);
+    add_record(forgeries[1], id, 4);
+    add_record(forgeries[1], id, 20);
+
+    /* the hidden header is listed in place of the first artifact ID. */
+    add_record(forgeries[2], id, 4);
+    add_record(forgeries[2], id, 20);
+
+    for (const std::vector<uint8_t>& records : forgeries)
+    {
+        fixture.reset_builder();
+        std::vector<uint8_t> cert = fixture.build_forged(records);
+        TEST_ASSERT(!cert.empty());
+        TEST_ASSERT(
+            0
+                == vccert_parser_init(
+                        &fixture.options, &parser, cert.data(),
+                        cert.size()));
+        TEST_EXPECT(
+            VCCERT_ERROR_PARSER_ATTEST_BAD_FIELD_INDEX
+                == vccert_parser_attest(&parser, 77, false));
+        TEST_EXPECT(NULL == parser.field_index);
+        dispose((disposable_t*)&parser);
+    }
+
+    /* the honest index for the same fields is accepted. */
+    std::vector<uint8_t> honest;
+    add_record(honest, id, 0);
+    add_record(honest, id, 20);
+
+    fixture.reset_builder();
+    std::vector<uint8_t> cert = fixture.build_forged(honest);
+    TEST_ASSERT(!cert.empty());
+    TEST_ASSERT(
+        0
+            == vccert_parser_init(
+                    &fixture.options, &parser, cert.data(), cert.size()));
+    TEST_ASSERT(0 == vccert_parser_attest(&parser, 77, false));
+    TEST_ASSERT(NULL != parser.field_index);
+
+    const uint8_t* value;
+    size_t size;
+    TEST_ASSERT(0 == vccert_parser_find_short(&parser, id, &value, &size));
+    TEST_EXPECT(cert.data() + 4 == value);
+    TEST_EXPECT(16 == size);
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that an index too large for a single field is refused.
+ */
+BEGIN_TEST_F(too_big)
+    const uint8_t empty = 0;
+
+    TEST_ASSERT(0 == fixture.builder_init_result);
+
+    for (size_t i = 0; i < 5500; ++i)
+    {
+        TEST_ASSERT(
+            0
+                == vccert_builder_add_short_buffer(
+                        &fixture.builder, 0x0100, &empty, 0));
+    }
+
+    TEST_EXPECT(
+        VCCERT_ERROR_BUILDER_ADD_TOO_BIG
+            == vccert_builder_add_field_index(&fixture.builder));
+END_TEST_F()
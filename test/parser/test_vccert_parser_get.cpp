@@ -0,0 +1,314 @@
+/**
+ * \file test_vccert_parser_get.cpp
+ *
+ * Test the typed field accessors.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t GET_CERT_SIZE = 8192;
+const size_t GET_ARRAY_COUNT = 37;
+
+static const uint8_t GET_UUID[16] = {
+    0x5a, 0x4b, 0x3c, 0x2d, 0x1e, 0x0f, 0xf0, 0xe1,
+    0xd2, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x78, 0x69 };
+
+class vccert_parser_get_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        options_init_result =
+            vccert_parser_options_simple_init(
+                &options, &alloc_opts, &crypto_suite);
+
+        builder_init_result =
+            vccert_builder_init(&builder_opts, &builder, GET_CERT_SIZE);
+    }
+
+    void tearDown()
+    {
+        if (builder_init_result == 0)
+        {
+            dispose((disposable_t*)&builder);
+        }
+
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Emit the builder's certificate and initialize a parser over it.
+     */
+    int parse(vccert_parser_context_t* parser)
+    {
+        size_t size;
+        const uint8_t* cert = vccert_builder_emit(&builder, &size);
+
+        return vccert_parser_init(&options, parser, cert, size);
+    }
+
+    int suite_init_result, builder_opts_init_result, options_init_result;
+    int builder_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t options;
+    vccert_builder_context_t builder;
+};
+
+TEST_SUITE(vccert_parser_get_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_parser_get_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that each scalar accessor decodes the value that was added.
+ */
+BEGIN_TEST_F(scalars)
+    vccert_parser_context_t parser;
+    uint8_t u8;
+    int8_t i8;
+    uint16_t u16;
+    int16_t i16;
+    uint32_t u32;
+    int32_t i32;
+    uint64_t u64;
+    int64_t i64;
+    uint8_t uuid[16];
+
+    TEST_ASSERT(0 == fixture.builder_init_result);
+    vccert_builder_add_short_uint8(&fixture.builder, 0x0401, 0xFE);
+    vccert_builder_add_short_int8(&fixture.builder, 0x0402, -5);
+    vccert_builder_add_short_uint16(&fixture.builder, 0x0403, 0xBEEF);
+    vccert_builder_add_short_int16(&fixture.builder, 0x0404, -300);
+    vccert_builder_add_short_uint32(&fixture.builder, 0x0405, 0xDEADBEEF);
+    vccert_builder_add_short_int32(&fixture.builder, 0x0406, -70000);
+    vccert_builder_add_short_uint64(
+        &fixture.builder, VCCERT_FIELD_TYPE_BLOCK_HEIGHT,
+        0x0123456789ABCDEFULL);
+    vccert_builder_add_short_int64(&fixture.builder, 0x0408, -5000000000LL);
+    vccert_builder_add_short_UUID(
+        &fixture.builder, VCCERT_FIELD_TYPE_ARTIFACT_ID, GET_UUID);
+    TEST_ASSERT(0 == fixture.parse(&parser));
+
+    TEST_ASSERT(0 == vccert_parser_get_uint8(&parser, 0x0401, &u8));
+    TEST_EXPECT(0xFE == u8);
+    TEST_ASSERT(0 == vccert_parser_get_int8(&parser, 0x0402, &i8));
+    TEST_EXPECT(-5 == i8);
+    TEST_ASSERT(0 == vccert_parser_get_uint16(&parser, 0x0403, &u16));
+    TEST_EXPECT(0xBEEF == u16);
+    TEST_ASSERT(0 == vccert_parser_get_int16(&parser, 0x0404, &i16));
+    TEST_EXPECT(-300 == i16);
+    TEST_ASSERT(0 == vccert_parser_get_uint32(&parser, 0x0405, &u32));
+    TEST_EXPECT(0xDEADBEEF == u32);
+    TEST_ASSERT(0 == vccert_parser_get_int32(&parser, 0x0406, &i32));
+    TEST_EXPECT(-70000 == i32);
+    TEST_ASSERT(
+        0
+            == vccert_parser_get_uint64(
+                    &parser, VCCERT_FIELD_TYPE_BLOCK_HEIGHT, &u64));
+    TEST_EXPECT(0x0123456789ABCDEFULL == u64);
+    TEST_ASSERT(0 == vccert_parser_get_int64(&parser, 0x0408, &i64));
+    TEST_EXPECT(-5000000000LL == i64);
+    TEST_ASSERT(
+        0
+            == vccert_parser_get_uuid(
+                    &parser, VCCERT_FIELD_TYPE_ARTIFACT_ID, uuid));
+    TEST_EXPECT(0 == memcmp(GET_UUID, uuid, 16));
+
+    /* the size must match the requested type. */
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE
+            == vccert_parser_get_uint32(&parser, 0x0403, &u32));
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE
+            == vccert_parser_get_uuid(&parser, 0x0408, uuid));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_FIELD_NEXT_FIELD_NOT_FOUND
+            == vccert_parser_get_uint16(&parser, 0x0999, &u16));
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_GET_INVALID_ARG
+            == vccert_parser_get_uint16(&parser, 0x0403, NULL));
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_GET_INVALID_ARG
+            == vccert_parser_get_uint16(NULL, 0x0403, &u16));
+
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that the array accessors decode every occurrence, across runs of
+ * consecutive records and lone records alike.
+ */
+BEGIN_TEST_F(arrays)
+    vccert_parser_context_t parser;
+    std::vector<uint16_t> fields(GET_ARRAY_COUNT, 0x0500);
+    std::vector<uint16_t> narrow(GET_ARRAY_COUNT, 0x0501);
+    std::vector<uint64_t> wide(GET_ARRAY_COUNT);
+    std::vector<uint32_t> small(GET_ARRAY_COUNT);
+    std::vector<int64_t> signed_values(GET_ARRAY_COUNT);
+    std::vector<uint16_t> signed_fields(GET_ARRAY_COUNT, 0x0502);
+
+    for (size_t i = 0; i < GET_ARRAY_COUNT; ++i)
+    {
+        wide[i] = 0x0102030405060708ULL * (i + 1);
+        small[i] = 0x01020304UL * (uint32_t)(i + 1);
+        signed_values[i] = -(int64_t)(i * 1000003);
+    }
+
+    TEST_ASSERT(0 == fixture.builder_init_result);
+    vccert_builder_add_short_uint64(&fixture.builder, 0x0500, 42);
+    vccert_builder_add_short_uint64_array(
+        &fixture.builder, fields.data(), wide.data(), GET_ARRAY_COUNT);
+    vccert_builder_add_short_uint32_array(
+        &fixture.builder, narrow.data(), small.data(), GET_ARRAY_COUNT);
+    vccert_builder_add_short_uint64(&fixture.builder, 0x0500, 43);
+    vccert_builder_add_short_int64_array(
+        &fixture.builder, signed_fields.data(), signed_values.data(),
+        GET_ARRAY_COUNT);
+    TEST_ASSERT(0 == fixture.parse(&parser));
+
+    std::vector<uint64_t> wide_out(GET_ARRAY_COUNT + 2);
+    size_t count;
+    TEST_ASSERT(
+        0
+            == vccert_parser_get_uint64_array(
+                    &parser, 0x0500, wide_out.data(), wide_out.size(),
+                    &count));
+    TEST_ASSERT(GET_ARRAY_COUNT + 2 == count);
+    TEST_EXPECT(42 == wide_out[0]);
+    TEST_EXPECT(43 == wide_out[GET_ARRAY_COUNT + 1]);
+    for (size_t i = 0; i < GET_ARRAY_COUNT; ++i)
+    {
+        TEST_EXPECT(wide[i] == wide_out[i + 1]);
+    }
+
+    std::vector<uint32_t> small_out(GET_ARRAY_COUNT);
+    TEST_ASSERT(
+        0
+            == vccert_parser_get_uint32_array(
+                    &parser, 0x0501, small_out.data(), small_out.size(),
+                    &count));
+    TEST_ASSERT(GET_ARRAY_COUNT == count);
+    TEST_EXPECT(small == small_out);
+
+    std::vector<int64_t> signed_out(GET_ARRAY_COUNT);
+    TEST_ASSERT(
+        0
+            == vccert_parser_get_int64_array(
+                    &parser, 0x0502, signed_out.data(), signed_out.size(),
+                    &count));
+    TEST_ASSERT(GET_ARRAY_COUNT == count);
+    TEST_EXPECT(signed_values == signed_out);
+
+    /* a short array receives a prefix, and still learns the full count. */
+    std::vector<uint64_t> prefix(5, 0);
+    TEST_ASSERT(
+        0
+            == vccert_parser_get_uint64_array(
+                    &parser, 0x0500, prefix.data(), prefix.size(), &count));
+    TEST_EXPECT(GET_ARRAY_COUNT + 2 == count);
+    TEST_EXPECT(42 == prefix[0]);
+    TEST_EXPECT(wide[3] == prefix[4]);
+
+    TEST_ASSERT(
+        0 == vccert_parser_get_uint64_array(&parser, 0x0500, NULL, 0, &count));
+    TEST_EXPECT(GET_ARRAY_COUNT + 2 == count);
+    TEST_ASSERT(
+        0 == vccert_parser_get_uint64_array(&parser, 0x0999, NULL, 0, &count));
+    TEST_EXPECT(0 == count);
+
+    /* every occurrence must have the requested width. */
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_GET_INVALID_FIELD_SIZE
+            == vccert_parser_get_uint32_array(
+                    &parser, 0x0500, small_out.data(), small_out.size(),
+                    &count));
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_GET_INVALID_ARG
+            == vccert_parser_get_uint32_array(
+                    &parser, 0x0501, NULL, 4, &count));
+
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that the array accessors report a malformed certificate, including one
+ * with a partial field header at the end, as an invalid field size.
+ */
+BEGIN_TEST_F(arrays_malformed)
+    vccert_parser_context_t parser;
+    uint64_t values[2];
+    size_t count;
+
+    static const uint8_t MALFORMED[] = {
+        0x05, 0x00, 0x00, 0x08, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+        0x05, 0x00, 0x00, 0x08 };
+
+    /* one to four bytes after the last field. */
+    for (size_t trailing = 1; trailing <= 4; ++trailing)
+    {
+        TEST_ASSERT(
+            0
+                == vccert_parser_init(
+                        &fixture.options, &parser, MALFORMED, 12 + trailing));
+        TEST_EXPECT(
+            VCCERT_ERROR_PARSER_FIELD_INVALID_FIELD_SIZE
+                == vccert_parser_get_uint64_array(
+                        &parser, 0x0500, values, 2, &count));
+        dispose((disposable_t*)&parser);
+    }
+
+    /* a field that runs past the end. */
+    TEST_ASSERT(
+        0
+            == vccert_parser_init(
+                    &fixture.options, &parser, MALFORMED, 11));
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_FIELD_INVALID_FIELD_SIZE
+            == vccert_parser_get_uint64_array(
+                    &parser, 0x0500, values, 2, &count));
+    dispose((disposable_t*)&parser);
+END_TEST_F()
@@ -0,0 +1,247 @@
+/**
+ * \file test_vccert_parser_hpp.cpp
+ *
+ * Test the C++ field views.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <algorithm>
+#include <minunit/minunit.h>
+#include <string.h>
+#include <utility>
+#include <vccert/builder.h>
+#include <vccert/parser.hpp>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t HPP_CERT_SIZE = 4096;
+const size_t HPP_FIELD_COUNT = 25;
+
+class vccert_parser_hpp_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        options_init_result =
+            vccert_parser_options_simple_init(
+                &options, &alloc_opts, &crypto_suite);
+
+        builder_init_result =
+            vccert_builder_init(&builder_opts, &builder, HPP_CERT_SIZE);
+
+        /* fields of growing size, so that every field is distinct. */
+        if (builder_init_result == 0)
+        {
+            for (size_t i = 0; i < HPP_FIELD_COUNT; ++i)
+            {
+                std::vector<uint8_t> value(i + 1, (uint8_t)i);
+
+                vccert_builder_add_short_buffer(
+                    &builder, (uint16_t)(0x0400 + i), value.data(), i);
+            }
+
+            vccert_builder_add_short_uint32(&builder, 0x0400, 0x01020304UL);
+
+            cert = vccert_builder_emit(&builder, &cert_size);
+        }
+    }
+
+    void tearDown()
+    {
+        if (builder_init_result == 0)
+        {
+            dispose((disposable_t*)&builder);
+        }
+
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    int suite_init_result, builder_opts_init_result, options_init_result;
+    int builder_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t options;
+    vccert_builder_context_t builder;
+    const uint8_t* cert;
+    size_t cert_size;
+};
+
+TEST_SUITE(vccert_parser_hpp_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_parser_hpp_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that a range-for visits the same fields as vccert_parser_field_first()
+ * and vccert_parser_field_next().
+ */
+BEGIN_TEST_F(range_for)
+    vccert_parser_context_t parser;
+    uint16_t type;
+    const uint8_t* value;
+    size_t size;
+    size_t count = 0;
+
+    TEST_ASSERT(0 == fixture.builder_init_result);
+    TEST_ASSERT(
+        0
+            == vccert_parser_init(
+                    &fixture.options, &parser, fixture.cert,
+                    fixture.cert_size));
+
+    int retval = vccert_parser_field_first(&parser, &type, &value, &size);
+    for (const vccert::field& f : vccert::field_range(parser))
+    {
+        TEST_ASSERT(0 == retval);
+        TEST_EXPECT(type == f.type());
+        TEST_EXPECT(value == f.data());
+        TEST_EXPECT(size == f.size());
+
+        ++count;
+        retval = vccert_parser_field_next(&parser, &type, &value, &size);
+    }
+
+    TEST_EXPECT(0 != retval);
+    TEST_EXPECT(HPP_FIELD_COUNT + 1 == count);
+    TEST_EXPECT(vccert::field_range(parser).well_formed());
+
+    dispose((disposable_t*)&parser);
+END_TEST_F()
+
+/**
+ * Test that the fields work with standard algorithms.
+ */
+BEGIN_TEST_F(algorithms)
+    TEST_ASSERT(0 == fixture.builder_init_result);
+
+    vccert::field_range fields(fixture.cert, fixture.cert_size);
+
+    TEST_EXPECT(
+        HPP_FIELD_COUNT + 1
+            == (size_t)std::distance(fields.begin(), fields.end()));
+    TEST_EXPECT(
+        2
+            == std::count_if(
+                    fields.begin(), fields.end(),
+                    [](const vccert::field& f) {
+                        return 0x0400 == f.type(); }));
+
+    auto found =
+        std::find_if(
+            fields.begin(), fields.end(),
+            [](const vccert::field& f) { return 0x0407 == f.type(); });
+    TEST_ASSERT(found != fields.end());
+    TEST_EXPECT(7 == found->size());
+    TEST_EXPECT(
+        std::all_of(
+            found->begin(), found->end(), [](uint8_t b) { return 7 == b; }));
+
+    /* the last field is the four byte value. */
+    vccert::field last;
+    for (const vccert::field& f : fields)
+    {
+        last = f;
+    }
+    TEST_EXPECT(4 == last.size());
+    TEST_EXPECT(0x04 == last[3]);
+END_TEST_F()
+
+/**
+ * Test that iteration stops at a malformed field.
+ */
+BEGIN_TEST_F(malformed)
+    static const uint8_t MALFORMED[] = {
+        0x04, 0x01, 0x00, 0x02, 0xAA, 0xBB,
+        0x04, 0x02, 0x00, 0x09, 0xCC };
+
+    vccert::field_range fields(MALFORMED, sizeof(MALFORMED));
+
+    TEST_EXPECT(1 == std::distance(fields.begin(), fields.end()));
+    TEST_EXPECT(0x0401 == fields.begin()->type());
+    TEST_EXPECT(!fields.well_formed());
+
+    /* a certificate ending in a header is malformed, as in the C parser. */
+    vccert::field_range header_only(MALFORMED, 10);
+    TEST_EXPECT(1 == std::distance(header_only.begin(), header_only.end()));
+    TEST_EXPECT(!header_only.well_formed());
+
+    vccert::field_range whole(MALFORMED, 6);
+    TEST_EXPECT(whole.well_formed());
+
+    vccert::field_range empty;
+    TEST_EXPECT(empty.begin() == empty.end());
+END_TEST_F()
+
+/**
+ * Test that the parser owns its context, and that ownership moves with it.
+ */
+BEGIN_TEST_F(parser_move)
+    vccert::parser p;
+
+    TEST_ASSERT(0 == fixture.builder_init_result);
+    TEST_EXPECT(!p);
+    TEST_EXPECT(p.fields().begin() == p.fields().end());
+    TEST_EXPECT(!p.find(0x0400));
+
+    TEST_ASSERT(
+        0 == p.init(&fixture.options, fixture.cert, fixture.cert_size));
+    TEST_ASSERT(!!p);
+
+    vccert::parser q(std::move(p));
+    TEST_EXPECT(!p);
+    TEST_ASSERT(!!q);
+
+    auto found = q.find(0x0405);
+    TEST_ASSERT(!!found);
+    TEST_EXPECT(5 == found->size());
+    TEST_EXPECT(
+        HPP_FIELD_COUNT + 1
+            == (size_t)std::distance(q.fields().begin(), q.fields().end()));
+
+    /* moving into a live parser disposes of its old context. */
+    TEST_ASSERT(
+        0 == p.init(&fixture.options, fixture.cert, fixture.cert_size));
+    q = std::move(p);
+    TEST_EXPECT(!p);
+    TEST_ASSERT(!!q);
+    TEST_EXPECT(!q.find(0x0999));
+
+    q.reset();
+    TEST_EXPECT(!q);
+END_TEST_F()
@@ -0,0 +1,240 @@
+/**
+ * \file test_vccert_parser_tuple_init.cpp
+ *
+ * Test vccert_parser_tuple_init.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vccert/parser.h>
+#include <vccrypt/suite.h>
+#include <vpr/allocator/malloc_allocator.h>
+
+static const uint8_t* TEST_CERT = (const uint8_t*)
+    //field 0x0001 is 0x01020304
+    "\x00\x01\x00\x04\x01\x02\x03\x04"
+    //field 0x0300 is a tuple of 21 bytes
+    "\x03\x00\x00\x15"
+        //field 0x0001 is 0x11
+        "\x00\x01\x00\x01\x11"
+        //field 0x0002 is 0x2222
+        "\x00\x02\x00\x02\x22\x22"
+        //field 0x0001 is 0x33
+        "\x00\x01\x00\x01\x33"
+        //field 0x0003 is 0x00
+        "\x00\x03\x00\x01\x00"
+    //field 0x0300 is a tuple of 5 bytes
+    "\x03\x00\x00\x05"
+        //field 0x0001 is 0x44
+        "\x00\x01\x00\x01\x44"
+    //field 0x0002 is 0x5555
+    "\x00\x02\x00\x02\x55\x55";
+static const size_t TEST_CERT_SIZE = 48;
+
+class vccert_parser_tuple_init_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        options_init_result =
+            vccert_parser_options_simple_init(
+                &options, &alloc_opts, &crypto_suite);
+
+        parser_init_result =
+            vccert_parser_init(&options, &parser, TEST_CERT, TEST_CERT_SIZE);
+    }
+
+    void tearDown()
+    {
+        if (parser_init_result == 0)
+        {
+            dispose((disposable_t*)&parser);
+        }
+
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    int suite_init_result, options_init_result, parser_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_parser_options_t options;
+    vccert_parser_context_t parser;
+};
+
+TEST_SUITE(vccert_parser_tuple_init_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_parser_tuple_init_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that a tuple view borrows the parent options and bounds.
+ */
+BEGIN_TEST_F(init)
+    const uint8_t* value;
+    size_t size;
+    vccert_parser_context_t tuple;
+
+    TEST_ASSERT(0 == fixture.parser_init_result);
+    TEST_ASSERT(
+        0 == vccert_parser_find_short(&fixture.parser, 0x0300, &value, &size));
+    TEST_ASSERT(21U == size);
+
+    TEST_ASSERT(
+        0 == vccert_parser_tuple_init(&fixture.parser, &tuple, value, size));
+    TEST_EXPECT(&fixture.options == tuple.options);
+    TEST_EXPECT(value == tuple.cert);
+    TEST_EXPECT(21U == tuple.raw_size);
+    TEST_EXPECT(21U == tuple.size);
+    TEST_EXPECT(nullptr == tuple.parent);
+
+    /* disposing a view is harmless. */
+    dispose((disposable_t*)&tuple);
+END_TEST_F()
+
+/**
+ * Test that the find and iteration calls work within a tuple view, and stop at
+ * the end of the tuple rather than the end of the parent.
+ */
+BEGIN_TEST_F(find_and_iterate)
+    const uint8_t* value;
+    size_t size;
+    uint16_t field_id;
+    vccert_parser_context_t tuple;
+
+    TEST_ASSERT(0 == fixture.parser_init_result);
+    TEST_ASSERT(
+        0 == vccert_parser_find_short(&fixture.parser, 0x0300, &value, &size));
+    TEST_ASSERT(
+        0 == vccert_parser_tuple_init(&fixture.parser, &tuple, value, size));
+
+    /* find_short and find_next */
+    TEST_ASSERT(0 == vccert_parser_find_short(&tuple, 0x0001, &value, &size));
+    TEST_EXPECT(1U == size && 0x11 == value[0]);
+    TEST_ASSERT(0 == vccert_parser_find_next(&tuple, &value, &size));
+    TEST_EXPECT(1U == size && 0x33 == value[0]);
+    TEST_EXPECT(0 != vccert_parser_find_next(&tuple, &value, &size));
+
+    /* the parent's trailing 0x0002 field is not visible from the view. */
+    TEST_ASSERT(0 == vccert_parser_find_short(&tuple, 0x0002, &value, &size));
+    TEST_EXPECT(2U == size && 0x22 == value[0]);
+    TEST_EXPECT(0 != vccert_parser_find_next(&tuple, &value, &size));
+
+    /* field_first and field_next */
+    TEST_ASSERT(
+        0 == vccert_parser_field_first(&tuple, &field_id, &value, &size));
+    TEST_EXPECT(0x0001 == field_id);
+    TEST_ASSERT(
+        0 == vccert_parser_field_next(&tuple, &field_id, &value, &size));
+    TEST_EXPECT(0x0002 == field_id);
+    TEST_ASSERT(
+        0 == vccert_parser_field_next(&tuple, &field_id, &value, &size));
+    TEST_EXPECT(0x0001 == field_id);
+    TEST_ASSERT(
+        0 == vccert_parser_field_next(&tuple, &field_id, &value, &size));
+    TEST_EXPECT(0x0003 == field_id);
+    TEST_EXPECT(
+        0 != vccert_parser_field_next(&tuple, &field_id, &value, &size));
+END_TEST_F()
+
+/**
+ * Test that every tuple in the parent can be walked without any setup.
+ */
+BEGIN_TEST_F(walk_tuples)
+    const uint8_t* value;
+    size_t size;
+    const uint8_t* inner;
+    size_t inner_size;
+    vccert_parser_context_t tuple;
+    uint8_t seen[2];
+    int count = 0;
+
+    TEST_ASSERT(0 == fixture.parser_init_result);
+
+    int retval =
+        vccert_parser_find_short(&fixture.parser, 0x0300, &value, &size);
+    while (0 == retval && count < 2)
+    {
+        TEST_ASSERT(
+            0
+                == vccert_parser_tuple_init(
+                        &fixture.parser, &tuple, value, size));
+        TEST_ASSERT(
+            0 == vccert_parser_find_short(&tuple, 0x0001, &inner, &inner_size));
+        seen[count++] = inner[0];
+
+        retval = vccert_parser_find_next(&fixture.parser, &value, &size);
+    }
+
+    TEST_EXPECT(2 == count);
+    TEST_EXPECT(0x11 == seen[0]);
+    TEST_EXPECT(0x44 == seen[1]);
+END_TEST_F()
+
+/**
+ * Test that a view cannot extend outside of its parent.
+ */
+BEGIN_TEST_F(out_of_bounds)
+    vccert_parser_context_t tuple;
+    const uint8_t other[4] = { 0, 1, 0, 0 };
+
+    TEST_ASSERT(0 == fixture.parser_init_result);
+
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_TUPLE_INIT_OUT_OF_BOUNDS
+            == vccert_parser_tuple_init(
+                    &fixture.parser, &tuple, TEST_CERT + 40, 9));
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_TUPLE_INIT_OUT_OF_BOUNDS
+            == vccert_parser_tuple_init(
+                    &fixture.parser, &tuple, TEST_CERT, TEST_CERT_SIZE + 1));
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_TUPLE_INIT_OUT_OF_BOUNDS
+            == vccert_parser_tuple_init(
+                    &fixture.parser, &tuple, other, sizeof(other)));
+    TEST_EXPECT(
+        0
+            == vccert_parser_tuple_init(
+                    &fixture.parser, &tuple, TEST_CERT + 40, 8));
+
+    /* once attested, only the attested region may be viewed. */
+    fixture.parser.size = 8;
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_TUPLE_INIT_OUT_OF_BOUNDS
+            == vccert_parser_tuple_init(
+                    &fixture.parser, &tuple, TEST_CERT + 12, 21));
+    fixture.parser.size = TEST_CERT_SIZE;
+
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_TUPLE_INIT_INVALID_ARG
+            == vccert_parser_tuple_init(
+                    &fixture.parser, &tuple, TEST_CERT, 0));
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_TUPLE_INIT_INVALID_ARG
+            == vccert_parser_tuple_init(nullptr, &tuple, TEST_CERT, 4));
+END_TEST_F()
@@ -0,0 +1,169 @@
+/**
+ * \file test_vccert_parser_validate_batch.cpp
+ *
+ * Test the batch structural validator.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <string.h>
+#include <vector>
+#include "../../src/parser/parser_internal.h"
+
+TEST_SUITE(vccert_parser_validate_batch_test);
+
+const size_t BATCH_CERT_COUNT = 1000;
+
+/**
+ * Build a certificate of random fields, then damage some of them.
+ */
+static std::vector<uint8_t> make_cert(uint32_t* seed)
+{
+    std::vector<uint8_t> cert;
+
+    *seed = *seed * 1103515245 + 12345;
+    size_t fields = (*seed >> 16) % 20;
+    for (size_t i = 0; i < fields; ++i)
+    {
+        *seed = *seed * 1103515245 + 12345;
+        size_t size = (*seed >> 16) % 40;
+
+        cert.push_back((uint8_t)(i >> 8));
+        cert.push_back((uint8_t)i);
+        cert.push_back((uint8_t)(size >> 8));
+        cert.push_back((uint8_t)size);
+        cert.insert(cert.end(), size, (uint8_t)i);
+    }
+
+    *seed = *seed * 1103515245 + 12345;
+    switch ((*seed >> 16) % 8)
+    {
+        /* cut the last field short. */
+        case 0:
+            if (!cert.empty())
+                cert.pop_back();
+            break;
+
+        /* a header with no room for a value. */
+        case 1:
+            cert.insert(cert.end(), 4, 0);
+            break;
+
+        /* a size that runs far past the end. */
+        case 2:
+            if (cert.size() > 4)
+                cert[2] = 0xFF;
+            break;
+
+        default:
+            break;
+    }
+
+    return cert;
+}
+
+/**
+ * Walk a certificate one field at a time.
+ */
+static int walk(
+    const std::vector<uint8_t>& cert, std::vector<size_t>* offsets)
+{
+    size_t offset = 0;
+    uint16_t field_type;
+    size_t field_size;
+    const uint8_t* field;
+
+    if (cert.empty())
+        return VCCERT_ERROR_PARSER_FIELD_INVALID_ARG;
+
+    while (offset < cert.size())
+    {
+        offsets->push_back(offset);
+        int retval =
+            vccert_parser_field(
+                cert.data(), cert.size(), offset, &field_type, &field_size,
+                &field, &offset);
+        if (0 != retval)
+        {
+            offsets->pop_back();
+            return retval;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Test that the lockstep walk matches a walk of each certificate on its own.
+ */
+TEST(matches_field_walk)
+{
+    std::vector<std::vector<uint8_t>> certs;
+    std::vector<vccert_parser_batch_entry_t> entries(BATCH_CERT_COUNT);
+    std::vector<std::vector<size_t>> offsets(BATCH_CERT_COUNT);
+    uint32_t seed = 1;
+    bool malformed = false;
+
+    for (size_t i = 0; i < BATCH_CERT_COUNT; ++i)
+    {
+        certs.push_back(make_cert(&seed));
+        offsets[i].resize(8);
+
+        memset(&entries[i], 0, sizeof(entries[i]));
+        entries[i].cert = certs[i].data();
+        entries[i].size = certs[i].size();
+        entries[i].offsets = offsets[i].data();
+        entries[i].offset_capacity = offsets[i].size();
+    }
+
+    int retval =
+        vccert_parser_validate_batch(entries.data(), entries.size());
+
+    for (size_t i = 0; i < BATCH_CERT_COUNT; ++i)
+    {
+        std::vector<size_t> expected;
+        int status = walk(certs[i], &expected);
+
+        malformed = malformed || 0 != status;
+        TEST_EXPECT(status == entries[i].status);
+        TEST_EXPECT(expected.size() == entries[i].field_count);
+        for (size_t f = 0; f < expected.size() && f < 8; ++f)
+        {
+            TEST_EXPECT(expected[f] == offsets[i][f]);
+        }
+    }
+
+    TEST_ASSERT(malformed);
+    TEST_EXPECT(VCCERT_ERROR_PARSER_VALIDATE_BATCH_MALFORMED == retval);
+}
+
+/**
+ * Test that a batch of well-formed certificates passes, even when it is
+ * smaller than the number of lanes.
+ */
+TEST(well_formed)
+{
+    const uint8_t cert[] = { 0x00, 0x01, 0x00, 0x01, 0xAA,
+                             0x00, 0x02, 0x00, 0x01, 0xDD,
+                             0x00, 0x03, 0x00, 0x02, 0xBB, 0xCC };
+    const size_t sizes[] = { 5, 10, sizeof(cert) };
+    vccert_parser_batch_entry_t entries[3];
+
+    memset(entries, 0, sizeof(entries));
+    for (size_t i = 0; i < 3; ++i)
+    {
+        entries[i].cert = cert;
+        entries[i].size = sizes[i];
+    }
+
+    TEST_EXPECT(0 == vccert_parser_validate_batch(entries, 3));
+    TEST_EXPECT(1 == entries[0].field_count);
+    TEST_EXPECT(2 == entries[1].field_count);
+    TEST_EXPECT(3 == entries[2].field_count);
+
+    TEST_EXPECT(0 == vccert_parser_validate_batch(nullptr, 0));
+    TEST_EXPECT(
+        VCCERT_ERROR_PARSER_VALIDATE_BATCH_INVALID_ARG
+            == vccert_parser_validate_batch(nullptr, 1));
+}
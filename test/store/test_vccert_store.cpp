@@ -0,0 +1,433 @@
+/**
+ * \file test_vccert_store.cpp
+ *
+ * Test the certificate store.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <minunit/minunit.h>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+#include <vccert/builder.h>
+#include <vccert/fields.h>
+#include <vccert/store.h>
+#include <vccrypt/suite.h>
+#include <vector>
+#include <vpr/allocator/malloc_allocator.h>
+
+const size_t STORE_CERT_COUNT = 1000;
+const size_t STORE_WORKERS = 4;
+
+class vccert_store_test {
+public:
+    void setUp()
+    {
+        vccrypt_suite_register_velo_v1();
+
+        malloc_allocator_options_init(&alloc_opts);
+
+        suite_init_result =
+            vccrypt_suite_options_init(&crypto_suite, &alloc_opts,
+                VCCRYPT_SUITE_VELO_V1);
+
+        builder_opts_init_result =
+            vccert_builder_options_init(
+                &builder_opts, &alloc_opts, &crypto_suite);
+
+        options_init_result =
+            vccert_parser_options_simple_init(
+                &options, &alloc_opts, &crypto_suite);
+    }
+
+    void tearDown()
+    {
+        if (options_init_result == 0)
+        {
+            dispose((disposable_t*)&options);
+        }
+
+        if (builder_opts_init_result == 0)
+        {
+            dispose((disposable_t*)&builder_opts);
+        }
+
+        if (suite_init_result == 0)
+        {
+            dispose((disposable_t*)&crypto_suite);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    /**
+     * Append a framed certificate holding the given sequence number and a
+     * padding field of varying size.
+     */
+    int append(uint64_t sequence)
+    {
+        vccert_builder_context_t builder;
+        uint8_t padding[64];
+        size_t size;
+
+        int retval = vccert_builder_init(&builder_opts, &builder, 256);
+        if (0 != retval)
+            return retval;
+
+        memset(padding, (uint8_t)sequence, sizeof(padding));
+        vccert_builder_add_short_uint64(
+            &builder, VCCERT_FIELD_TYPE_CERTIFICATE_VALID_FROM, sequence);
+        vccert_builder_add_short_buffer(
+            &builder, VCCERT_FIELD_TYPE_SIGNATURE, padding,
+            sequence % sizeof(padding));
+
+        const uint8_t* cert = vccert_builder_emit(&builder, &size);
+        for (int shift = 24; shift >= 0; shift -= 8)
+        {
+            data.push_back((uint8_t)(size >> shift));
+        }
+
+        offsets.push_back(data.size());
+        data.insert(data.end(), cert, cert + size);
+        dispose((disposable_t*)&builder);
+
+        return 0;
+    }
+
+    /**
+     * Fill the store with certificates.
+     */
+    int fill()
+    {
+        for (size_t i = 0; i < STORE_CERT_COUNT; ++i)
+        {
+            int retval = append(i);
+            if (0 != retval)
+                return retval;
+        }
+
+        return 0;
+    }
+
+    /**
+     * Check that every certificate in the store can be found and parsed in
+     * place.
+     */
+    bool check_store(vccert_store_t* store)
+    {
+        vccert_parser_context_t parser;
+        const uint8_t* cert;
+        const uint8_t* value;
+        size_t size, value_size;
+
+        if (STORE_CERT_COUNT != store->count)
+            return false;
+
+        for (size_t i = 0; i < STORE_CERT_COUNT; ++i)
+        {
+            if (0 != vccert_store_at(store, i, &cert, &size)
+             || store->data + offsets[i] != cert)
+                return false;
+
+            if (0 != vccert_store_parser_init(store, &options, &parser, i))
+                return false;
+
+            int retval =
+                vccert_parser_find_short(
+                    &parser, VCCERT_FIELD_TYPE_CERTIFICATE_VALID_FROM, &value,
+                    &value_size);
+            dispose((disposable_t*)&parser);
+
+            if (0 != retval || 8 != value_size || (uint8_t)i != value[7]
+             || (uint8_t)(i >> 8) != value[6])
+                return false;
+        }
+
+        return
+            VCCERT_ERROR_STORE_AT_OUT_OF_RANGE
+                == vccert_store_at(store, STORE_CERT_COUNT, &cert, &size);
+    }
+
+    /**
+     * Write bytes to a new temporary file.
+     */
+    static std::string write_file(const std::vector<uint8_t>& bytes)
+    {
+        char path[] = "/tmp/vccert_store_XXXXXX";
+
+        int fd = mkstemp(path);
+        if (fd < 0)
+            return std::string();
+
+        ssize_t written = write(fd, bytes.data(), bytes.size());
+        close(fd);
+
+        return (size_t)written == bytes.size() ? path : std::string();
+    }
+
+    int suite_init_result, builder_opts_init_result, options_init_result;
+    allocator_options_t alloc_opts;
+    vccrypt_suite_options_t crypto_suite;
+    vccert_builder_options_t builder_opts;
+    vccert_parser_options_t options;
+    std::vector<uint8_t> data;
+    std::vector<size_t> offsets;
+};
+
+TEST_SUITE(vccert_store_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_store_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Test that an index is built for a store held in memory.
+ */
+BEGIN_TEST_F(build_index)
+    vccert_store_t store;
+
+    TEST_ASSERT(0 == fixture.fill());
+    TEST_ASSERT(
+        0
+            == vccert_store_init(
+                    &store, &fixture.alloc_opts, fixture.data.data(),
+                    fixture.data.size(), nullptr, 0));
+
+    TEST_EXPECT(fixture.check_store(&store));
+
+    dispose((disposable_t*)&store);
+END_TEST_F()
+
+/**
+ * Test that a written index can be loaded, and that a foreign or damaged
+ * index is caught.
+ */
+BEGIN_TEST_F(load_index)
+    vccert_store_t built, loaded;
+    const uint8_t* cert;
+    size_t required, size;
+
+    TEST_ASSERT(0 == fixture.fill());
+    TEST_ASSERT(
+        0
+            == vccert_store_init(
+                    &built, &fixture.alloc_opts, fixture.data.data(),
+                    fixture.data.size(), nullptr, 0));
+
+    TEST_ASSERT(0 == vccert_store_index_write(&built, nullptr, 0, &required));
+    TEST_EXPECT(
+        VCCERT_STORE_INDEX_HEADER_SIZE + 8 * STORE_CERT_COUNT == required);
+
+    std::vector<uint8_t> index(required);
+    TEST_EXPECT(
+        VCCERT_ERROR_STORE_INDEX_WRITE_BUFFER_TOO_SMALL
+            == vccert_store_index_write(
+                    &built, index.data(), required - 1, &required));
+    TEST_ASSERT(
+        0
+            == vccert_store_index_write(
+                    &built, index.data(), index.size(), &required));
+    dispose((disposable_t*)&built);
+
+    TEST_ASSERT(
+        0
+            == vccert_store_init(
+                    &loaded, &fixture.alloc_opts, fixture.data.data(),
+                    fixture.data.size(), index.data(), index.size()));
+    TEST_EXPECT(fixture.check_store(&loaded));
+    dispose((disposable_t*)&loaded);
+
+    /* the index of a different store. */
+    TEST_EXPECT(
+        VCCERT_ERROR_STORE_INIT_BAD_INDEX
+            == vccert_store_init(
+                    &loaded, &fixture.alloc_opts, fixture.data.data(),
+                    fixture.data.size() - 1, index.data(), index.size()));
+
+    /* an index missing an offset. */
+    TEST_EXPECT(
+        VCCERT_ERROR_STORE_INIT_BAD_INDEX
+            == vccert_store_init(
+                    &loaded, &fixture.alloc_opts, fixture.data.data(),
+                    fixture.data.size(), index.data(), index.size() - 8));
+
+    /* an offset past the end of the store is caught when it is read. */
+    memset(&index[VCCERT_STORE_INDEX_HEADER_SIZE + 8 * 5], 0xFF, 8);
+    TEST_ASSERT(
+        0
+            == vccert_store_init(
+                    &loaded, &fixture.alloc_opts, fixture.data.data(),
+                    fixture.data.size(), index.data(), index.size()));
+    TEST_EXPECT(
+        VCCERT_ERROR_STORE_AT_BAD_FRAME
+            == vccert_store_at(&loaded, 5, &cert, &size));
+    dispose((disposable_t*)&loaded);
+END_TEST_F()
+
+/**
+ * Test that a store ending in a partial frame is rejected.
+ */
+BEGIN_TEST_F(truncated)
+    vccert_store_t store;
+
+    TEST_ASSERT(0 == fixture.append(1));
+    TEST_ASSERT(0 == fixture.append(2));
+
+    TEST_EXPECT(
+        VCCERT_ERROR_STORE_INIT_TRUNCATED
+            == vccert_store_init(
+                    &store, &fixture.alloc_opts, fixture.data.data(),
+                    fixture.data.size() - 1, nullptr, 0));
+    TEST_EXPECT(
+        VCCERT_ERROR_STORE_INIT_TRUNCATED
+            == vccert_store_init(
+                    &store, &fixture.alloc_opts, fixture.data.data(),
+                    fixture.offsets[1] - 2, nullptr, 0));
+    TEST_EXPECT(
+        VCCERT_ERROR_STORE_INIT_INVALID_ARG
+            == vccert_store_init(
+                    &store, &fixture.alloc_opts, nullptr, 0, nullptr, 0));
+END_TEST_F()
+
+/**
+ * Visit state for the for_each test.
+ */
+struct store_visit
+{
+    std::mutex lock;
+    std::vector<int> visits;
+    size_t fail_from;
+};
+
+static int count_visitor(
+    void* context, size_t index, const uint8_t* cert, size_t size,
+    size_t worker)
+{
+    store_visit* visit = (store_visit*)context;
+
+    (void)cert;
+    (void)size;
+    (void)worker;
+
+    std::lock_guard<std::mutex> guard(visit->lock);
+    ++visit->visits[index];
+
+    return index >= visit->fail_from ? -1 : 0;
+}
+
+/**
+ * Test that every certificate is visited once across the thread pool, and
+ * that the earliest failure is reported.
+ */
+BEGIN_TEST_F(for_each)
+    vccert_store_t store;
+    vccert_thread_pool_t pool;
+    store_visit visit;
+    size_t failed;
+
+    TEST_ASSERT(0 == fixture.fill());
+    TEST_ASSERT(
+        0
+            == vccert_store_init(
+                    &store, &fixture.alloc_opts, fixture.data.data(),
+                    fixture.data.size(), nullptr, 0));
+    TEST_ASSERT(
+        0
+            == vccert_thread_pool_init(
+                    &pool, &fixture.alloc_opts, STORE_WORKERS));
+
+    visit.visits.assign(STORE_CERT_COUNT, 0);
+    visit.fail_from = STORE_CERT_COUNT;
+    TEST_EXPECT(
+        0 == vccert_store_for_each(
+                &store, &pool, &count_visitor, &visit, &failed));
+    TEST_EXPECT(VCCERT_STORE_NO_CERT == failed);
+    for (size_t i = 0; i < STORE_CERT_COUNT; ++i)
+    {
+        TEST_EXPECT(1 == visit.visits[i]);
+    }
+
+    visit.visits.assign(STORE_CERT_COUNT, 0);
+    visit.fail_from = 700;
+    TEST_EXPECT(
+        -1 == vccert_store_for_each(
+                &store, &pool, &count_visitor, &visit, &failed));
+    TEST_EXPECT(700U == failed);
+    for (size_t i = 0; i < 700; ++i)
+    {
+        TEST_EXPECT(1 == visit.visits[i]);
+    }
+
+    /* the partition helper covers the store without overlap. */
+    size_t next = 0, begin, end;
+    for (size_t p = 0; p < 7; ++p)
+    {
+        vccert_store_partition(&store, p, 7, &begin, &end);
+        TEST_EXPECT(next == begin);
+        next = end;
+    }
+    TEST_EXPECT(STORE_CERT_COUNT == next);
+
+    dispose((disposable_t*)&pool);
+    dispose((disposable_t*)&store);
+END_TEST_F()
+
+/**
+ * Test that store and index files can be mapped.
+ */
+BEGIN_TEST_F(open)
+    vccert_store_t store;
+    size_t required;
+
+    TEST_ASSERT(0 == fixture.fill());
+    std::string path = fixture.write_file(fixture.data);
+    TEST_ASSERT(!path.empty());
+
+    TEST_ASSERT(
+        0 == vccert_store_open(
+                &store, &fixture.alloc_opts, path.c_str(), nullptr));
+    TEST_EXPECT(fixture.check_store(&store));
+
+    std::vector<uint8_t> index(
+        VCCERT_STORE_INDEX_HEADER_SIZE + 8 * STORE_CERT_COUNT);
+    TEST_ASSERT(
+        0
+            == vccert_store_index_write(
+                    &store, index.data(), index.size(), &required));
+    dispose((disposable_t*)&store);
+
+    std::string index_path = fixture.write_file(index);
+    TEST_ASSERT(!index_path.empty());
+
+    TEST_ASSERT(
+        0 == vccert_store_open(
+                &store, &fixture.alloc_opts, path.c_str(),
+                index_path.c_str()));
+    TEST_EXPECT(fixture.check_store(&store));
+    dispose((disposable_t*)&store);
+
+    /* an index that does not match the store is not left mapped. */
+    TEST_EXPECT(
+        VCCERT_ERROR_STORE_INIT_BAD_INDEX
+            == vccert_store_open(
+                    &store, &fixture.alloc_opts, index_path.c_str(),
+                    index_path.c_str()));
+    TEST_EXPECT(
+        VCCERT_ERROR_STORE_OPEN_FAILED
+            == vccert_store_open(
+                    &store, &fixture.alloc_opts, "/nonexistent/store",
+                    nullptr));
+
+    unlink(path.c_str());
+    unlink(index_path.c_str());
+END_TEST_F()
@@ -138,7 +138,7 @@ TEST(types_0050_005F)
     TEST_EXPECT(0x0053 == VCCERT_FIELD_TYPE_PUBLIC_SIGNING_KEY);
     TEST_EXPECT(0x0054 == VCCERT_FIELD_TYPE_PRIVATE_ENCRYPTION_KEY);
     TEST_EXPECT(0x0055 == VCCERT_FIELD_TYPE_PRIVATE_SIGNING_KEY);
-    TEST_EXPECT(0x0056 == VCCERT_FIELD_TYPE_VELO_RESERVED_0056);
+    TEST_EXPECT(0x0056 == VCCERT_FIELD_TYPE_FIELD_INDEX);
     TEST_EXPECT(0x0057 == VCCERT_FIELD_TYPE_VELO_RESERVED_0057);
     TEST_EXPECT(0x0058 == VCCERT_FIELD_TYPE_VELO_RESERVED_0058);
     TEST_EXPECT(0x0059 == VCCERT_FIELD_TYPE_VELO_RESERVED_0059);
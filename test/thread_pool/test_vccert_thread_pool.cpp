@@ -0,0 +1,154 @@
+/**
+ * \file test_vccert_thread_pool.cpp
+ *
+ * Test the vccert thread pool.
+ *
+ * \copyright 2026 Velo-Payments, Inc.  All rights reserved.
+ */
+
+#include <atomic>
+#include <minunit/minunit.h>
+#include <vccert/error_codes.h>
+#include <vccert/thread_pool.h>
+#include <vpr/allocator/malloc_allocator.h>
+#include <vector>
+
+const size_t THREAD_POOL_WORKERS = 4;
+
+class vccert_thread_pool_test {
+public:
+    void setUp()
+    {
+        malloc_allocator_options_init(&alloc_opts);
+
+        pool_init_result =
+            vccert_thread_pool_init(&pool, &alloc_opts, THREAD_POOL_WORKERS);
+    }
+
+    void tearDown()
+    {
+        if (pool_init_result == 0)
+        {
+            dispose((disposable_t*)&pool);
+        }
+
+        dispose((disposable_t*)&alloc_opts);
+    }
+
+    int pool_init_result;
+    allocator_options_t alloc_opts;
+    vccert_thread_pool_t pool;
+};
+
+TEST_SUITE(vccert_thread_pool_test);
+
+#define BEGIN_TEST_F(name) \
+TEST(name) \
+{ \
+    vccert_thread_pool_test fixture; \
+    fixture.setUp();
+
+#define END_TEST_F() \
+    fixture.tearDown(); \
+}
+
+/**
+ * Per-run bookkeeping for the counting task.
+ */
+struct count_run
+{
+    std::vector<std::atomic<int>> hits;
+    size_t worker_count;
+    std::atomic<bool> bad_worker;
+
+    count_run(size_t count, size_t workers)
+        : hits(count), worker_count(workers), bad_worker(false)
+    {
+        for (auto& h : hits)
+            h = 0;
+    }
+};
+
+/**
+ * Record that an index was run.
+ */
+static void count_task(void* context, size_t index, size_t worker)
+{
+    count_run* run = (count_run*)context;
+
+    run->hits[index]++;
+    if (worker >= run->worker_count)
+        run->bad_worker = true;
+}
+
+/**
+ * Happy path test for vccert_thread_pool_init.
+ */
+BEGIN_TEST_F(init)
+    TEST_ASSERT(0 == fixture.pool_init_result);
+
+    /* platforms without threads fall back to a single worker. */
+    TEST_EXPECT(
+        THREAD_POOL_WORKERS == fixture.pool.worker_count
+     || 1U == fixture.pool.worker_count);
+END_TEST_F()
+
+/**
+ * Test that vccert_thread_pool_init rejects invalid arguments.
+ */
+BEGIN_TEST_F(init_invalid_args)
+    vccert_thread_pool_t other;
+
+    TEST_EXPECT(
+        VCCERT_ERROR_THREAD_POOL_INIT_INVALID_ARG
+            == vccert_thread_pool_init(nullptr, &fixture.alloc_opts, 2));
+    TEST_EXPECT(
+        VCCERT_ERROR_THREAD_POOL_INIT_INVALID_ARG
+            == vccert_thread_pool_init(&other, nullptr, 2));
+    TEST_EXPECT(
+        VCCERT_ERROR_THREAD_POOL_INIT_INVALID_ARG
+            == vccert_thread_pool_init(&other, &fixture.alloc_opts, 0));
+END_TEST_F()
+
+/**
+ * Test that every index is run exactly once, across several runs.
+ */
+BEGIN_TEST_F(run_each_index_once)
+    TEST_ASSERT(0 == fixture.pool_init_result);
+
+    for (size_t count : { 0, 1, 2, 7, 1000 })
+    {
+        count_run run(count, fixture.pool.worker_count);
+
+        TEST_ASSERT(
+            0
+                == vccert_thread_pool_run(
+                        &fixture.pool, &count_task, &run, count));
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            TEST_EXPECT(1 == run.hits[i]);
+        }
+
+        TEST_EXPECT(!run.bad_worker);
+    }
+END_TEST_F()
+
+/**
+ * Test that a NULL pool runs every index on the calling thread.
+ */
+BEGIN_TEST_F(run_without_pool)
+    count_run run(16, 1);
+
+    TEST_ASSERT(0 == vccert_thread_pool_run(nullptr, &count_task, &run, 16));
+
+    for (size_t i = 0; i < 16; ++i)
+    {
+        TEST_EXPECT(1 == run.hits[i]);
+    }
+
+    TEST_EXPECT(!run.bad_worker);
+    TEST_EXPECT(
+        VCCERT_ERROR_THREAD_POOL_RUN_INVALID_ARG
+            == vccert_thread_pool_run(nullptr, nullptr, &run, 16));
+END_TEST_F()